@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_AMG_HIERARCHY_HPP
+#define TESTING_AMG_HIERARCHY_HPP
+
+#include "utility.hpp"
+
+#include <cstdio>
+#include <rocalution/rocalution.hpp>
+#include <string>
+
+using namespace rocalution;
+
+static bool check_residual(float res)
+{
+    return (res < 1e-2f);
+}
+
+static bool check_residual(double res)
+{
+    return (res < 1e-5);
+}
+
+template <typename T>
+static BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* create_amg(const std::string& amg)
+{
+    if(amg == "SAAMG")
+    {
+        return new SAAMG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(amg == "UAAMG")
+    {
+        return new UAAMG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(amg == "RSAMG")
+    {
+        return new RugeStuebenAMG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+
+    return NULL;
+}
+
+template <typename T>
+bool testing_amg_hierarchy(Arguments argus)
+{
+    int          ndim           = argus.size;
+    std::string  amg            = argus.precond;
+    unsigned int format         = argus.format;
+    bool         rebuildnumeric = argus.rebuildnumeric;
+
+    // Unique per type and parameter set, such that tests can run concurrently
+    std::string filename = temp_file_path(
+        "rocalution_amg_hierarchy_" + amg + "_" + std::to_string(sizeof(T)) + "_"
+        + std::to_string(ndim) + "_" + std::to_string(format) + "_"
+        + std::to_string(rebuildnumeric) + ".rsio");
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> e;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    // Scaled values for the numerical rebuild of the loaded hierarchy
+    T* csr_val2 = new T[nnz];
+    for(int i = 0; i < nnz; ++i)
+    {
+        csr_val2[i] = static_cast<T>(2) * csr_val[i];
+    }
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    // b = A * 1
+    e.Ones();
+    A.Apply(e, &b);
+
+    // Build the hierarchy from scratch and store it
+    BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* p1 = create_amg<T>(amg);
+
+    if(p1 == NULL)
+    {
+        delete[] csr_val2;
+        stop_rocalution();
+        return false;
+    }
+
+    p1->SetOperator(A);
+    p1->SetSmootherPreIter(2);
+    p1->SetSmootherPostIter(1);
+    p1->SetOperatorFormat(format, format == BCSR ? argus.blockdim : 1);
+    p1->InitMaxIter(1);
+    p1->Verbose(0);
+
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls1;
+    ls1.Verbose(0);
+    ls1.SetOperator(A);
+    ls1.SetPreconditioner(*p1);
+    ls1.Init(1e-8, 0.0, 1e+8, 10000);
+    ls1.Build();
+
+    p1->SaveHierarchy(filename);
+
+    int levels1 = p1->GetNumLevels();
+
+    x.Zeros();
+    ls1.Solve(b, &x);
+
+    int iter1 = ls1.GetIterationCount();
+
+    ls1.Clear();
+    delete p1;
+
+    // Load the stored hierarchy, the configuration is restored from the file
+    BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* p2 = create_amg<T>(amg);
+
+    p2->SetOperator(A);
+    p2->LoadHierarchy(filename);
+    p2->InitMaxIter(1);
+    p2->Verbose(0);
+
+    int levels2 = p2->GetNumLevels();
+
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls2;
+    ls2.Verbose(0);
+    ls2.SetOperator(A);
+    ls2.SetPreconditioner(*p2);
+    ls2.Init(1e-8, 0.0, 1e+8, 10000);
+    ls2.Build();
+
+    if(rebuildnumeric)
+    {
+        A.UpdateValuesCSR(csr_val2);
+
+        // b = A * 1
+        A.Apply(e, &b);
+
+        ls2.ReBuildNumeric();
+    }
+
+    x.Zeros();
+    ls2.Solve(b, &x);
+
+    int iter2 = ls2.GetIterationCount();
+
+    // Verify solution
+    x.ScaleAdd(-1.0, e);
+    T nrm2 = x.Norm();
+
+    bool success = check_residual(nrm2) && levels1 == levels2;
+
+    // The loaded hierarchy has to reproduce the original solver
+    if(rebuildnumeric == false)
+    {
+        success = success && iter1 == iter2;
+    }
+
+    // Clean up
+    ls2.Clear();
+    delete p2;
+    delete[] csr_val2;
+
+    std::remove(filename.c_str());
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_AMG_HIERARCHY_HPP
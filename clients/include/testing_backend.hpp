@@ -30,6 +30,10 @@
 #include <gtest/gtest.h>
 #include <rocalution/rocalution.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace rocalution;
 
 void testing_backend_init_order(void)
@@ -62,6 +66,9 @@ void testing_backend_init_order(void)
     // Enable/disable accelerator after init_rocalution should terminate
     ASSERT_DEATH(disable_accelerator_rocalution(use_acc), ".*Assertion.*");
 
+    // Enable/disable NUMA mode after init_rocalution should terminate
+    ASSERT_DEATH(set_omp_numa_rocalution(true), ".*Assertion.*");
+
     // Stop rocalution platform
     stop_rocalution();
 }
@@ -98,4 +105,158 @@ void testing_backend(Arguments argus)
     stop_rocalution();
 }
 
+void testing_backend_host_memory_pool(void)
+{
+    set_device_rocalution(device);
+    init_rocalution();
+
+    enable_host_memory_pool();
+
+    HostMemoryPoolStats stats0;
+    get_host_memory_pool_stats(&stats0);
+
+    LocalVector<double> vec;
+
+    // Repeatedly allocate and clear, all but the first allocation should be reused
+    for(int i = 0; i < 10; ++i)
+    {
+        vec.Allocate("vec", 1000);
+        vec.Ones();
+
+        EXPECT_EQ(vec.Norm(), std::sqrt(1000.0));
+
+        vec.Clear();
+    }
+
+    HostMemoryPoolStats stats;
+    get_host_memory_pool_stats(&stats);
+
+    EXPECT_EQ(stats.allocations - stats0.allocations, 10);
+    EXPECT_EQ(stats.hits - stats0.hits, 9);
+    EXPECT_EQ(stats.live_bytes, stats0.live_bytes);
+    EXPECT_GE(stats.peak_bytes, 1000 * static_cast<int64_t>(sizeof(double)));
+    EXPECT_GE(stats.cached_bytes, 1000 * static_cast<int64_t>(sizeof(double)));
+
+    // Pool buffers are aligned to 64 bytes
+    double* data = NULL;
+    allocate_host(17, &data);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % 64, 0);
+
+    // Buffers in use survive trimming and disabling of the pool
+    trim_host_memory_pool();
+    get_host_memory_pool_stats(&stats);
+    EXPECT_EQ(stats.cached_bytes, 0);
+
+    disable_host_memory_pool();
+    free_host(&data);
+
+    get_host_memory_pool_stats(&stats);
+    EXPECT_EQ(stats.live_bytes, stats0.live_bytes);
+    EXPECT_EQ(stats.cached_bytes, 0);
+
+    stop_rocalution();
+}
+
+void testing_backend_numa(void)
+{
+    // Enable NUMA mode
+    set_omp_numa_rocalution(true);
+
+    set_device_rocalution(device);
+    init_rocalution();
+
+    info_rocalution();
+
+    // Vectors are first touched in parallel, results must not change
+    LocalVector<double> vec;
+    vec.Allocate("vec", 100000);
+    vec.Ones();
+
+    EXPECT_EQ(vec.Asum(), 100000.0);
+
+    vec.Clear();
+
+#ifdef _OPENMP
+    // Allocations below the threshold are first touched by a single thread, the
+    // OpenMP setting of the caller must not change
+    set_omp_threads_rocalution(2);
+    set_omp_threshold_rocalution(10000);
+
+    int nthreads = omp_get_max_threads();
+
+    double* buffer = NULL;
+    allocate_host(16, &buffer);
+
+    EXPECT_EQ(omp_get_max_threads(), nthreads);
+
+    free_host(&buffer);
+#endif
+
+    stop_rocalution();
+
+    // Restore default
+    set_omp_numa_rocalution(false);
+}
+
+void testing_backend_timer(void)
+{
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Both clocks are monotonic
+    double t0 = rocalution_time();
+    double t1 = rocalution_time();
+    double t2 = rocalution_time_nosync();
+    double t3 = rocalution_time_nosync();
+
+    EXPECT_GE(t1, t0);
+    EXPECT_GE(t2, t1);
+    EXPECT_GE(t3, t2);
+
+    // Accumulated time of synchronized and non synchronized timers
+    LocalVector<double> vec;
+    vec.Allocate("vec", 10000);
+
+    for(int sync = 0; sync < 2; ++sync)
+    {
+        Timer timer(sync == 1);
+
+        EXPECT_EQ(timer.GetTime(), 0.0);
+
+        double total = 0.0;
+
+        for(int i = 0; i < 3; ++i)
+        {
+            timer.Start();
+            vec.Ones();
+            double dt = timer.Stop();
+
+            EXPECT_GE(dt, 0.0);
+
+            total += dt;
+
+            // The accumulated time does not decrease
+            EXPECT_GE(timer.GetTime(), total - 1e-9);
+        }
+
+        EXPECT_DOUBLE_EQ(timer.GetTime(), total);
+
+        timer.Reset();
+        EXPECT_EQ(timer.GetTime(), 0.0);
+
+        // Scoped timers add their lifetime to the given time
+        double scoped = 1.0;
+        {
+            ScopedTimer scoped_timer(&scoped, sync == 1);
+            vec.Ones();
+        }
+
+        EXPECT_GE(scoped, 1.0);
+    }
+
+    vec.Clear();
+
+    stop_rocalution();
+}
+
 #endif // TESTING_BACKEND_HPP
@@ -27,7 +27,10 @@
 
 #include "utility.hpp"
 
+#include <cmath>
+#include <limits>
 #include <rocalution/rocalution.hpp>
+#include <vector>
 
 using namespace rocalution;
 
@@ -41,7 +44,8 @@ static bool check_residual(double res)
     return (res < 1e-6);
 }
 
-template <typename T>
+// The solver type is CG by default, PipeCG is tested with the same parameters
+template <typename T, template <class, class, typename> class SolverType = CG>
 bool testing_cg(Arguments argus)
 {
     int          ndim    = argus.size;
@@ -87,7 +91,7 @@ bool testing_cg(Arguments argus)
     x.SetRandomUniform(12345ULL, -4.0, 6.0);
 
     // Solver
-    CG<LocalMatrix<T>, LocalVector<T>, T> ls;
+    SolverType<LocalMatrix<T>, LocalVector<T>, T> ls;
 
     // Preconditioner
     Preconditioner<LocalMatrix<T>, LocalVector<T>, T>* p;
@@ -175,4 +179,414 @@ bool testing_cg(Arguments argus)
     return success;
 }
 
+template <typename T>
+bool testing_cg_rebuildnumeric(Arguments argus)
+{
+    int         ndim    = argus.size;
+    std::string precond = argus.precond;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> e;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    // Same pattern, with a stronger diagonal
+    std::vector<T> csr_val2(nnz);
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+        {
+            csr_val2[j] = (csr_col[j] == i) ? csr_val[j] * static_cast<T>(2) : csr_val[j];
+        }
+    }
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    e.Ones();
+
+    // Solvers, the first is built for the original values and numerically rebuilt,
+    // the second is built from scratch for the new values
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls[2];
+
+    Solver<LocalMatrix<T>, LocalVector<T>, T>* p[2];
+
+    for(int k = 0; k < 2; ++k)
+    {
+        if(precond == "FSAI")
+            p[k] = new FSAI<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(precond == "SPAI")
+            p[k] = new SPAI<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(precond == "ILU")
+            p[k] = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(precond == "ILUT")
+            p[k] = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(precond == "IC")
+            p[k] = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(precond == "SAAMG" || precond == "RSAMG")
+        {
+            BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* amg;
+
+            if(precond == "SAAMG")
+                amg = new SAAMG<LocalMatrix<T>, LocalVector<T>, T>;
+            else
+                amg = new RugeStuebenAMG<LocalMatrix<T>, LocalVector<T>, T>;
+
+            // Small enough for a hierarchy on the smallest grid
+            amg->SetCoarsestLevel(16);
+
+            p[k] = amg;
+        }
+        else
+            return false;
+
+        ls[k].Verbose(0);
+        ls[k].SetOperator(A);
+        ls[k].SetPreconditioner(*p[k]);
+        ls[k].Init(1e-8, 0.0, 1e+8, 10000);
+    }
+
+    ls[0].Build();
+
+    // Update the values and rebuild
+    A.UpdateValuesCSR(csr_val2.data());
+
+    ls[0].ReBuildNumeric();
+    ls[1].Build();
+
+    // b = A * 1
+    A.Apply(e, &b);
+
+    bool success = true;
+    int  iter[2];
+
+    for(int k = 0; k < 2; ++k)
+    {
+        // Random initial guess
+        x.SetRandomUniform(12345ULL, -4.0, 6.0);
+
+        ls[k].Solve(b, &x);
+
+        iter[k] = ls[k].GetIterationCount();
+
+        // Verify solution
+        x.ScaleAdd(-1.0, e);
+        success &= check_residual(x.Norm());
+    }
+
+    // ILUT keeps its previous pattern, all others have to match the fresh build
+    if(precond != "ILUT")
+    {
+        success &= (iter[0] == iter[1]);
+    }
+
+    // Clean up
+    for(int k = 0; k < 2; ++k)
+    {
+        ls[k].Clear();
+        delete p[k];
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_cg_multi(Arguments argus)
+{
+    int          ndim    = argus.size;
+    std::string  precond = argus.precond;
+    unsigned int format  = argus.format;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T>      A;
+    LocalMultiVector<T> x;
+    LocalMultiVector<T> b;
+    LocalMultiVector<T> e;
+
+    // Number of right-hand sides
+    int num_vec = 3;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN(), num_vec);
+    b.Allocate("b", A.GetM(), num_vec);
+    e.Allocate("e", A.GetN(), num_vec);
+
+    // b = A * e
+    e.SetRandomUniform(54321ULL, -1.0, 1.0);
+    A.Apply(e, &b);
+
+    // Random initial guess
+    x.SetRandomUniform(12345ULL, -4.0, 6.0);
+
+    // Solver
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // Preconditioner
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>* p;
+
+    if(precond == "None")
+        p = NULL;
+    else if(precond == "Chebyshev")
+    {
+        // Chebyshev preconditioner
+
+        // Determine min and max eigenvalues
+        T lambda_min;
+        T lambda_max;
+
+        A.Gershgorin(lambda_min, lambda_max);
+
+        AIChebyshev<LocalMatrix<T>, LocalVector<T>, T>* cheb
+            = new AIChebyshev<LocalMatrix<T>, LocalVector<T>, T>;
+        cheb->Set(3, lambda_max / 7.0, lambda_max);
+
+        p = cheb;
+    }
+    else if(precond == "FSAI")
+        p = new FSAI<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "SPAI")
+        p = new SPAI<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "TNS")
+        p = new TNS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "Jacobi")
+        p = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "GS")
+        p = new GS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "SGS")
+        p = new SGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ILU")
+        p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ItILU0")
+        p = new ItILU0<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ILUT")
+        p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "IC")
+        p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCGS")
+        p = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCSGS")
+        p = new MultiColoredSGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCILU")
+        p = new MultiColoredILU<LocalMatrix<T>, LocalVector<T>, T>;
+    else
+        return false;
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+
+    // Set preconditioner
+    if(p != NULL)
+    {
+        ls.SetPreconditioner(*p);
+    }
+
+    ls.Init(1e-8, 0.0, 1e+8, 10000);
+    ls.Build();
+
+    // Matrix format
+    A.ConvertTo(format, format == BCSR ? argus.blockdim : 1);
+
+    ls.SolveMulti(b, &x);
+
+    // Verify solutions
+    std::vector<T> minus_one(num_vec, static_cast<T>(-1));
+    std::vector<T> nrm2(num_vec);
+
+    x.ScaleAdd(minus_one.data(), e);
+    x.Norm(nrm2.data());
+
+    bool success = true;
+
+    for(int j = 0; j < num_vec; ++j)
+    {
+        success &= check_residual(nrm2[j]);
+    }
+
+    // Clean up
+    ls.Clear();
+    if(p != NULL)
+    {
+        delete p;
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_cg_multi_scaled(Arguments argus)
+{
+    int         ndim    = argus.size;
+    std::string precond = argus.precond;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T>      A;
+    LocalMultiVector<T> x;
+    LocalMultiVector<T> b;
+    LocalMultiVector<T> r;
+
+    // Number of right-hand sides
+    int num_vec = 3;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Allocate x, b and r
+    x.Allocate("x", A.GetN(), num_vec);
+    b.Allocate("b", A.GetM(), num_vec);
+    r.Allocate("r", A.GetM(), num_vec);
+
+    // Random right-hand sides of very different scale
+    std::vector<T> scale = {static_cast<T>(1), static_cast<T>(1e-4), static_cast<T>(1)};
+
+    b.SetRandomUniform(54321ULL, -1.0, 1.0);
+    b.Scale(scale.data());
+
+    // The largest system is an eigenvector of A, it converges in a single iteration
+    // and must not stop the other systems
+    LocalVector<T> v;
+    v.Allocate("v", A.GetM());
+
+    const double pi = 3.14159265358979323846;
+
+    for(int i = 0; i < ndim; ++i)
+    {
+        for(int j = 0; j < ndim; ++j)
+        {
+            v[i * ndim + j] = static_cast<T>(1e+4 * std::sin(pi * (i + 1) / (ndim + 1))
+                                             * std::sin(pi * (j + 1) / (ndim + 1)));
+        }
+    }
+
+    b.SetColumn(2, v);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    r.MoveToAccelerator();
+
+    x.Zeros();
+
+    // Solver
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // Preconditioner
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>* p;
+
+    if(precond == "None")
+        p = NULL;
+    else if(precond == "Jacobi")
+        p = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+    else
+        return false;
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+
+    // Set preconditioner
+    if(p != NULL)
+    {
+        ls.SetPreconditioner(*p);
+    }
+
+    // Relative tolerance only, so each system has to reach it on its own scale
+    T rel_tol = std::sqrt(std::numeric_limits<T>::epsilon());
+
+    ls.Init(0.0, rel_tol, 1e+8, 10000);
+    ls.Build();
+
+    ls.SolveMulti(b, &x);
+
+    // Verify the relative residual of each system, the initial guess is zero
+    std::vector<T> minus_one(num_vec, static_cast<T>(-1));
+    std::vector<T> b_nrm2(num_vec);
+    std::vector<T> r_nrm2(num_vec);
+
+    A.Apply(x, &r);
+    r.ScaleAdd(minus_one.data(), b);
+
+    b.Norm(b_nrm2.data());
+    r.Norm(r_nrm2.data());
+
+    bool success = true;
+
+    for(int j = 0; j < num_vec; ++j)
+    {
+        success &= (r_nrm2[j] <= static_cast<T>(10) * rel_tol * b_nrm2[j]);
+    }
+
+    // Clean up
+    ls.Clear();
+    if(p != NULL)
+    {
+        delete p;
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_CG_HPP
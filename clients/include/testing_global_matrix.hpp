@@ -27,8 +27,11 @@
 
 #include "utility.hpp"
 
+#include <cstdio>
 #include <gtest/gtest.h>
+#include <mpi.h>
 #include <rocalution/rocalution.hpp>
+#include <string>
 
 using namespace rocalution;
 
@@ -371,4 +374,97 @@ void testing_global_matrix_bad_args(void)
     stop_rocalution();
 }
 
+template <typename T>
+bool testing_global_matrix_read_rsio_collective(Arguments argus)
+{
+    int ndim = argus.size;
+
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate the reference matrix on all ranks
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> L;
+    L.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "L", nnz, nrow, nrow);
+
+    // The first rank writes the file, all ranks read their part of it
+    std::string filename = "rocalution_global_matrix_collective_" + std::to_string(sizeof(T))
+                           + "_" + std::to_string(ndim) + ".rsio";
+
+    if(rank == 0)
+    {
+        L.WriteFileRSIO(filename);
+    }
+
+    MPI_Barrier(comm);
+
+    ParallelManager pm;
+    GlobalMatrix<T> A;
+
+    pm.SetMPICommunicator(&comm);
+    A.ReadFileRSIOCollective(filename, &pm);
+
+    MPI_Barrier(comm);
+
+    if(rank == 0)
+    {
+        std::remove(filename.c_str());
+    }
+
+    bool success = (A.GetM() == nrow) && (A.GetN() == nrow) && (A.GetNnz() == nnz);
+
+    // Compare the distributed product against the product of the reference matrix
+    LocalVector<T> lx;
+    LocalVector<T> ly;
+
+    lx.Allocate("lx", nrow);
+    ly.Allocate("ly", nrow);
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        lx[i] = static_cast<T>(i % 7 - 3);
+    }
+
+    L.Apply(lx, &ly);
+
+    GlobalVector<T> x(pm);
+    GlobalVector<T> y(pm);
+
+    x.Allocate("x", A.GetN());
+    y.Allocate("y", A.GetM());
+
+    int64_t row_begin = pm.GetGlobalRowBegin();
+    int64_t col_begin = pm.GetGlobalColumnBegin();
+
+    for(int64_t i = 0; i < x.GetInterior().GetSize(); ++i)
+    {
+        x.GetInterior()[i] = lx[col_begin + i];
+    }
+
+    A.Apply(x, &y);
+
+    // All entries are small integers, the products are exact
+    for(int64_t i = 0; i < y.GetInterior().GetSize(); ++i)
+    {
+        success &= (y.GetInterior()[i] == ly[row_begin + i]);
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_GLOBAL_MATRIX_HPP
@@ -25,9 +25,12 @@
 #ifndef TESTING_GLOBAL_VECTOR_HPP
 #define TESTING_GLOBAL_VECTOR_HPP
 
+#include "common.hpp"
 #include "utility.hpp"
 
+#include <cmath>
 #include <gtest/gtest.h>
+#include <limits>
 #include <rocalution/rocalution.hpp>
 
 using namespace rocalution;
@@ -63,4 +66,74 @@ void testing_global_vector_bad_args(void)
     stop_rocalution();
 }
 
+template <typename T>
+bool testing_global_vector_dot_async(Arguments argus)
+{
+    int ndim = argus.size;
+
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int nprocs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nprocs);
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // The Laplacian provides the parallel manager for the vectors
+    ParallelManager pm;
+    GlobalMatrix<T> A;
+
+    generate_2d_laplacian(ndim, ndim, &comm, &A, &pm, rank, nprocs, 5);
+
+    GlobalVector<T> x(pm);
+    GlobalVector<T> y(pm);
+    GlobalVector<T> z(pm);
+
+    x.MoveToAccelerator();
+    y.MoveToAccelerator();
+    z.MoveToAccelerator();
+
+    x.Allocate("x", A.GetN());
+    y.Allocate("y", A.GetN());
+    z.Allocate("z", A.GetN());
+
+    x.SetRandomUniform(1234ULL, -1.0, 1.0);
+    y.SetRandomUniform(5678ULL, -1.0, 1.0);
+    z.SetRandomUniform(9012ULL, -1.0, 1.0);
+
+    // Fused non-blocking reduction of <x,y>, <x,z> and <z,z>
+    const GlobalVector<T>* vx[3] = {&x, &x, &z};
+    const GlobalVector<T>* vy[3] = {&y, &z, &z};
+
+    T result[3];
+
+    x.DotAsync(3, vx, vy, result);
+    x.DotSync();
+
+    // Compare against the blocking dot products
+    T ref[3] = {x.Dot(y), x.Dot(z), z.Dot(z)};
+
+    bool success = true;
+
+    for(int i = 0; i < 3; ++i)
+    {
+        T tol = std::numeric_limits<T>::epsilon() * static_cast<T>(100) * std::abs(ref[i])
+                + std::numeric_limits<T>::min();
+
+        if(std::abs(result[i] - ref[i]) > tol)
+        {
+            success = false;
+        }
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_GLOBAL_VECTOR_HPP
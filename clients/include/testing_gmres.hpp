@@ -27,7 +27,10 @@
 
 #include "utility.hpp"
 
+#include <cmath>
+#include <limits>
 #include <rocalution/rocalution.hpp>
+#include <vector>
 
 using namespace rocalution;
 
@@ -176,4 +179,290 @@ bool testing_gmres(Arguments argus, bool expectConvergence = true)
     return success;
 }
 
+template <typename T>
+bool testing_gmres_multi(Arguments argus)
+{
+    int          ndim    = argus.size;
+    int          basis   = argus.index;
+    std::string  matrix  = argus.matrix;
+    std::string  precond = argus.precond;
+    unsigned int format  = argus.format;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T>      A;
+    LocalMultiVector<T> x;
+    LocalMultiVector<T> b;
+    LocalMultiVector<T> e;
+
+    // Number of right-hand sides
+    int num_vec = 3;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    if(matrix == "laplacian")
+        nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    else if(matrix == "permuted_identity")
+        nrow = gen_permuted_identity(ndim, &csr_ptr, &csr_col, &csr_val);
+    else
+        return false;
+
+    int nnz = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN(), num_vec);
+    b.Allocate("b", A.GetM(), num_vec);
+    e.Allocate("e", A.GetN(), num_vec);
+
+    // b = A * e
+    e.SetRandomUniform(54321ULL, -1.0, 1.0);
+    A.Apply(e, &b);
+
+    // Random initial guess
+    x.SetRandomUniform(12345ULL, -4.0, 6.0);
+
+    // Solver
+    GMRES<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // Preconditioner
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>* p;
+
+    if(precond == "None")
+        p = NULL;
+    else if(precond == "Chebyshev")
+    {
+        // Chebyshev preconditioner
+
+        // Determine min and max eigenvalues
+        T lambda_min;
+        T lambda_max;
+
+        A.Gershgorin(lambda_min, lambda_max);
+
+        AIChebyshev<LocalMatrix<T>, LocalVector<T>, T>* cheb
+            = new AIChebyshev<LocalMatrix<T>, LocalVector<T>, T>;
+        cheb->Set(3, lambda_max / 7.0, lambda_max);
+
+        p = cheb;
+    }
+    else if(precond == "FSAI")
+        p = new FSAI<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "SPAI")
+        p = new SPAI<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "TNS")
+        p = new TNS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "Jacobi")
+        p = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "GS")
+        p = new GS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "SGS")
+        p = new SGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ILU")
+        p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ItILU0")
+        p = new ItILU0<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ILUT")
+        p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "IC")
+        p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCGS")
+        p = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCSGS")
+        p = new MultiColoredSGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCILU")
+        p = new MultiColoredILU<LocalMatrix<T>, LocalVector<T>, T>;
+    else
+        return false;
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+
+    // Set preconditioner
+    if(p != NULL)
+    {
+        ls.SetPreconditioner(*p);
+    }
+
+    ls.Init(1e-6, 0.0, 1e+8, 10000);
+    ls.SetBasisSize(basis);
+
+    ls.Build();
+
+    // Matrix format
+    A.ConvertTo(format, format == BCSR ? argus.blockdim : 1);
+
+    ls.SolveMulti(b, &x);
+
+    // Verify solutions
+    std::vector<T> minus_one(num_vec, static_cast<T>(-1));
+    std::vector<T> nrm2(num_vec);
+
+    x.ScaleAdd(minus_one.data(), e);
+    x.Norm(nrm2.data());
+
+    bool success = true;
+
+    for(int j = 0; j < num_vec; ++j)
+    {
+        success &= (nrm2[j] < 1e3);
+    }
+
+    // Clean up
+    ls.Clear();
+    if(p != NULL)
+    {
+        delete p;
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_gmres_multi_scaled(Arguments argus)
+{
+    int         ndim    = argus.size;
+    int         basis   = argus.index;
+    std::string precond = argus.precond;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T>      A;
+    LocalMultiVector<T> x;
+    LocalMultiVector<T> b;
+    LocalMultiVector<T> r;
+
+    // Number of right-hand sides
+    int num_vec = 3;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Allocate x, b and r
+    x.Allocate("x", A.GetN(), num_vec);
+    b.Allocate("b", A.GetM(), num_vec);
+    r.Allocate("r", A.GetM(), num_vec);
+
+    // Random right-hand sides of very different scale
+    std::vector<T> scale = {static_cast<T>(1), static_cast<T>(1e-4), static_cast<T>(1)};
+
+    b.SetRandomUniform(54321ULL, -1.0, 1.0);
+    b.Scale(scale.data());
+
+    // The largest system is an eigenvector of A, it converges in a single iteration
+    // and must not stop the other systems
+    LocalVector<T> v;
+    v.Allocate("v", A.GetM());
+
+    const double pi = 3.14159265358979323846;
+
+    for(int i = 0; i < ndim; ++i)
+    {
+        for(int j = 0; j < ndim; ++j)
+        {
+            v[i * ndim + j] = static_cast<T>(1e+4 * std::sin(pi * (i + 1) / (ndim + 1))
+                                             * std::sin(pi * (j + 1) / (ndim + 1)));
+        }
+    }
+
+    b.SetColumn(2, v);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    r.MoveToAccelerator();
+
+    x.Zeros();
+
+    // Solver
+    GMRES<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // Preconditioner
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>* p;
+
+    if(precond == "None")
+        p = NULL;
+    else if(precond == "Jacobi")
+        p = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+    else
+        return false;
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+
+    // Set preconditioner
+    if(p != NULL)
+    {
+        ls.SetPreconditioner(*p);
+    }
+
+    // Relative tolerance only, so each system has to reach it on its own scale
+    T rel_tol = std::sqrt(std::numeric_limits<T>::epsilon());
+
+    ls.Init(0.0, rel_tol, 1e+8, 10000);
+    ls.SetBasisSize(basis);
+
+    ls.Build();
+
+    ls.SolveMulti(b, &x);
+
+    // Verify the relative residual of each system, the initial guess is zero
+    std::vector<T> minus_one(num_vec, static_cast<T>(-1));
+    std::vector<T> b_nrm2(num_vec);
+    std::vector<T> r_nrm2(num_vec);
+
+    A.Apply(x, &r);
+    r.ScaleAdd(minus_one.data(), b);
+
+    b.Norm(b_nrm2.data());
+    r.Norm(r_nrm2.data());
+
+    bool success = true;
+
+    for(int j = 0; j < num_vec; ++j)
+    {
+        success &= (r_nrm2[j] <= static_cast<T>(10) * rel_tol * b_nrm2[j]);
+    }
+
+    // Clean up
+    ls.Clear();
+    if(p != NULL)
+    {
+        delete p;
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_GMRES_HPP
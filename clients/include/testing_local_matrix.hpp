@@ -26,12 +26,58 @@
 #define TESTING_LOCAL_MATRIX_HPP
 
 #include "utility.hpp"
+#include "validate.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <limits>
+#include <numeric>
+#include <random>
 #include <rocalution/rocalution.hpp>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 using namespace rocalution;
 
+// Generate a matrix of the given type in CSR format, returns false for an unknown type
+template <typename T>
+bool gen_local_matrix(const std::string& matrix_type,
+                      int                size,
+                      int*               nrow,
+                      int*               ncol,
+                      int**              csr_ptr,
+                      int**              csr_col,
+                      T**                csr_val)
+{
+    if(matrix_type == "Laplacian2D")
+    {
+        *nrow = gen_2d_laplacian(size, csr_ptr, csr_col, csr_val);
+        *ncol = *nrow;
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        *nrow = gen_permuted_identity(size, csr_ptr, csr_col, csr_val);
+        *ncol = *nrow;
+    }
+    else if(matrix_type == "Random")
+    {
+        *nrow = gen_random(100 * size, 50 * size, 6, csr_ptr, csr_col, csr_val);
+        *ncol = 50 * size;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
 template <typename T>
 void testing_local_matrix_bad_args(void)
 {
@@ -383,22 +429,7 @@ bool testing_local_matrix_conversions(Arguments argus)
 
     int nrow = 0;
     int ncol = 0;
-    if(matrix_type == "Laplacian2D")
-    {
-        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
-        ncol = nrow;
-    }
-    else if(matrix_type == "PermutedIdentity")
-    {
-        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
-        ncol = nrow;
-    }
-    else if(matrix_type == "Random")
-    {
-        nrow = gen_random(100 * size, 50 * size, 6, &csr_ptr, &csr_col, &csr_val);
-        ncol = 50 * size;
-    }
-    else
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
     {
         return false;
     }
@@ -429,6 +460,8 @@ bool testing_local_matrix_conversions(Arguments argus)
     success &= A.Check();
     A.ConvertToBCSR(blockdim);
     success &= A.Check();
+    A.ConvertToSELL();
+    success &= A.Check();
     A.ConvertToCSR();
     success &= A.Check();
 
@@ -449,6 +482,8 @@ bool testing_local_matrix_conversions(Arguments argus)
     success &= A.Check();
     A.ConvertToBCSR(blockdim);
     success &= A.Check();
+    A.ConvertToSELL();
+    success &= A.Check();
     A.ConvertToCSR();
     success &= A.Check();
 
@@ -459,60 +494,1897 @@ bool testing_local_matrix_conversions(Arguments argus)
 }
 
 template <typename T>
-bool testing_local_matrix_allocations(Arguments argus)
+bool testing_local_matrix_read_mtx(Arguments argus)
 {
-    int size     = argus.size;
-    int blockdim = argus.blockdim;
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
 
-    int m  = size;
-    int n  = size;
-    int mb = (m + blockdim - 1) / blockdim;
-    int nb = (n + blockdim - 1) / blockdim;
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
 
-    int nnz = 0.05 * m * n;
-    if(nnz == 0)
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
     {
-        nnz = m * n;
+        return false;
     }
 
-    int nnzb = 0.01 * mb * nb;
-    if(nnzb == 0)
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    std::string filename = "rocalution_local_matrix_read.mtx";
+
+    A.WriteFileMTX(filename);
+
+    // Read into CSR and COO
+    LocalMatrix<T> B;
+    LocalMatrix<T> C;
+
+    B.ReadFileMTX(filename);
+    C.ConvertToCOO();
+    C.ReadFileMTX(filename);
+    C.ConvertToCSR();
+
+    std::remove(filename.c_str());
+
+    bool success = true;
+
+    success &= B.Check();
+    success &= (B.GetM() == nrow) && (B.GetN() == ncol) && (B.GetNnz() == nnz);
+    success &= (C.GetM() == nrow) && (C.GetN() == ncol) && (C.GetNnz() == nnz);
+
+    if(success == true)
     {
-        nnzb = mb * nb;
+        int* A_ptr = NULL;
+        int* A_col = NULL;
+        T*   A_val = NULL;
+        int* B_ptr = NULL;
+        int* B_col = NULL;
+        T*   B_val = NULL;
+        int* C_ptr = NULL;
+        int* C_col = NULL;
+        T*   C_val = NULL;
+
+        A.LeaveDataPtrCSR(&A_ptr, &A_col, &A_val);
+        B.LeaveDataPtrCSR(&B_ptr, &B_col, &B_val);
+        C.LeaveDataPtrCSR(&C_ptr, &C_col, &C_val);
+
+        for(int i = 0; i < nrow + 1; ++i)
+        {
+            success &= (A_ptr[i] == B_ptr[i]) && (A_ptr[i] == C_ptr[i]);
+        }
+
+        for(int i = 0; i < nnz; ++i)
+        {
+            success &= (A_col[i] == B_col[i]) && (A_col[i] == C_col[i]);
+            success &= (std::abs(A_val[i] - B_val[i]) <= 1e-6 * std::abs(A_val[i]));
+            success &= (B_val[i] == C_val[i]);
+        }
+
+        free_host(&A_ptr);
+        free_host(&A_col);
+        free_host(&A_val);
+        free_host(&B_ptr);
+        free_host(&B_col);
+        free_host(&B_val);
+        free_host(&C_ptr);
+        free_host(&C_col);
+        free_host(&C_val);
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+// Write the entries of A in matrix market format with the given field and symmetry,
+// symmetric storage keeps the lower triangular part only. Returns the expected
+// matrix after reading, in row major order, as (row, col, val) triples.
+template <typename T>
+std::vector<std::tuple<int, int, T>> write_local_matrix_mtx_file(const std::string& filename,
+                                                                 int                nrow,
+                                                                 int                ncol,
+                                                                 const int*         csr_ptr,
+                                                                 const int*         csr_col,
+                                                                 const T*           csr_val,
+                                                                 bool               pattern,
+                                                                 bool               symmetric)
+{
+    std::vector<std::tuple<int, int, T>> entries;
+    std::vector<std::tuple<int, int, T>> expected;
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+        {
+            int col = csr_col[j];
+            T   val = (pattern == true) ? static_cast<T>(1) : csr_val[j];
+
+            if(symmetric == true && col > i)
+            {
+                continue;
+            }
+
+            entries.push_back(std::make_tuple(i, col, val));
+            expected.push_back(std::make_tuple(i, col, val));
+
+            if(symmetric == true && col != i)
+            {
+                expected.push_back(std::make_tuple(col, i, val));
+            }
+        }
+    }
+
+    std::stable_sort(expected.begin(),
+                     expected.end(),
+                     [](const std::tuple<int, int, T>& a, const std::tuple<int, int, T>& b) {
+                         return std::make_pair(std::get<0>(a), std::get<1>(a))
+                                < std::make_pair(std::get<0>(b), std::get<1>(b));
+                     });
+
+    FILE* file = fopen(filename.c_str(), "w");
+
+    fprintf(file,
+            "%%%%MatrixMarket matrix coordinate %s %s\n",
+            (pattern == true) ? "pattern" : "real",
+            (symmetric == true) ? "symmetric" : "general");
+    fprintf(file, "%d %d %zu\n", nrow, ncol, entries.size());
+
+    for(const std::tuple<int, int, T>& e : entries)
+    {
+        if(pattern == true)
+        {
+            fprintf(file, "%d %d\n", std::get<0>(e) + 1, std::get<1>(e) + 1);
+        }
+        else
+        {
+            fprintf(file,
+                    "%d %d %.17g\n",
+                    std::get<0>(e) + 1,
+                    std::get<1>(e) + 1,
+                    static_cast<double>(std::get<2>(e)));
+        }
+    }
+
+    fclose(file);
+
+    return expected;
+}
+
+// Compare a CSR matrix against (row, col, val) triples in row major order
+template <typename T>
+bool check_local_matrix_entries(LocalMatrix<T>& A, const std::vector<std::tuple<int, int, T>>& ref)
+{
+    if(A.GetNnz() != static_cast<int64_t>(ref.size()))
+    {
+        return false;
+    }
+
+    int nrow = A.GetM();
+    int nnz  = static_cast<int>(A.GetNnz());
+
+    std::vector<int> ptr(nrow + 1);
+    std::vector<int> col(nnz);
+    std::vector<T>   val(nnz);
+
+    A.ConvertToCSR();
+    A.CopyToCSR(ptr.data(), col.data(), val.data());
+
+    bool success = true;
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int j = ptr[i]; j < ptr[i + 1]; ++j)
+        {
+            success &= (std::get<0>(ref[j]) == i);
+            success &= (std::get<1>(ref[j]) == col[j]);
+            success &= (std::get<2>(ref[j]) == val[j]);
+        }
     }
 
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_read_mtx_header(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
     // Initialize rocALUTION
     set_device_rocalution(device);
     init_rocalution();
 
-    int ndiag       = 5;
-    int ell_max_row = 6;
-    int ell_nnz     = ell_max_row * m;
-    int coo_nnz     = (nnz - ell_nnz) < 0 ? 0 : nnz - ell_nnz;
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
 
-    // Testing allocating matrix types
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    std::string filename = temp_file_path("rocalution_local_matrix_read_header.mtx");
+
+    bool success = true;
+
+    // pattern general, real symmetric and pattern symmetric, symmetric storage requires
+    // a square matrix
+    for(int variant = 0; variant < 3; ++variant)
+    {
+        bool pattern   = (variant != 1);
+        bool symmetric = (variant != 0);
+
+        if(symmetric == true && nrow != ncol)
+        {
+            continue;
+        }
+
+        std::vector<std::tuple<int, int, T>> ref = write_local_matrix_mtx_file(
+            filename, nrow, ncol, csr_ptr, csr_col, csr_val, pattern, symmetric);
+
+        // Read into CSR and COO
+        LocalMatrix<T> B;
+        LocalMatrix<T> C;
+
+        B.ReadFileMTX(filename);
+        C.ConvertToCOO();
+        C.ReadFileMTX(filename);
+
+        success &= B.Check();
+        success &= (B.GetM() == nrow) && (B.GetN() == ncol);
+        success &= (C.GetM() == nrow) && (C.GetN() == ncol);
+
+        success &= check_local_matrix_entries(B, ref);
+        success &= check_local_matrix_entries(C, ref);
+    }
+
+    std::remove(filename.c_str());
+
+    free_host(&csr_ptr);
+    free_host(&csr_col);
+    free_host(&csr_val);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+// Write a rocALUTION binary csr file, optionally with an additional empty row
+template <typename T>
+void write_local_matrix_csr_file(const std::string& filename,
+                                 int                nrow,
+                                 int                ncol,
+                                 const int*         csr_ptr,
+                                 const int*         csr_col,
+                                 const T*           csr_val,
+                                 bool               empty_row)
+{
+    std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+
+    int     version = 30000;
+    int64_t m       = nrow + (empty_row ? 1 : 0);
+    int64_t n       = ncol;
+    int64_t nnz     = csr_ptr[nrow];
+
+    out << "#rocALUTION binary csr file" << std::endl;
+    out.write((char*)&version, sizeof(int));
+    out.write((char*)&m, sizeof(int64_t));
+    out.write((char*)&n, sizeof(int64_t));
+    out.write((char*)&nnz, sizeof(int64_t));
+    out.write((char*)csr_ptr, (nrow + 1) * sizeof(int));
+
+    if(empty_row == true)
+    {
+        out.write((char*)&csr_ptr[nrow], sizeof(int));
+    }
+
+    out.write((char*)csr_col, nnz * sizeof(int));
+
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        double v = static_cast<double>(csr_val[i]);
+        out.write((char*)&v, sizeof(double));
+    }
+
+    out.close();
+}
+
+template <typename T>
+bool testing_local_matrix_map_csr(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int64_t nnz = csr_ptr[nrow];
+
+    // Write rocALUTION binary csr file
+    std::string filename = "rocalution_local_matrix_map.csr";
+
+    write_local_matrix_csr_file(filename, nrow, ncol, csr_ptr, csr_col, csr_val, false);
+
+    // Map the file
     LocalMatrix<T> A;
-    A.AllocateCSR("A", nnz, m, n);
+    A.MapFileCSR(filename);
+
+    bool success = A.Check();
+    success &= (A.GetM() == nrow) && (A.GetN() == ncol) && (A.GetNnz() == nnz);
+
+    // Modifications must not change the file
+    A.Scale(static_cast<T>(2));
 
     LocalMatrix<T> B;
-    B.AllocateBCSR("B", nnzb, mb, nb, blockdim);
+    B.MapFileCSR(filename);
+
+    std::remove(filename.c_str());
+
+    if(success == true)
+    {
+        int* A_ptr = NULL;
+        int* A_col = NULL;
+        T*   A_val = NULL;
+        int* B_ptr = NULL;
+        int* B_col = NULL;
+        T*   B_val = NULL;
+
+        A.LeaveDataPtrCSR(&A_ptr, &A_col, &A_val);
+        B.LeaveDataPtrCSR(&B_ptr, &B_col, &B_val);
+
+        for(int i = 0; i < nrow + 1; ++i)
+        {
+            success &= (A_ptr[i] == csr_ptr[i]) && (B_ptr[i] == csr_ptr[i]);
+        }
+
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            success &= (A_col[i] == csr_col[i]) && (B_col[i] == csr_col[i]);
+            success &= (A_val[i] == static_cast<T>(2) * csr_val[i]) && (B_val[i] == csr_val[i]);
+        }
+
+#if defined(__linux__) || defined(__APPLE__)
+        // Index arrays are always taken from the mapping, double precision values only if
+        // they are aligned, i.e. if the number of rows plus non-zeros is odd
+        bool val_mapped = std::is_same<T, double>::value && (nrow + nnz) % 2 == 1;
+
+        success &= is_host_mapping(B_ptr) && is_host_mapping(B_col);
+        success &= (is_host_mapping(B_val) == val_mapped);
+#endif
+
+        free_host(&A_ptr);
+        free_host(&A_col);
+        free_host(&A_val);
+        free_host(&B_ptr);
+        free_host(&B_col);
+        free_host(&B_val);
+    }
+
+    // An empty trailing row flips the alignment of the values
+    write_local_matrix_csr_file(filename, nrow, ncol, csr_ptr, csr_col, csr_val, true);
 
     LocalMatrix<T> C;
-    C.AllocateCOO("C", nnz, m, n);
+    C.MapFileCSR(filename);
 
-    LocalMatrix<T> D;
-    D.AllocateDIA("D", nnz, m, n, ndiag);
+    std::remove(filename.c_str());
 
-    LocalMatrix<T> F;
-    F.AllocateELL("F", ell_nnz, m, n, ell_max_row);
+    success &= (C.GetM() == nrow + 1) && (C.GetN() == ncol) && (C.GetNnz() == nnz);
 
-    LocalMatrix<T> G;
-    G.AllocateHYB("G", ell_nnz, coo_nnz, ell_max_row, m, n);
+    if(success == true)
+    {
+        int* C_ptr = NULL;
+        int* C_col = NULL;
+        T*   C_val = NULL;
+
+        C.LeaveDataPtrCSR(&C_ptr, &C_col, &C_val);
+
+        success &= (C_ptr[nrow + 1] == nnz);
+
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            success &= (C_col[i] == csr_col[i]) && (C_val[i] == csr_val[i]);
+        }
+
+#if defined(__linux__) || defined(__APPLE__)
+        bool val_mapped = std::is_same<T, double>::value && (nrow + 1 + nnz) % 2 == 1;
+
+        success &= is_host_mapping(C_ptr) && is_host_mapping(C_col);
+        success &= (is_host_mapping(C_val) == val_mapped);
+#endif
+
+        free_host(&C_ptr);
+        free_host(&C_col);
+        free_host(&C_val);
+    }
+
+    free_host(&csr_ptr);
+    free_host(&csr_col);
+    free_host(&csr_val);
 
     // Stop rocALUTION platform
     stop_rocalution();
 
-    return true;
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_rsio_compressed(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int64_t nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.AllocateCSR("A", nnz, nrow, ncol);
+    A.CopyFromCSR(csr_ptr, csr_col, csr_val);
+
+    std::string filename = "rocalution_local_matrix_compressed.rsio";
+
+    bool success = true;
+
+    // Compressed values from CSR, compressed indices only from a non CSR format
+    for(int compress_val = 1; compress_val >= 0; --compress_val)
+    {
+        if(compress_val == 0)
+        {
+            A.ConvertToCOO();
+        }
+
+        A.WriteFileRSIOCompressed(filename, compress_val == 1);
+
+        LocalMatrix<T> B;
+        B.ReadFileRSIO(filename);
+
+        std::remove(filename.c_str());
+
+        success &= (B.GetFormat() == CSR);
+        success &= (B.GetM() == nrow) && (B.GetN() == ncol) && (B.GetNnz() == nnz);
+
+        if(success == true)
+        {
+            int* B_ptr = NULL;
+            int* B_col = NULL;
+            T*   B_val = NULL;
+
+            B.LeaveDataPtrCSR(&B_ptr, &B_col, &B_val);
+
+            for(int i = 0; i < nrow + 1; ++i)
+            {
+                success &= (B_ptr[i] == csr_ptr[i]);
+            }
+
+            for(int64_t i = 0; i < nnz; ++i)
+            {
+                success &= (B_col[i] == csr_col[i]) && (B_val[i] == csr_val[i]);
+            }
+
+            free_host(&B_ptr);
+            free_host(&B_col);
+            free_host(&B_val);
+        }
+    }
+
+    free_host(&csr_ptr);
+    free_host(&csr_col);
+    free_host(&csr_val);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_rsio_compressed_blocks(Arguments argus)
+{
+    int         size   = argus.size;
+    std::string values = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Laplacian with more non-zeros than a single block of the compressed format
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int     nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    int64_t nnz  = csr_ptr[nrow];
+
+    // Random bit patterns cannot be compressed and are stored as raw values
+    if(values == "RandomBits")
+    {
+        std::mt19937_64 gen(12345ULL);
+
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            uint64_t bits = gen();
+            std::memcpy(&csr_val[i], &bits, sizeof(T));
+        }
+    }
+
+    LocalMatrix<T> A;
+    A.AllocateCSR("A", nnz, nrow, nrow);
+    A.CopyFromCSR(csr_ptr, csr_col, csr_val);
+
+    std::string filename = "rocalution_local_matrix_compressed_blocks.rsio";
+
+    A.WriteFileRSIOCompressed(filename, true);
+
+    LocalMatrix<T> B;
+    B.ReadFileRSIO(filename);
+
+    std::remove(filename.c_str());
+
+    bool success = (nnz > 65536);
+
+    success &= (B.GetFormat() == CSR);
+    success &= (B.GetM() == nrow) && (B.GetN() == nrow) && (B.GetNnz() == nnz);
+
+    if(success == true)
+    {
+        int* B_ptr = NULL;
+        int* B_col = NULL;
+        T*   B_val = NULL;
+
+        B.LeaveDataPtrCSR(&B_ptr, &B_col, &B_val);
+
+        success &= std::equal(csr_ptr, csr_ptr + nrow + 1, B_ptr);
+        success &= std::equal(csr_col, csr_col + nnz, B_col);
+
+        // Random bit patterns may be NaN, values are compared bitwise
+        success &= (std::memcmp(csr_val, B_val, sizeof(T) * nnz) == 0);
+
+        free_host(&B_ptr);
+        free_host(&B_col);
+        free_host(&B_val);
+    }
+
+    free_host(&csr_ptr);
+    free_host(&csr_col);
+    free_host(&csr_val);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_assembler(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int64_t nnz = csr_ptr[nrow];
+
+    // Each entry is split into two halves, one added as two blocks of rows and one as
+    // triples in reverse order and in small batches
+    std::vector<T>   half_val(nnz);
+    std::vector<T>   quarter_val(nnz);
+    std::vector<int> coo_row(nnz);
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+        {
+            half_val[j]    = csr_val[j] / static_cast<T>(2);
+            quarter_val[j] = csr_val[j] / static_cast<T>(4);
+            coo_row[j]     = i;
+        }
+    }
+
+    std::vector<int> rev_row(coo_row.rbegin(), coo_row.rend());
+    std::vector<int> rev_col(nnz);
+    std::vector<T>   rev_val(half_val.rbegin(), half_val.rend());
+
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        rev_col[i] = csr_col[nnz - 1 - i];
+    }
+
+    LocalMatrixAssembler<T> assembler;
+    assembler.Init(nrow, ncol);
+
+    assembler.AddRows(0, nrow, csr_ptr, csr_col, quarter_val.data());
+    assembler.AddRows(0, nrow, csr_ptr, csr_col, quarter_val.data());
+
+    // Batches may be added concurrently
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int64_t i = 0; i < nnz; i += 7)
+    {
+        int64_t batch = std::min(static_cast<int64_t>(7), nnz - i);
+        assembler.Add(batch, rev_row.data() + i, rev_col.data() + i, rev_val.data() + i);
+    }
+
+    bool success = (assembler.GetBufferedNnz() <= 3 * nnz);
+
+    // Buffers beyond the compression threshold of 16384 entries sum their duplicates
+    // while entries are added
+    if(nnz >= 16384)
+    {
+        success &= (assembler.GetBufferedNnz() <= 2 * nnz);
+    }
+
+    LocalMatrix<T> A;
+    assembler.Finalize("A", &A);
+
+    success &= (assembler.GetBufferedNnz() == 0);
+    success &= A.Check();
+    success &= (A.GetFormat() == CSR);
+    success &= (A.GetM() == nrow) && (A.GetN() == ncol) && (A.GetNnz() == nnz);
+
+    if(success == true)
+    {
+        int* A_ptr = NULL;
+        int* A_col = NULL;
+        T*   A_val = NULL;
+
+        A.LeaveDataPtrCSR(&A_ptr, &A_col, &A_val);
+
+        for(int i = 0; i < nrow + 1; ++i)
+        {
+            success &= (A_ptr[i] == csr_ptr[i]);
+        }
+
+        // Generated matrices are sorted, quarters and halves of floating point numbers add
+        // up exactly
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            success &= (A_col[i] == csr_col[i]) && (A_val[i] == csr_val[i]);
+        }
+
+        free_host(&A_ptr);
+        free_host(&A_col);
+        free_host(&A_val);
+    }
+
+    free_host(&csr_ptr);
+    free_host(&csr_col);
+    free_host(&csr_val);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_autoformat(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    // Reference statistics
+    int64_t          min_row_nnz = nnz;
+    int64_t          max_row_nnz = 0;
+    int64_t          bandwidth   = 0;
+    int64_t          profile     = 0;
+    bool             full_diag   = (nrow == ncol);
+    std::vector<int> diag_used(nrow + ncol - 1, 0);
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        int64_t row_nnz = csr_ptr[i + 1] - csr_ptr[i];
+        bool    diag    = false;
+        int     first   = i;
+
+        min_row_nnz = std::min(min_row_nnz, row_nnz);
+        max_row_nnz = std::max(max_row_nnz, row_nnz);
+
+        for(int j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+        {
+            diag_used[nrow - 1 + csr_col[j] - i] = 1;
+            diag |= (csr_col[j] == i);
+
+            bandwidth = std::max(bandwidth, static_cast<int64_t>(std::abs(csr_col[j] - i)));
+            first     = std::min(first, csr_col[j]);
+        }
+
+        full_diag &= diag;
+        profile += i - first;
+    }
+
+    int64_t num_diag = 0;
+    for(size_t i = 0; i < diag_used.size(); ++i)
+    {
+        num_diag += diag_used[i];
+    }
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    MatrixSparsityInfo info;
+    A.GetSparsityInfo(&info);
+
+    bool success = true;
+
+    success &= (info.nrow == nrow) && (info.ncol == ncol) && (info.nnz == nnz);
+    success &= (info.min_row_nnz == min_row_nnz) && (info.max_row_nnz == max_row_nnz);
+    success &= (info.num_diag == num_diag) && (info.full_diag == full_diag);
+    success &= (info.bandwidth == bandwidth) && (info.profile == profile);
+
+    int64_t hist_rows = 0;
+    for(int b = 0; b < 32; ++b)
+    {
+        hist_rows += info.row_nnz_histogram[b];
+    }
+
+    success &= (hist_rows == nrow);
+
+    for(int b = 0; b < 7; ++b)
+    {
+        success &= (info.block_fill[b] > 0.0) && (info.block_fill[b] <= 1.0);
+    }
+
+    // Reference product in CSR format
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> y_ref;
+
+    x.Allocate("x", ncol);
+    y.Allocate("y", nrow);
+    y_ref.Allocate("y_ref", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+    A.Apply(x, &y_ref);
+
+    T ref_nrm = y_ref.Norm();
+
+    // Product after format selection, with model and benchmark, on host and accelerator
+    for(int dev = 0; dev < 2; ++dev)
+    {
+        if(dev == 1)
+        {
+            A.MoveToAccelerator();
+            x.MoveToAccelerator();
+            y.MoveToAccelerator();
+            y_ref.MoveToAccelerator();
+        }
+
+        for(int benchmark = 0; benchmark < 2; ++benchmark)
+        {
+            A.ConvertToCSR();
+            A.AutoFormat(benchmark == 1);
+
+            unsigned int format = A.GetFormat();
+
+            success &= A.Check();
+
+            // Banded matrices are stored in DIA format
+            if(dev == 0 && benchmark == 0 && matrix_type == "Laplacian2D")
+            {
+                success &= (format == DIA);
+            }
+
+            A.Apply(x, &y);
+            y.ScaleAdd(static_cast<T>(-1), y_ref);
+
+            success &= (y.Norm() <= 1e-5 * ref_nrm);
+
+            // The cached decision is the same
+            A.ConvertToCSR();
+            A.AutoFormat(benchmark == 1);
+
+            success &= (A.GetFormat() == format);
+        }
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_bcsr_detection(Arguments argus)
+{
+    int         size        = argus.size;
+    int         blockdim    = argus.blockdim;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate scalar matrix S
+    int* S_ptr = NULL;
+    int* S_col = NULL;
+    T*   S_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &S_ptr, &S_col, &S_val) == false)
+    {
+        return false;
+    }
+
+    // Dense, non-symmetric and diagonally dominant block B
+    std::vector<T> B(blockdim * blockdim);
+
+    for(int i = 0; i < blockdim; ++i)
+    {
+        for(int j = 0; j < blockdim; ++j)
+        {
+            B[i * blockdim + j] = (i == j) ? static_cast<T>(2 * blockdim)
+                                           : static_cast<T>(1) / static_cast<T>(1 + i + 2 * j);
+        }
+    }
+
+    // Multi-DOF matrix A = S (x) B, in CSR format
+    int m   = nrow * blockdim;
+    int n   = ncol * blockdim;
+    int nnz = S_ptr[nrow] * blockdim * blockdim;
+
+    int* A_ptr = NULL;
+    int* A_col = NULL;
+    T*   A_val = NULL;
+
+    allocate_host(m + 1, &A_ptr);
+    allocate_host(nnz, &A_col);
+    allocate_host(nnz, &A_val);
+
+    A_ptr[0] = 0;
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int bi = 0; bi < blockdim; ++bi)
+        {
+            int row = i * blockdim + bi;
+            int idx = A_ptr[row];
+
+            for(int j = S_ptr[i]; j < S_ptr[i + 1]; ++j)
+            {
+                for(int bj = 0; bj < blockdim; ++bj)
+                {
+                    A_col[idx] = S_col[j] * blockdim + bj;
+                    A_val[idx] = S_val[j] * B[bi * blockdim + bj];
+                    ++idx;
+                }
+            }
+
+            A_ptr[row + 1] = idx;
+        }
+    }
+
+    free_host(&S_ptr);
+    free_host(&S_col);
+    free_host(&S_val);
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&A_ptr, &A_col, &A_val, "A", nnz, m, n);
+
+    bool success = true;
+
+    // Block structure detection
+    int detected = A.DetectBlockDimension();
+
+    if(blockdim <= 8)
+    {
+        success &= (detected == blockdim);
+    }
+    else
+    {
+        success &= (detected == 1) || (m % detected == 0 && n % detected == 0);
+    }
+
+    LocalMatrix<T> A_bcsr;
+    A_bcsr.CloneFrom(A);
+    A_bcsr.ConvertToBCSR(0);
+
+    if(detected > 1)
+    {
+        success &= (A_bcsr.GetFormat() == BCSR) && (A_bcsr.GetBlockDimension() == detected);
+    }
+    else
+    {
+        success &= (A_bcsr.GetFormat() == CSR);
+    }
+
+    // Matrix-vector product in BCSR format
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> y_ref;
+
+    x.Allocate("x", n);
+    y.Allocate("y", m);
+    y_ref.Allocate("y_ref", m);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    A.Apply(x, &y_ref);
+
+    // Convert from CSR, such that the block pattern does not contain explicit zeros of
+    // the detected block dimension
+    A_bcsr.CloneFrom(A);
+    A_bcsr.ConvertToBCSR(blockdim);
+    success &= (A_bcsr.GetFormat() == BCSR) && (A_bcsr.GetBlockDimension() == blockdim);
+
+    A_bcsr.Apply(x, &y);
+
+    y.ScaleAdd(static_cast<T>(-1), y_ref);
+    success &= (y.Norm() <= 1e-5 * y_ref.Norm());
+
+    if(m == n)
+    {
+        y.CopyFrom(y_ref);
+        A_bcsr.ApplyAdd(x, static_cast<T>(-1), &y);
+        success &= (y.Norm() <= 1e-5 * y_ref.Norm());
+    }
+
+    // Block ILU(0) equals scalar ILU(0) on the block sparsity pattern
+    if(matrix_type == "Laplacian2D")
+    {
+        A.ILU0Factorize();
+        A.LUAnalyse();
+        A.LUSolve(x, &y_ref);
+
+        A_bcsr.ILU0Factorize();
+        success &= (A_bcsr.GetFormat() == BCSR);
+
+        A_bcsr.LUAnalyse();
+        A_bcsr.LUSolve(x, &y);
+
+        y.ScaleAdd(static_cast<T>(-1), y_ref);
+        success &= (y.Norm() <= 1e-4 * y_ref.Norm());
+
+        // Block cyclic shift of B, where no block row has a diagonal block
+        int nblock  = 3;
+        int m_shift = nblock * blockdim;
+
+        std::vector<int> shift_ptr(m_shift + 1);
+        std::vector<int> shift_col(m_shift * blockdim);
+        std::vector<T>   shift_val(m_shift * blockdim);
+
+        for(int i = 0; i < m_shift; ++i)
+        {
+            int bi = i % blockdim;
+            int bj = (i / blockdim + 1) % nblock;
+
+            shift_ptr[i] = i * blockdim;
+
+            for(int j = 0; j < blockdim; ++j)
+            {
+                shift_col[i * blockdim + j] = bj * blockdim + j;
+                shift_val[i * blockdim + j] = B[bi * blockdim + j];
+            }
+        }
+
+        shift_ptr[m_shift] = m_shift * blockdim;
+
+        LocalMatrix<T> A_shift;
+        A_shift.AllocateCSR("A_shift", m_shift * blockdim, m_shift, m_shift);
+        A_shift.CopyFromCSR(shift_ptr.data(), shift_col.data(), shift_val.data());
+        A_shift.ConvertToBCSR(blockdim);
+
+        success &= (A_shift.GetFormat() == BCSR);
+
+        // Block ILU(0) is rejected instead of a CSR factorization in BCSR storage
+        EXPECT_DEATH(A_shift.ILU0Factorize(), "");
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_coo_apply(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> y_ref;
+
+    x.Allocate("x", ncol);
+    y.Allocate("y", nrow);
+    y_ref.Allocate("y_ref", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    // Reference product in CSR format
+    A.Apply(x, &y_ref);
+
+    T ref_nrm = y_ref.Norm();
+
+    bool success = true;
+
+    // COO and HYB, where the COO part of HYB holds the entries of the longer rows
+    unsigned int formats[] = {COO, HYB};
+
+    for(unsigned int format : formats)
+    {
+        LocalMatrix<T> B;
+        B.CloneFrom(A);
+        B.ConvertTo(format);
+
+        // Output must be overwritten
+        y.SetRandomUniform(54321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+        B.Apply(x, &y);
+        y.ScaleAdd(static_cast<T>(-1), y_ref);
+
+        success &= (y.Norm() <= 1e-5 * ref_nrm);
+
+        // y = y_ref - 2 * B * x
+        y.CopyFrom(y_ref);
+        B.ApplyAdd(x, static_cast<T>(-2), &y);
+        y.AddScale(y_ref, static_cast<T>(1));
+
+        success &= (y.Norm() <= 1e-5 * ref_nrm);
+    }
+
+    // COO entries with even positions first, rows are not contiguous
+    std::vector<int> coo_row(nnz);
+    std::vector<int> coo_col(nnz);
+    std::vector<T>   coo_val(nnz);
+
+    {
+        LocalMatrix<T> B;
+        B.CloneFrom(A);
+        B.ConvertTo(COO);
+
+        int* B_row = NULL;
+        int* B_col = NULL;
+        T*   B_val = NULL;
+
+        B.LeaveDataPtrCOO(&B_row, &B_col, &B_val);
+
+        int half = (nnz + 1) / 2;
+
+        for(int i = 0; i < nnz; ++i)
+        {
+            int j = (i < half) ? 2 * i : 2 * (i - half) + 1;
+
+            coo_row[i] = B_row[j];
+            coo_col[i] = B_col[j];
+            coo_val[i] = B_val[j];
+        }
+
+        free_host(&B_row);
+        free_host(&B_col);
+        free_host(&B_val);
+    }
+
+    LocalMatrix<T> C;
+    C.AllocateCOO("C", nnz, nrow, ncol);
+    C.CopyFromCOO(coo_row.data(), coo_col.data(), coo_val.data());
+
+    y.SetRandomUniform(54321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    C.Apply(x, &y);
+    y.ScaleAdd(static_cast<T>(-1), y_ref);
+
+    success &= (y.Norm() <= 1e-5 * ref_nrm);
+
+    y.CopyFrom(y_ref);
+    C.ApplyAdd(x, static_cast<T>(-2), &y);
+    y.AddScale(y_ref, static_cast<T>(1));
+
+    success &= (y.Norm() <= 1e-5 * ref_nrm);
+
+    // Sorting and overwriting the entries must not keep a stale row order
+    C.Sort();
+
+    C.Apply(x, &y);
+    y.ScaleAdd(static_cast<T>(-1), y_ref);
+
+    success &= (y.Norm() <= 1e-5 * ref_nrm);
+
+    C.CopyFromCOO(coo_row.data(), coo_col.data(), coo_val.data());
+
+    C.Apply(x, &y);
+    y.ScaleAdd(static_cast<T>(-1), y_ref);
+
+    success &= (y.Norm() <= 1e-5 * ref_nrm);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+// Reference y = A * x computed row by row, bound[i] receives sum_j |a_ij * x_j| of each
+// row to scale the tolerance of the comparison
+template <typename T>
+void host_csrmv_reference(int             nrow,
+                          const int*      csr_ptr,
+                          const int*      csr_col,
+                          const T*        csr_val,
+                          const T*        x,
+                          std::vector<T>* y,
+                          std::vector<T>* bound)
+{
+    y->assign(nrow, static_cast<T>(0));
+    bound->assign(nrow, static_cast<T>(0));
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+        {
+            (*y)[i] += csr_val[j] * x[csr_col[j]];
+            (*bound)[i] += std::abs(csr_val[j] * x[csr_col[j]]);
+        }
+    }
+}
+
+// Compare y entry by entry against the reference y_ref = alpha * A * x
+template <typename T>
+bool check_local_matrix_apply(const LocalVector<T>& y,
+                              const std::vector<T>& y_ref,
+                              const std::vector<T>& bound,
+                              T                     alpha)
+{
+    std::vector<T> hy(y_ref.size());
+    y.CopyToData(hy.data());
+
+    T eps = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+
+    for(size_t i = 0; i < hy.size(); ++i)
+    {
+        if(std::abs(hy[i] - alpha * y_ref[i]) > eps * (std::abs(alpha) * bound[i] + 1))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+bool testing_local_matrix_sell_apply(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    std::vector<T> hx(ncol);
+
+    std::mt19937                      gen(12345);
+    std::uniform_real_distribution<T> dis(static_cast<T>(-1), static_cast<T>(1));
+
+    for(int i = 0; i < ncol; ++i)
+    {
+        hx[i] = dis(gen);
+    }
+
+    // Reference product, independent of the library kernels
+    std::vector<T> y_ref;
+    std::vector<T> bound;
+    host_csrmv_reference(nrow, csr_ptr, csr_col, csr_val, hx.data(), &y_ref, &bound);
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    // SELL is a host format, the conversion must not fall back to CSR
+    A.ConvertToSELL();
+
+    bool success = (A.GetFormat() == SELL);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+
+    x.Allocate("x", ncol);
+    y.Allocate("y", nrow);
+
+    x.CopyFromData(hx.data());
+
+    // Output must be overwritten, including padded rows of the last slice
+    y.SetRandomUniform(54321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    A.Apply(x, &y);
+
+    success &= check_local_matrix_apply(y, y_ref, bound, static_cast<T>(1));
+
+    // y = y_ref - 2 * A * x = -y_ref
+    y.CopyFromData(y_ref.data());
+    A.ApplyAdd(x, static_cast<T>(-2), &y);
+
+    success &= check_local_matrix_apply(y, y_ref, bound, static_cast<T>(-1));
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_long_rows(Arguments argus)
+{
+    int n = argus.size;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Dense first, middle and last rows and an empty second row among rows with two
+    // non-zeros, such that long rows are split between threads
+    std::vector<int> row_nnz(n, 2);
+
+    row_nnz[0]     = n;
+    row_nnz[1]     = 0;
+    row_nnz[n / 2] = n;
+    row_nnz[n - 1] = n;
+
+    std::mt19937                      gen(12345);
+    std::uniform_real_distribution<T> dis(static_cast<T>(-1), static_cast<T>(1));
+
+    std::vector<int> h_ptr(n + 1, 0);
+    std::vector<int> h_col;
+    std::vector<T>   h_val;
+
+    for(int i = 0; i < n; ++i)
+    {
+        for(int k = 0; k < row_nnz[i]; ++k)
+        {
+            h_col.push_back((row_nnz[i] == n) ? k : (i + k) % n);
+            h_val.push_back(dis(gen));
+        }
+
+        h_ptr[i + 1] = static_cast<int>(h_col.size());
+    }
+
+    int nnz = h_ptr[n];
+
+    std::vector<T> hx(n);
+    std::vector<T> hb(n);
+
+    for(int i = 0; i < n; ++i)
+    {
+        hx[i] = dis(gen);
+        hb[i] = dis(gen);
+    }
+
+    std::vector<T> y_ref;
+    std::vector<T> bound;
+    host_csrmv_reference(n, h_ptr.data(), h_col.data(), h_val.data(), hx.data(), &y_ref, &bound);
+
+    bool success = true;
+
+    int nthreads[] = {1, 2, 3, 4, 7};
+
+    for(int nt : nthreads)
+    {
+        // Run multi-threaded regardless of the problem size
+        set_omp_threads_rocalution(nt);
+        set_omp_threshold_rocalution(0);
+
+        LocalMatrix<T> A;
+        A.AllocateCSR("A", nnz, n, n);
+        A.CopyFromCSR(h_ptr.data(), h_col.data(), h_val.data());
+
+        LocalVector<T> x;
+        LocalVector<T> b;
+        LocalVector<T> y;
+
+        x.Allocate("x", n);
+        b.Allocate("b", n);
+        y.Allocate("y", n);
+
+        x.CopyFromData(hx.data());
+        b.CopyFromData(hb.data());
+
+        // Output must be overwritten
+        y.SetRandomUniform(54321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+        A.Apply(x, &y);
+
+        success &= check_local_matrix_apply(y, y_ref, bound, static_cast<T>(1));
+
+        // y = y_ref - 2 * A * x = -y_ref
+        y.CopyFromData(y_ref.data());
+        A.ApplyAdd(x, static_cast<T>(-2), &y);
+
+        success &= check_local_matrix_apply(y, y_ref, bound, static_cast<T>(-1));
+
+        // y = b - A * x, then b - y = A * x
+        y.SetRandomUniform(54321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+        A.Residual(b, x, &y);
+        y.ScaleAdd(static_cast<T>(-1), b);
+
+        success &= check_local_matrix_apply(y, y_ref, bound, static_cast<T>(1));
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+void gen_local_matrix_aggregation(int n, int width, LocalMatrix<T>* R)
+{
+    // Aggregates of width consecutive columns, starting at every second column
+    int n_c = (n + 1) / 2;
+
+    int* R_ptr = NULL;
+    int* R_col = NULL;
+    T*   R_val = NULL;
+
+    allocate_host(n_c + 1, &R_ptr);
+    allocate_host(width * n_c, &R_col);
+    allocate_host(width * n_c, &R_val);
+
+    R_ptr[0] = 0;
+
+    for(int i = 0; i < n_c; ++i)
+    {
+        R_ptr[i + 1] = R_ptr[i];
+
+        for(int j = 2 * i; j < std::min(2 * i + width, n); ++j)
+        {
+            R_col[R_ptr[i + 1]] = j;
+            R_val[R_ptr[i + 1]] = static_cast<T>(1) / static_cast<T>(j - 2 * i + 1);
+            ++R_ptr[i + 1];
+        }
+    }
+
+    R->SetDataPtrCSR(&R_ptr, &R_col, &R_val, "R", R_ptr[n_c], n_c, n);
+}
+
+template <typename T>
+bool testing_local_matrix_residual(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> r;
+    LocalVector<T> r_ref;
+
+    x.Allocate("x", ncol);
+    b.Allocate("b", nrow);
+    r.Allocate("r", nrow);
+    r_ref.Allocate("r_ref", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+    b.SetRandomUniform(67890ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    // Reference residual
+    A.Apply(x, &r_ref);
+    r_ref.ScaleAdd(static_cast<T>(-1), b);
+
+    T ref_nrm = r_ref.Norm();
+
+    bool success = true;
+
+    // Residual for all formats, output must be overwritten
+    for(unsigned int format = CSR; format <= SELL; ++format)
+    {
+        LocalMatrix<T> B;
+        B.CloneFrom(A);
+        B.ConvertTo(format, (format == BCSR) ? 2 : 1);
+
+        r.SetRandomUniform(54321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+        B.Residual(b, x, &r);
+        r.ScaleAdd(static_cast<T>(-1), r_ref);
+
+        success &= (r.Norm() <= 1e-5 * ref_nrm);
+    }
+
+    // Restriction operators with aggregates of two rows (nnz(R) <= nrow, fused) and of
+    // three overlapping rows (nnz(R) > nrow)
+    int nrow_c = (nrow + 1) / 2;
+
+    for(int width = 2; width <= 3; ++width)
+    {
+        LocalMatrix<T> R;
+        gen_local_matrix_aggregation(nrow, width, &R);
+
+        LocalVector<T> rc;
+        LocalVector<T> rc_ref;
+
+        rc.Allocate("rc", nrow_c);
+        rc_ref.Allocate("rc_ref", nrow_c);
+
+        R.Apply(r_ref, &rc_ref);
+
+        T ref_nrm_c = rc_ref.Norm();
+
+        rc.SetRandomUniform(54321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+        A.ResidualRestrict(b, x, R, &r, &rc);
+        rc.ScaleAdd(static_cast<T>(-1), rc_ref);
+
+        success &= (rc.Norm() <= 1e-5 * ref_nrm_c);
+
+        // Fallback for non-CSR restriction
+        R.ConvertTo(COO);
+
+        A.ResidualRestrict(b, x, R, &r, &rc);
+        rc.ScaleAdd(static_cast<T>(-1), rc_ref);
+
+        success &= (rc.Norm() <= 1e-5 * ref_nrm_c);
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool check_local_matrix_triple_product(const LocalMatrix<T>& C,
+                                       const LocalMatrix<T>& R,
+                                       const LocalMatrix<T>& A,
+                                       const LocalMatrix<T>& P)
+{
+    // Unfused reference product
+    LocalMatrix<T> RA;
+    LocalMatrix<T> RAP;
+
+    RA.MatrixMult(R, A);
+    RAP.MatrixMult(RA, P);
+
+    LocalMatrix<T> C_dense;
+    C_dense.CloneFrom(C);
+    C_dense.ConvertToDENSE();
+    RAP.ConvertToDENSE();
+
+    T* C_val   = NULL;
+    T* RAP_val = NULL;
+
+    C_dense.LeaveDataPtrDENSE(&C_val);
+    RAP.LeaveDataPtrDENSE(&RAP_val);
+
+    int64_t size = C.GetM() * C.GetN();
+
+    double max_val  = 0.0;
+    double max_diff = 0.0;
+
+    for(int64_t i = 0; i < size; ++i)
+    {
+        max_val  = std::max(max_val, static_cast<double>(std::abs(RAP_val[i])));
+        max_diff = std::max(max_diff, static_cast<double>(std::abs(C_val[i] - RAP_val[i])));
+    }
+
+    free_host(&C_val);
+    free_host(&RAP_val);
+
+    return (C.GetM() == R.GetM()) && (C.GetN() == P.GetN()) && (max_diff <= 1e-5 * max_val);
+}
+
+template <typename T>
+bool testing_local_matrix_triple_product(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(gen_local_matrix(matrix_type, size, &nrow, &ncol, &csr_ptr, &csr_col, &csr_val) == false)
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    // Same structure, different values
+    std::vector<T> csr_val2(nnz);
+
+    for(int j = 0; j < nnz; ++j)
+    {
+        csr_val2[j] = csr_val[j] * static_cast<T>(1 + j % 3);
+    }
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    // Transfer operators with overlapping aggregates
+    LocalMatrix<T> R;
+    LocalMatrix<T> P;
+    LocalMatrix<T> P_t;
+
+    gen_local_matrix_aggregation(nrow, 3, &R);
+    gen_local_matrix_aggregation(ncol, 3, &P_t);
+
+    P_t.Transpose(&P);
+
+    // Fused product
+    LocalMatrix<T> C;
+    C.TripleMatrixProduct(R, A, P);
+
+    bool success = check_local_matrix_triple_product(C, R, A, P);
+
+    int64_t nnz_c = C.GetNnz();
+
+    // New values of A, the structure of C is reused
+    A.UpdateValuesCSR(csr_val2.data());
+    C.TripleMatrixProduct(R, A, P, true);
+
+    success &= (C.GetNnz() == nnz_c);
+    success &= check_local_matrix_triple_product(C, R, A, P);
+
+    // The structure of D, a single entry per row, does not contain the product, which
+    // is computed from scratch
+    int nrow_c = R.GetM();
+    int ncol_c = P.GetN();
+
+    std::vector<int> D_ptr(nrow_c + 1);
+    std::vector<int> D_col(nrow_c);
+    std::vector<T>   D_val(nrow_c, static_cast<T>(1));
+
+    for(int i = 0; i < nrow_c; ++i)
+    {
+        D_ptr[i] = i;
+        D_col[i] = i % ncol_c;
+    }
+
+    D_ptr[nrow_c] = nrow_c;
+
+    LocalMatrix<T> D;
+    D.AllocateCSR("D", nrow_c, nrow_c, ncol_c);
+    D.CopyFromCSR(D_ptr.data(), D_col.data(), D_val.data());
+
+    success &= (D.GetNnz() < nnz_c);
+
+    D.TripleMatrixProduct(R, A, P, true);
+
+    success &= (D.GetNnz() == nnz_c);
+    success &= check_local_matrix_triple_product(D, R, A, P);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_allocations(Arguments argus)
+{
+    int size     = argus.size;
+    int blockdim = argus.blockdim;
+
+    int m  = size;
+    int n  = size;
+    int mb = (m + blockdim - 1) / blockdim;
+    int nb = (n + blockdim - 1) / blockdim;
+
+    int nnz = 0.05 * m * n;
+    if(nnz == 0)
+    {
+        nnz = m * n;
+    }
+
+    int nnzb = 0.01 * mb * nb;
+    if(nnzb == 0)
+    {
+        nnzb = mb * nb;
+    }
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    int ndiag       = 5;
+    int ell_max_row = 6;
+    int ell_nnz     = ell_max_row * m;
+    int coo_nnz     = (nnz - ell_nnz) < 0 ? 0 : nnz - ell_nnz;
+
+    // Testing allocating matrix types
+    LocalMatrix<T> A;
+    A.AllocateCSR("A", nnz, m, n);
+
+    LocalMatrix<T> B;
+    B.AllocateBCSR("B", nnzb, mb, nb, blockdim);
+
+    LocalMatrix<T> C;
+    C.AllocateCOO("C", nnz, m, n);
+
+    LocalMatrix<T> D;
+    D.AllocateDIA("D", nnz, m, n, ndiag);
+
+    LocalMatrix<T> F;
+    F.AllocateELL("F", ell_nnz, m, n, ell_max_row);
+
+    LocalMatrix<T> G;
+    G.AllocateHYB("G", ell_nnz, coo_nnz, ell_max_row, m, n);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return true;
+}
+
+template <typename T>
+bool testing_local_matrix_reordering(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else
+    {
+        stop_rocalution();
+
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Scramble rows and columns
+    std::vector<int> scramble_data(nrow);
+    std::iota(scramble_data.begin(), scramble_data.end(), 0);
+    std::shuffle(scramble_data.begin(), scramble_data.end(), std::mt19937(12345));
+
+    LocalVector<int> scramble;
+    scramble.Allocate("scramble", nrow);
+    scramble.CopyFromData(scramble_data.data());
+
+    A.Permute(scramble);
+
+    MatrixSparsityInfo info;
+    A.GetSparsityInfo(&info);
+
+    LocalVector<int> cmk;
+    LocalVector<int> rcmk;
+    LocalVector<int> loc;
+
+    std::vector<int> cmk_data(nrow);
+    std::vector<int> rcmk_data(nrow);
+    std::vector<int> loc_data(nrow);
+
+    bool success = true;
+
+    // Check host sequential and parallel ordering
+    for(int parallel = 0; parallel < 2; ++parallel)
+    {
+        set_omp_parallel_ordering_rocalution(parallel == 1);
+
+        A.CMK(&cmk);
+        A.RCMK(&rcmk);
+
+        cmk.CopyToData(cmk_data.data());
+        rcmk.CopyToData(rcmk_data.data());
+
+        success &= valid_permutation(nrow, cmk_data.data());
+        success &= valid_permutation(nrow, rcmk_data.data());
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            success &= (rcmk_data[i] == nrow - 1 - cmk_data[i]);
+        }
+
+        // The ordering does not depend on the number of threads
+        set_omp_threshold_rocalution(0);
+
+        for(int nthreads = 1; nthreads <= 4; ++nthreads)
+        {
+            set_omp_threads_rocalution(nthreads);
+
+            LocalVector<int> perm;
+            A.RCMK(&perm);
+
+            std::vector<int> perm_data(nrow);
+            perm.CopyToData(perm_data.data());
+
+            success &= (perm_data == rcmk_data);
+        }
+
+        set_omp_threshold_rocalution(10000);
+
+        // RCMK reduces bandwidth and profile. The sequential ordering only follows the
+        // pattern of the matrix, which is unsymmetric for the permuted identity.
+        LocalMatrix<T> B;
+        B.CloneFrom(A);
+        B.Permute(rcmk);
+
+        MatrixSparsityInfo rcmk_info;
+        B.GetSparsityInfo(&rcmk_info);
+
+        if(parallel == 1 || matrix_type == "Laplacian2D")
+        {
+            success &= (rcmk_info.bandwidth <= info.bandwidth);
+            success &= (rcmk_info.profile <= info.profile);
+        }
+
+        // Starting from a corner, the bandwidth of the 2D Laplacian is bounded by the
+        // size of the largest level (an anti-diagonal of the grid)
+        if(parallel == 1 && matrix_type == "Laplacian2D")
+        {
+            success &= (rcmk_info.bandwidth <= 2 * size);
+        }
+    }
+
+    set_omp_parallel_ordering_rocalution(false);
+
+    A.LocalityOrder(&loc);
+    loc.CopyToData(loc_data.data());
+
+    success &= valid_permutation(nrow, loc_data.data());
+
+    // Locality ordering of a non CSR matrix is performed in CSR format
+    LocalMatrix<T> C;
+    C.CloneFrom(A);
+    C.ConvertToCOO();
+
+    LocalVector<int> loc_coo;
+    C.LocalityOrder(&loc_coo);
+
+    std::vector<int> loc_coo_data(nrow);
+    loc_coo.CopyToData(loc_coo_data.data());
+
+    success &= (loc_coo_data == loc_data);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
 }
 
 #endif // TESTING_LOCAL_MATRIX_HPP
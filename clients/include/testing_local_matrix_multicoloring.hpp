@@ -28,6 +28,7 @@
 
 #include <gtest/gtest.h>
 #include <rocalution/rocalution.hpp>
+#include <vector>
 
 using namespace rocalution;
 
@@ -93,16 +94,69 @@ bool testing_local_matrix_multicoloring(Arguments argus)
 
     bool success = true;
 
-    // Check host multicoloring
-    A.MultiColoring(num_colors, &size_colors, &coloring);
-    coloring.CopyToHostData(perm);
-    success &= valid_permutation(nrow, perm);
-    success &= valid_coloring(nrow, csr_ptr, csr_col, num_colors, size_colors, perm);
+    // Check host multicoloring and maximal independent set, sequential and parallel.
+    // The results must not depend on the number of threads.
+    set_omp_threshold_rocalution(0);
 
-    // Reset
-    coloring.Clear();
-    delete[] size_colors;
-    size_colors = NULL;
+    for(int parallel = 0; parallel < 2; ++parallel)
+    {
+        set_omp_parallel_coloring_rocalution(parallel == 1);
+
+        std::vector<int> ref_perm;
+        std::vector<int> ref_size_colors;
+        std::vector<int> ref_mis_perm;
+        int              ref_mis_size = 0;
+
+        for(int nthreads = 1; nthreads <= 4; nthreads += 3)
+        {
+            set_omp_threads_rocalution(nthreads);
+
+            A.MultiColoring(num_colors, &size_colors, &coloring);
+            coloring.CopyToHostData(perm);
+            success &= valid_permutation(nrow, perm);
+            success &= valid_coloring(nrow, csr_ptr, csr_col, num_colors, size_colors, perm);
+
+            if(nthreads == 1)
+            {
+                ref_perm.assign(perm, perm + nrow);
+                ref_size_colors.assign(size_colors, size_colors + num_colors);
+            }
+            else
+            {
+                success &= (std::vector<int>(perm, perm + nrow) == ref_perm);
+                success &= (std::vector<int>(size_colors, size_colors + num_colors)
+                            == ref_size_colors);
+            }
+
+            // Reset
+            coloring.Clear();
+            delete[] size_colors;
+            size_colors = NULL;
+
+            int mis_size;
+
+            A.MaximalIndependentSet(mis_size, &coloring);
+            coloring.CopyToHostData(perm);
+            success &= valid_permutation(nrow, perm);
+            success &= valid_independent_set(nrow, csr_ptr, csr_col, mis_size, perm);
+
+            if(nthreads == 1)
+            {
+                ref_mis_perm.assign(perm, perm + nrow);
+                ref_mis_size = mis_size;
+            }
+            else
+            {
+                success &= (std::vector<int>(perm, perm + nrow) == ref_mis_perm);
+                success &= (mis_size == ref_mis_size);
+            }
+
+            coloring.Clear();
+        }
+    }
+
+    set_omp_parallel_coloring_rocalution(false);
+    set_omp_threshold_rocalution(10000);
 
     // Check accelerator multicoloring
     A.MoveToAccelerator();
@@ -242,6 +242,38 @@ bool testing_local_matrix_llsolve(Arguments argus)
 
     success &= check_residual(nrm2);
 
+    // The level scheduled host solves require more than one thread
+    set_omp_threads_rocalution(4);
+
+    // LLSolve on host with the schedule of LAnalyse
+    test_x.CopyFrom(base_x);
+    test_x.MoveToHost();
+
+    L.LAnalyse(false);
+    L.LLSolve(b, &test_x);
+    L.LAnalyseClear();
+
+    test_x.MoveToAccelerator();
+    test_x.ScaleAdd(-1.0, e);
+    nrm2 = test_x.Norm();
+
+    success &= check_residual(nrm2);
+
+    // LLSolve on host after LAnalyse replaced the schedule of LLAnalyse
+    test_x.CopyFrom(base_x);
+    test_x.MoveToHost();
+
+    L.LLAnalyse();
+    L.LAnalyse(false);
+    L.LLSolve(b, &test_x);
+    L.LLAnalyseClear();
+
+    test_x.MoveToAccelerator();
+    test_x.ScaleAdd(-1.0, e);
+    nrm2 = test_x.Norm();
+
+    success &= check_residual(nrm2);
+
     // Stop rocALUTION platform
     stop_rocalution();
 
@@ -108,8 +108,104 @@ void testing_local_vector_bad_args(void)
         free_host(&vint);
     }
 
+    // AddScalePairNormSquared
+    {
+        LocalVector<T> x;
+        x.Allocate("", safe_size);
+        ASSERT_DEATH(vec.AddScalePairNormSquared(x, 1.0, nullptr, x, 1.0),
+                     ".*Assertion.*y != (NULL|__null)*");
+        ASSERT_DEATH(vec.AddScalePairNormSquared(x, 1.0, &vec, x, 1.0),
+                     ".*Assertion.*y != this*");
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+static bool check_vector_diff(LocalVector<T>* vec, const LocalVector<T>& ref, T tol)
+{
+    // vec = vec - ref
+    vec->AddScale(ref, static_cast<T>(-1));
+
+    return vec->Norm() <= tol * std::max(ref.Norm(), static_cast<T>(1));
+}
+
+template <typename T>
+bool testing_local_vector_add_scale_norm(Arguments argus)
+{
+    int  size    = argus.size;
+    bool use_acc = argus.use_acc;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> z;
+    LocalVector<T> w;
+
+    x.Allocate("x", size);
+    y.Allocate("y", size);
+    z.Allocate("z", size);
+    w.Allocate("w", size);
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+    y.SetRandomUniform(23456ULL, -1.0, 1.0);
+    z.SetRandomUniform(34567ULL, -1.0, 1.0);
+    w.SetRandomUniform(45678ULL, -1.0, 1.0);
+
+    if(use_acc)
+    {
+        x.MoveToAccelerator();
+        y.MoveToAccelerator();
+        z.MoveToAccelerator();
+        w.MoveToAccelerator();
+    }
+
+    T alpha = static_cast<T>(0.75);
+    T beta  = static_cast<T>(-1.25);
+    T tol   = static_cast<T>(std::is_same<T, float>::value ? 1e-4 : 1e-10);
+
+    // Reference, separate updates and dot products
+    LocalVector<T> y_ref;
+    LocalVector<T> w_ref;
+
+    y_ref.CloneFrom(y);
+    w_ref.CloneFrom(w);
+
+    y_ref.AddScale(x, alpha);
+    w_ref.AddScale(z, beta);
+
+    T y_nrm_ref = y_ref.Dot(y_ref);
+    T w_nrm_ref = w_ref.Dot(w_ref);
+
+    // Fused single update
+    LocalVector<T> y1;
+    y1.CloneFrom(y);
+
+    T y_nrm = y1.AddScaleNormSquared(x, alpha);
+
+    // Fused pair update
+    LocalVector<T> y2;
+    LocalVector<T> w2;
+    y2.CloneFrom(y);
+    w2.CloneFrom(w);
+
+    T w_nrm = y2.AddScalePairNormSquared(x, alpha, &w2, z, beta);
+
+    bool success = std::abs(y_nrm - y_nrm_ref) <= tol * std::max(y_nrm_ref, static_cast<T>(1));
+    success = success
+              && std::abs(w_nrm - w_nrm_ref) <= tol * std::max(w_nrm_ref, static_cast<T>(1));
+    success = success && check_vector_diff(&y1, y_ref, tol);
+    success = success && check_vector_diff(&y2, y_ref, tol);
+    success = success && check_vector_diff(&w2, w_ref, tol);
+
     // Stop rocALUTION
     stop_rocalution();
+
+    return success;
 }
 
 #endif // TESTING_LOCAL_VECTOR_HPP
@@ -44,14 +44,15 @@ static bool check_residual(double res)
 template <typename T>
 bool testing_ruge_stueben_amg(Arguments argus)
 {
-    int          ndim           = argus.size;
-    int          pre_iter       = argus.pre_smooth;
-    int          post_iter      = argus.post_smooth;
-    std::string  smoother       = argus.smoother;
-    unsigned int format         = argus.format;
-    int          cycle          = argus.cycle;
-    bool         scaling        = argus.ordering;
-    bool         rebuildnumeric = argus.rebuildnumeric;
+    int          ndim                = argus.size;
+    int          pre_iter            = argus.pre_smooth;
+    int          post_iter           = argus.post_smooth;
+    std::string  smoother            = argus.smoother;
+    std::string  coarsening_strategy = argus.coarsening_strategy;
+    unsigned int format              = argus.format;
+    int          cycle               = argus.cycle;
+    bool         scaling             = argus.ordering;
+    bool         rebuildnumeric      = argus.rebuildnumeric;
 
     // Initialize rocALUTION platform
     set_device_rocalution(device);
@@ -115,7 +116,23 @@ bool testing_ruge_stueben_amg(Arguments argus)
     RugeStuebenAMG<LocalMatrix<T>, LocalVector<T>, T> p;
 
     // Setup AMG
-    p.SetCoarseningStrategy(PMIS);
+    if(coarsening_strategy == "Greedy")
+    {
+        p.SetCoarseningStrategy(CoarseningStrategy::Greedy);
+    }
+    else if(coarsening_strategy == "PMIS")
+    {
+        p.SetCoarseningStrategy(CoarseningStrategy::PMIS);
+    }
+    else if(coarsening_strategy == "HMIS")
+    {
+        p.SetCoarseningStrategy(CoarseningStrategy::HMIS);
+    }
+    else
+    {
+        return false;
+    }
+
     p.SetInterpolationType(ExtPI);
     p.SetCoarsestLevel(300);
     p.SetCycle(cycle);
@@ -27,7 +27,10 @@
 
 #include "utility.hpp"
 
+#include <cstdio>
+#include <fstream>
 #include <rocalution/rocalution.hpp>
+#include <vector>
 
 using namespace rocalution;
 
@@ -242,4 +245,325 @@ bool testing_saamg(Arguments argus)
     return success;
 }
 
+template <typename T>
+bool testing_saamg_multi(Arguments argus)
+{
+    int          ndim                = argus.size;
+    int          pre_iter            = argus.pre_smooth;
+    int          post_iter           = argus.post_smooth;
+    std::string  smoother            = argus.smoother;
+    std::string  coarsening_strategy = argus.coarsening_strategy;
+    unsigned int format              = argus.format;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T>      A;
+    LocalMultiVector<T> x;
+    LocalMultiVector<T> b;
+    LocalMultiVector<T> e;
+
+    // Number of right-hand sides
+    int num_vec = 4;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN(), num_vec);
+    b.Allocate("b", A.GetM(), num_vec);
+    e.Allocate("e", A.GetN(), num_vec);
+
+    // b = A * e
+    e.SetRandomUniform(54321ULL, -1.0, 1.0);
+    A.Apply(e, &b);
+
+    // Random initial guess
+    x.SetRandomUniform(12345ULL, -4.0, 6.0);
+
+    // Solver
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // AMG, all right-hand sides are cycled together in the V-cycle
+    SAAMG<LocalMatrix<T>, LocalVector<T>, T> p;
+
+    p.SetCoarsestLevel(10);
+    p.SetCycle(Vcycle);
+    p.SetOperator(A);
+    p.SetManualSmoothers(true);
+    p.SetManualSolver(true);
+    p.SetScaling(false);
+
+    if(coarsening_strategy == "Greedy")
+    {
+        p.SetCoarseningStrategy(CoarseningStrategy::Greedy);
+    }
+    else if(coarsening_strategy == "PMIS")
+    {
+        p.SetCoarseningStrategy(CoarseningStrategy::PMIS);
+    }
+    else
+    {
+        return false;
+    }
+
+    p.SetCouplingStrength(0.001);
+    p.SetInterpRelax(2.0 / 3.0);
+    p.BuildHierarchy();
+
+    // Get number of hierarchy levels
+    int levels = p.GetNumLevels();
+
+    // Coarse grid solver
+    CG<LocalMatrix<T>, LocalVector<T>, T> cgs;
+    cgs.Verbose(0);
+
+    // Smoother for each level
+    IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>** sm
+        = new IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>*[levels - 1];
+
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>** smooth
+        = new Preconditioner<LocalMatrix<T>, LocalVector<T>, T>*[levels - 1];
+
+    for(int i = 0; i < levels - 1; ++i)
+    {
+        sm[i] = new FixedPoint<LocalMatrix<T>, LocalVector<T>, T>;
+
+        if(smoother == "FSAI")
+            smooth[i] = new FSAI<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(smoother == "SPAI")
+            smooth[i] = new SPAI<LocalMatrix<T>, LocalVector<T>, T>;
+        else
+            return false;
+
+        sm[i]->SetPreconditioner(*(smooth[i]));
+        sm[i]->Verbose(0);
+    }
+
+    p.SetSmoother(sm);
+    p.SetSolver(cgs);
+    p.SetSmootherPreIter(pre_iter);
+    p.SetSmootherPostIter(post_iter);
+    p.SetOperatorFormat(format, format == BCSR ? argus.blockdim : 1);
+    p.InitMaxIter(1);
+    p.Verbose(0);
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+    ls.SetPreconditioner(p);
+
+    ls.Init(1e-8, 0.0, 1e+8, 10000);
+
+    ls.Build();
+
+    // Matrix format
+    A.ConvertTo(format, format == BCSR ? argus.blockdim : 1);
+
+    ls.SolveMulti(b, &x);
+
+    // Verify solutions
+    std::vector<T> minus_one(num_vec, static_cast<T>(-1));
+    std::vector<T> nrm2(num_vec);
+
+    x.ScaleAdd(minus_one.data(), e);
+    x.Norm(nrm2.data());
+
+    bool success = true;
+
+    for(int j = 0; j < num_vec; ++j)
+    {
+        success &= check_residual(nrm2[j]);
+    }
+
+    // Clean up
+    ls.Clear();
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    for(int i = 0; i < levels - 1; ++i)
+    {
+        delete smooth[i];
+        delete sm[i];
+    }
+    delete[] smooth;
+    delete[] sm;
+
+    return success;
+}
+
+template <typename T>
+bool testing_saamg_profile(Arguments argus)
+{
+    int          ndim                = argus.size;
+    int          pre_iter            = argus.pre_smooth;
+    int          post_iter           = argus.post_smooth;
+    std::string  coarsening_strategy = argus.coarsening_strategy;
+    unsigned int format              = argus.format;
+    int          cycle               = argus.cycle;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> e;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    // b = A * 1
+    e.Ones();
+    A.Apply(e, &b);
+
+    // Random initial guess
+    x.SetRandomUniform(12345ULL, -4.0, 6.0);
+
+    // Solver
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // AMG
+    SAAMG<LocalMatrix<T>, LocalVector<T>, T> p;
+
+    p.SetCoarsestLevel(10);
+    p.SetCycle(cycle);
+    p.SetSmootherPreIter(pre_iter);
+    p.SetSmootherPostIter(post_iter);
+    p.SetScaling(false);
+    p.SetOperatorFormat(format, format == BCSR ? argus.blockdim : 1);
+    p.InitMaxIter(1);
+    p.Verbose(0);
+
+    if(coarsening_strategy == "Greedy")
+    {
+        p.SetCoarseningStrategy(CoarseningStrategy::Greedy);
+    }
+    else if(coarsening_strategy == "PMIS")
+    {
+        p.SetCoarseningStrategy(CoarseningStrategy::PMIS);
+    }
+    else
+    {
+        return false;
+    }
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+    ls.SetPreconditioner(p);
+    ls.Init(1e-8, 0.0, 1e+8, 10000);
+
+    // Record the profile of the outer solver, including the AMG hierarchy
+    ls.EnableProfiling();
+
+    ls.Build();
+
+    // Matrix format
+    A.ConvertTo(format, format == BCSR ? argus.blockdim : 1);
+
+    ls.Solve(b, &x);
+
+    const SolverProfile& prof = ls.GetProfile();
+
+    bool success = true;
+
+    success &= (prof.GetCalls(ProfilePhase_Build) == 1);
+    success &= (prof.GetCalls(ProfilePhase_Solve) == 1);
+    success &= (prof.GetCalls(ProfilePhase_SpMV) > ls.GetIterationCount());
+    success &= (prof.GetCalls(ProfilePhase_Precond) >= ls.GetIterationCount());
+    success &= (prof.GetCalls(ProfilePhase_Reduction) > ls.GetIterationCount());
+    success &= (prof.GetCalls(ProfilePhase_HaloExchange) == 0);
+    success &= (prof.GetTime(ProfilePhase_Solve) >= prof.GetTime(ProfilePhase_Precond));
+
+    // Each level of the cycle smooths twice per restriction and prolongation
+    int levels = p.GetNumLevels();
+
+    success &= (prof.GetNumLevels() == levels);
+
+    for(int i = 0; i < levels - 1; ++i)
+    {
+        int64_t nrestrict = prof.GetLevelCalls(i, ProfileLevelPhase_Restrict);
+
+        success &= (nrestrict > 0);
+        success &= (prof.GetLevelCalls(i, ProfileLevelPhase_Prolong) == nrestrict);
+        success &= (prof.GetLevelCalls(i, ProfileLevelPhase_Smooth) == 2 * nrestrict);
+    }
+
+    success &= (prof.GetLevelCalls(levels - 1, ProfileLevelPhase_CoarseSolve) > 0);
+
+    // Dump the profile
+    std::string csv_file  = "rocalution_saamg_profile.csv";
+    std::string json_file = "rocalution_saamg_profile.json";
+
+    prof.WriteCSV(csv_file);
+    prof.WriteJSON(json_file);
+
+    std::ifstream csv(csv_file.c_str());
+    std::string   line;
+    int           nlines = 0;
+
+    while(std::getline(csv, line))
+    {
+        ++nlines;
+    }
+
+    csv.close();
+
+    success &= (nlines
+                == 1 + static_cast<int>(ProfilePhase_Count)
+                       + static_cast<int>(ProfileLevelPhase_Count) * levels);
+
+    std::remove(csv_file.c_str());
+    std::remove(json_file.c_str());
+
+    // Reset
+    ls.ResetProfile();
+
+    success &= (prof.GetCalls(ProfilePhase_Solve) == 0);
+    success &= (prof.GetNumLevels() == 0);
+
+    // Clean up
+    ls.Clear();
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_SAAMG_HPP
@@ -307,6 +307,27 @@ static bool is_any_env_var_set(const std::initializer_list<const char*>& vars,
     return false;
 }
 
+/* ============================================================================================ */
+/*! \brief  Path of a file in the temporary directory of the system */
+inline std::string temp_file_path(const std::string& name)
+{
+    for(const char* var : {"TMPDIR", "TMP", "TEMP"})
+    {
+        const char* dir = std::getenv(var);
+
+        if(dir && dir[0] != '\0')
+        {
+            return std::string(dir) + "/" + name;
+        }
+    }
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32)
+    return name;
+#else
+    return "/tmp/" + name;
+#endif
+}
+
 /* ============================================================================================ */
 
 /*! \brief Class used to parse command arguments in both client & gtest   */
@@ -25,7 +25,7 @@
 
 #include <vector>
 
-bool valid_permutation(int m, const int* permutation)
+inline bool valid_permutation(int m, const int* permutation)
 {
     std::vector<int> check(m, 0);
 
@@ -50,12 +50,12 @@ bool valid_permutation(int m, const int* permutation)
     return true;
 }
 
-bool valid_coloring(int        m,
-                    const int* csr_ptr,
-                    const int* csr_ind,
-                    int        num_colors,
-                    const int* size_colors,
-                    const int* permutation)
+inline bool valid_coloring(int        m,
+                           const int* csr_ptr,
+                           const int* csr_ind,
+                           int        num_colors,
+                           const int* size_colors,
+                           const int* permutation)
 {
     /*
     *   Create Inverse Permutation
@@ -106,3 +106,57 @@ bool valid_coloring(int        m,
 
     return true;
 }
+
+inline bool valid_independent_set(
+    int m, const int* csr_ptr, const int* csr_ind, int size, const int* permutation)
+{
+    // Nodes that are permuted to the first size positions form the set
+    std::vector<int> in_set(m, 0);
+    std::vector<int> covered(m, 0);
+
+    for(int i = 0; i < m; i++)
+    {
+        in_set[i] = (permutation[i] < size) ? 1 : 0;
+    }
+
+    for(int i = 0; i < m; i++)
+    {
+        for(int k = csr_ptr[i]; k < csr_ptr[i + 1]; k++)
+        {
+            const int j = csr_ind[k];
+
+            if(i == j)
+            {
+                continue;
+            }
+
+            // invalid set if adjacent nodes are both in the set
+            if(in_set[i] != 0 && in_set[j] != 0)
+            {
+                return false;
+            }
+
+            // nodes adjacent to the set
+            if(in_set[i] != 0)
+            {
+                covered[j] = 1;
+            }
+
+            if(in_set[j] != 0)
+            {
+                covered[i] = 1;
+            }
+        }
+    }
+
+    // the set is not maximal if a node could be added to it
+    for(int i = 0; i < m; i++)
+    {
+        if(in_set[i] == 0 && covered[i] == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
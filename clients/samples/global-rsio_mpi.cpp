@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <iostream>
+#include <mpi.h>
+#include <rocalution/rocalution.hpp>
+
+using namespace rocalution;
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2)
+    {
+        std::cerr << argv[0] << " <matrix> [rhs]" << std::endl;
+        exit(1);
+    }
+
+    // Initialize MPI
+    MPI_Init(&argc, &argv);
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    // Disable OpenMP thread affinity
+    set_omp_affinity_rocalution(false);
+
+    // Initialize platform with rank and # of accelerator devices in the node
+    init_rocalution(rank, 2);
+
+    // Disable OpenMP
+    set_omp_threads_rocalution(1);
+
+    // Print platform
+    info_rocalution();
+
+    // Parallel Manager
+    ParallelManager pm;
+
+    // Initialize Parallel Manager
+    pm.SetMPICommunicator(&comm);
+
+    // Each rank reads its rows from the global matrix file, the parallel manager
+    // is generated from the matrix
+    GlobalMatrix<double> mat;
+    mat.ReadFileRSIOCollective(std::string(argv[1]), &pm);
+
+    // Create global structures
+    GlobalVector<double> rhs(pm);
+    GlobalVector<double> x(pm);
+
+    // Move structures to accelerator, if available
+    mat.MoveToAccelerator();
+    rhs.MoveToAccelerator();
+    x.MoveToAccelerator();
+
+    // Read right-hand side, if available
+    if(argc > 2)
+    {
+        rhs.ReadFileBinaryCollective(std::string(argv[2]));
+        rhs.MoveToAccelerator();
+    }
+    else
+    {
+        rhs.Allocate("rhs", mat.GetM());
+        rhs.Ones();
+    }
+
+    x.Allocate("x", mat.GetN());
+    x.Zeros();
+
+    CG<GlobalMatrix<double>, GlobalVector<double>, double>          ls;
+    BlockJacobi<GlobalMatrix<double>, GlobalVector<double>, double> bj;
+    FSAI<LocalMatrix<double>, LocalVector<double>, double>          p;
+
+    bj.Set(p);
+
+    ls.SetPreconditioner(bj);
+    ls.SetOperator(mat);
+    ls.Build();
+    ls.Verbose(1);
+
+    mat.Info();
+
+    double time = rocalution_time();
+
+    ls.Solve(rhs, &x);
+
+    time = rocalution_time() - time;
+    if(rank == 0)
+    {
+        std::cout << "Solving: " << time / 1e6 << " sec" << std::endl;
+    }
+
+    ls.Clear();
+
+    stop_rocalution();
+
+    MPI_Finalize();
+
+    return 0;
+}
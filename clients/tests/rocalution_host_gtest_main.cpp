@@ -27,6 +27,10 @@
 #include <rocalution/rocalution.hpp>
 #include <stdexcept>
 
+#ifdef SUPPORT_MPI
+#include <mpi.h>
+#endif
+
 #define VAL(str) #str
 #define TOSTRING(str) VAL(str)
 
@@ -59,13 +63,28 @@ int main(int argc, char** argv)
         }
     }
 
+#ifdef SUPPORT_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
     rocalution::set_device_rocalution(device);
     rocalution::init_rocalution();
     rocalution::info_rocalution();
     rocalution::stop_rocalution();
 
     ::testing::InitGoogleTest(&argc, argv);
+#ifdef SUPPORT_MPI
+    // Re-executing the binary would initialize MPI a second time, fork instead
+    ::testing::FLAGS_gtest_death_test_style = "fast";
+#else
     ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+#endif
+
+    int status = RUN_ALL_TESTS();
+
+#ifdef SUPPORT_MPI
+    MPI_Finalize();
+#endif
 
-    return RUN_ALL_TESTS();
+    return status;
 }
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_amg_hierarchy.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef std::tuple<int, std::string, unsigned int, int> amg_hierarchy_tuple;
+
+std::vector<int>          amg_hierarchy_size           = {63};
+std::vector<std::string>  amg_hierarchy_amg            = {"SAAMG", "UAAMG", "RSAMG"};
+std::vector<unsigned int> amg_hierarchy_format         = {1, 7};
+std::vector<int>          amg_hierarchy_rebuildnumeric = {0, 1};
+
+class parameterized_amg_hierarchy : public testing::TestWithParam<amg_hierarchy_tuple>
+{
+protected:
+    parameterized_amg_hierarchy() {}
+    virtual ~parameterized_amg_hierarchy() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_amg_hierarchy_arguments(amg_hierarchy_tuple tup)
+{
+    Arguments arg;
+    arg.size           = std::get<0>(tup);
+    arg.precond        = std::get<1>(tup);
+    arg.format         = std::get<2>(tup);
+    arg.rebuildnumeric = std::get<3>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_amg_hierarchy, amg_hierarchy_float)
+{
+    Arguments arg = setup_amg_hierarchy_arguments(GetParam());
+    ASSERT_EQ(testing_amg_hierarchy<float>(arg), true);
+}
+
+TEST_P(parameterized_amg_hierarchy, amg_hierarchy_double)
+{
+    Arguments arg = setup_amg_hierarchy_arguments(GetParam());
+    ASSERT_EQ(testing_amg_hierarchy<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(amg_hierarchy,
+                        parameterized_amg_hierarchy,
+                        testing::Combine(testing::ValuesIn(amg_hierarchy_size),
+                                         testing::ValuesIn(amg_hierarchy_amg),
+                                         testing::ValuesIn(amg_hierarchy_format),
+                                         testing::ValuesIn(amg_hierarchy_rebuildnumeric)));
@@ -79,6 +79,35 @@ TEST(backend_init_order, backend)
     testing_backend_init_order();
 }
 
+TEST(backend_host_memory_pool, backend)
+{
+    if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                           "ROCALUTION_EMULATION_REGRESSION",
+                           "ROCALUTION_EMULATION_EXTENDED"}))
+    {
+        GTEST_SKIP();
+    }
+
+    testing_backend_host_memory_pool();
+}
+
+TEST(backend_numa, backend)
+{
+    if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                           "ROCALUTION_EMULATION_REGRESSION",
+                           "ROCALUTION_EMULATION_EXTENDED"}))
+    {
+        GTEST_SKIP();
+    }
+
+    testing_backend_numa();
+}
+
+TEST(backend_timer, backend)
+{
+    testing_backend_timer();
+}
+
 TEST_P(parameterized_backend, backend)
 {
     Arguments arg = setup_backend_arguments(GetParam());
@@ -106,8 +106,109 @@ TEST_P(parameterized_cg, cg_double)
     ASSERT_EQ(testing_cg<double>(arg), true);
 }
 
+TEST_P(parameterized_cg, pipecg_float)
+{
+    Arguments arg = setup_cg_arguments(GetParam());
+    ASSERT_EQ((testing_cg<float, PipeCG>(arg)), true);
+}
+
+TEST_P(parameterized_cg, pipecg_double)
+{
+    Arguments arg = setup_cg_arguments(GetParam());
+    ASSERT_EQ((testing_cg<double, PipeCG>(arg)), true);
+}
+
+TEST_P(parameterized_cg, cg_multi_float)
+{
+    Arguments arg = setup_cg_arguments(GetParam());
+    ASSERT_EQ(testing_cg_multi<float>(arg), true);
+}
+
+TEST_P(parameterized_cg, cg_multi_double)
+{
+    Arguments arg = setup_cg_arguments(GetParam());
+    ASSERT_EQ(testing_cg_multi<double>(arg), true);
+}
+
 INSTANTIATE_TEST_CASE_P(cg,
                         parameterized_cg,
                         testing::Combine(testing::ValuesIn(cg_size),
                                          testing::ValuesIn(cg_precond),
                                          testing::ValuesIn(cg_format)));
+
+typedef std::tuple<int, std::string> cg_rebuildnumeric_tuple;
+
+std::vector<std::string> cg_rebuildnumeric_precond
+    = {"FSAI", "SPAI", "ILU", "ILUT", "IC", "SAAMG", "RSAMG"};
+
+class parameterized_cg_rebuildnumeric : public testing::TestWithParam<cg_rebuildnumeric_tuple>
+{
+protected:
+    parameterized_cg_rebuildnumeric() {}
+    virtual ~parameterized_cg_rebuildnumeric() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_cg_rebuildnumeric_arguments(cg_rebuildnumeric_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.precond = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_cg_rebuildnumeric, cg_rebuildnumeric_float)
+{
+    Arguments arg = setup_cg_rebuildnumeric_arguments(GetParam());
+    ASSERT_EQ(testing_cg_rebuildnumeric<float>(arg), true);
+}
+
+TEST_P(parameterized_cg_rebuildnumeric, cg_rebuildnumeric_double)
+{
+    Arguments arg = setup_cg_rebuildnumeric_arguments(GetParam());
+    ASSERT_EQ(testing_cg_rebuildnumeric<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(cg_rebuildnumeric,
+                        parameterized_cg_rebuildnumeric,
+                        testing::Combine(testing::ValuesIn(cg_size),
+                                         testing::ValuesIn(cg_rebuildnumeric_precond)));
+
+typedef std::tuple<int, std::string> cg_multi_scaled_tuple;
+
+std::vector<std::string> cg_multi_scaled_precond = {"None", "Jacobi"};
+
+class parameterized_cg_multi_scaled : public testing::TestWithParam<cg_multi_scaled_tuple>
+{
+protected:
+    parameterized_cg_multi_scaled() {}
+    virtual ~parameterized_cg_multi_scaled() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_cg_multi_scaled_arguments(cg_multi_scaled_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.precond = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_cg_multi_scaled, cg_multi_scaled_float)
+{
+    Arguments arg = setup_cg_multi_scaled_arguments(GetParam());
+    ASSERT_EQ(testing_cg_multi_scaled<float>(arg), true);
+}
+
+TEST_P(parameterized_cg_multi_scaled, cg_multi_scaled_double)
+{
+    Arguments arg = setup_cg_multi_scaled_arguments(GetParam());
+    ASSERT_EQ(testing_cg_multi_scaled<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(cg_multi_scaled,
+                        parameterized_cg_multi_scaled,
+                        testing::Combine(testing::ValuesIn(cg_size),
+                                         testing::ValuesIn(cg_multi_scaled_precond)));
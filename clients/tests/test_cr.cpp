@@ -32,7 +32,7 @@ typedef std::tuple<int, std::string, unsigned int> cr_tuple;
 std::vector<int>         cr_size = {7, 63};
 std::vector<std::string> cr_precond
     = {"None", "Chebyshev", "FSAI", "Jacobi", "SGS", "ILU", "ItILU0", "IC", "MCSGS"};
-std::vector<unsigned int> cr_format = {2, 4, 7};
+std::vector<unsigned int> cr_format = {2, 4, 7, 8};
 
 // Function to update tests if environment variable is set
 void update_cr()
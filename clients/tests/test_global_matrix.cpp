@@ -25,6 +25,46 @@
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
+#include <vector>
+
+typedef std::tuple<int> global_matrix_read_rsio_collective_tuple;
+
+std::vector<int> global_matrix_read_rsio_collective_size = {7, 63};
+
+class parameterized_global_matrix_read_rsio_collective
+    : public testing::TestWithParam<global_matrix_read_rsio_collective_tuple>
+{
+protected:
+    parameterized_global_matrix_read_rsio_collective() {}
+    virtual ~parameterized_global_matrix_read_rsio_collective() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments
+    setup_global_matrix_read_rsio_collective_arguments(global_matrix_read_rsio_collective_tuple tup)
+{
+    Arguments arg;
+    arg.size = std::get<0>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_global_matrix_read_rsio_collective, global_matrix_read_rsio_collective_float)
+{
+    Arguments arg = setup_global_matrix_read_rsio_collective_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_read_rsio_collective<float>(arg), true);
+}
+
+TEST_P(parameterized_global_matrix_read_rsio_collective, global_matrix_read_rsio_collective_double)
+{
+    Arguments arg = setup_global_matrix_read_rsio_collective_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_read_rsio_collective<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    global_matrix_read_rsio_collective,
+    parameterized_global_matrix_read_rsio_collective,
+    testing::Combine(testing::ValuesIn(global_matrix_read_rsio_collective_size)));
 /*
 typedef std::tuple<int, int, int, int, bool, int, bool> backend_tuple;
 
@@ -25,6 +25,44 @@
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
+#include <vector>
+
+typedef std::tuple<int> global_vector_dot_async_tuple;
+
+std::vector<int> global_vector_dot_async_size = {7, 100};
+
+class parameterized_global_vector_dot_async
+    : public testing::TestWithParam<global_vector_dot_async_tuple>
+{
+protected:
+    parameterized_global_vector_dot_async() {}
+    virtual ~parameterized_global_vector_dot_async() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_global_vector_dot_async_arguments(global_vector_dot_async_tuple tup)
+{
+    Arguments arg;
+    arg.size = std::get<0>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_global_vector_dot_async, global_vector_dot_async_float)
+{
+    Arguments arg = setup_global_vector_dot_async_arguments(GetParam());
+    ASSERT_EQ(testing_global_vector_dot_async<float>(arg), true);
+}
+
+TEST_P(parameterized_global_vector_dot_async, global_vector_dot_async_double)
+{
+    Arguments arg = setup_global_vector_dot_async_arguments(GetParam());
+    ASSERT_EQ(testing_global_vector_dot_async<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(global_vector_dot_async,
+                        parameterized_global_vector_dot_async,
+                        testing::Combine(testing::ValuesIn(global_vector_dot_async_size)));
 /*
 typedef std::tuple<int, int, int, int, bool, int, bool> backend_tuple;
 
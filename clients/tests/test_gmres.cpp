@@ -135,6 +135,18 @@ TEST_P(parameterized_gmres, gmres_double)
     ASSERT_EQ(testing_gmres<double>(arg), true);
 }
 
+TEST_P(parameterized_gmres, gmres_multi_float)
+{
+    Arguments arg = setup_gmres_arguments(GetParam());
+    ASSERT_EQ(testing_gmres_multi<float>(arg), true);
+}
+
+TEST_P(parameterized_gmres, gmres_multi_double)
+{
+    Arguments arg = setup_gmres_arguments(GetParam());
+    ASSERT_EQ(testing_gmres_multi<double>(arg), true);
+}
+
 TEST_P(parameterized_gmres_bad_precond, gmres_float)
 {
     Arguments arg = setup_gmres_arguments(GetParam());
@@ -156,3 +168,43 @@ INSTANTIATE_TEST_CASE_P(gmres_bad_precond,
                                          testing::ValuesIn(gmres_bad_precond_matrix),
                                          testing::ValuesIn(gmres_bad_precond),
                                          testing::ValuesIn(gmres_format)));
+
+typedef std::tuple<int, int, std::string> gmres_multi_scaled_tuple;
+
+std::vector<std::string> gmres_multi_scaled_precond = {"None", "Jacobi"};
+
+class parameterized_gmres_multi_scaled : public testing::TestWithParam<gmres_multi_scaled_tuple>
+{
+protected:
+    parameterized_gmres_multi_scaled() {}
+    virtual ~parameterized_gmres_multi_scaled() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_gmres_multi_scaled_arguments(gmres_multi_scaled_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.index   = std::get<1>(tup);
+    arg.precond = std::get<2>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_gmres_multi_scaled, gmres_multi_scaled_float)
+{
+    Arguments arg = setup_gmres_multi_scaled_arguments(GetParam());
+    ASSERT_EQ(testing_gmres_multi_scaled<float>(arg), true);
+}
+
+TEST_P(parameterized_gmres_multi_scaled, gmres_multi_scaled_double)
+{
+    Arguments arg = setup_gmres_multi_scaled_arguments(GetParam());
+    ASSERT_EQ(testing_gmres_multi_scaled<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(gmres_multi_scaled,
+                        parameterized_gmres_multi_scaled,
+                        testing::Combine(testing::ValuesIn(gmres_size),
+                                         testing::ValuesIn(gmres_basis),
+                                         testing::ValuesIn(gmres_multi_scaled_precond)));
@@ -121,6 +121,687 @@ INSTANTIATE_TEST_CASE_P(local_matrix_conversions,
                                          testing::ValuesIn(local_matrix_conversions_blockdim),
                                          testing::ValuesIn(local_matrix_type)));
 
+typedef std::tuple<int, std::string> local_matrix_read_mtx_tuple;
+
+int local_matrix_read_mtx_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_read_mtx
+    : public testing::TestWithParam<local_matrix_read_mtx_tuple>
+{
+protected:
+    parameterized_local_matrix_read_mtx() {}
+    virtual ~parameterized_local_matrix_read_mtx() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_read_mtx_arguments(local_matrix_read_mtx_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_read_mtx, local_matrix_read_mtx_float)
+{
+    Arguments arg = setup_local_matrix_read_mtx_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_read_mtx<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_read_mtx, local_matrix_read_mtx_double)
+{
+    Arguments arg = setup_local_matrix_read_mtx_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_read_mtx<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_read_mtx,
+                        parameterized_local_matrix_read_mtx,
+                        testing::Combine(testing::ValuesIn(local_matrix_read_mtx_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_read_mtx_header_tuple;
+
+int local_matrix_read_mtx_header_size[] = {10, 17};
+
+class parameterized_local_matrix_read_mtx_header
+    : public testing::TestWithParam<local_matrix_read_mtx_header_tuple>
+{
+protected:
+    parameterized_local_matrix_read_mtx_header() {}
+    virtual ~parameterized_local_matrix_read_mtx_header() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_read_mtx_header_arguments(local_matrix_read_mtx_header_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_read_mtx_header, local_matrix_read_mtx_header_float)
+{
+    Arguments arg = setup_local_matrix_read_mtx_header_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_read_mtx_header<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_read_mtx_header, local_matrix_read_mtx_header_double)
+{
+    Arguments arg = setup_local_matrix_read_mtx_header_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_read_mtx_header<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_read_mtx_header,
+                        parameterized_local_matrix_read_mtx_header,
+                        testing::Combine(testing::ValuesIn(local_matrix_read_mtx_header_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_map_csr_tuple;
+
+int local_matrix_map_csr_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_map_csr
+    : public testing::TestWithParam<local_matrix_map_csr_tuple>
+{
+protected:
+    parameterized_local_matrix_map_csr() {}
+    virtual ~parameterized_local_matrix_map_csr() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_map_csr_arguments(local_matrix_map_csr_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_map_csr, local_matrix_map_csr_float)
+{
+    Arguments arg = setup_local_matrix_map_csr_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_map_csr<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_map_csr, local_matrix_map_csr_double)
+{
+    Arguments arg = setup_local_matrix_map_csr_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_map_csr<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_map_csr,
+                        parameterized_local_matrix_map_csr,
+                        testing::Combine(testing::ValuesIn(local_matrix_map_csr_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_rsio_compressed_tuple;
+
+int local_matrix_rsio_compressed_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_rsio_compressed
+    : public testing::TestWithParam<local_matrix_rsio_compressed_tuple>
+{
+protected:
+    parameterized_local_matrix_rsio_compressed() {}
+    virtual ~parameterized_local_matrix_rsio_compressed() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_rsio_compressed_arguments(local_matrix_rsio_compressed_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_rsio_compressed, local_matrix_rsio_compressed_float)
+{
+    Arguments arg = setup_local_matrix_rsio_compressed_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_rsio_compressed<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_rsio_compressed, local_matrix_rsio_compressed_double)
+{
+    Arguments arg = setup_local_matrix_rsio_compressed_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_rsio_compressed<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_rsio_compressed,
+                        parameterized_local_matrix_rsio_compressed,
+                        testing::Combine(testing::ValuesIn(local_matrix_rsio_compressed_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_rsio_compressed_blocks_tuple;
+
+int         local_matrix_rsio_compressed_blocks_size[]   = {128, 256};
+std::string local_matrix_rsio_compressed_blocks_values[] = {"Laplacian2D", "RandomBits"};
+
+class parameterized_local_matrix_rsio_compressed_blocks
+    : public testing::TestWithParam<local_matrix_rsio_compressed_blocks_tuple>
+{
+protected:
+    parameterized_local_matrix_rsio_compressed_blocks() {}
+    virtual ~parameterized_local_matrix_rsio_compressed_blocks() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments
+    setup_local_matrix_rsio_compressed_blocks_arguments(local_matrix_rsio_compressed_blocks_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_rsio_compressed_blocks,
+       local_matrix_rsio_compressed_blocks_float)
+{
+    Arguments arg = setup_local_matrix_rsio_compressed_blocks_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_rsio_compressed_blocks<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_rsio_compressed_blocks,
+       local_matrix_rsio_compressed_blocks_double)
+{
+    Arguments arg = setup_local_matrix_rsio_compressed_blocks_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_rsio_compressed_blocks<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    local_matrix_rsio_compressed_blocks,
+    parameterized_local_matrix_rsio_compressed_blocks,
+    testing::Combine(testing::ValuesIn(local_matrix_rsio_compressed_blocks_size),
+                     testing::ValuesIn(local_matrix_rsio_compressed_blocks_values)));
+
+typedef std::tuple<int, std::string> local_matrix_assembler_tuple;
+
+int local_matrix_assembler_size[] = {10, 17, 64};
+
+class parameterized_local_matrix_assembler
+    : public testing::TestWithParam<local_matrix_assembler_tuple>
+{
+protected:
+    parameterized_local_matrix_assembler() {}
+    virtual ~parameterized_local_matrix_assembler() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_assembler_arguments(local_matrix_assembler_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_assembler, local_matrix_assembler_float)
+{
+    Arguments arg = setup_local_matrix_assembler_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_assembler<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_assembler, local_matrix_assembler_double)
+{
+    Arguments arg = setup_local_matrix_assembler_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_assembler<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_assembler,
+                        parameterized_local_matrix_assembler,
+                        testing::Combine(testing::ValuesIn(local_matrix_assembler_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_autoformat_tuple;
+
+int local_matrix_autoformat_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_autoformat
+    : public testing::TestWithParam<local_matrix_autoformat_tuple>
+{
+protected:
+    parameterized_local_matrix_autoformat() {}
+    virtual ~parameterized_local_matrix_autoformat() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_autoformat_arguments(local_matrix_autoformat_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_autoformat, local_matrix_autoformat_float)
+{
+    Arguments arg = setup_local_matrix_autoformat_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_autoformat<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_autoformat, local_matrix_autoformat_double)
+{
+    Arguments arg = setup_local_matrix_autoformat_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_autoformat<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_autoformat,
+                        parameterized_local_matrix_autoformat,
+                        testing::Combine(testing::ValuesIn(local_matrix_autoformat_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, int, std::string> local_matrix_bcsr_detection_tuple;
+
+int         local_matrix_bcsr_detection_size[]     = {10, 17, 21};
+int         local_matrix_bcsr_detection_blockdim[] = {4, 7, 11};
+
+class parameterized_local_matrix_bcsr_detection
+    : public testing::TestWithParam<local_matrix_bcsr_detection_tuple>
+{
+protected:
+    parameterized_local_matrix_bcsr_detection() {}
+    virtual ~parameterized_local_matrix_bcsr_detection() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_bcsr_detection_arguments(local_matrix_bcsr_detection_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.blockdim    = std::get<1>(tup);
+    arg.matrix_type = std::get<2>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_bcsr_detection, local_matrix_bcsr_detection_float)
+{
+    Arguments arg = setup_local_matrix_bcsr_detection_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_bcsr_detection<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_bcsr_detection, local_matrix_bcsr_detection_double)
+{
+    Arguments arg = setup_local_matrix_bcsr_detection_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_bcsr_detection<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_bcsr_detection,
+                        parameterized_local_matrix_bcsr_detection,
+                        testing::Combine(testing::ValuesIn(local_matrix_bcsr_detection_size),
+                                         testing::ValuesIn(local_matrix_bcsr_detection_blockdim),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_coo_apply_tuple;
+
+int local_matrix_coo_apply_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_coo_apply
+    : public testing::TestWithParam<local_matrix_coo_apply_tuple>
+{
+protected:
+    parameterized_local_matrix_coo_apply() {}
+    virtual ~parameterized_local_matrix_coo_apply() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_coo_apply_arguments(local_matrix_coo_apply_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_coo_apply, local_matrix_coo_apply_float)
+{
+    Arguments arg = setup_local_matrix_coo_apply_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_coo_apply<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_coo_apply, local_matrix_coo_apply_double)
+{
+    Arguments arg = setup_local_matrix_coo_apply_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_coo_apply<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_coo_apply,
+                        parameterized_local_matrix_coo_apply,
+                        testing::Combine(testing::ValuesIn(local_matrix_coo_apply_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_sell_apply_tuple;
+
+// Sizes with partially filled last slices and, for Laplacian2D, more than one sorting window
+int local_matrix_sell_apply_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_sell_apply
+    : public testing::TestWithParam<local_matrix_sell_apply_tuple>
+{
+protected:
+    parameterized_local_matrix_sell_apply() {}
+    virtual ~parameterized_local_matrix_sell_apply() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_sell_apply_arguments(local_matrix_sell_apply_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_sell_apply, local_matrix_sell_apply_float)
+{
+    Arguments arg = setup_local_matrix_sell_apply_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_sell_apply<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_sell_apply, local_matrix_sell_apply_double)
+{
+    Arguments arg = setup_local_matrix_sell_apply_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_sell_apply<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_sell_apply,
+                        parameterized_local_matrix_sell_apply,
+                        testing::Combine(testing::ValuesIn(local_matrix_sell_apply_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int> local_matrix_long_rows_tuple;
+
+int local_matrix_long_rows_size[] = {8, 100, 1000};
+
+class parameterized_local_matrix_long_rows
+    : public testing::TestWithParam<local_matrix_long_rows_tuple>
+{
+protected:
+    parameterized_local_matrix_long_rows() {}
+    virtual ~parameterized_local_matrix_long_rows() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_long_rows_arguments(local_matrix_long_rows_tuple tup)
+{
+    Arguments arg;
+    arg.size = std::get<0>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_long_rows, local_matrix_long_rows_float)
+{
+    Arguments arg = setup_local_matrix_long_rows_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_long_rows<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_long_rows, local_matrix_long_rows_double)
+{
+    Arguments arg = setup_local_matrix_long_rows_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_long_rows<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_long_rows,
+                        parameterized_local_matrix_long_rows,
+                        testing::Combine(testing::ValuesIn(local_matrix_long_rows_size)));
+
+typedef std::tuple<int, std::string> local_matrix_residual_tuple;
+
+int local_matrix_residual_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_residual
+    : public testing::TestWithParam<local_matrix_residual_tuple>
+{
+protected:
+    parameterized_local_matrix_residual() {}
+    virtual ~parameterized_local_matrix_residual() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_residual_arguments(local_matrix_residual_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_residual, local_matrix_residual_float)
+{
+    Arguments arg = setup_local_matrix_residual_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_residual<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_residual, local_matrix_residual_double)
+{
+    Arguments arg = setup_local_matrix_residual_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_residual<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_residual,
+                        parameterized_local_matrix_residual,
+                        testing::Combine(testing::ValuesIn(local_matrix_residual_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_triple_product_tuple;
+
+int local_matrix_triple_product_size[] = {10, 17, 21};
+
+class parameterized_local_matrix_triple_product
+    : public testing::TestWithParam<local_matrix_triple_product_tuple>
+{
+protected:
+    parameterized_local_matrix_triple_product() {}
+    virtual ~parameterized_local_matrix_triple_product() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_triple_product_arguments(local_matrix_triple_product_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_triple_product, local_matrix_triple_product_float)
+{
+    Arguments arg = setup_local_matrix_triple_product_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_triple_product<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_triple_product, local_matrix_triple_product_double)
+{
+    Arguments arg = setup_local_matrix_triple_product_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_triple_product<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_triple_product,
+                        parameterized_local_matrix_triple_product,
+                        testing::Combine(testing::ValuesIn(local_matrix_triple_product_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+typedef std::tuple<int, std::string> local_matrix_reordering_tuple;
+
+// Levels of the larger grid are wider than 256 vertices and searched in parallel
+int         local_matrix_reordering_size[] = {10, 21, 300};
+std::string local_matrix_reordering_type[] = {"Laplacian2D", "PermutedIdentity"};
+
+class parameterized_local_matrix_reordering
+    : public testing::TestWithParam<local_matrix_reordering_tuple>
+{
+protected:
+    parameterized_local_matrix_reordering() {}
+    virtual ~parameterized_local_matrix_reordering() {}
+    virtual void SetUp() override
+    {
+        if(is_any_env_var_set({"ROCALUTION_EMULATION_SMOKE",
+                               "ROCALUTION_EMULATION_REGRESSION",
+                               "ROCALUTION_EMULATION_EXTENDED"}))
+        {
+            GTEST_SKIP();
+        }
+    }
+
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_reordering_arguments(local_matrix_reordering_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_matrix_reordering, local_matrix_reordering_float)
+{
+    Arguments arg = setup_local_matrix_reordering_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_reordering<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_reordering, local_matrix_reordering_double)
+{
+    Arguments arg = setup_local_matrix_reordering_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_reordering<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_reordering,
+                        parameterized_local_matrix_reordering,
+                        testing::Combine(testing::ValuesIn(local_matrix_reordering_size),
+                                         testing::ValuesIn(local_matrix_reordering_type)));
+
 TEST_P(parameterized_local_matrix_allocations, local_matrix_allocations_float)
 {
     Arguments arg = setup_local_matrix_allocations_arguments(GetParam());
@@ -30,6 +30,7 @@ typedef std::tuple<int, unsigned int>       local_matrix_gen_solve_tuple;
 typedef std::tuple<int, unsigned int, bool> local_matrix_tri_solve_tuple;
 
 static const int          local_matrix_solve_size[]      = {10, 17, 21};
+static const int          local_matrix_tri_solve_size[]  = {10, 17, 21, 300};
 static const unsigned int local_matrix_solve_format[]    = {1};
 static const bool         local_matrix_solve_unit_diag[] = {false, true};
 
@@ -181,17 +182,17 @@ INSTANTIATE_TEST_CASE_P(local_matrix_solve,
 
 INSTANTIATE_TEST_CASE_P(local_matrix_solve,
                         parameterized_local_matrix_llsolve,
-                        testing::Combine(testing::ValuesIn(local_matrix_solve_size),
+                        testing::Combine(testing::ValuesIn(local_matrix_tri_solve_size),
                                          testing::ValuesIn(local_matrix_solve_format)));
 
 INSTANTIATE_TEST_CASE_P(local_matrix_solve,
                         parameterized_local_matrix_lsolve,
-                        testing::Combine(testing::ValuesIn(local_matrix_solve_size),
+                        testing::Combine(testing::ValuesIn(local_matrix_tri_solve_size),
                                          testing::ValuesIn(local_matrix_solve_format),
                                          testing::ValuesIn(local_matrix_solve_unit_diag)));
 
 INSTANTIATE_TEST_CASE_P(local_matrix_solve,
                         parameterized_local_matrix_usolve,
-                        testing::Combine(testing::ValuesIn(local_matrix_solve_size),
+                        testing::Combine(testing::ValuesIn(local_matrix_tri_solve_size),
                                          testing::ValuesIn(local_matrix_solve_format),
                                          testing::ValuesIn(local_matrix_solve_unit_diag)));
@@ -25,6 +25,7 @@
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
+#include <vector>
 /*
 typedef std::tuple<int, int, int, int, bool, int, bool> backend_tuple;
 
@@ -69,6 +70,46 @@ TEST(local_vector_bad_args, local_vector)
 
     testing_local_vector_bad_args<float>();
 }
+
+typedef std::tuple<int, int> local_vector_add_scale_norm_tuple;
+
+std::vector<int> local_vector_add_scale_norm_size    = {1, 1000, 300000};
+std::vector<int> local_vector_add_scale_norm_use_acc = {0, 1};
+
+class parameterized_local_vector_add_scale_norm
+    : public testing::TestWithParam<local_vector_add_scale_norm_tuple>
+{
+protected:
+    parameterized_local_vector_add_scale_norm() {}
+    virtual ~parameterized_local_vector_add_scale_norm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_vector_add_scale_norm_arguments(local_vector_add_scale_norm_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.use_acc = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_local_vector_add_scale_norm, local_vector_add_scale_norm_float)
+{
+    Arguments arg = setup_local_vector_add_scale_norm_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_add_scale_norm<float>(arg), true);
+}
+
+TEST_P(parameterized_local_vector_add_scale_norm, local_vector_add_scale_norm_double)
+{
+    Arguments arg = setup_local_vector_add_scale_norm_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_add_scale_norm<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_vector_add_scale_norm,
+                        parameterized_local_vector_add_scale_norm,
+                        testing::Combine(testing::ValuesIn(local_vector_add_scale_norm_size),
+                                         testing::ValuesIn(local_vector_add_scale_norm_use_acc)));
 /*
 TEST_P(parameterized_backend, backend)
 {
@@ -27,10 +27,12 @@
 #include <gtest/gtest.h>
 #include <vector>
 
-typedef std::tuple<int, std::string, unsigned int, int, int, int, int, int> rsamg_tuple;
+typedef std::tuple<int, std::string, std::string, unsigned int, int, int, int, int, int>
+    rsamg_tuple;
 
 std::vector<int>          rsamg_size           = {63, 134};
 std::vector<std::string>  rsamg_smoother       = {"Jacobi"};
+std::vector<std::string>  rsamg_coarsening     = {"Greedy", "PMIS", "HMIS"};
 std::vector<unsigned int> rsamg_format         = {1, 7};
 std::vector<int>          rsamg_pre_iter       = {1, 2};
 std::vector<int>          rsamg_post_iter      = {1, 2};
@@ -47,6 +49,7 @@ void update_rsamg()
     {
         rsamg_size.clear();
         rsamg_smoother.clear();
+        rsamg_coarsening.clear();
         rsamg_format.clear();
         rsamg_pre_iter.clear();
         rsamg_post_iter.clear();
@@ -59,6 +62,7 @@ void update_rsamg()
     {
         rsamg_size.push_back(63);
         rsamg_smoother.push_back("Jacobi");
+        rsamg_coarsening.push_back("PMIS");
         rsamg_format.push_back(3);
         rsamg_pre_iter.push_back(1);
         rsamg_post_iter.push_back(1);
@@ -70,6 +74,7 @@ void update_rsamg()
     {
         rsamg_size.push_back(134);
         rsamg_smoother.push_back("Jacobi");
+        rsamg_coarsening.insert(rsamg_coarsening.end(), {"PMIS", "HMIS"});
         rsamg_format.push_back(1);
         rsamg_pre_iter.push_back(2);
         rsamg_post_iter.push_back(2);
@@ -81,6 +86,7 @@ void update_rsamg()
     {
         rsamg_size.push_back(134);
         rsamg_smoother.push_back("Jacobi");
+        rsamg_coarsening.insert(rsamg_coarsening.end(), {"Greedy", "PMIS", "HMIS"});
         rsamg_format.push_back(7);
         rsamg_pre_iter.push_back(1);
         rsamg_post_iter.push_back(2);
@@ -113,14 +119,15 @@ protected:
 Arguments setup_rsamg_arguments(rsamg_tuple tup)
 {
     Arguments arg;
-    arg.size           = std::get<0>(tup);
-    arg.smoother       = std::get<1>(tup);
-    arg.format         = std::get<2>(tup);
-    arg.pre_smooth     = std::get<3>(tup);
-    arg.post_smooth    = std::get<4>(tup);
-    arg.cycle          = std::get<5>(tup);
-    arg.ordering       = std::get<6>(tup);
-    arg.rebuildnumeric = std::get<7>(tup);
+    arg.size                = std::get<0>(tup);
+    arg.smoother            = std::get<1>(tup);
+    arg.coarsening_strategy = std::get<2>(tup);
+    arg.format              = std::get<3>(tup);
+    arg.pre_smooth          = std::get<4>(tup);
+    arg.post_smooth         = std::get<5>(tup);
+    arg.cycle               = std::get<6>(tup);
+    arg.ordering            = std::get<7>(tup);
+    arg.rebuildnumeric      = std::get<8>(tup);
     return arg;
 }
 
@@ -140,6 +147,7 @@ INSTANTIATE_TEST_CASE_P(ruge_stueben_amg,
                         parameterized_ruge_stueben_amg,
                         testing::Combine(testing::ValuesIn(rsamg_size),
                                          testing::ValuesIn(rsamg_smoother),
+                                         testing::ValuesIn(rsamg_coarsening),
                                          testing::ValuesIn(rsamg_format),
                                          testing::ValuesIn(rsamg_pre_iter),
                                          testing::ValuesIn(rsamg_post_iter),
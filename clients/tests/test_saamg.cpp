@@ -147,6 +147,30 @@ TEST_P(parameterized_saamg, saamg_double)
     ASSERT_EQ(testing_saamg<double>(arg), true);
 }
 
+TEST_P(parameterized_saamg, saamg_multi_float)
+{
+    Arguments arg = setup_saamg_arguments(GetParam());
+    ASSERT_EQ(testing_saamg_multi<float>(arg), true);
+}
+
+TEST_P(parameterized_saamg, saamg_multi_double)
+{
+    Arguments arg = setup_saamg_arguments(GetParam());
+    ASSERT_EQ(testing_saamg_multi<double>(arg), true);
+}
+
+TEST_P(parameterized_saamg, saamg_profile_float)
+{
+    Arguments arg = setup_saamg_arguments(GetParam());
+    ASSERT_EQ(testing_saamg_profile<float>(arg), true);
+}
+
+TEST_P(parameterized_saamg, saamg_profile_double)
+{
+    Arguments arg = setup_saamg_arguments(GetParam());
+    ASSERT_EQ(testing_saamg_profile<double>(arg), true);
+}
+
 INSTANTIATE_TEST_CASE_P(saamg,
                         parameterized_saamg,
                         testing::Combine(testing::ValuesIn(saamg_size),
@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "backend_manager.hpp"
+#include "../utils/allocate_free.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "base_matrix.hpp"
@@ -36,6 +37,7 @@
 #include "host/host_matrix_ell.hpp"
 #include "host/host_matrix_hyb.hpp"
 #include "host/host_matrix_mcsr.hpp"
+#include "host/host_matrix_sell.hpp"
 #include "host/host_vector.hpp"
 #include "rocalution/version.hpp"
 
@@ -75,7 +77,10 @@ namespace rocalution
         -1, // pre-init OpenMP threads
         0, // pre-init OpenMP threads
         true, // host affinity (active)
+        false, // host NUMA mode (inactive)
         10000, // threshold size
+        false, // host parallel coloring (inactive)
+        false, // host parallel ordering (inactive)
         // HIP section
         NULL, // *HIP_blas_handle
         NULL, // *HIP_sparse_handle
@@ -170,7 +175,14 @@ namespace rocalution
         omp_set_nested(0);
 #endif
 
-        rocalution_set_omp_affinity(_get_backend_descriptor()->OpenMP_affinity);
+        if(_get_backend_descriptor()->OpenMP_numa == true)
+        {
+            rocalution_set_omp_numa_affinity();
+        }
+        else
+        {
+            rocalution_set_omp_affinity(_get_backend_descriptor()->OpenMP_affinity);
+        }
 #else
         _get_backend_descriptor()->OpenMP_threads = 1;
 #endif
@@ -221,6 +233,9 @@ namespace rocalution
 
         _rocalution_delete_all_obj();
 
+        // Release the cached buffers of the host memory pool
+        trim_host_memory_pool();
+
 #ifdef SUPPORT_HIP
         if(_get_backend_descriptor()->disable_accelerator == false)
         {
@@ -263,7 +278,14 @@ namespace rocalution
 
 #if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__)
 
-        rocalution_set_omp_affinity(_get_backend_descriptor()->OpenMP_affinity);
+        if(_get_backend_descriptor()->OpenMP_numa == true)
+        {
+            rocalution_set_omp_numa_affinity();
+        }
+        else
+        {
+            rocalution_set_omp_affinity(_get_backend_descriptor()->OpenMP_affinity);
+        }
 
 #endif // linux
 
@@ -334,6 +356,11 @@ namespace rocalution
 
 #ifdef _OPENMP
         LOG_INFO("OpenMP threads: " << backend_descriptor.OpenMP_threads);
+
+        if(backend_descriptor.OpenMP_numa == true)
+        {
+            rocalution_info_omp_numa();
+        }
 #else
         LOG_INFO("No OpenMP support");
 #endif
@@ -394,6 +421,13 @@ namespace rocalution
         _get_backend_descriptor()->OpenMP_affinity = affinity;
     }
 
+    void set_omp_numa_rocalution(bool numa)
+    {
+        assert(_get_backend_descriptor()->init == false);
+
+        _get_backend_descriptor()->OpenMP_numa = numa;
+    }
+
     void set_omp_threshold_rocalution(int threshold)
     {
         assert(_get_backend_descriptor()->init == true);
@@ -401,6 +435,16 @@ namespace rocalution
         _get_backend_descriptor()->OpenMP_threshold = threshold;
     }
 
+    void set_omp_parallel_coloring_rocalution(bool parallel)
+    {
+        _get_backend_descriptor()->OpenMP_parallel_coloring = parallel;
+    }
+
+    void set_omp_parallel_ordering_rocalution(bool parallel)
+    {
+        _get_backend_descriptor()->OpenMP_parallel_ordering = parallel;
+    }
+
     bool _rocalution_available_accelerator(void)
     {
         return _get_backend_descriptor()->accelerator;
@@ -512,6 +556,8 @@ namespace rocalution
             return new HostMatrixMCSR<ValueType>(backend_descriptor);
         case BCSR:
             return new HostMatrixBCSR<ValueType>(backend_descriptor, blockdim);
+        case SELL:
+            return new HostMatrixSELL<ValueType>(backend_descriptor);
         default:
             return NULL;
         }
@@ -69,8 +69,14 @@ namespace rocalution
         int OpenMP_def_nested;
         /** \brief Host affinity (true-yes/false-no) */
         bool OpenMP_affinity;
+        /** \brief Host NUMA mode (true-yes/false-no) */
+        bool OpenMP_numa;
         /** \brief Host threshold size */
         int64_t OpenMP_threshold;
+        /** \brief Host parallel coloring and independent sets (true-yes/false-no) */
+        bool OpenMP_parallel_coloring;
+        /** \brief Host parallel Cuthill-McKee ordering (true-yes/false-no) */
+        bool OpenMP_parallel_ordering;
 
         // HIP handle section
         /** \brief rocblas_handle casted in void ** */
@@ -230,6 +236,29 @@ namespace rocalution
     ROCALUTION_EXPORT
     void set_omp_affinity_rocalution(bool affinity);
 
+    /** \ingroup backend_module
+  * \brief Enable/disable OpenMP host NUMA mode
+  * \details
+  * \p set_omp_numa_rocalution enables / disables the NUMA mode of the OpenMP host
+  * backend. In NUMA mode, each OpenMP thread is pinned to a single core. The threads are
+  * distributed in contiguous blocks over the NUMA nodes (sockets), i.e. the first block
+  * of threads is placed on the first NUMA node, the second block on the second node and
+  * so on. Host vector and matrix arrays are first touched in parallel by allocate_host(),
+  * with the same static partition that is used by the host kernels, such that each
+  * thread mostly accesses memory of its own NUMA node. The resulting placement is
+  * reported by info_rocalution().
+  *
+  * \note
+  * The NUMA mode is available only for Linux. It has to be set before initializing the
+  * library (i.e. before init_rocalution()) and replaces the affinity of
+  * set_omp_affinity_rocalution().
+  *
+  * @param[in]
+  * numa    boolean to turn on/off OpenMP host NUMA mode
+  */
+    ROCALUTION_EXPORT
+    void set_omp_numa_rocalution(bool numa);
+
     /** \ingroup backend_module
   * \brief Set OpenMP threshold size
   * \details
@@ -248,6 +277,43 @@ namespace rocalution
     ROCALUTION_EXPORT
     void set_omp_threshold_rocalution(int threshold);
 
+    /** \ingroup backend_module
+  * \brief Enable/disable parallel graph coloring on the host
+  * \details
+  * \p set_omp_parallel_coloring_rocalution selects the algorithms of the host
+  * LocalMatrix::MultiColoring() and LocalMatrix::MaximalIndependentSet(), which are
+  * used by the multi-colored and multi-elimination preconditioners. By default, the
+  * sequential greedy algorithms are used, which process the vertices in their natural
+  * order. Enabling selects the parallel Jones-Plassmann coloring and Luby independent
+  * set. Both process the vertices in an order given by a fixed hash of their indices,
+  * such that the result is independent of the number of OpenMP threads, but typically
+  * require more colors, e.g. 6 instead of 2 for a 7-point Laplacian. More colors
+  * weaken multi-colored preconditioners.
+  *
+  * @param[in]
+  * parallel    boolean to turn on/off the parallel algorithms
+  */
+    ROCALUTION_EXPORT
+    void set_omp_parallel_coloring_rocalution(bool parallel);
+
+    /** \ingroup backend_module
+  * \brief Enable/disable parallel Cuthill-McKee ordering on the host
+  * \details
+  * \p set_omp_parallel_ordering_rocalution selects the algorithm of the host
+  * LocalMatrix::CMK() and LocalMatrix::RCMK(). By default, the sequential
+  * breadth-first search is used, which starts from the first neighbor of the first
+  * row. Enabling selects a level synchronous breadth-first search on the symmetrized
+  * sparsity pattern, starting each connected component from a pseudo-peripheral node.
+  * Wide levels are processed in parallel and the result is independent of the number
+  * of OpenMP threads. It typically reduces the bandwidth further, but the search for
+  * the starting nodes makes it several times more expensive on a single thread.
+  *
+  * @param[in]
+  * parallel    boolean to turn on/off the parallel algorithm
+  */
+    ROCALUTION_EXPORT
+    void set_omp_parallel_ordering_rocalution(bool parallel);
+
     /** \ingroup backend_module
   * \brief Print info about rocALUTION
   * \details
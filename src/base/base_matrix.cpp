@@ -249,6 +249,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::MapFileCSR(const std::string& filename)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::WriteFileCSR(const std::string& filename) const
     {
@@ -267,6 +273,13 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::WriteFileRSIOCompressed(const std::string& filename,
+                                                        bool               compress_val) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::ExtractDiagonal(BaseVector<ValueType>* vec_diag) const
     {
@@ -434,6 +447,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::LocalityOrder(BaseVector<int>* permutation, int window) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::MultiColoring(int&             num_colors,
                                               int**            size_colors,
@@ -498,6 +517,31 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyMulti(const BaseVector<ValueType>& in,
+                                           int                          num_vec,
+                                           BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::Residual(const BaseVector<ValueType>& rhs,
+                                         const BaseVector<ValueType>& x,
+                                         BaseVector<ValueType>*       res) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ResidualRestrict(const BaseVector<ValueType>& rhs,
+                                                 const BaseVector<ValueType>& x,
+                                                 const BaseMatrix<ValueType>& restrict_mat,
+                                                 BaseVector<ValueType>*       res_coarse) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Scale(ValueType alpha)
     {
@@ -722,6 +766,22 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::SymbolicTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                            const BaseMatrix<ValueType>& A,
+                                                            const BaseMatrix<ValueType>& P)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::NumericTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                           const BaseMatrix<ValueType>& A,
+                                                           const BaseMatrix<ValueType>& P)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::AMGConnect(ValueType eps, BaseVector<int>* connections) const
     {
@@ -993,6 +1053,13 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::RSHMISFirstPass(BaseVector<int>*        CFmap,
+                                                const BaseVector<bool>& S) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::RSDirectProlongNnz(const BaseVector<int>&       CFmap,
                                                    const BaseVector<bool>&      S,
@@ -1250,6 +1317,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::SparsityInfo(MatrixSparsityInfo* info) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     void BaseMatrix<ValueType>::SetDataPtrCOO(
         int** row, int** col, ValueType** val, int64_t nnz, int nrow, int ncol)
@@ -56,6 +56,8 @@ namespace rocalution
     class HostMatrixMCSR;
     template <typename ValueType>
     class HostMatrixBCSR;
+    template <typename ValueType>
+    class HostMatrixSELL;
 
     template <typename ValueType>
     class HIPAcceleratorMatrixCSR;
@@ -214,6 +216,8 @@ namespace rocalution
         virtual bool RCMK(BaseVector<int>* permutation) const;
         /** \brief Create permutation vector for connectivity reordering of the matrix (increasing nnz per row) */
         virtual bool ConnectivityOrder(BaseVector<int>* permutation) const;
+        /** \brief Create permutation vector for a cache-oriented (Gorder) reordering of the matrix */
+        virtual bool LocalityOrder(BaseVector<int>* permutation, int window) const;
 
         /** \brief Perform multi-coloring decomposition of the matrix; Returns number of
         * colors, the corresponding sizes (the array is allocated in the function)
@@ -279,6 +283,8 @@ namespace rocalution
 
         /** \brief Read matrix from CSR (ROCALUTION binary format) file */
         virtual bool ReadFileCSR(const std::string& filename);
+        /** \brief Map matrix from CSR (ROCALUTION binary format) file */
+        virtual bool MapFileCSR(const std::string& filename);
         /** \brief Write matrix to CSR (ROCALUTION binary format) file */
         virtual bool WriteFileCSR(const std::string& filename) const;
 
@@ -286,6 +292,8 @@ namespace rocalution
         virtual bool ReadFileRSIO(const std::string& filename);
         /** \brief Write matrix to rocsparse I/O file */
         virtual bool WriteFileRSIO(const std::string& filename) const;
+        /** \brief Write matrix to compressed rocsparse I/O file */
+        virtual bool WriteFileRSIOCompressed(const std::string& filename, bool compress_val) const;
 
         /** \brief Perform symbolic computation (structure only) of |this|^p */
         virtual bool SymbolicPower(int p);
@@ -303,6 +311,17 @@ namespace rocalution
         * this = A*B */
         virtual bool NumericMatMatMult(const BaseMatrix<ValueType>& A,
                                        const BaseMatrix<ValueType>& B);
+        /** \brief Perform symbolic triple matrix product (i.e. determine the structure),
+        * this = R*A*P */
+        virtual bool SymbolicTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                 const BaseMatrix<ValueType>& A,
+                                                 const BaseMatrix<ValueType>& P);
+        /** \brief Perform numerical triple matrix product (i.e. value computation) on the
+        * structure of this, this = R*A*P; returns false, if the structure does not contain
+        * all entries of the product */
+        virtual bool NumericTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                const BaseMatrix<ValueType>& A,
+                                                const BaseMatrix<ValueType>& P);
         /** \brief Multiply the matrix with diagonal matrix (stored in LocalVector),
         * this=this*diag (right multiplication) */
         virtual bool DiagonalMatrixMultR(const BaseVector<ValueType>& diag);
@@ -452,6 +471,23 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const = 0;
+        /** \brief Apply the matrix to \p num_vec column-major vectors at once, out_j = this*in_j;
+        * returns false if the format does not provide a multi-vector product */
+        virtual bool ApplyMulti(const BaseVector<ValueType>& in,
+                                int                          num_vec,
+                                BaseVector<ValueType>*       out) const;
+        /** \brief Compute the residual res = rhs - this*x in a single pass; returns false if
+        * the format does not provide a fused residual */
+        virtual bool Residual(const BaseVector<ValueType>& rhs,
+                              const BaseVector<ValueType>& x,
+                              BaseVector<ValueType>*       res) const;
+        /** \brief Compute the restricted residual res_coarse = restrict_mat*(rhs - this*x)
+        * without storing the fine residual; returns false if not supported for this
+        * combination of formats and structures */
+        virtual bool ResidualRestrict(const BaseVector<ValueType>& rhs,
+                                      const BaseVector<ValueType>& x,
+                                      const BaseMatrix<ValueType>& restrict_mat,
+                                      BaseVector<ValueType>*       res_coarse) const;
 
         /** \brief Delete all entries abs(a_ij) <= drop_off;
         * the diagonal elements are never deleted */
@@ -468,6 +504,9 @@ namespace rocalution
         /** \brief Return key for row, col and val */
         virtual bool Key(long int& row_key, long int& col_key, long int& val_key) const;
 
+        /** \brief Compute sparsity statistics of the matrix */
+        virtual bool SparsityInfo(MatrixSparsityInfo* info) const;
+
         /** \brief Replace a column vector of a matrix */
         virtual bool ReplaceColumnVector(int idx, const BaseVector<ValueType>& vec);
 
@@ -661,6 +700,11 @@ namespace rocalution
                                              const BaseMatrix<ValueType>& ghost) const;
         virtual bool RSPMISCheckUndecided(bool& undecided, const BaseVector<int>& CFmap) const;
 
+        /** \brief First pass of HMIS coarsening, marks the coarse vertices of a
+          * classical Ruge Stueben splitting of fixed size blocks of rows
+          */
+        virtual bool RSHMISFirstPass(BaseVector<int>* CFmap, const BaseVector<bool>& S) const;
+
         /** \brief Ruge Stueben Direct Interpolation */
         virtual bool RSDirectProlongNnz(const BaseVector<int>&       CFmap,
                                         const BaseVector<bool>&      S,
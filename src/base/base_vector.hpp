@@ -145,12 +145,44 @@ namespace rocalution
                                const BaseVector<ValueType>& y,
                                ValueType                    gamma)
             = 0;
+        /** \brief Perform vector update of type this = this + alpha*x and return the squared L2
+      * norm of this
+      */
+        virtual ValueType AddScaleNormSquared(const BaseVector<ValueType>& x, ValueType alpha) = 0;
+        /** \brief Perform vector updates of type this = this + alpha*x, y = y + beta*z and return
+      * the squared L2 norm of y
+      */
+        virtual ValueType AddScalePairNormSquared(const BaseVector<ValueType>& x,
+                                                  ValueType                    alpha,
+                                                  BaseVector<ValueType>*       y,
+                                                  const BaseVector<ValueType>& z,
+                                                  ValueType                    beta)
+            = 0;
         /** \brief Perform vector scaling this = alpha*this */
         virtual void Scale(ValueType alpha) = 0;
         /** \brief Compute dot (scalar) product, return this^T y */
         virtual ValueType Dot(const BaseVector<ValueType>& x) const = 0;
         /** \brief Compute non-conjugated dot (scalar) product, return this^T y */
         virtual ValueType DotNonConj(const BaseVector<ValueType>& x) const = 0;
+        /** \brief Compute the dot products of \p num_vec contiguous blocks of equal size,
+      * result[j] = this_j^T x_j
+      */
+        virtual void
+            DotBatched(const BaseVector<ValueType>& x, int num_vec, ValueType* result) const = 0;
+        /** \brief Compute the non-conjugated dot products of \p num_vec contiguous blocks of
+      * equal size, result[j] = this_j^T x_j
+      */
+        virtual void
+            DotNonConjBatched(const BaseVector<ValueType>& x, int num_vec, ValueType* result) const
+            = 0;
+        /** \brief Perform vector updates of \p num_vec contiguous blocks of equal size,
+      * this_j = alpha[j]*this_j + beta[j]*x_j
+      */
+        virtual void ScaleAddScaleBatched(const ValueType*             alpha,
+                                          const BaseVector<ValueType>& x,
+                                          const ValueType*             beta,
+                                          int                          num_vec)
+            = 0;
         /** \brief Compute L2 norm of the vector, return =  srqt(this^T this) */
         virtual ValueType Norm(void) const = 0;
         /** \brief Reduce vector */
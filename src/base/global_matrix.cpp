@@ -26,6 +26,8 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profile.hpp"
+#include "../utils/rocsparseio.h"
 #include "base_matrix.hpp"
 #include "base_vector.hpp"
 #include "global_vector.hpp"
@@ -39,8 +41,10 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstdio>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 namespace rocalution
 {
@@ -74,7 +78,8 @@ namespace rocalution
 
         this->object_name_ = "";
 
-        this->pm_ = &pm;
+        this->pm_      = &pm;
+        this->pm_self_ = NULL;
 
         this->nnz_ = 0;
 
@@ -909,6 +914,12 @@ namespace rocalution
         this->ConvertTo(DENSE);
     }
 
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ConvertToSELL(void)
+    {
+        this->ConvertTo(SELL);
+    }
+
     template <typename ValueType>
     void GlobalMatrix<ValueType>::ConvertTo(unsigned int matrix_format, int blockdim)
     {
@@ -926,6 +937,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalMatrix::Apply()", (const void*&)in, out);
 
+        ProfileRegion region(ProfilePhase_SpMV);
+
         assert(out != NULL);
         assert(&in != out);
 
@@ -981,11 +994,16 @@ namespace rocalution
         // Synchronize compute mode ghost
         _rocalution_sync_ghost();
 
-        // Initiate communication
-        this->pm_->CommunicateAsync_(send_buffer, this->recv_boundary_);
+        // Exchange halo
+        {
+            ProfileRegion region(ProfilePhase_HaloExchange);
 
-        // Sync communication
-        this->pm_->CommunicateSync_();
+            // Initiate communication
+            this->pm_->CommunicateAsync_(send_buffer, this->recv_boundary_);
+
+            // Sync communication
+            this->pm_->CommunicateSync_();
+        }
 
         if(this->is_host_() == true)
         {
@@ -1287,13 +1305,15 @@ namespace rocalution
     template <typename ValueType>
     void GlobalMatrix<ValueType>::TripleMatrixProduct(const GlobalMatrix<ValueType>& R,
                                                       const GlobalMatrix<ValueType>& A,
-                                                      const GlobalMatrix<ValueType>& P)
+                                                      const GlobalMatrix<ValueType>& P,
+                                                      bool                           reuse)
     {
         log_debug(this,
                   "GlobalMatrix::TripleMatrixProduct()",
                   (const void*&)R,
                   (const void*&)A,
-                  (const void*&)P);
+                  (const void*&)P,
+                  reuse);
 
         assert(&R != this);
         assert(&A != this);
@@ -1315,7 +1335,7 @@ namespace rocalution
         if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
         {
             this->matrix_interior_.TripleMatrixProduct(
-                R.matrix_interior_, A.matrix_interior_, P.matrix_interior_);
+                R.matrix_interior_, A.matrix_interior_, P.matrix_interior_, reuse);
 
             this->CreateParallelManager_();
 
@@ -2165,6 +2185,423 @@ namespace rocalution
         this->matrix_ghost_.WriteFileRSIO(ghost_name);
     }
 
+#ifdef SUPPORT_MULTINODE
+    // Contiguous block of an equally split range of size entries
+    static void rsio_partition(int64_t size, int nprocs, int rank, int64_t* begin, int64_t* end)
+    {
+        int64_t chunk = size / nprocs;
+        int64_t rest  = size % nprocs;
+
+        *begin = rank * chunk + std::min(static_cast<int64_t>(rank), rest);
+        *end   = *begin + chunk + (rank < rest ? 1 : 0);
+    }
+
+    // Size in bytes of a rocsparse I/O type, zero if unsupported
+    static int64_t rsio_type_size(uint64_t type)
+    {
+        switch(type)
+        {
+        case ROCSPARSEIO_TYPE_INT32:
+        case ROCSPARSEIO_TYPE_FLOAT32:
+            return 4;
+        case ROCSPARSEIO_TYPE_INT64:
+        case ROCSPARSEIO_TYPE_FLOAT64:
+        case ROCSPARSEIO_TYPE_COMPLEX32:
+            return 8;
+        case ROCSPARSEIO_TYPE_COMPLEX64:
+            return 16;
+        }
+
+        return 0;
+    }
+
+    // Agree on the validity of the data read by each rank, such that either all ranks
+    // continue or all ranks abort
+    static void
+        rsio_check_all(bool valid, const char* what, const std::string& filename, const void* comm)
+    {
+        int local_error = (valid == true) ? 0 : 1;
+        int error;
+
+        communication_sync_allreduce_single_max(&local_error, &error, comm);
+
+        if(error != 0)
+        {
+            LOG_INFO("GlobalMatrix::ReadFileRSIOCollective() " << what << ": " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    // Check whether indices of rocsparse I/O type can be converted into 64 bit indices
+    static bool rsio_valid_index_type(uint64_t type)
+    {
+        return type == ROCSPARSEIO_TYPE_INT32 || type == ROCSPARSEIO_TYPE_INT64;
+    }
+
+    // Check whether values of rocsparse I/O type can be converted into ValueType (real)
+    template <typename ValueType>
+    static bool rsio_valid_value_type(uint64_t type, const ValueType*)
+    {
+        return type == ROCSPARSEIO_TYPE_FLOAT32 || type == ROCSPARSEIO_TYPE_FLOAT64;
+    }
+
+    // Check whether values of rocsparse I/O type can be converted into ValueType (complex)
+    template <typename ValueType>
+    static bool rsio_valid_value_type(uint64_t type, const std::complex<ValueType>*)
+    {
+        return type == ROCSPARSEIO_TYPE_FLOAT32 || type == ROCSPARSEIO_TYPE_FLOAT64
+               || type == ROCSPARSEIO_TYPE_COMPLEX32 || type == ROCSPARSEIO_TYPE_COMPLEX64;
+    }
+
+    template <typename T, typename S>
+    static void rsio_copy(const void* in, int64_t size, T* out)
+    {
+        const S* src = static_cast<const S*>(in);
+
+        for(int64_t i = 0; i < size; ++i)
+        {
+            out[i] = static_cast<T>(src[i]);
+        }
+    }
+
+    // Convert indices of rocsparse I/O type into 64 bit indices
+    static bool rsio_copy_indices(uint64_t type, const void* in, int64_t size, int64_t* out)
+    {
+        switch(type)
+        {
+        case ROCSPARSEIO_TYPE_INT32:
+            rsio_copy<int64_t, int32_t>(in, size, out);
+            return true;
+        case ROCSPARSEIO_TYPE_INT64:
+            rsio_copy<int64_t, int64_t>(in, size, out);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Convert values of rocsparse I/O type into ValueType (real)
+    template <typename ValueType>
+    static bool rsio_copy_values(uint64_t type, const void* in, int64_t size, ValueType* out)
+    {
+        switch(type)
+        {
+        case ROCSPARSEIO_TYPE_FLOAT32:
+            rsio_copy<ValueType, float>(in, size, out);
+            return true;
+        case ROCSPARSEIO_TYPE_FLOAT64:
+            rsio_copy<ValueType, double>(in, size, out);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Convert values of rocsparse I/O type into ValueType (complex)
+    template <typename ValueType>
+    static bool
+        rsio_copy_values(uint64_t type, const void* in, int64_t size, std::complex<ValueType>* out)
+    {
+        switch(type)
+        {
+        case ROCSPARSEIO_TYPE_FLOAT32:
+            rsio_copy<std::complex<ValueType>, float>(in, size, out);
+            return true;
+        case ROCSPARSEIO_TYPE_FLOAT64:
+            rsio_copy<std::complex<ValueType>, double>(in, size, out);
+            return true;
+        case ROCSPARSEIO_TYPE_COMPLEX32:
+            rsio_copy<std::complex<ValueType>, std::complex<float>>(in, size, out);
+            return true;
+        case ROCSPARSEIO_TYPE_COMPLEX64:
+            rsio_copy<std::complex<ValueType>, std::complex<double>>(in, size, out);
+            return true;
+        }
+
+        return false;
+    }
+#endif
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ReadFileRSIOCollective(const std::string& filename,
+                                                         ParallelManager*   pm)
+    {
+        log_debug(this, "GlobalMatrix::ReadFileRSIOCollective()", filename, pm);
+
+        assert(pm != NULL);
+        assert(pm->comm_ != NULL);
+
+#ifdef SUPPORT_MULTINODE
+        MFile file;
+
+        if(communication_file_open(filename.c_str(), &file, pm->comm_) == false)
+        {
+            LOG_INFO("Cannot open GlobalMatrix file [read]: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header consists of the file magic, the object name and the CSX meta data
+        const int64_t nmagic = 2;
+        const int64_t nname  = sizeof(rocsparseio_string) / sizeof(uint64_t);
+        const int64_t nmeta  = 9;
+
+        uint64_t header[nmagic + nname + nmeta];
+
+        rsio_check_all(
+            communication_file_read_at_all(&file, 0, sizeof(header), header, pm->comm_),
+            "cannot read the header",
+            filename,
+            pm->comm_);
+
+        uint64_t magic[nmagic] = {};
+        snprintf((char*)magic, sizeof(magic), "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
+
+        const uint64_t* meta = header + nmagic + nname;
+
+        uint64_t format    = meta[0];
+        uint64_t dir       = meta[1];
+        int64_t  m         = static_cast<int64_t>(meta[2]);
+        int64_t  n         = static_cast<int64_t>(meta[3]);
+        int64_t  nnz       = static_cast<int64_t>(meta[4]);
+        uint64_t ptr_type  = meta[5];
+        uint64_t ind_type  = meta[6];
+        uint64_t data_type = meta[7];
+        int64_t  base      = static_cast<int64_t>(meta[8]);
+
+        rsio_check_all(header[0] == magic[0] && header[1] == magic[1]
+                           && format == ROCSPARSEIO_FORMAT_SPARSE_CSX
+                           && dir == ROCSPARSEIO_DIRECTION_ROW
+                           && (base == ROCSPARSEIO_INDEX_BASE_ZERO
+                               || base == ROCSPARSEIO_INDEX_BASE_ONE),
+                       "requires a CSR rocsparse I/O file",
+                       filename,
+                       pm->comm_);
+
+        // Validate sizes and types before any offset is derived from them
+        rsio_check_all(m >= 0 && n >= 0 && nnz >= 0 && rsio_valid_index_type(ptr_type) == true
+                           && rsio_valid_index_type(ind_type) == true
+                           && rsio_valid_value_type(data_type, static_cast<const ValueType*>(NULL))
+                                  == true,
+                       "unsupported sizes or data types",
+                       filename,
+                       pm->comm_);
+
+        int64_t ptr_size  = rsio_type_size(ptr_type);
+        int64_t ind_size  = rsio_type_size(ind_type);
+        int64_t data_size = rsio_type_size(data_type);
+
+        // Each array is preceded by its element size and number of elements
+        int64_t ptr_offset  = sizeof(header) + 2 * sizeof(uint64_t);
+        int64_t ind_offset  = ptr_offset + (m + 1) * ptr_size + 2 * sizeof(uint64_t);
+        int64_t data_offset = ind_offset + nnz * ind_size + 2 * sizeof(uint64_t);
+
+        // Split rows and columns into equally sized blocks
+        int64_t row_begin;
+        int64_t row_end;
+        int64_t col_begin;
+        int64_t col_end;
+
+        rsio_partition(m, pm->num_procs_, pm->rank_, &row_begin, &row_end);
+        rsio_partition(n, pm->num_procs_, pm->rank_, &col_begin, &col_end);
+
+        int64_t local_nrow = row_end - row_begin;
+        int64_t local_ncol = col_end - col_begin;
+
+        // Read the row offsets of this rank
+        std::vector<char>    buffer((local_nrow + 1) * ptr_size);
+        std::vector<int64_t> row_ptr(local_nrow + 1);
+
+        bool valid = communication_file_read_at_all(&file,
+                                                    ptr_offset + row_begin * ptr_size,
+                                                    buffer.size(),
+                                                    buffer.data(),
+                                                    pm->comm_);
+
+        valid = valid && rsio_copy_indices(ptr_type, buffer.data(), local_nrow + 1, row_ptr.data());
+
+        rsio_check_all(valid, "cannot read row offsets", filename, pm->comm_);
+
+        int64_t nnz_begin = row_ptr[0] - base;
+        int64_t local_nnz = row_ptr[local_nrow] - row_ptr[0];
+
+        // Row offsets determine the part of the file that is read by this rank
+        valid = (nnz_begin >= 0 && local_nnz >= 0 && nnz_begin + local_nnz <= nnz);
+
+        for(int64_t i = 0; i < local_nrow && valid == true; ++i)
+        {
+            valid = (row_ptr[i] <= row_ptr[i + 1]);
+        }
+
+        rsio_check_all(valid, "invalid row offsets", filename, pm->comm_);
+
+        // Read the column indices and values of this rank
+        std::vector<int64_t>   col(local_nnz);
+        std::vector<ValueType> val(local_nnz);
+
+        buffer.resize(local_nnz * ind_size);
+        valid = communication_file_read_at_all(
+            &file, ind_offset + nnz_begin * ind_size, buffer.size(), buffer.data(), pm->comm_);
+
+        valid = valid && rsio_copy_indices(ind_type, buffer.data(), local_nnz, col.data());
+
+        rsio_check_all(valid, "cannot read column indices", filename, pm->comm_);
+
+        buffer.resize(local_nnz * data_size);
+        valid = communication_file_read_at_all(
+            &file, data_offset + nnz_begin * data_size, buffer.size(), buffer.data(), pm->comm_);
+
+        valid = valid && rsio_copy_values(data_type, buffer.data(), local_nnz, val.data());
+
+        rsio_check_all(valid, "cannot read values", filename, pm->comm_);
+
+        communication_file_close(&file);
+
+        // Column indices must address a column of the global matrix
+        for(int64_t j = 0; j < local_nnz && valid == true; ++j)
+        {
+            valid = (col[j] - base >= 0 && col[j] - base < n);
+        }
+
+        rsio_check_all(valid, "invalid column indices", filename, pm->comm_);
+
+        std::vector<char>().swap(buffer);
+
+        // Count interior and ghost entries
+        PtrType* int_row_ptr = NULL;
+        PtrType* gst_row_ptr = NULL;
+
+        allocate_host(local_nrow + 1, &int_row_ptr);
+        allocate_host(local_nrow + 1, &gst_row_ptr);
+
+        int_row_ptr[0] = 0;
+        gst_row_ptr[0] = 0;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            int_row_ptr[i + 1] = int_row_ptr[i];
+            gst_row_ptr[i + 1] = gst_row_ptr[i];
+
+            for(int64_t j = row_ptr[i] - row_ptr[0]; j < row_ptr[i + 1] - row_ptr[0]; ++j)
+            {
+                int64_t global_col = col[j] - base;
+
+                if(global_col >= col_begin && global_col < col_end)
+                {
+                    ++int_row_ptr[i + 1];
+                }
+                else
+                {
+                    ++gst_row_ptr[i + 1];
+                }
+            }
+        }
+
+        int64_t int_nnz = int_row_ptr[local_nrow];
+        int64_t gst_nnz = gst_row_ptr[local_nrow];
+
+        // Split into interior and ghost part, ghost columns remain global for now
+        int*                 int_col = NULL;
+        ValueType*           int_val = NULL;
+        int*                 gst_col = NULL;
+        ValueType*           gst_val = NULL;
+        std::vector<int64_t> gst_global_col(gst_nnz);
+
+        allocate_host(int_nnz, &int_col);
+        allocate_host(int_nnz, &int_val);
+        allocate_host(gst_nnz, &gst_col);
+        allocate_host(gst_nnz, &gst_val);
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            PtrType int_idx = int_row_ptr[i];
+            PtrType gst_idx = gst_row_ptr[i];
+
+            for(int64_t j = row_ptr[i] - row_ptr[0]; j < row_ptr[i + 1] - row_ptr[0]; ++j)
+            {
+                int64_t global_col = col[j] - base;
+
+                if(global_col >= col_begin && global_col < col_end)
+                {
+                    int_col[int_idx] = static_cast<int>(global_col - col_begin);
+                    int_val[int_idx] = val[j];
+                    ++int_idx;
+                }
+                else
+                {
+                    gst_global_col[gst_idx] = global_col;
+                    gst_val[gst_idx]        = val[j];
+                    ++gst_idx;
+                }
+            }
+        }
+
+        std::vector<int64_t>().swap(col);
+        std::vector<ValueType>().swap(val);
+
+        // Sorted unique ghost columns, ordered by their owning rank
+        std::vector<int64_t> ghost_col(gst_global_col);
+
+        std::sort(ghost_col.begin(), ghost_col.end());
+        ghost_col.erase(std::unique(ghost_col.begin(), ghost_col.end()), ghost_col.end());
+
+        // Renumber ghost columns (from global to local)
+        for(int64_t i = 0; i < gst_nnz; ++i)
+        {
+            gst_col[i] = static_cast<int>(
+                std::lower_bound(ghost_col.begin(), ghost_col.end(), gst_global_col[i])
+                - ghost_col.begin());
+        }
+
+        // Generate the parallel manager
+        pm->Clear();
+
+        pm->SetGlobalNrow(m);
+        pm->SetGlobalNcol(n);
+        pm->SetLocalNrow(local_nrow);
+        pm->SetLocalNcol(local_ncol);
+
+        // The partition is known on all ranks, global offsets need no communication
+        for(int r = 0; r <= pm->num_procs_; ++r)
+        {
+            int64_t begin;
+            int64_t end;
+
+            rsio_partition(m, pm->num_procs_, r, &begin, &end);
+            pm->global_row_offset_[r] = begin;
+
+            rsio_partition(n, pm->num_procs_, r, &begin, &end);
+            pm->global_col_offset_[r] = begin;
+        }
+
+        pm->global_offset_ = true;
+
+        // The manager is its own parent, as global offsets are already available
+        pm->GenerateFromGhostColumnsWithParent_(ghost_col.size(), ghost_col.data(), *pm);
+
+        // Convert global boundary index to local index
+        pm->BoundaryTransformGlobalToLocal_();
+
+        // Communicate ghost to global map
+        pm->CommunicateGhostToGlobalMapAsync_();
+        pm->CommunicateGhostToGlobalMapSync_();
+
+        this->SetParallelManager(*pm);
+
+        this->SetDataPtrCSR(&int_row_ptr,
+                            &int_col,
+                            &int_val,
+                            &gst_row_ptr,
+                            &gst_col,
+                            &gst_val,
+                            filename,
+                            int_nnz,
+                            gst_nnz);
+#else
+        LOG_INFO("GlobalMatrix::ReadFileRSIOCollective() requires multinode support");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
     template <typename ValueType>
     void GlobalMatrix<ValueType>::ExtractDiagonal(GlobalVector<ValueType>* vec_diag) const
     {
@@ -3595,6 +4032,25 @@ namespace rocalution
     {
         log_debug(this, "GlobalMatrix::RSPMISCoarsening()", eps, CFmap, S);
 
+        this->RSPMISCoarsening_(eps, false, CFmap, S);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSHMISCoarsening(float              eps,
+                                                   LocalVector<int>*  CFmap,
+                                                   LocalVector<bool>* S) const
+    {
+        log_debug(this, "GlobalMatrix::RSHMISCoarsening()", eps, CFmap, S);
+
+        this->RSPMISCoarsening_(eps, true, CFmap, S);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSPMISCoarsening_(float              eps,
+                                                    bool               hmis,
+                                                    LocalVector<int>*  CFmap,
+                                                    LocalVector<bool>* S) const
+    {
         assert(eps < 1.0f);
         assert(eps > 0.0f);
         assert(CFmap != NULL);
@@ -3610,7 +4066,7 @@ namespace rocalution
         // Calling global routine with single process
         if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
         {
-            this->matrix_interior_.RSPMISCoarsening(eps, CFmap, S);
+            this->matrix_interior_.RSPMISCoarsening_(eps, hmis, CFmap, S);
 
             return;
         }
@@ -3708,6 +4164,39 @@ namespace rocalution
             // Update omega with received omega from neighbors
             omega.SetContinuousValues(int_ptr->GetM(), omega.GetSize(), hrecv_buffer);
 
+            // HMIS starts with the coarse vertices of a block wise Ruge Stueben splitting
+            // of the interior, which are then augmented by PMIS
+            if(hmis == true)
+            {
+                int_ptr->RSHMISFirstPass_(CFmap, *S);
+
+                LocalVector<int> isend_buffer;
+                isend_buffer.CloneBackend(*this);
+                isend_buffer.Allocate("int send buffer", nsend);
+
+                // Communicate the coarse vertices to neighbors
+                CFmap->GetIndexValues(this->halo_, &isend_buffer);
+                isend_buffer.CopyToHostData(hisend_buffer);
+
+                this->pm_->CommunicateAsync_(hisend_buffer, hirecv_buffer);
+                this->pm_->CommunicateSync_();
+
+                CFmap->SetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+
+                // Mark undecided vertices that strongly depend on a coarse vertex as fine
+                int_ptr->matrix_->RSPMISCoarseEdgesToFine(
+                    CFmap->vector_, *S->vector_, *gst_ptr->matrix_);
+
+                // Communicate the fine vertices to neighbors
+                CFmap->GetIndexValues(this->halo_, &isend_buffer);
+                isend_buffer.CopyToHostData(hisend_buffer);
+
+                this->pm_->CommunicateAsync_(hisend_buffer, hirecv_buffer);
+                this->pm_->CommunicateSync_();
+
+                CFmap->SetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+            }
+
             // Iteratively find coarse and fine vertices until all undecided vertices have
             // been marked (JPL approach)
             int iter = 0;
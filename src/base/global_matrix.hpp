@@ -47,7 +47,7 @@ namespace rocalution
   * \tparam ValueType - can be int, float, double, std::complex<float> and
   *                     std::complex<double>
   *
-  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, and DENSE.
+  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, SELL, and DENSE.
   * \note For CSR type matrices, the column indices must be sorted in increasing order. For COO matrices, the row
   * indices must be sorted in increasing order. The function \p Check can be used to check whether a matrix
   * contains valid data. For CSR and COO matrices, the function \p Sort can be used to sort the row or column
@@ -199,6 +199,8 @@ namespace rocalution
         void ConvertToHYB(void);
         /** \brief Convert the matrix to DENSE structure */
         void ConvertToDENSE(void);
+        /** \brief Convert the matrix to SELL-C-sigma structure */
+        void ConvertToSELL(void);
         /** \brief Convert the matrix to specified matrix ID format */
         void ConvertTo(unsigned int matrix_format, int blockdim = 1);
 
@@ -215,10 +217,15 @@ namespace rocalution
         /** \brief Transpose the matrix */
         void Transpose(GlobalMatrix<ValueType>* T) const;
 
-        /** \brief Triple matrix product C=RAP */
+        /** \brief Triple matrix product C=RAP
+      * \details
+      * \p reuse is forwarded to LocalMatrix::TripleMatrixProduct() for a single process
+      * and ignored otherwise.
+      */
         void TripleMatrixProduct(const GlobalMatrix<ValueType>& R,
                                  const GlobalMatrix<ValueType>& A,
-                                 const GlobalMatrix<ValueType>& P);
+                                 const GlobalMatrix<ValueType>& P,
+                                 bool                           reuse = false);
 
         /** \brief Read matrix from MTX (Matrix Market Format) file */
         void ReadFileMTX(const std::string& filename);
@@ -245,6 +252,36 @@ namespace rocalution
         ROCALUTION_EXPORT
         void WriteFileRSIO(const std::string& filename) const;
 
+        /** \brief Read a distributed matrix collectively from a single rocsparse I/O file
+        * \details
+        * Each rank reads only its block of rows of a global CSR matrix, stored in rocsparse
+        * I/O format, using MPI-IO. Rows and columns are split into contiguous blocks of
+        * equal size. The ghost columns are determined from the local rows and the parallel
+        * manager halo is generated from them, such that no pre-partitioned files are
+        * required.
+        *
+        * @param[in]
+        * filename  name of the global rocsparse I/O file.
+        * @param[inout]
+        * pm        parallel manager with an MPI communicator set. The matrix distribution
+        *           and its communication pattern are written into pm, which is then
+        *           attached to the matrix and can be used for global vectors.
+        *
+        * \par Example
+        * \code{.cpp}
+        *   ParallelManager pm;
+        *   pm.SetMPICommunicator(&comm);
+        *
+        *   GlobalMatrix<ValueType> mat;
+        *   mat.ReadFileRSIOCollective("matrix.rsio", &pm);
+        *
+        *   GlobalVector<ValueType> rhs(pm);
+        *   rhs.ReadFileBinaryCollective("rhs.bin");
+        * \endcode
+        */
+        ROCALUTION_EXPORT
+        void ReadFileRSIOCollective(const std::string& filename, ParallelManager* pm);
+
         /** \brief Sort the matrix indices
         * \details
         * Sorts the matrix by indices.
@@ -332,6 +369,8 @@ namespace rocalution
         void RSCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
         /** \brief Parallel maximal independent set coarsening for RS AMG*/
         void RSPMISCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
+        /** \brief Hybrid maximal independent set (HMIS) coarsening for RS AMG*/
+        void RSHMISCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
 
         /** \brief Ruge Stueben Direct Interpolation */
         void RSDirectInterpolation(const LocalVector<int>&  CFmap,
@@ -353,6 +392,12 @@ namespace rocalution
         void CreateParallelManager_(void);
         void InitCommPattern_(void);
 
+        // PMIS coarsening, optionally started from the first pass of HMIS
+        void RSPMISCoarsening_(float              eps,
+                               bool               hmis,
+                               LocalVector<int>*  CFmap,
+                               LocalVector<bool>* S) const;
+
         ParallelManager* pm_self_;
 
         ValueType* recv_boundary_;
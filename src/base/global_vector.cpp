@@ -25,6 +25,7 @@
 #include "../utils/allocate_free.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
+#include "../utils/profile.hpp"
 #include "local_vector.hpp"
 
 #ifdef SUPPORT_MULTINODE
@@ -34,9 +35,12 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstring>
 #include <limits>
 #include <math.h>
 #include <sstream>
+#include <typeinfo>
+#include <vector>
 
 namespace rocalution
 {
@@ -54,6 +58,11 @@ namespace rocalution
         this->pm_ = NULL;
 
         this->object_name_ = "";
+
+        this->dot_event_       = NULL;
+        this->dot_buffer_      = NULL;
+        this->dot_buffer_size_ = 0;
+        this->dot_pending_     = false;
     }
 
     template <typename ValueType>
@@ -66,6 +75,11 @@ namespace rocalution
         this->object_name_ = "";
 
         this->pm_ = &pm;
+
+        this->dot_event_       = NULL;
+        this->dot_buffer_      = NULL;
+        this->dot_buffer_size_ = 0;
+        this->dot_pending_     = false;
     }
 
     template <typename ValueType>
@@ -74,6 +88,14 @@ namespace rocalution
         log_debug(this, "GlobalVector::~GlobalVector()");
 
         this->Clear();
+
+        // Complete any pending reduction before its buffers are released
+        this->DotSync();
+
+#ifdef SUPPORT_MULTINODE
+        delete this->dot_event_;
+#endif
+        free_host(&this->dot_buffer_);
     }
 
     template <typename ValueType>
@@ -490,6 +512,125 @@ namespace rocalution
         this->vector_interior_.WriteFileBinary(name);
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::ReadFileBinaryCollective(const std::string& filename)
+    {
+        log_debug(this, "GlobalVector::ReadFileBinaryCollective()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+#ifdef SUPPORT_MULTINODE
+        MFile file;
+
+        if(communication_file_open(filename.c_str(), &file, this->pm_->comm_) == false)
+        {
+            LOG_INFO("Cannot open GlobalVector file [read]: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header line, version and size
+        const std::string title = "#rocALUTION binary vector file\n";
+
+        std::vector<char> header(title.size() + sizeof(int) + sizeof(int64_t));
+
+        // All ranks read the same header, they agree on its validity
+        bool valid = communication_file_read_at_all(
+            &file, 0, header.size(), header.data(), this->pm_->comm_);
+
+        if(valid == false || std::string(header.data(), title.size()) != title)
+        {
+            LOG_INFO("ReadFileBinaryCollective: filename=" << filename
+                                                           << " is not a rocALUTION vector");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int     version;
+        int64_t n;
+        int64_t offset = title.size() + sizeof(int);
+
+        memcpy(&version, header.data() + title.size(), sizeof(int));
+
+        // We need backward compatibility, v3.0.0 and later will store sizes with 64 bits
+        if(version < 30000)
+        {
+            int size32;
+            memcpy(&size32, header.data() + offset, sizeof(int));
+
+            n = size32;
+            offset += sizeof(int);
+        }
+        else
+        {
+            memcpy(&n, header.data() + offset, sizeof(int64_t));
+            offset += sizeof(int64_t);
+        }
+
+        if(n != this->pm_->GetGlobalNrow())
+        {
+            LOG_INFO("ReadFileBinaryCollective: filename=" << filename << "; size mismatch");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Block of rows of this rank
+        int64_t row_begin  = this->pm_->GetGlobalRowBegin();
+        int64_t local_size = this->pm_->GetLocalNrow();
+
+        ValueType* data = NULL;
+        allocate_host(local_size, &data);
+
+        // We read always in double precision
+        if(typeid(ValueType) == typeid(double) || typeid(ValueType) == typeid(float))
+        {
+            std::vector<double> tmp(local_size);
+
+            valid = communication_file_read_at_all(&file,
+                                                   offset + row_begin * sizeof(double),
+                                                   sizeof(double) * local_size,
+                                                   tmp.data(),
+                                                   this->pm_->comm_);
+
+            for(int64_t i = 0; i < local_size; ++i)
+            {
+                data[i] = static_cast<ValueType>(tmp[i]);
+            }
+        }
+        else if(typeid(ValueType) == typeid(int) || typeid(ValueType) == typeid(int64_t))
+        {
+            valid = communication_file_read_at_all(&file,
+                                                   offset + row_begin * sizeof(ValueType),
+                                                   sizeof(ValueType) * local_size,
+                                                   data,
+                                                   this->pm_->comm_);
+        }
+        else
+        {
+            LOG_INFO("ReadFileBinaryCollective: filename=" << filename << "; internal error");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        communication_file_close(&file);
+
+        // Agree on the completeness of the reads, such that either all ranks continue or
+        // all ranks abort
+        int local_error = (valid == true) ? 0 : 1;
+        int error;
+
+        communication_sync_allreduce_single_max(&local_error, &error, this->pm_->comm_);
+
+        if(error != 0)
+        {
+            LOG_INFO("ReadFileBinaryCollective: filename=" << filename << "; file is truncated");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        this->SetDataPtr(&data, filename, n);
+#else
+        LOG_INFO("GlobalVector::ReadFileBinaryCollective() requires multinode support");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
     template <typename ValueType>
     void GlobalVector<ValueType>::AddScale(const GlobalVector<ValueType>& x, ValueType alpha)
     {
@@ -543,11 +684,65 @@ namespace rocalution
         this->vector_interior_.ScaleAddScale(alpha, x.vector_interior_, beta);
     }
 
+    template <typename ValueType>
+    ValueType GlobalVector<ValueType>::AddScaleNormSquared(const GlobalVector<ValueType>& x,
+                                                           ValueType                      alpha)
+    {
+        log_debug(this, "GlobalVector::AddScaleNormSquared()", (const void*&)x, alpha);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        ValueType local = this->vector_interior_.AddScaleNormSquared(x.vector_interior_, alpha);
+        ValueType global;
+
+#ifdef SUPPORT_MULTINODE
+        communication_sync_allreduce_single_sum(&local, &global, this->pm_->comm_);
+#else
+        global = local;
+#endif
+
+        return global;
+    }
+
+    template <typename ValueType>
+    ValueType GlobalVector<ValueType>::AddScalePairNormSquared(const GlobalVector<ValueType>& x,
+                                                               ValueType                      alpha,
+                                                               GlobalVector<ValueType>*       y,
+                                                               const GlobalVector<ValueType>& z,
+                                                               ValueType                      beta)
+    {
+        log_debug(this,
+                  "GlobalVector::AddScalePairNormSquared()",
+                  (const void*&)x,
+                  alpha,
+                  y,
+                  (const void*&)z,
+                  beta);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        assert(y != NULL);
+
+        ValueType local = this->vector_interior_.AddScalePairNormSquared(
+            x.vector_interior_, alpha, &y->vector_interior_, z.vector_interior_, beta);
+        ValueType global;
+
+#ifdef SUPPORT_MULTINODE
+        communication_sync_allreduce_single_sum(&local, &global, this->pm_->comm_);
+#else
+        global = local;
+#endif
+
+        return global;
+    }
+
     template <typename ValueType>
     ValueType GlobalVector<ValueType>::Dot(const GlobalVector<ValueType>& x) const
     {
         log_debug(this, "GlobalVector::Dot()", (const void*&)x);
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         ValueType local = this->vector_interior_.Dot(x.vector_interior_);
         ValueType global;
 
@@ -565,6 +760,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::DotNonConj()", (const void*&)x);
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         ValueType local = this->vector_interior_.DotNonConj(x.vector_interior_);
         ValueType global;
 
@@ -577,11 +774,80 @@ namespace rocalution
         return global;
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotAsync(int                                   n,
+                                           const GlobalVector<ValueType>* const* x,
+                                           const GlobalVector<ValueType>* const* y,
+                                           ValueType*                            result)
+    {
+        log_debug(this, "GlobalVector::DotAsync()", n, x, y, result);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        assert(n > 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        // Only a single reduction can be in flight
+        this->DotSync();
+
+        if(n > this->dot_buffer_size_)
+        {
+            free_host(&this->dot_buffer_);
+            allocate_host(n, &this->dot_buffer_);
+
+            this->dot_buffer_size_ = n;
+        }
+
+        // Local contributions
+        for(int i = 0; i < n; ++i)
+        {
+            assert(x[i] != NULL);
+            assert(y[i] != NULL);
+
+            this->dot_buffer_[i] = x[i]->vector_interior_.Dot(y[i]->vector_interior_);
+        }
+
+#ifdef SUPPORT_MULTINODE
+        if(this->dot_event_ == NULL)
+        {
+            this->dot_event_ = new MRequest;
+        }
+
+        communication_async_allreduce_sum(
+            this->dot_buffer_, result, n, this->pm_->comm_, this->dot_event_);
+
+        this->dot_pending_ = true;
+#else
+        copy_h2h(n, this->dot_buffer_, result);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotSync(void)
+    {
+        log_debug(this, "GlobalVector::DotSync()");
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+#ifdef SUPPORT_MULTINODE
+        if(this->dot_pending_ == true)
+        {
+            communication_sync(this->dot_event_);
+
+            this->dot_pending_ = false;
+        }
+#endif
+    }
+
     template <typename ValueType>
     ValueType GlobalVector<ValueType>::Norm(void) const
     {
         log_debug(this, "GlobalVector::Norm()");
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         ValueType result = this->Dot(*this);
         return std::sqrt(result);
     }
@@ -591,6 +857,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::Reduce()");
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         ValueType local = this->vector_interior_.Reduce();
         ValueType global;
 
@@ -640,6 +908,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::Asum()");
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         ValueType local = this->vector_interior_.Asum();
         ValueType global;
 
@@ -656,6 +926,8 @@ namespace rocalution
     int64_t GlobalVector<ValueType>::Amax(ValueType& value) const
     {
         log_debug(this, "GlobalVector::Amax()", value);
+
+        ProfileRegion region(ProfilePhase_Reduction);
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
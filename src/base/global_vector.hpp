@@ -137,6 +137,8 @@ namespace rocalution
         virtual void ReadFileBinary(const std::string& filename);
         /** \brief Write GlobalVector to binary file. This method writes the current ranks interior vector to the file */
         virtual void WriteFileBinary(const std::string& filename) const;
+        /** \brief Read GlobalVector collectively from a single binary file. Each rank reads its block of rows from the global vector using MPI-IO */
+        void ReadFileBinaryCollective(const std::string& filename);
 
         /** \brief Perform scalar-vector multiplication and add it to another vector, this = this + alpha * x; */
         virtual void AddScale(const GlobalVector<ValueType>& x, ValueType alpha);
@@ -151,12 +153,29 @@ namespace rocalution
         /** \brief Perform scalar-vector multiplication and add another scaled vector (i.e. axpby), this = alpha * this + beta * x; */
         virtual void
             ScaleAddScale(ValueType alpha, const GlobalVector<ValueType>& x, ValueType beta);
+        /** \brief Perform this = this + alpha * x and return the squared L2 norm of this */
+        virtual ValueType AddScaleNormSquared(const GlobalVector<ValueType>& x, ValueType alpha);
+        /** \brief Perform this = this + alpha * x, y = y + beta * z and return the squared L2 norm of y */
+        virtual ValueType AddScalePairNormSquared(const GlobalVector<ValueType>& x,
+                                                  ValueType                      alpha,
+                                                  GlobalVector<ValueType>*       y,
+                                                  const GlobalVector<ValueType>& z,
+                                                  ValueType                      beta);
         /** \brief Scale vector, this = alpha * this; */
         virtual void Scale(ValueType alpha);
         /** \brief Perform dot product */
         virtual ValueType Dot(const GlobalVector<ValueType>& x) const;
         /** \brief Perform non conjugate (when T is complex) dot product */
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
+        /** \brief Start n dot products result[i] = x[i]^H y[i] as a single, merged and non-blocking global reduction.
+        * The results must not be accessed before DotSync() has been called on this vector.
+        */
+        void DotAsync(int                                   n,
+                      const GlobalVector<ValueType>* const* x,
+                      const GlobalVector<ValueType>* const* y,
+                      ValueType*                            result);
+        /** \brief Wait for the global reduction started by DotAsync() to complete */
+        void DotSync(void);
         /** \brief Compute L2 (Euclidean) norm of vector */
         virtual ValueType Norm(void) const;
         /** \brief Reduce (sum) the vector components */
@@ -196,6 +215,12 @@ namespace rocalution
     private:
         LocalVector<ValueType> vector_interior_;
 
+        // Pending non-blocking reduction of DotAsync()
+        MRequest*  dot_event_;
+        ValueType* dot_buffer_;
+        int        dot_buffer_size_;
+        bool       dot_pending_;
+
         friend class LocalMatrix<ValueType>;
         friend class GlobalMatrix<ValueType>;
 
@@ -217,6 +217,168 @@ namespace rocalution
                              (rocblas_double_complex*)result);
     }
 
+    // rocblas strided batched dotu
+    template <>
+    rocblas_status rocblasTdotu_strided_batched(rocblas_handle handle,
+                                                int            n,
+                                                const float*   x,
+                                                int            incx,
+                                                int64_t        stridex,
+                                                const float*   y,
+                                                int            incy,
+                                                int64_t        stridey,
+                                                int            batch_count,
+                                                float*         result)
+    {
+        return rocblas_sdot_strided_batched(
+            handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    }
+
+    template <>
+    rocblas_status rocblasTdotu_strided_batched(rocblas_handle handle,
+                                                int            n,
+                                                const double*  x,
+                                                int            incx,
+                                                int64_t        stridex,
+                                                const double*  y,
+                                                int            incy,
+                                                int64_t        stridey,
+                                                int            batch_count,
+                                                double*        result)
+    {
+        return rocblas_ddot_strided_batched(
+            handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    }
+
+    template <>
+    rocblas_status rocblasTdotu_strided_batched(rocblas_handle             handle,
+                                                int                        n,
+                                                const std::complex<float>* x,
+                                                int                        incx,
+                                                int64_t                    stridex,
+                                                const std::complex<float>* y,
+                                                int                        incy,
+                                                int64_t                    stridey,
+                                                int                        batch_count,
+                                                std::complex<float>*       result)
+    {
+        return rocblas_cdotu_strided_batched(handle,
+                                             n,
+                                             (const rocblas_float_complex*)x,
+                                             incx,
+                                             stridex,
+                                             (const rocblas_float_complex*)y,
+                                             incy,
+                                             stridey,
+                                             batch_count,
+                                             (rocblas_float_complex*)result);
+    }
+
+    template <>
+    rocblas_status rocblasTdotu_strided_batched(rocblas_handle              handle,
+                                                int                         n,
+                                                const std::complex<double>* x,
+                                                int                         incx,
+                                                int64_t                     stridex,
+                                                const std::complex<double>* y,
+                                                int                         incy,
+                                                int64_t                     stridey,
+                                                int                         batch_count,
+                                                std::complex<double>*       result)
+    {
+        return rocblas_zdotu_strided_batched(handle,
+                                             n,
+                                             (const rocblas_double_complex*)x,
+                                             incx,
+                                             stridex,
+                                             (const rocblas_double_complex*)y,
+                                             incy,
+                                             stridey,
+                                             batch_count,
+                                             (rocblas_double_complex*)result);
+    }
+
+    // rocblas strided batched dotconj
+    template <>
+    rocblas_status rocblasTdotc_strided_batched(rocblas_handle handle,
+                                                int            n,
+                                                const float*   x,
+                                                int            incx,
+                                                int64_t        stridex,
+                                                const float*   y,
+                                                int            incy,
+                                                int64_t        stridey,
+                                                int            batch_count,
+                                                float*         result)
+    {
+        return rocblas_sdot_strided_batched(
+            handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    }
+
+    template <>
+    rocblas_status rocblasTdotc_strided_batched(rocblas_handle handle,
+                                                int            n,
+                                                const double*  x,
+                                                int            incx,
+                                                int64_t        stridex,
+                                                const double*  y,
+                                                int            incy,
+                                                int64_t        stridey,
+                                                int            batch_count,
+                                                double*        result)
+    {
+        return rocblas_ddot_strided_batched(
+            handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    }
+
+    template <>
+    rocblas_status rocblasTdotc_strided_batched(rocblas_handle             handle,
+                                                int                        n,
+                                                const std::complex<float>* x,
+                                                int                        incx,
+                                                int64_t                    stridex,
+                                                const std::complex<float>* y,
+                                                int                        incy,
+                                                int64_t                    stridey,
+                                                int                        batch_count,
+                                                std::complex<float>*       result)
+    {
+        return rocblas_cdotc_strided_batched(handle,
+                                             n,
+                                             (const rocblas_float_complex*)x,
+                                             incx,
+                                             stridex,
+                                             (const rocblas_float_complex*)y,
+                                             incy,
+                                             stridey,
+                                             batch_count,
+                                             (rocblas_float_complex*)result);
+    }
+
+    template <>
+    rocblas_status rocblasTdotc_strided_batched(rocblas_handle              handle,
+                                                int                         n,
+                                                const std::complex<double>* x,
+                                                int                         incx,
+                                                int64_t                     stridex,
+                                                const std::complex<double>* y,
+                                                int                         incy,
+                                                int64_t                     stridey,
+                                                int                         batch_count,
+                                                std::complex<double>*       result)
+    {
+        return rocblas_zdotc_strided_batched(handle,
+                                             n,
+                                             (const rocblas_double_complex*)x,
+                                             incx,
+                                             stridex,
+                                             (const rocblas_double_complex*)y,
+                                             incy,
+                                             stridey,
+                                             batch_count,
+                                             (rocblas_double_complex*)result);
+    }
+
     // rocprim reduce
     template <>
     hipError_t rocprimTreduce(
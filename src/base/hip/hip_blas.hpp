@@ -59,6 +59,32 @@ namespace rocalution
                                 int              incy,
                                 ValueType*       result);
 
+    // rocblas strided batched dotu
+    template <typename ValueType>
+    rocblas_status rocblasTdotu_strided_batched(rocblas_handle   handle,
+                                                int              n,
+                                                const ValueType* x,
+                                                int              incx,
+                                                int64_t          stridex,
+                                                const ValueType* y,
+                                                int              incy,
+                                                int64_t          stridey,
+                                                int              batch_count,
+                                                ValueType*       result);
+
+    // rocblas strided batched dotconj
+    template <typename ValueType>
+    rocblas_status rocblasTdotc_strided_batched(rocblas_handle   handle,
+                                                int              n,
+                                                const ValueType* x,
+                                                int              incx,
+                                                int64_t          stridex,
+                                                const ValueType* y,
+                                                int              incy,
+                                                int64_t          stridey,
+                                                int              batch_count,
+                                                ValueType*       result);
+
     // rocprim reduction
     template <typename ValueType>
     hipError_t rocprimTreduce(void*       buffer,
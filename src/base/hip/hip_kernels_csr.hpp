@@ -34,6 +34,41 @@
 
 namespace rocalution
 {
+    // Y = A * X for num_vec column-major vectors, one thread per row and vector.
+    // Neighbouring threads process neighbouring rows of the same vector, such that
+    // the multi-vector accesses are coalesced and the matrix is shared through cache.
+    template <typename T, typename I, typename J>
+    __global__ void kernel_csr_spmm(I nrow,
+                                    I ncol,
+                                    I num_vec,
+                                    const J* __restrict__ row_offset,
+                                    const I* __restrict__ col,
+                                    const T* __restrict__ val,
+                                    const T* __restrict__ in,
+                                    T* __restrict__ out)
+    {
+        int64_t gid = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+
+        if(gid >= static_cast<int64_t>(nrow) * num_vec)
+        {
+            return;
+        }
+
+        I ai = static_cast<I>(gid % nrow);
+        I c  = static_cast<I>(gid / nrow);
+
+        const T* x = in + static_cast<int64_t>(c) * ncol;
+
+        T sum = static_cast<T>(0);
+
+        for(J aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+        {
+            sum += val[aj] * x[col[aj]];
+        }
+
+        out[gid] = sum;
+    }
+
     template <typename T, typename I, typename J>
     __global__ void kernel_csr_scale_diagonal(I nrow,
                                               const J* __restrict__ row_offset,
@@ -27,6 +27,7 @@
 #include <hip/hip_runtime.h>
 
 #include "hip_atomics.hpp"
+#include "hip_utils.hpp"
 
 namespace rocalution
 {
@@ -117,6 +118,127 @@ namespace rocalution
         out[ind] = alpha * out[ind] + beta * x[ind] + gamma * y[ind];
     }
 
+    // out_j = alpha[j] * out_j + beta[j] * x_j for num_vec contiguous blocks of size n,
+    // x and out may alias (scaling)
+    template <typename ValueType, typename IndexType>
+    __global__ void kernel_scaleaddscale_batched(IndexType n,
+                                                 int       num_vec,
+                                                 const ValueType* __restrict__ alpha,
+                                                 const ValueType* __restrict__ beta,
+                                                 const ValueType* x,
+                                                 ValueType*       out)
+    {
+        IndexType ind = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+        if(ind >= n * num_vec)
+        {
+            return;
+        }
+
+        int j = ind / n;
+
+        out[ind] = alpha[j] * out[ind] + beta[j] * x[ind];
+    }
+
+    // y = y + alpha * x and block partial sums of |y|^2
+    template <unsigned int BLOCKSIZE, typename ValueType, typename RealType>
+    __launch_bounds__(BLOCKSIZE) __global__
+        void kernel_axpy_nrm2sq_blockreduce(int64_t   size,
+                                            ValueType alpha,
+                                            const ValueType* __restrict__ x,
+                                            ValueType* __restrict__ y,
+                                            RealType* __restrict__ workspace)
+    {
+        unsigned int tid = hipThreadIdx_x;
+        int64_t      gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+        __shared__ RealType sdata[BLOCKSIZE];
+
+        RealType sum = static_cast<RealType>(0);
+
+        for(int64_t idx = gid; idx < size; idx += hipGridDim_x * BLOCKSIZE)
+        {
+            ValueType val = y[idx] + alpha * x[idx];
+            RealType  abs = hip_abs(val);
+
+            y[idx] = val;
+            sum += abs * abs;
+        }
+
+        sdata[tid] = sum;
+
+        __syncthreads();
+
+        block_reduce_sum<BLOCKSIZE>(tid, sdata);
+
+        if(tid == 0)
+        {
+            workspace[hipBlockIdx_x] = sdata[0];
+        }
+    }
+
+    // y = y + alpha * x, w = w + beta * z and block partial sums of |w|^2
+    template <unsigned int BLOCKSIZE, typename ValueType, typename RealType>
+    __launch_bounds__(BLOCKSIZE) __global__
+        void kernel_axpy_pair_nrm2sq_blockreduce(int64_t   size,
+                                                 ValueType alpha,
+                                                 const ValueType* __restrict__ x,
+                                                 ValueType* __restrict__ y,
+                                                 ValueType beta,
+                                                 const ValueType* __restrict__ z,
+                                                 ValueType* __restrict__ w,
+                                                 RealType* __restrict__ workspace)
+    {
+        unsigned int tid = hipThreadIdx_x;
+        int64_t      gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+        __shared__ RealType sdata[BLOCKSIZE];
+
+        RealType sum = static_cast<RealType>(0);
+
+        for(int64_t idx = gid; idx < size; idx += hipGridDim_x * BLOCKSIZE)
+        {
+            ValueType val = w[idx] + beta * z[idx];
+            RealType  abs = hip_abs(val);
+
+            y[idx] = y[idx] + alpha * x[idx];
+            w[idx] = val;
+            sum += abs * abs;
+        }
+
+        sdata[tid] = sum;
+
+        __syncthreads();
+
+        block_reduce_sum<BLOCKSIZE>(tid, sdata);
+
+        if(tid == 0)
+        {
+            workspace[hipBlockIdx_x] = sdata[0];
+        }
+    }
+
+    // Sum up the BLOCKSIZE block partial sums stored in workspace
+    template <unsigned int BLOCKSIZE, typename RealType>
+    __launch_bounds__(BLOCKSIZE) __global__
+        void kernel_nrm2sq_finalreduce(RealType* __restrict__ workspace)
+    {
+        unsigned int tid = hipThreadIdx_x;
+
+        __shared__ RealType sdata[BLOCKSIZE];
+
+        sdata[tid] = workspace[tid];
+
+        __syncthreads();
+
+        block_reduce_sum<BLOCKSIZE>(tid, sdata);
+
+        if(tid == 0)
+        {
+            workspace[0] = sdata[0];
+        }
+    }
+
     template <typename ValueType, typename IndexType>
     __global__ void kernel_pointwisemult(IndexType n,
                                          const ValueType* __restrict__ x,
@@ -244,6 +244,8 @@ namespace rocalution
             copy_d2h(this->nnz_, this->mat_.row, cast_mat->mat_.row);
             copy_d2h(this->nnz_, this->mat_.col, cast_mat->mat_.col);
             copy_d2h(this->nnz_, this->mat_.val, cast_mat->mat_.val);
+
+            cast_mat->row_sorted_valid_ = false;
         }
         else
         {
@@ -422,6 +424,8 @@ namespace rocalution
                      cast_mat->mat_.val,
                      true,
                      HIPSTREAM(this->local_backend_.HIP_stream_current));
+
+            cast_mat->row_sorted_valid_ = false;
         }
         else
         {
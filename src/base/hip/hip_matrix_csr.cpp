@@ -1251,6 +1251,49 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    bool HIPAcceleratorMatrixCSR<ValueType>::ApplyMulti(const BaseVector<ValueType>& in,
+                                                        int                          num_vec,
+                                                        BaseVector<ValueType>*       out) const
+    {
+        assert(out != NULL);
+        assert(num_vec > 0);
+
+        const HIPAcceleratorVector<ValueType>* cast_in
+            = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&in);
+        HIPAcceleratorVector<ValueType>* cast_out
+            = dynamic_cast<HIPAcceleratorVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+        assert(cast_in->size_ == static_cast<int64_t>(this->ncol_) * num_vec);
+        assert(cast_out->size_ == static_cast<int64_t>(this->nrow_) * num_vec);
+
+        if(this->nrow_ > 0)
+        {
+            int64_t size = static_cast<int64_t>(this->nrow_) * num_vec;
+
+            dim3 BlockSize(this->local_backend_.HIP_block_size);
+            dim3 GridSize(size / this->local_backend_.HIP_block_size + 1);
+
+            kernel_csr_spmm<<<GridSize,
+                              BlockSize,
+                              0,
+                              HIPSTREAM(this->local_backend_.HIP_stream_current)>>>(
+                this->nrow_,
+                this->ncol_,
+                num_vec,
+                this->mat_.row_offset,
+                this->mat_.col,
+                this->mat_.val,
+                cast_in->vec_,
+                cast_out->vec_);
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+        }
+
+        return true;
+    }
+
     template <typename ValueType>
     void HIPAcceleratorMatrixCSR<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
                                                       ValueType                    scalar,
@@ -1319,6 +1362,13 @@ namespace rocalution
                 this->mat_buffer_size_ = buffer_size;
                 allocate_hip(buffer_size, &this->mat_buffer_);
             }
+            else if(this->mat_buffer_size_ < buffer_size)
+            {
+                // Re-factorization after LUAnalyse()
+                this->mat_buffer_size_ = buffer_size;
+                free_hip(&this->mat_buffer_);
+                allocate_hip(buffer_size, &this->mat_buffer_);
+            }
 
             assert(this->mat_buffer_size_ >= buffer_size);
             assert(this->mat_buffer_ != NULL);
@@ -189,6 +189,9 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const;
+        virtual bool ApplyMulti(const BaseVector<ValueType>& in,
+                                int                          num_vec,
+                                BaseVector<ValueType>*       out) const;
 
         virtual bool Compress(double drop_off);
         virtual bool Sort(void);
@@ -259,6 +259,8 @@ namespace rocalution
             copy_d2h(this->coo_nnz_, this->mat_.COO.row, cast_mat->mat_.COO.row);
             copy_d2h(this->coo_nnz_, this->mat_.COO.col, cast_mat->mat_.COO.col);
             copy_d2h(this->coo_nnz_, this->mat_.COO.val, cast_mat->mat_.COO.val);
+
+            cast_mat->coo_row_sorted_valid_ = false;
         }
         else
         {
@@ -485,6 +487,8 @@ namespace rocalution
                      cast_mat->mat_.COO.val,
                      true,
                      HIPSTREAM(this->local_backend_.HIP_stream_current));
+
+            cast_mat->coo_row_sorted_valid_ = false;
         }
         else
         {
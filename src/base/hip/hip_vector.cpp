@@ -26,6 +26,7 @@
 #include "../../utils/def.hpp"
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/type_traits.hpp"
 #include "../backend_manager.hpp"
 #include "../base_vector.hpp"
 #include "../host/host_vector.hpp"
@@ -745,6 +746,154 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    ValueType HIPAcceleratorVector<ValueType>::AddScaleNormSquared(const BaseVector<ValueType>& x,
+                                                                   ValueType alpha)
+    {
+        ValueType res = static_cast<ValueType>(0);
+
+        if(this->size_ > 0)
+        {
+            const HIPAcceleratorVector<ValueType>* cast_x
+                = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&x);
+
+            assert(cast_x != NULL);
+            assert(this->size_ == cast_x->size_);
+
+            numeric_traits_t<ValueType>* workspace = NULL;
+            allocate_hip(256, &workspace);
+
+            kernel_axpy_nrm2sq_blockreduce<256>
+                <<<dim3(256), dim3(256), 0, HIPSTREAM(this->local_backend_.HIP_stream_current)>>>(
+                    this->size_, alpha, cast_x->vec_, this->vec_, workspace);
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+
+            kernel_nrm2sq_finalreduce<256>
+                <<<dim3(1), dim3(256), 0, HIPSTREAM(this->local_backend_.HIP_stream_current)>>>(
+                    workspace);
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+
+            numeric_traits_t<ValueType> norm2;
+            copy_d2h(1, workspace, &norm2);
+            free_hip(&workspace);
+
+            res = static_cast<ValueType>(norm2);
+        }
+
+        return res;
+    }
+
+    template <>
+    bool HIPAcceleratorVector<bool>::AddScaleNormSquared(const BaseVector<bool>& x, bool alpha)
+    {
+        LOG_INFO("No bool axpy function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int HIPAcceleratorVector<int>::AddScaleNormSquared(const BaseVector<int>& x, int alpha)
+    {
+        LOG_INFO("No int axpy nrm2 function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int64_t HIPAcceleratorVector<int64_t>::AddScaleNormSquared(const BaseVector<int64_t>& x,
+                                                               int64_t                    alpha)
+    {
+        LOG_INFO("No integral axpy nrm2 function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    ValueType
+        HIPAcceleratorVector<ValueType>::AddScalePairNormSquared(const BaseVector<ValueType>& x,
+                                                                 ValueType                    alpha,
+                                                                 BaseVector<ValueType>*       y,
+                                                                 const BaseVector<ValueType>& z,
+                                                                 ValueType                    beta)
+    {
+        ValueType res = static_cast<ValueType>(0);
+
+        if(this->size_ > 0)
+        {
+            const HIPAcceleratorVector<ValueType>* cast_x
+                = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&x);
+            HIPAcceleratorVector<ValueType>* cast_y
+                = dynamic_cast<HIPAcceleratorVector<ValueType>*>(y);
+            const HIPAcceleratorVector<ValueType>* cast_z
+                = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&z);
+
+            assert(cast_x != NULL);
+            assert(cast_y != NULL);
+            assert(cast_z != NULL);
+            assert(this->size_ == cast_x->size_);
+            assert(this->size_ == cast_y->size_);
+            assert(this->size_ == cast_z->size_);
+
+            numeric_traits_t<ValueType>* workspace = NULL;
+            allocate_hip(256, &workspace);
+
+            kernel_axpy_pair_nrm2sq_blockreduce<256>
+                <<<dim3(256), dim3(256), 0, HIPSTREAM(this->local_backend_.HIP_stream_current)>>>(
+                    this->size_,
+                    alpha,
+                    cast_x->vec_,
+                    this->vec_,
+                    beta,
+                    cast_z->vec_,
+                    cast_y->vec_,
+                    workspace);
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+
+            kernel_nrm2sq_finalreduce<256>
+                <<<dim3(1), dim3(256), 0, HIPSTREAM(this->local_backend_.HIP_stream_current)>>>(
+                    workspace);
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+
+            numeric_traits_t<ValueType> norm2;
+            copy_d2h(1, workspace, &norm2);
+            free_hip(&workspace);
+
+            res = static_cast<ValueType>(norm2);
+        }
+
+        return res;
+    }
+
+    template <>
+    bool HIPAcceleratorVector<bool>::AddScalePairNormSquared(const BaseVector<bool>& x,
+                                                             bool                    alpha,
+                                                             BaseVector<bool>*       y,
+                                                             const BaseVector<bool>& z,
+                                                             bool                    beta)
+    {
+        LOG_INFO("No bool axpy function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int HIPAcceleratorVector<int>::AddScalePairNormSquared(const BaseVector<int>& x,
+                                                           int                    alpha,
+                                                           BaseVector<int>*       y,
+                                                           const BaseVector<int>& z,
+                                                           int                    beta)
+    {
+        LOG_INFO("No int axpy nrm2 function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int64_t HIPAcceleratorVector<int64_t>::AddScalePairNormSquared(const BaseVector<int64_t>& x,
+                                                                   int64_t                    alpha,
+                                                                   BaseVector<int64_t>*       y,
+                                                                   const BaseVector<int64_t>& z,
+                                                                   int64_t                    beta)
+    {
+        LOG_INFO("No integral axpy nrm2 function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     void HIPAcceleratorVector<ValueType>::Scale(ValueType alpha)
     {
@@ -885,6 +1034,189 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void HIPAcceleratorVector<ValueType>::DotBatched(const BaseVector<ValueType>& x,
+                                                     int                          num_vec,
+                                                     ValueType*                   result) const
+    {
+        const HIPAcceleratorVector<ValueType>* cast_x
+            = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(result != NULL);
+        assert(num_vec > 0);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vec == 0);
+
+        int64_t n = this->size_ / num_vec;
+
+        if(n > 0)
+        {
+            rocblas_status status;
+            status
+                = rocblasTdotc_strided_batched(ROCBLAS_HANDLE(this->local_backend_.ROC_blas_handle),
+                                               n,
+                                               this->vec_,
+                                               1,
+                                               n,
+                                               cast_x->vec_,
+                                               1,
+                                               n,
+                                               num_vec,
+                                               result);
+            CHECK_ROCBLAS_ERROR(status, __FILE__, __LINE__);
+
+            // Synchronize stream to make sure, result is available on the host
+            hipStreamSynchronize(HIPSTREAM(this->local_backend_.HIP_stream_current));
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+        }
+        else
+        {
+            for(int j = 0; j < num_vec; ++j)
+            {
+                result[j] = static_cast<ValueType>(0);
+            }
+        }
+    }
+
+    template <>
+    void HIPAcceleratorVector<bool>::DotBatched(const BaseVector<bool>& x,
+                                                int                     num_vec,
+                                                bool*                   result) const
+    {
+        LOG_INFO("No bool batched dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int>::DotBatched(const BaseVector<int>& x,
+                                               int                    num_vec,
+                                               int*                   result) const
+    {
+        LOG_INFO("No int batched dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int64_t>::DotBatched(const BaseVector<int64_t>& x,
+                                                   int                        num_vec,
+                                                   int64_t*                   result) const
+    {
+        LOG_INFO("No integral batched dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void HIPAcceleratorVector<ValueType>::DotNonConjBatched(
+        const BaseVector<ValueType>& x, int num_vec, ValueType* result) const
+    {
+        const HIPAcceleratorVector<ValueType>* cast_x
+            = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(result != NULL);
+        assert(num_vec > 0);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vec == 0);
+
+        int64_t n = this->size_ / num_vec;
+
+        if(n > 0)
+        {
+            rocblas_status status;
+            status
+                = rocblasTdotu_strided_batched(ROCBLAS_HANDLE(this->local_backend_.ROC_blas_handle),
+                                               n,
+                                               this->vec_,
+                                               1,
+                                               n,
+                                               cast_x->vec_,
+                                               1,
+                                               n,
+                                               num_vec,
+                                               result);
+            CHECK_ROCBLAS_ERROR(status, __FILE__, __LINE__);
+
+            // Synchronize stream to make sure, result is available on the host
+            hipStreamSynchronize(HIPSTREAM(this->local_backend_.HIP_stream_current));
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+        }
+        else
+        {
+            for(int j = 0; j < num_vec; ++j)
+            {
+                result[j] = static_cast<ValueType>(0);
+            }
+        }
+    }
+
+    template <>
+    void HIPAcceleratorVector<bool>::DotNonConjBatched(const BaseVector<bool>& x,
+                                                       int                     num_vec,
+                                                       bool*                   result) const
+    {
+        LOG_INFO("No bool batched dotu function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int>::DotNonConjBatched(const BaseVector<int>& x,
+                                                      int                    num_vec,
+                                                      int*                   result) const
+    {
+        LOG_INFO("No int batched dotu function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int64_t>::DotNonConjBatched(const BaseVector<int64_t>& x,
+                                                          int                        num_vec,
+                                                          int64_t*                   result) const
+    {
+        LOG_INFO("No integral batched dotu function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void HIPAcceleratorVector<ValueType>::ScaleAddScaleBatched(const ValueType*             alpha,
+                                                               const BaseVector<ValueType>& x,
+                                                               const ValueType*             beta,
+                                                               int num_vec)
+    {
+        assert(alpha != NULL);
+        assert(beta != NULL);
+        assert(num_vec > 0);
+
+        if(this->size_ > 0)
+        {
+            const HIPAcceleratorVector<ValueType>* cast_x
+                = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&x);
+
+            assert(cast_x != NULL);
+            assert(this->size_ == cast_x->size_);
+            assert(this->size_ % num_vec == 0);
+
+            // Scaling factors are passed to the kernel as device arrays
+            ValueType* coeff = NULL;
+            allocate_hip(2 * num_vec, &coeff);
+
+            copy_h2d(num_vec, alpha, coeff);
+            copy_h2d(num_vec, beta, coeff + num_vec);
+
+            dim3 BlockSize(this->local_backend_.HIP_block_size);
+            dim3 GridSize(this->size_ / this->local_backend_.HIP_block_size + 1);
+
+            kernel_scaleaddscale_batched<<<GridSize,
+                                           BlockSize,
+                                           0,
+                                           HIPSTREAM(this->local_backend_.HIP_stream_current)>>>(
+                this->size_ / num_vec, num_vec, coeff, coeff + num_vec, cast_x->vec_, this->vec_);
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+
+            free_hip(&coeff);
+        }
+    }
+
     template <typename ValueType>
     ValueType HIPAcceleratorVector<ValueType>::Norm(void) const
     {
@@ -103,6 +103,14 @@ namespace rocalution
                                ValueType                    beta,
                                const BaseVector<ValueType>& y,
                                ValueType                    gamma);
+        // this = this + alpha*x, return ||this||^2
+        virtual ValueType AddScaleNormSquared(const BaseVector<ValueType>& x, ValueType alpha);
+        // this = this + alpha*x, y = y + beta*z, return ||y||^2
+        virtual ValueType AddScalePairNormSquared(const BaseVector<ValueType>& x,
+                                                  ValueType                    alpha,
+                                                  BaseVector<ValueType>*       y,
+                                                  const BaseVector<ValueType>& z,
+                                                  ValueType                    beta);
         // this = alpha*this
         virtual void Scale(ValueType alpha);
 
@@ -110,6 +118,17 @@ namespace rocalution
         virtual ValueType Dot(const BaseVector<ValueType>& x) const;
         // this^T x
         virtual ValueType DotNonConj(const BaseVector<ValueType>& x) const;
+        // this_j^T x_j for each of the num_vec blocks
+        virtual void
+            DotBatched(const BaseVector<ValueType>& x, int num_vec, ValueType* result) const;
+        // non-conjugated this_j^T x_j for each of the num_vec blocks
+        virtual void
+            DotNonConjBatched(const BaseVector<ValueType>& x, int num_vec, ValueType* result) const;
+        // this_j = alpha[j]*this_j + beta[j]*x_j for each of the num_vec blocks
+        virtual void ScaleAddScaleBatched(const ValueType*             alpha,
+                                          const BaseVector<ValueType>& x,
+                                          const ValueType*             beta,
+                                          int                          num_vec);
         // srqt(this^T this)
         virtual ValueType Norm(void) const;
         // reduce
@@ -45,6 +45,11 @@
 
 #include "../../utils/log.hpp"
 
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
 namespace rocalution
 {
 
@@ -144,4 +149,196 @@ namespace rocalution
         }
     }
 
+#if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__)
+    // Parse a sysfs cpu list, e.g. "0-15,32-47"
+    static void _parse_cpu_list(const std::string& list, std::vector<int>* cpus)
+    {
+        std::stringstream ss(list);
+        std::string       range;
+
+        while(std::getline(ss, range, ','))
+        {
+            if(range.empty() == true)
+            {
+                continue;
+            }
+
+            size_t dash  = range.find('-');
+            int    first = std::stoi(range.substr(0, dash));
+            int    last  = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+
+            for(int i = first; i <= last; ++i)
+            {
+                cpus->push_back(i);
+            }
+        }
+    }
+
+    // Read a single line from a sysfs file
+    static bool _read_sysfs_line(const std::string& filename, std::string* line)
+    {
+        std::ifstream file(filename.c_str());
+
+        if(!file.is_open())
+        {
+            return false;
+        }
+
+        std::getline(file, *line);
+
+        return true;
+    }
+#endif // linux
+
+    // Core and NUMA node of each OpenMP thread, set by rocalution_set_omp_numa_affinity()
+    static std::vector<int> _omp_thread_cpu;
+    static std::vector<int> _omp_thread_node;
+    static int              _omp_num_nodes = 0;
+
+    void rocalution_set_omp_numa_affinity(void)
+    {
+        _omp_thread_cpu.clear();
+        _omp_thread_node.clear();
+        _omp_num_nodes = 0;
+
+#ifdef _OPENMP
+#if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__)
+        // Cores that are available to the process
+        cpu_set_t process_mask;
+        CPU_ZERO(&process_mask);
+
+        if(sched_getaffinity(0, sizeof(process_mask), &process_mask) != 0)
+        {
+            LOG_VERBOSE_INFO(2, "Cannot obtain the process affinity mask");
+            return;
+        }
+
+        // Available cores of each NUMA node
+        std::vector<std::vector<int>> node_cpus;
+        std::vector<int>              node_ids;
+        std::vector<int>              nodes;
+        std::string                   line;
+
+        if(_read_sysfs_line("/sys/devices/system/node/online", &line) == true)
+        {
+            _parse_cpu_list(line, &nodes);
+        }
+
+        for(size_t n = 0; n < nodes.size(); ++n)
+        {
+            std::vector<int> cpus;
+            std::vector<int> available;
+
+            if(_read_sysfs_line("/sys/devices/system/node/node" + std::to_string(nodes[n])
+                                    + "/cpulist",
+                                &line)
+               == true)
+            {
+                _parse_cpu_list(line, &cpus);
+            }
+
+            for(size_t i = 0; i < cpus.size(); ++i)
+            {
+                if(cpus[i] < CPU_SETSIZE && CPU_ISSET(cpus[i], &process_mask))
+                {
+                    available.push_back(cpus[i]);
+                }
+            }
+
+            if(available.empty() == false)
+            {
+                node_cpus.push_back(available);
+                node_ids.push_back(nodes[n]);
+            }
+        }
+
+        // No NUMA information, treat all available cores as a single node
+        if(node_cpus.empty() == true)
+        {
+            std::vector<int> available;
+
+            for(int i = 0; i < CPU_SETSIZE; ++i)
+            {
+                if(CPU_ISSET(i, &process_mask))
+                {
+                    available.push_back(i);
+                }
+            }
+
+            node_cpus.push_back(available);
+            node_ids.push_back(0);
+        }
+
+        int nnodes   = static_cast<int>(node_cpus.size());
+        int nthreads = omp_get_max_threads();
+
+        _omp_thread_cpu.resize(nthreads);
+        _omp_thread_node.resize(nthreads);
+        _omp_num_nodes = nnodes;
+
+        // Thread t is placed on node t * nnodes / nthreads, such that the chunks of a
+        // static partition are placed on consecutive nodes
+        for(int t = 0; t < nthreads; ++t)
+        {
+            int node  = static_cast<int>(static_cast<int64_t>(t) * nnodes / nthreads);
+            int first = static_cast<int>((static_cast<int64_t>(node) * nthreads + nnodes - 1)
+                                         / nnodes);
+
+            const std::vector<int>& cpus = node_cpus[node];
+
+            _omp_thread_node[t] = node_ids[node];
+            _omp_thread_cpu[t]  = cpus[(t - first) % cpus.size()];
+        }
+
+#pragma omp parallel num_threads(nthreads)
+        {
+            int tid = omp_get_thread_num();
+
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            CPU_SET(_omp_thread_cpu[tid], &mask);
+
+            sched_setaffinity(0, sizeof(mask), &mask);
+        }
+
+        LOG_VERBOSE_INFO(2,
+                         "Host thread affinity policy - NUMA, " << nthreads
+                                                                << " threads pinned on "
+                                                                << nnodes << " NUMA nodes");
+#else // !linux
+
+        LOG_VERBOSE_INFO(2, "The default OS thread affinity configuration will be used");
+
+#endif // linux
+#endif // omp
+    }
+
+    void rocalution_info_omp_numa(void)
+    {
+        if(_omp_num_nodes == 0)
+        {
+            LOG_INFO("OpenMP NUMA placement: not available");
+            return;
+        }
+
+        LOG_INFO("OpenMP NUMA placement: " << _omp_num_nodes << " NUMA node(s)");
+
+        int nthreads = static_cast<int>(_omp_thread_cpu.size());
+
+        for(int t = 0; t < nthreads;)
+        {
+            int first = t;
+
+            std::stringstream cpus;
+
+            for(; t < nthreads && _omp_thread_node[t] == _omp_thread_node[first]; ++t)
+            {
+                cpus << (t > first ? "," : "") << _omp_thread_cpu[t];
+            }
+
+            LOG_INFO("  NUMA node " << _omp_thread_node[first] << ": threads " << first << "-"
+                                    << t - 1 << " on cores " << cpus.str());
+        }
+    }
+
 } // namespace rocalution
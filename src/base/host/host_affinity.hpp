@@ -29,6 +29,13 @@ namespace rocalution
 
     void rocalution_set_omp_affinity(bool aff);
 
+    // Pin each OpenMP thread to a core, threads are distributed in contiguous blocks over
+    // the NUMA nodes (sockets), such that a static partition maps onto the NUMA nodes
+    void rocalution_set_omp_numa_affinity(void);
+
+    // Print the NUMA placement of the OpenMP threads
+    void rocalution_info_omp_numa(void);
+
 } // namespace rocalution
 
 #endif // ROCALUTION_HOST_HOST_AFFINITY_HPP_
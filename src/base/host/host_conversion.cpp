@@ -29,6 +29,7 @@
 #include "../matrix_formats_ind.hpp"
 #include "rocalution/utils/types.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <cstdlib>
 #include <limits>
@@ -761,6 +762,203 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_sell(int                                                 omp_threads,
+                     int64_t                                             nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixSELL<ValueType, IndexType, PointerType>*      dst,
+                     int64_t*                                            nnz_sell)
+    {
+        assert(nnz > 0);
+        assert(nrow > 0);
+        assert(ncol > 0);
+        assert(dst->slice_size > 0);
+        assert(dst->sigma % dst->slice_size == 0);
+
+        omp_set_num_threads(omp_threads);
+
+        IndexType C     = dst->slice_size;
+        IndexType sigma = dst->sigma;
+
+        dst->nslice = (nrow - 1) / C + 1;
+
+        allocate_host(nrow, &dst->perm);
+        allocate_host(dst->nslice + 1, &dst->slice_offset);
+
+        // Sort rows by decreasing length within each sorting scope sigma
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType scope = 0; scope < (nrow - 1) / sigma + 1; ++scope)
+        {
+            IndexType begin = scope * sigma;
+            IndexType end   = std::min(begin + sigma, nrow);
+
+            for(IndexType i = begin; i < end; ++i)
+            {
+                dst->perm[i] = i;
+            }
+
+            std::stable_sort(
+                dst->perm + begin, dst->perm + end, [&src](IndexType a, IndexType b) {
+                    return src.row_offset[a + 1] - src.row_offset[a]
+                           > src.row_offset[b + 1] - src.row_offset[b];
+                });
+        }
+
+        // Slice widths are determined by the longest row of each slice
+        dst->slice_offset[0] = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            PointerType width = 0;
+
+            for(IndexType r = s * C; r < std::min((s + 1) * C, nrow); ++r)
+            {
+                IndexType row = dst->perm[r];
+                width         = std::max(width, src.row_offset[row + 1] - src.row_offset[row]);
+            }
+
+            dst->slice_offset[s + 1] = width * C;
+        }
+
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            dst->slice_offset[s + 1] += dst->slice_offset[s];
+        }
+
+        *nnz_sell = dst->slice_offset[dst->nslice];
+
+        allocate_host(*nnz_sell, &dst->col);
+        allocate_host(*nnz_sell, &dst->val);
+
+        // Fill slices, padding is marked by negative column indices
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            PointerType offset = dst->slice_offset[s];
+            IndexType   width  = static_cast<IndexType>((dst->slice_offset[s + 1] - offset) / C);
+
+            for(IndexType r = 0; r < C; ++r)
+            {
+                IndexType n   = 0;
+                IndexType row = s * C + r;
+
+                if(row < nrow)
+                {
+                    IndexType i = dst->perm[row];
+
+                    for(PointerType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
+                    {
+                        PointerType ind = SELL_IND(offset, r, n, C);
+
+                        dst->col[ind] = src.col[j];
+                        dst->val[ind] = src.val[j];
+                        ++n;
+                    }
+                }
+
+                for(; n < width; ++n)
+                {
+                    PointerType ind = SELL_IND(offset, r, n, C);
+
+                    dst->col[ind] = static_cast<IndexType>(-1);
+                    dst->val[ind] = static_cast<ValueType>(0);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool sell_to_csr(int                                                  omp_threads,
+                     int64_t                                              nnz,
+                     IndexType                                            nrow,
+                     IndexType                                            ncol,
+                     const MatrixSELL<ValueType, IndexType, PointerType>& src,
+                     MatrixCSR<ValueType, IndexType, PointerType>*        dst,
+                     int64_t*                                             nnz_csr)
+    {
+        assert(nnz > 0);
+        assert(nrow > 0);
+        assert(ncol > 0);
+
+        omp_set_num_threads(omp_threads);
+
+        IndexType C = src.slice_size;
+
+        allocate_host(nrow + 1, &dst->row_offset);
+        set_to_zero_host(nrow + 1, dst->row_offset);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType row = 0; row < nrow; ++row)
+        {
+            IndexType   s      = row / C;
+            IndexType   r      = row % C;
+            PointerType offset = src.slice_offset[s];
+            IndexType   width  = static_cast<IndexType>((src.slice_offset[s + 1] - offset) / C);
+
+            PointerType row_nnz = 0;
+
+            for(IndexType n = 0; n < width; ++n)
+            {
+                if(src.col[SELL_IND(offset, r, n, C)] >= 0)
+                {
+                    ++row_nnz;
+                }
+            }
+
+            dst->row_offset[src.perm[row] + 1] = row_nnz;
+        }
+
+        for(IndexType i = 0; i < nrow; ++i)
+        {
+            dst->row_offset[i + 1] += dst->row_offset[i];
+        }
+
+        *nnz_csr = dst->row_offset[nrow];
+
+        allocate_host(*nnz_csr, &dst->col);
+        allocate_host(*nnz_csr, &dst->val);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType row = 0; row < nrow; ++row)
+        {
+            IndexType   s      = row / C;
+            IndexType   r      = row % C;
+            PointerType offset = src.slice_offset[s];
+            IndexType   width  = static_cast<IndexType>((src.slice_offset[s + 1] - offset) / C);
+
+            PointerType ind = dst->row_offset[src.perm[row]];
+
+            for(IndexType n = 0; n < width; ++n)
+            {
+                PointerType aj = SELL_IND(offset, r, n, C);
+
+                if(src.col[aj] >= 0)
+                {
+                    dst->col[ind] = src.col[aj];
+                    dst->val[ind] = src.val[aj];
+                    ++ind;
+                }
+            }
+        }
+
+        return true;
+    }
+
     template <typename ValueType, typename IndexType, typename PointerType>
     bool hyb_to_csr(int                                           omp_threads,
                     int64_t                                       nnz,
@@ -1721,6 +1919,74 @@ namespace rocalution
                              MatrixCSR<int, int, PtrType>* dst,
                              int64_t*                      nnz_csr);
 
+    template bool csr_to_sell(int                                    omp_threads,
+                              int64_t                                nnz,
+                              int                                    nrow,
+                              int                                    ncol,
+                              const MatrixCSR<double, int, PtrType>& src,
+                              MatrixSELL<double, int, PtrType>*      dst,
+                              int64_t*                               nnz_sell);
+
+    template bool csr_to_sell(int                                   omp_threads,
+                              int64_t                               nnz,
+                              int                                   nrow,
+                              int                                   ncol,
+                              const MatrixCSR<float, int, PtrType>& src,
+                              MatrixSELL<float, int, PtrType>*      dst,
+                              int64_t*                              nnz_sell);
+
+#ifdef SUPPORT_COMPLEX
+    template bool csr_to_sell(int                                                  omp_threads,
+                              int64_t                                              nnz,
+                              int                                                  nrow,
+                              int                                                  ncol,
+                              const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                              MatrixSELL<std::complex<double>, int, PtrType>*      dst,
+                              int64_t*                                             nnz_sell);
+
+    template bool csr_to_sell(int                                                 omp_threads,
+                              int64_t                                             nnz,
+                              int                                                 nrow,
+                              int                                                 ncol,
+                              const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                              MatrixSELL<std::complex<float>, int, PtrType>*      dst,
+                              int64_t*                                            nnz_sell);
+#endif
+
+    template bool sell_to_csr(int                                     omp_threads,
+                              int64_t                                 nnz,
+                              int                                     nrow,
+                              int                                     ncol,
+                              const MatrixSELL<double, int, PtrType>& src,
+                              MatrixCSR<double, int, PtrType>*        dst,
+                              int64_t*                                nnz_csr);
+
+    template bool sell_to_csr(int                                    omp_threads,
+                              int64_t                                nnz,
+                              int                                    nrow,
+                              int                                    ncol,
+                              const MatrixSELL<float, int, PtrType>& src,
+                              MatrixCSR<float, int, PtrType>*        dst,
+                              int64_t*                               nnz_csr);
+
+#ifdef SUPPORT_COMPLEX
+    template bool sell_to_csr(int                                                   omp_threads,
+                              int64_t                                               nnz,
+                              int                                                   nrow,
+                              int                                                   ncol,
+                              const MatrixSELL<std::complex<double>, int, PtrType>& src,
+                              MatrixCSR<std::complex<double>, int, PtrType>*        dst,
+                              int64_t*                                              nnz_csr);
+
+    template bool sell_to_csr(int                                                  omp_threads,
+                              int64_t                                              nnz,
+                              int                                                  nrow,
+                              int                                                  ncol,
+                              const MatrixSELL<std::complex<float>, int, PtrType>& src,
+                              MatrixCSR<std::complex<float>, int, PtrType>*        dst,
+                              int64_t*                                             nnz_csr);
+#endif
+
     template bool coo_to_csr(int                              omp_threads,
                              int64_t                          nnz,
                              int                              nrow,
@@ -90,6 +90,15 @@ namespace rocalution
                     int64_t*                                            nnz_ell,
                     int64_t*                                            nnz_coo);
 
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_sell(int                                                 omp_threads,
+                     int64_t                                             nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixSELL<ValueType, IndexType, PointerType>*      dst,
+                     int64_t*                                            nnz_sell);
+
     template <typename ValueType, typename IndexType, typename PointerType>
     bool bcsr_to_csr(int                                           omp_threads,
                      int64_t                                       nnz,
@@ -124,6 +133,15 @@ namespace rocalution
                     MatrixCSR<ValueType, IndexType, PointerType>* dst,
                     int64_t*                                      nnz_csr);
 
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool sell_to_csr(int                                                  omp_threads,
+                     int64_t                                              nnz,
+                     IndexType                                            nrow,
+                     IndexType                                            ncol,
+                     const MatrixSELL<ValueType, IndexType, PointerType>& src,
+                     MatrixCSR<ValueType, IndexType, PointerType>*        dst,
+                     int64_t*                                             nnz_csr);
+
     template <typename ValueType, typename IndexType, typename PointerType>
     bool coo_to_csr(int                                           omp_threads,
                     int64_t                                       nnz,
@@ -0,0 +1,1152 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_graph.hpp"
+#include "../../utils/def.hpp"
+
+#include "rocalution/utils/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#define omp_get_num_threads() 1
+#define omp_get_thread_num() 0
+#endif
+
+namespace rocalution
+{
+    // Priority of a vertex, a hash of its index with the index breaking ties
+    static inline uint64_t host_graph_priority(int64_t i, unsigned int seed)
+    {
+        // Murmur3 finalizer
+        uint32_t h = static_cast<uint32_t>(i) * 0x9e3779b9u + seed;
+
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+
+        return (static_cast<uint64_t>(h) << 32) | static_cast<uint32_t>(i);
+    }
+
+    // Copy all vertices of the work list in, that satisfy keep(), to out, preserving
+    // their order. Returns the number of copied vertices.
+    template <typename J, typename Predicate>
+    static J host_graph_compact(J size, const J* in, J* out, Predicate keep)
+    {
+        std::vector<J> offset;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int nthreads = omp_get_num_threads();
+            int tid      = omp_get_thread_num();
+
+#ifdef _OPENMP
+#pragma omp single
+#endif
+            offset.assign(nthreads + 1, 0);
+
+            J begin = static_cast<J>(static_cast<int64_t>(size) * tid / nthreads);
+            J end   = static_cast<J>(static_cast<int64_t>(size) * (tid + 1) / nthreads);
+
+            J count = 0;
+
+            for(J k = begin; k < end; ++k)
+            {
+                if(keep(in[k]))
+                {
+                    ++count;
+                }
+            }
+
+            offset[tid + 1] = count;
+
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+            for(int t = 0; t < nthreads; ++t)
+            {
+                offset[t + 1] += offset[t];
+            }
+
+            J pos = offset[tid];
+
+            for(J k = begin; k < end; ++k)
+            {
+                if(keep(in[k]))
+                {
+                    out[pos++] = in[k];
+                }
+            }
+        }
+
+        return offset.back();
+    }
+
+    template <typename I, typename J>
+    bool host_graph_transpose(J        n,
+                              const I* row_ptr,
+                              const J* col_ind,
+                              I*       t_row_ptr,
+                              J*       t_col_ind)
+    {
+        for(J i = 0; i < n + 1; ++i)
+        {
+            t_row_ptr[i] = 0;
+        }
+
+        // Count the entries of each column
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            for(I j = row_ptr[i]; j < row_ptr[i + 1]; ++j)
+            {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                ++t_row_ptr[col_ind[j] + 1];
+            }
+        }
+
+        for(J i = 0; i < n; ++i)
+        {
+            t_row_ptr[i + 1] += t_row_ptr[i];
+        }
+
+        // Fill the columns, the order of the entries within a column is unspecified
+        std::vector<I> pos(t_row_ptr, t_row_ptr + n);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            for(I j = row_ptr[i]; j < row_ptr[i + 1]; ++j)
+            {
+                I idx;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                idx = pos[col_ind[j]]++;
+
+                t_col_ind[idx] = i;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename I, typename J>
+    bool host_graph_is_symmetric(J n, const I* row_ptr, const J* col_ind)
+    {
+        bool symmetric = true;
+
+        // Column indices have to be sorted for the binary search
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : symmetric)
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            for(I j = row_ptr[i] + 1; j < row_ptr[i + 1] && symmetric; ++j)
+            {
+                symmetric = (col_ind[j - 1] < col_ind[j]);
+            }
+        }
+
+        if(symmetric == false)
+        {
+            return false;
+        }
+
+        // Each entry (i, j) with j > i requires an entry (j, i). Then, the pattern is
+        // symmetric, if the number of entries below and above the diagonal match.
+        int64_t balance = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : symmetric) reduction(+ : balance)
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            for(I j = row_ptr[i]; j < row_ptr[i + 1] && symmetric; ++j)
+            {
+                J c = col_ind[j];
+
+                if(c < i)
+                {
+                    ++balance;
+                }
+                else if(c > i)
+                {
+                    --balance;
+
+                    symmetric
+                        = std::binary_search(col_ind + row_ptr[c], col_ind + row_ptr[c + 1], i);
+                }
+            }
+        }
+
+        return symmetric && (balance == 0);
+    }
+
+    template <typename I, typename J>
+    bool host_graph_coloring(J            n,
+                             const I*     row_ptr,
+                             const J*     col_ind,
+                             const I*     t_row_ptr,
+                             const J*     t_col_ind,
+                             unsigned int seed,
+                             J*           color,
+                             J*           num_colors)
+    {
+        std::vector<J>    work(n);
+        std::vector<J>    next(n);
+        std::vector<char> selected(n);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            work[i]  = i;
+            color[i] = 0;
+        }
+
+        J nwork     = n;
+        J max_color = 0;
+
+        while(nwork > 0)
+        {
+            // Select the uncolored vertices of maximal priority in their neighborhood.
+            // Adjacent vertices are never selected in the same round.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(J k = 0; k < nwork; ++k)
+            {
+                J        v       = work[k];
+                uint64_t p       = host_graph_priority(v, seed);
+                bool     sel     = true;
+                I        t_begin = (t_row_ptr != NULL) ? t_row_ptr[v] : 0;
+                I        t_end   = (t_row_ptr != NULL) ? t_row_ptr[v + 1] : 0;
+
+                for(I j = row_ptr[v]; j < row_ptr[v + 1] && sel; ++j)
+                {
+                    J u = col_ind[j];
+                    sel = (u == v || color[u] != 0 || host_graph_priority(u, seed) < p);
+                }
+
+                for(I j = t_begin; j < t_end && sel; ++j)
+                {
+                    J u = t_col_ind[j];
+                    sel = (u == v || color[u] != 0 || host_graph_priority(u, seed) < p);
+                }
+
+                selected[v] = sel;
+            }
+
+            // Color the selected vertices with the smallest color that is not used by
+            // their (previously colored) neighbors
+#ifdef _OPENMP
+#pragma omp parallel reduction(max : max_color)
+#endif
+            {
+                // Marks the colors of the neighbors of vertex v with v
+                std::vector<J> mark;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+                for(J k = 0; k < nwork; ++k)
+                {
+                    J v = work[k];
+
+                    if(selected[v] == false)
+                    {
+                        continue;
+                    }
+
+                    I t_begin = (t_row_ptr != NULL) ? t_row_ptr[v] : 0;
+                    I t_end   = (t_row_ptr != NULL) ? t_row_ptr[v + 1] : 0;
+
+                    J deg = static_cast<J>(row_ptr[v + 1] - row_ptr[v] + t_end - t_begin);
+
+                    if(static_cast<J>(mark.size()) < deg + 2)
+                    {
+                        mark.resize(deg + 2, -1);
+                    }
+
+                    for(I j = row_ptr[v]; j < row_ptr[v + 1]; ++j)
+                    {
+                        J c = color[col_ind[j]];
+
+                        if(c <= deg + 1)
+                        {
+                            mark[c] = v;
+                        }
+                    }
+
+                    for(I j = t_begin; j < t_end; ++j)
+                    {
+                        J c = color[t_col_ind[j]];
+
+                        if(c <= deg + 1)
+                        {
+                            mark[c] = v;
+                        }
+                    }
+
+                    J c = 1;
+
+                    while(mark[c] == v)
+                    {
+                        ++c;
+                    }
+
+                    color[v]  = c;
+                    max_color = std::max(max_color, c);
+                }
+            }
+
+            nwork = host_graph_compact(
+                nwork, work.data(), next.data(), [color](J v) { return color[v] == 0; });
+
+            work.swap(next);
+        }
+
+        *num_colors = max_color;
+
+        return true;
+    }
+
+    template <typename I, typename J>
+    bool host_graph_mis(J            n,
+                        const I*     row_ptr,
+                        const J*     col_ind,
+                        const I*     t_row_ptr,
+                        const J*     t_col_ind,
+                        unsigned int seed,
+                        J*           mis,
+                        J*           size)
+    {
+        std::vector<J>    work(n);
+        std::vector<J>    next(n);
+        std::vector<char> selected(n);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            work[i] = i;
+            mis[i]  = 0;
+        }
+
+        J nwork = n;
+
+        while(nwork > 0)
+        {
+            // Select the undecided vertices of maximal priority in their neighborhood
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(J k = 0; k < nwork; ++k)
+            {
+                J        v       = work[k];
+                uint64_t p       = host_graph_priority(v, seed);
+                bool     sel     = true;
+                I        t_begin = (t_row_ptr != NULL) ? t_row_ptr[v] : 0;
+                I        t_end   = (t_row_ptr != NULL) ? t_row_ptr[v + 1] : 0;
+
+                for(I j = row_ptr[v]; j < row_ptr[v + 1] && sel; ++j)
+                {
+                    J u = col_ind[j];
+                    sel = (u == v || mis[u] != 0 || host_graph_priority(u, seed) < p);
+                }
+
+                for(I j = t_begin; j < t_end && sel; ++j)
+                {
+                    J u = t_col_ind[j];
+                    sel = (u == v || mis[u] != 0 || host_graph_priority(u, seed) < p);
+                }
+
+                selected[v] = sel;
+            }
+
+            // Add the selected vertices to the set and remove their neighbors. Vertices
+            // that have been selected in previous rounds have no undecided neighbors.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(J k = 0; k < nwork; ++k)
+            {
+                J v       = work[k];
+                I t_begin = (t_row_ptr != NULL) ? t_row_ptr[v] : 0;
+                I t_end   = (t_row_ptr != NULL) ? t_row_ptr[v + 1] : 0;
+
+                if(selected[v] == true)
+                {
+                    mis[v] = 1;
+                    continue;
+                }
+
+                bool removed = false;
+
+                for(I j = row_ptr[v]; j < row_ptr[v + 1] && !removed; ++j)
+                {
+                    removed = (col_ind[j] != v && selected[col_ind[j]] == true);
+                }
+
+                for(I j = t_begin; j < t_end && !removed; ++j)
+                {
+                    removed = (t_col_ind[j] != v && selected[t_col_ind[j]] == true);
+                }
+
+                if(removed == true)
+                {
+                    mis[v] = -1;
+                }
+            }
+
+            nwork = host_graph_compact(
+                nwork, work.data(), next.data(), [mis](J v) { return mis[v] == 0; });
+
+            work.swap(next);
+        }
+
+        J count = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : count)
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            count += (mis[i] == 1) ? 1 : 0;
+        }
+
+        *size = count;
+
+        return true;
+    }
+
+    template <typename I, typename J>
+    bool host_graph_symmetrize(J               n,
+                               const I*        row_ptr,
+                               const J*        col_ind,
+                               std::vector<I>& adj_ptr,
+                               std::vector<J>& adj_ind)
+    {
+        bool symmetric = host_graph_is_symmetric(n, row_ptr, col_ind);
+
+        std::vector<I> t_row_ptr;
+        std::vector<J> t_col_ind;
+
+        if(symmetric == false)
+        {
+            t_row_ptr.resize(n + 1);
+            t_col_ind.resize(row_ptr[n]);
+
+            host_graph_transpose(n, row_ptr, col_ind, t_row_ptr.data(), t_col_ind.data());
+        }
+
+        adj_ptr.assign(n + 1, 0);
+
+        // The first pass counts the neighbors of each vertex, the second pass fills them
+        for(int pass = 0; pass < 2; ++pass)
+        {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                std::vector<J> row;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+                for(J i = 0; i < n; ++i)
+                {
+                    row.clear();
+
+                    for(I j = row_ptr[i]; j < row_ptr[i + 1]; ++j)
+                    {
+                        if(col_ind[j] != i)
+                        {
+                            row.push_back(col_ind[j]);
+                        }
+                    }
+
+                    // Merge with the transposed row, a symmetric pattern is already sorted
+                    if(symmetric == false)
+                    {
+                        for(I j = t_row_ptr[i]; j < t_row_ptr[i + 1]; ++j)
+                        {
+                            if(t_col_ind[j] != i)
+                            {
+                                row.push_back(t_col_ind[j]);
+                            }
+                        }
+
+                        std::sort(row.begin(), row.end());
+                        row.erase(std::unique(row.begin(), row.end()), row.end());
+                    }
+
+                    if(pass == 0)
+                    {
+                        adj_ptr[i + 1] = static_cast<I>(row.size());
+                    }
+                    else
+                    {
+                        std::copy(row.begin(), row.end(), adj_ind.begin() + adj_ptr[i]);
+                    }
+                }
+            }
+
+            if(pass == 0)
+            {
+                for(J i = 0; i < n; ++i)
+                {
+                    adj_ptr[i + 1] += adj_ptr[i];
+                }
+
+                adj_ind.resize(adj_ptr[n]);
+            }
+        }
+
+        return true;
+    }
+
+    // State of a vertex during the Cuthill-McKee ordering, kept together such that the
+    // random accesses of the searches touch a single cache line per vertex
+    template <typename J>
+    struct host_graph_cm_vertex
+    {
+        // Non-zero, if the vertex has been reached by the current search
+        J mark;
+        // Level of the vertex in the last search
+        J level;
+        // Position of the vertex in the ordering
+        J order;
+    };
+
+    // Level synchronous breadth-first search from vertex root, that determines the level
+    // structure. The reached vertices are written level by level to queue, starting at
+    // position begin, the order within a level is unspecified. The vertices of the
+    // component have to be unmarked. Returns the number of levels, level_ptr holds the
+    // beginning of each level in queue followed by the end of the search.
+    template <typename I, typename J>
+    static J host_graph_bfs_levels(const I*                 adj_ptr,
+                                   const J*                 adj_ind,
+                                   J                        root,
+                                   J                        begin,
+                                   J*                       queue,
+                                   host_graph_cm_vertex<J>* vertex,
+                                   std::vector<J>&          level_ptr)
+    {
+        queue[begin]        = root;
+        vertex[root].mark  = 1;
+        vertex[root].level = 0;
+
+        level_ptr.assign(1, begin);
+        level_ptr.push_back(begin + 1);
+
+        std::vector<J> offset;
+
+        while(true)
+        {
+            J nlevel      = static_cast<J>(level_ptr.size()) - 1;
+            J level_begin = level_ptr[nlevel - 1];
+            J level_end   = level_ptr[nlevel];
+            J width       = level_end - level_begin;
+            J next_width  = 0;
+
+            // Narrow levels are searched sequentially, avoiding the synchronization
+            if(width <= 256 || omp_get_max_threads() == 1)
+            {
+                J next_end = level_end;
+
+                for(J k = level_begin; k < level_end; ++k)
+                {
+                    J u = queue[k];
+
+                    for(I j = adj_ptr[u]; j < adj_ptr[u + 1]; ++j)
+                    {
+                        J w = adj_ind[j];
+
+                        if(vertex[w].mark == 0)
+                        {
+                            vertex[w].mark  = 1;
+                            vertex[w].level = nlevel;
+                            queue[next_end] = w;
+                            ++next_end;
+                        }
+                    }
+                }
+
+                next_width = next_end - level_end;
+            }
+            else
+            {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+                {
+                    int nthreads = omp_get_num_threads();
+                    int tid      = omp_get_thread_num();
+
+#ifdef _OPENMP
+#pragma omp single
+#endif
+                    offset.assign(nthreads + 1, 0);
+
+                    J k_begin = level_begin
+                                + static_cast<J>(static_cast<int64_t>(width) * tid / nthreads);
+                    J k_end   = level_begin
+                              + static_cast<J>(static_cast<int64_t>(width) * (tid + 1) / nthreads);
+
+                    std::vector<J> found;
+
+                    for(J k = k_begin; k < k_end; ++k)
+                    {
+                        J u = queue[k];
+
+                        for(I j = adj_ptr[u]; j < adj_ptr[u + 1]; ++j)
+                        {
+                            J w = adj_ind[j];
+                            J m;
+
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+                            m = vertex[w].mark;
+
+                            if(m != 0)
+                            {
+                                continue;
+                            }
+
+                            // The thread that increments the mark first claims the vertex
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                            m = vertex[w].mark++;
+
+                            if(m == 0)
+                            {
+                                vertex[w].level = nlevel;
+                                found.push_back(w);
+                            }
+                        }
+                    }
+
+                    offset[tid + 1] = static_cast<J>(found.size());
+
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+                    for(int t = 0; t < nthreads; ++t)
+                    {
+                        offset[t + 1] += offset[t];
+                    }
+
+                    std::copy(found.begin(), found.end(), queue + level_end + offset[tid]);
+                }
+
+                next_width = offset.back();
+            }
+
+            if(next_width == 0)
+            {
+                break;
+            }
+
+            level_ptr.push_back(level_end + next_width);
+        }
+
+        return static_cast<J>(level_ptr.size()) - 1;
+    }
+
+    // Order the level structure of a search from queue[level_ptr[0]] in Cuthill-McKee
+    // order. The parent of a vertex is its first neighbor in the previous level. The
+    // vertices of a level are ordered by the position of their parent, the children of
+    // the same parent by degree and index.
+    template <typename I, typename J>
+    static void host_graph_cm_order(const I*                 adj_ptr,
+                                    const J*                 adj_ind,
+                                    const std::vector<J>&    level_ptr,
+                                    J*                       queue,
+                                    host_graph_cm_vertex<J>* vertex)
+    {
+        J nlevel = static_cast<J>(level_ptr.size()) - 1;
+
+        vertex[queue[level_ptr[0]]].order = level_ptr[0];
+
+        std::vector<J> parent;
+        std::vector<J> count;
+        std::vector<J> next;
+
+        auto by_degree = [adj_ptr](J a, J b) {
+            I deg_a = adj_ptr[a + 1] - adj_ptr[a];
+            I deg_b = adj_ptr[b + 1] - adj_ptr[b];
+
+            return (deg_a < deg_b) || (deg_a == deg_b && a < b);
+        };
+
+        for(J lev = 0; lev < nlevel - 1; ++lev)
+        {
+            J level_begin = level_ptr[lev];
+            J width       = level_ptr[lev + 1] - level_begin;
+            J next_begin  = level_ptr[lev + 1];
+            J next_width  = level_ptr[lev + 2] - next_begin;
+
+            // Narrow levels are ordered sequentially, appending the children of each vertex
+            // in the order of the current level
+            if(next_width <= 256 || omp_get_max_threads() == 1)
+            {
+                J next_end = next_begin;
+
+                for(J k = level_begin; k < next_begin; ++k)
+                {
+                    J u     = queue[k];
+                    J first = next_end;
+
+                    for(I j = adj_ptr[u]; j < adj_ptr[u + 1]; ++j)
+                    {
+                        J w = adj_ind[j];
+
+                        if(vertex[w].level == lev + 1 && vertex[w].order < 0)
+                        {
+                            vertex[w].order = next_end;
+                            queue[next_end] = w;
+                            ++next_end;
+                        }
+                    }
+
+                    std::sort(queue + first, queue + next_end, by_degree);
+                }
+
+                for(J k = next_begin; k < next_end; ++k)
+                {
+                    vertex[queue[k]].order = k;
+                }
+
+                continue;
+            }
+
+            parent.resize(next_width);
+            next.resize(next_width);
+            count.assign(width + 1, 0);
+
+            // Determine the parent of each vertex of the next level and count the
+            // children of each vertex of the current level
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+            for(J k = 0; k < next_width; ++k)
+            {
+                J w = queue[next_begin + k];
+                J p = next_begin;
+
+                for(I j = adj_ptr[w]; j < adj_ptr[w + 1]; ++j)
+                {
+                    const host_graph_cm_vertex<J>& x = vertex[adj_ind[j]];
+
+                    if(x.level == lev && x.order < p)
+                    {
+                        p = x.order;
+                    }
+                }
+
+                parent[k] = p - level_begin;
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                ++count[parent[k] + 1];
+            }
+
+            for(J k = 0; k < width; ++k)
+            {
+                count[k + 1] += count[k];
+            }
+
+            // Group the next level by parent
+            std::vector<J> pos(count.begin(), count.end() - 1);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(J k = 0; k < next_width; ++k)
+            {
+                J idx;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                idx = pos[parent[k]]++;
+
+                next[idx] = queue[next_begin + k];
+            }
+
+            // Order the children of each parent by degree
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+            for(J k = 0; k < width; ++k)
+            {
+                std::sort(next.begin() + count[k], next.begin() + count[k + 1], by_degree);
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(J k = 0; k < next_width; ++k)
+            {
+                queue[next_begin + k]  = next[k];
+                vertex[next[k]].order = next_begin + k;
+            }
+        }
+    }
+
+    template <typename I, typename J>
+    bool host_graph_cuthill_mckee(J n, const I* adj_ptr, const J* adj_ind, J* perm)
+    {
+        std::vector<J>                       queue(n);
+        std::vector<host_graph_cm_vertex<J>> vertex(n);
+        std::vector<J>                       level_ptr;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            vertex[i].mark  = 0;
+            vertex[i].level = -1;
+            vertex[i].order = -1;
+        }
+
+        J begin  = 0;
+        J cursor = 0;
+
+        // Each iteration orders one connected component
+        while(begin < n)
+        {
+            while(vertex[cursor].mark != 0)
+            {
+                ++cursor;
+            }
+
+            // Search for a pseudo-peripheral vertex (George-Liu), restarting from a
+            // vertex of minimum degree in the last level as long as the number of
+            // levels increases
+            J root   = cursor;
+            J nlevel = host_graph_bfs_levels(
+                adj_ptr, adj_ind, root, begin, queue.data(), vertex.data(), level_ptr);
+
+            while(nlevel > 1)
+            {
+                J candidate = queue[level_ptr[nlevel - 1]];
+
+                for(J k = level_ptr[nlevel - 1] + 1; k < level_ptr[nlevel]; ++k)
+                {
+                    J v = queue[k];
+
+                    I deg_v = adj_ptr[v + 1] - adj_ptr[v];
+                    I deg_c = adj_ptr[candidate + 1] - adj_ptr[candidate];
+
+                    if(deg_v < deg_c || (deg_v == deg_c && v < candidate))
+                    {
+                        candidate = v;
+                    }
+                }
+
+                for(J k = begin; k < level_ptr[nlevel]; ++k)
+                {
+                    vertex[queue[k]].mark = 0;
+                }
+
+                // The eccentricity of the candidate is at least the one of root, thus
+                // its level structure is kept
+                J candidate_nlevel = host_graph_bfs_levels(
+                    adj_ptr, adj_ind, candidate, begin, queue.data(), vertex.data(), level_ptr);
+
+                root = candidate;
+
+                if(candidate_nlevel <= nlevel)
+                {
+                    break;
+                }
+
+                nlevel = candidate_nlevel;
+            }
+
+            host_graph_cm_order(adj_ptr, adj_ind, level_ptr, queue.data(), vertex.data());
+
+            begin = level_ptr.back();
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            perm[i] = vertex[i].order;
+        }
+
+        return true;
+    }
+
+    template <typename I, typename J>
+    bool host_graph_locality_order(
+        J n, const I* adj_ptr, const J* adj_ind, J window, J* perm)
+    {
+        if(n == 0)
+        {
+            return true;
+        }
+
+        // Unit heap, vertices are kept in doubly linked lists, one for each key
+        std::vector<J> key(n, 0);
+        std::vector<J> prev(n);
+        std::vector<J> next(n);
+        std::vector<J> head(1, 0);
+        std::vector<J> seq(n);
+
+        J top = 0;
+
+        for(J i = 0; i < n; ++i)
+        {
+            prev[i] = i - 1;
+            next[i] = (i + 1 < n) ? i + 1 : -1;
+            perm[i] = -1;
+        }
+
+        auto unlink = [&](J v) {
+            if(prev[v] >= 0)
+            {
+                next[prev[v]] = next[v];
+            }
+            else
+            {
+                head[key[v]] = next[v];
+            }
+
+            if(next[v] >= 0)
+            {
+                prev[next[v]] = prev[v];
+            }
+        };
+
+        auto update = [&](J v, J delta) {
+            if(perm[v] >= 0)
+            {
+                return;
+            }
+
+            unlink(v);
+
+            key[v] += delta;
+
+            if(key[v] >= static_cast<J>(head.size()))
+            {
+                head.resize(key[v] + 1, -1);
+            }
+
+            prev[v] = -1;
+            next[v] = head[key[v]];
+
+            if(next[v] >= 0)
+            {
+                prev[next[v]] = v;
+            }
+
+            head[key[v]] = v;
+            top          = std::max(top, key[v]);
+        };
+
+        // Vertices of larger degree are not used to relate their neighbors
+        I max_sibling_degree = static_cast<I>(std::sqrt(static_cast<double>(n)));
+
+        // Add (delta = 1) or remove (delta = -1) vertex v from the window
+        auto slide = [&](J v, J delta) {
+            for(I j = adj_ptr[v]; j < adj_ptr[v + 1]; ++j)
+            {
+                J x = adj_ind[j];
+
+                update(x, delta);
+
+                if(adj_ptr[x + 1] - adj_ptr[x] > max_sibling_degree)
+                {
+                    continue;
+                }
+
+                for(I l = adj_ptr[x]; l < adj_ptr[x + 1]; ++l)
+                {
+                    if(adj_ind[l] != v)
+                    {
+                        update(adj_ind[l], delta);
+                    }
+                }
+            }
+        };
+
+        // Start with a vertex of maximum degree
+        J start = 0;
+
+        for(J i = 1; i < n; ++i)
+        {
+            if(adj_ptr[i + 1] - adj_ptr[i] > adj_ptr[start + 1] - adj_ptr[start])
+            {
+                start = i;
+            }
+        }
+
+        for(J k = 0; k < n; ++k)
+        {
+            J v = start;
+
+            if(k > 0)
+            {
+                while(head[top] < 0)
+                {
+                    --top;
+                }
+
+                v = head[top];
+            }
+
+            unlink(v);
+
+            perm[v] = k;
+            seq[k]  = v;
+
+            slide(v, 1);
+
+            if(k >= window)
+            {
+                slide(seq[k - window], -1);
+            }
+        }
+
+        return true;
+    }
+
+    template <typename I, typename J>
+    bool host_graph_bandwidth(J        n,
+                              const I* row_ptr,
+                              const J* col_ind,
+                              const J* perm,
+                              int64_t* bandwidth,
+                              int64_t* profile)
+    {
+        int64_t bw   = 0;
+        int64_t prof = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(max : bw) reduction(+ : prof)
+#endif
+        for(J i = 0; i < n; ++i)
+        {
+            int64_t pi    = (perm != NULL) ? perm[i] : i;
+            int64_t first = pi;
+
+            for(I j = row_ptr[i]; j < row_ptr[i + 1]; ++j)
+            {
+                int64_t pj = (perm != NULL) ? perm[col_ind[j]] : col_ind[j];
+
+                bw    = std::max(bw, std::abs(pi - pj));
+                first = std::min(first, pj);
+            }
+
+            prof += pi - first;
+        }
+
+        *bandwidth = bw;
+        *profile   = prof;
+
+        return true;
+    }
+
+    template bool host_graph_transpose<PtrType, int>(int            n,
+                                                     const PtrType* row_ptr,
+                                                     const int*     col_ind,
+                                                     PtrType*       t_row_ptr,
+                                                     int*           t_col_ind);
+
+    template bool host_graph_is_symmetric<PtrType, int>(int            n,
+                                                        const PtrType* row_ptr,
+                                                        const int*     col_ind);
+
+    template bool host_graph_coloring<PtrType, int>(int            n,
+                                                    const PtrType* row_ptr,
+                                                    const int*     col_ind,
+                                                    const PtrType* t_row_ptr,
+                                                    const int*     t_col_ind,
+                                                    unsigned int   seed,
+                                                    int*           color,
+                                                    int*           num_colors);
+
+    template bool host_graph_mis<PtrType, int>(int            n,
+                                               const PtrType* row_ptr,
+                                               const int*     col_ind,
+                                               const PtrType* t_row_ptr,
+                                               const int*     t_col_ind,
+                                               unsigned int   seed,
+                                               int*           mis,
+                                               int*           size);
+
+    template bool host_graph_symmetrize<PtrType, int>(int                   n,
+                                                      const PtrType*        row_ptr,
+                                                      const int*            col_ind,
+                                                      std::vector<PtrType>& adj_ptr,
+                                                      std::vector<int>&     adj_ind);
+
+    template bool host_graph_cuthill_mckee<PtrType, int>(int            n,
+                                                         const PtrType* adj_ptr,
+                                                         const int*     adj_ind,
+                                                         int*           perm);
+
+    template bool host_graph_locality_order<PtrType, int>(
+        int n, const PtrType* adj_ptr, const int* adj_ind, int window, int* perm);
+
+    template bool host_graph_bandwidth<PtrType, int>(int            n,
+                                                     const PtrType* row_ptr,
+                                                     const int*     col_ind,
+                                                     const int*     perm,
+                                                     int64_t*       bandwidth,
+                                                     int64_t*       profile);
+
+} // namespace rocalution
@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_GRAPH_HPP_
+#define ROCALUTION_HOST_HOST_GRAPH_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace rocalution
+{
+    // The graph algorithms below operate on the adjacency graph of a square sparsity
+    // pattern, symmetrized by the pattern of its transpose. The transposed pattern can
+    // be NULL, if the pattern is symmetric. Diagonal entries are ignored. The results
+    // depend on the seed only, not on the number of threads.
+
+    // Check, whether a square CSR sparsity pattern with sorted column indices is
+    // structurally symmetric. Returns false, if the column indices are not sorted.
+    template <typename I, typename J>
+    bool host_graph_is_symmetric(J n, const I* row_ptr, const J* col_ind);
+
+    // Compute the transposed sparsity pattern of a square n x n CSR matrix. t_row_ptr
+    // and t_col_ind must be allocated with n + 1 and nnz entries, respectively.
+    template <typename I, typename J>
+    bool host_graph_transpose(J        n,
+                              const I* row_ptr,
+                              const J* col_ind,
+                              I*       t_row_ptr,
+                              J*       t_col_ind);
+
+    // Jones-Plassmann coloring with hashed vertex priorities. Each round colors all
+    // uncolored vertices of locally maximal priority with the smallest color that is
+    // not used by their neighbors. Colors start at 1.
+    template <typename I, typename J>
+    bool host_graph_coloring(J            n,
+                             const I*     row_ptr,
+                             const J*     col_ind,
+                             const I*     t_row_ptr,
+                             const J*     t_col_ind,
+                             unsigned int seed,
+                             J*           color,
+                             J*           num_colors);
+
+    // Luby maximal independent set with hashed vertex priorities. Each round adds all
+    // undecided vertices of locally maximal priority to the set and removes their
+    // neighbors. On return, mis is 1 for vertices in the set and -1 otherwise.
+    template <typename I, typename J>
+    bool host_graph_mis(J            n,
+                        const I*     row_ptr,
+                        const J*     col_ind,
+                        const I*     t_row_ptr,
+                        const J*     t_col_ind,
+                        unsigned int seed,
+                        J*           mis,
+                        J*           size);
+
+    // Symmetric adjacency graph of a square CSR sparsity pattern, that is the union of
+    // the pattern and its transpose without diagonal entries. The column indices of
+    // each row are sorted.
+    template <typename I, typename J>
+    bool host_graph_symmetrize(J               n,
+                               const I*        row_ptr,
+                               const J*        col_ind,
+                               std::vector<I>& adj_ptr,
+                               std::vector<J>& adj_ind);
+
+    // Cuthill-McKee ordering of a structurally symmetric pattern (see
+    // host_graph_symmetrize). Each connected component is traversed by a level
+    // synchronous breadth-first search, starting from a pseudo-peripheral vertex
+    // (George-Liu). The vertices of a level are ordered by their parent and then by
+    // degree, such that the result matches the sequential algorithm. Levels of up to 256
+    // vertices are processed sequentially. Diagonal entries only contribute to the
+    // degree. perm[i] is the new index of vertex i.
+    template <typename I, typename J>
+    bool host_graph_cuthill_mckee(J n, const I* adj_ptr, const J* adj_ind, J* perm);
+
+    // Greedy locality ordering (Gorder) of a symmetric adjacency graph without diagonal
+    // entries. Vertices are placed one at a time, each time choosing the vertex with
+    // the most neighbors and siblings (vertices sharing a neighbor) among the last
+    // window placed vertices. Siblings are not considered through vertices of degree
+    // larger than sqrt(n). perm[i] is the new index of vertex i.
+    template <typename I, typename J>
+    bool host_graph_locality_order(
+        J n, const I* adj_ptr, const J* adj_ind, J window, J* perm);
+
+    // Bandwidth max |p(i) - p(j)| and profile sum_i (p(i) - min_j p(j)), where the
+    // minimum is taken over all entries (i, j) with p(j) <= p(i), of a CSR sparsity
+    // pattern with rows and columns permuted by p(i) = perm[i]. If perm is NULL, the
+    // pattern is not permuted.
+    template <typename I, typename J>
+    bool host_graph_bandwidth(J        n,
+                              const I* row_ptr,
+                              const J* col_ind,
+                              const J* perm,
+                              int64_t* bandwidth,
+                              int64_t* profile);
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_GRAPH_HPP_
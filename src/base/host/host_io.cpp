@@ -28,6 +28,8 @@
 #include "../../utils/rocsparseio.h"
 #include "rocalution/version.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <cinttypes>
 #include <complex>
 #include <cstdio>
@@ -38,6 +40,18 @@
 #include <string>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__) \
+    || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace rocalution
 {
 
@@ -48,12 +62,160 @@ namespace rocalution
         char storage_type[64];
     };
 
-    bool mm_read_banner(FILE* fin, mm_banner& b)
+    // Read-only view of a file, memory mapped where supported
+    class MappedFile
+    {
+    public:
+        MappedFile()
+            : data_(NULL)
+            , size_(0)
+        {
+        }
+
+        ~MappedFile()
+        {
+            this->Close();
+        }
+
+        bool Open(const char* filename)
+        {
+#if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__) \
+    || defined(__APPLE__)
+            int fd = open(filename, O_RDONLY);
+
+            if(fd < 0)
+            {
+                return false;
+            }
+
+            struct stat st;
+
+            if(fstat(fd, &st) != 0)
+            {
+                close(fd);
+                return false;
+            }
+
+            this->size_ = static_cast<size_t>(st.st_size);
+
+            if(this->size_ > 0)
+            {
+                void* data = mmap(NULL, this->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if(data == MAP_FAILED)
+                {
+                    close(fd);
+                    this->size_ = 0;
+                    return false;
+                }
+
+                this->data_ = static_cast<const char*>(data);
+            }
+
+            // The mapping stays valid after closing the file
+            close(fd);
+
+            return true;
+#else
+            std::ifstream in(filename, std::ios::binary | std::ios::ate);
+
+            if(!in.is_open())
+            {
+                return false;
+            }
+
+            this->buffer_.resize(static_cast<size_t>(in.tellg()));
+            in.seekg(0);
+            in.read(this->buffer_.data(), this->buffer_.size());
+
+            this->data_ = this->buffer_.data();
+            this->size_ = this->buffer_.size();
+
+            return true;
+#endif
+        }
+
+        void Close(void)
+        {
+#if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__) \
+    || defined(__APPLE__)
+            if(this->data_ != NULL)
+            {
+                munmap(const_cast<char*>(this->data_), this->size_);
+            }
+#else
+            this->buffer_.clear();
+#endif
+            this->data_ = NULL;
+            this->size_ = 0;
+        }
+
+        const char* GetData(void) const
+        {
+            return this->data_;
+        }
+
+        size_t GetSize(void) const
+        {
+            return this->size_;
+        }
+
+    private:
+        const char* data_;
+        size_t      size_;
+
+#if !(defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__) \
+      || defined(__APPLE__))
+        std::vector<char> buffer_;
+#endif
+    };
+
+    // Return the end of the line that starts at p
+    static inline const char* mm_line_end(const char* p, const char* end)
+    {
+        const char* e = static_cast<const char*>(memchr(p, '\n', end - p));
+
+        return (e == NULL) ? end : e;
+    }
+
+    // Return the beginning of the line that follows the line ending at e
+    static inline const char* mm_next_line(const char* e, const char* end)
+    {
+        return (e < end) ? e + 1 : end;
+    }
+
+    // Return true, if the line [p, e) is neither empty nor a comment
+    static inline bool mm_is_data_line(const char* p, const char* e)
+    {
+        while(p < e && isspace(static_cast<unsigned char>(*p)))
+        {
+            ++p;
+        }
+
+        return (p < e) && (*p != '%');
+    }
+
+    // Copy the line [p, e) into a null terminated buffer of size 1025
+    static inline bool mm_copy_line(const char* p, const char* e, char* line)
+    {
+        size_t len = e - p;
+
+        if(len > 1024)
+        {
+            return false;
+        }
+
+        memcpy(line, p, len);
+        line[len] = '\0';
+
+        return true;
+    }
+
+    bool mm_parse_banner(const char* p, const char* e, mm_banner& b)
     {
         char line[1025];
 
-        // Read banner line
-        if(!fgets(line, 1025, fin))
+        if(mm_copy_line(p, e, line) != true)
         {
             return false;
         }
@@ -62,7 +224,13 @@ namespace rocalution
         char mtx[64];
 
         // Read 5 tokens from banner
-        if(sscanf(line, "%s %s %s %s %s", banner, mtx, b.array_type, b.matrix_type, b.storage_type)
+        if(sscanf(line,
+                  "%63s %63s %63s %63s %63s",
+                  banner,
+                  mtx,
+                  b.array_type,
+                  b.matrix_type,
+                  b.storage_type)
            != 5)
         {
             return false;
@@ -131,86 +299,267 @@ namespace rocalution
         return ValueType(real, imag);
     }
 
+    typedef enum _mm_field
+    {
+        mm_real,
+        mm_complex,
+        mm_pattern
+    } mm_field;
+
+    // Parse a single coordinate entry from the line [p, e)
     template <typename ValueType>
-    bool mm_read_coordinate(FILE*       fin,
-                            mm_banner&  b,
-                            int&        nrow,
-                            int&        ncol,
-                            int64_t&    nnz,
-                            int**       row,
-                            int**       col,
-                            ValueType** val)
+    static inline bool mm_parse_entry(
+        const char* p, const char* e, mm_field field, int* row, int* col, ValueType* val)
     {
         char line[1025];
 
-        // Skip banner and comments
-        do
+        if(mm_copy_line(p, e, line) != true)
+        {
+            return false;
+        }
+
+        char* s = line;
+        char* next;
+
+        long r = strtol(s, &next, 10);
+        if(next == s)
+        {
+            return false;
+        }
+        s = next;
+
+        long c = strtol(s, &next, 10);
+        if(next == s)
         {
-            // Check for EOF
-            if(!fgets(line, 1025, fin))
+            return false;
+        }
+        s = next;
+
+        if(field == mm_pattern)
+        {
+            *val = static_cast<ValueType>(1);
+        }
+        else
+        {
+            double real = strtod(s, &next);
+            if(next == s)
             {
                 return false;
             }
-        } while(line[0] == '%');
+            s = next;
+
+            double imag = real;
+
+            if(field == mm_complex)
+            {
+                imag = strtod(s, &next);
+                if(next == s)
+                {
+                    return false;
+                }
+            }
+
+            *val = read_complex<ValueType>(real, imag);
+        }
+
+        *row = static_cast<int>(r - 1);
+        *col = static_cast<int>(c - 1);
+
+        return true;
+    }
+
+    // Read the coordinate entries of a matrix market file. The file is memory mapped and
+    // split into newline aligned chunks, which are parsed in parallel. Symmetric and
+    // hermitian matrices are not expanded.
+    template <typename ValueType>
+    static bool mm_read_coordinate(const char* filename,
+                                   mm_banner&  b,
+                                   int&        nrow,
+                                   int&        ncol,
+                                   int64_t&    nnz,
+                                   int**       row,
+                                   int**       col,
+                                   ValueType** val)
+    {
+        MappedFile file;
 
-        // Read m, n, nnz
-        while(sscanf(line, "%d %d %" SCNd64, &nrow, &ncol, &nnz) != 3)
+        if(file.Open(filename) != true)
         {
-            // Check for EOF and loop until line with 3 integer entries found
-            if(!fgets(line, 1025, fin))
+            LOG_INFO("ReadFileMTX: cannot open file " << filename);
+            return false;
+        }
+
+        const char* p   = file.GetData();
+        const char* end = p + file.GetSize();
+
+        // Read banner
+        const char* e = mm_line_end(p, end);
+
+        if(p == end || mm_parse_banner(p, e, b) != true)
+        {
+            LOG_INFO("ReadFileMTX: invalid matrix market banner");
+            return false;
+        }
+
+        p = mm_next_line(e, end);
+
+        // Skip comments and read m, n, nnz
+        bool found = false;
+
+        while(p < end && found == false)
+        {
+            e = mm_line_end(p, end);
+
+            char line[1025];
+
+            if(mm_is_data_line(p, e) == true && mm_copy_line(p, e, line) == true
+               && sscanf(line, "%d %d %" SCNd64, &nrow, &ncol, &nnz) == 3)
             {
-                return false;
+                found = true;
             }
+
+            p = mm_next_line(e, end);
         }
 
-        // Allocate arrays
-        allocate_host(nnz, row);
-        allocate_host(nnz, col);
-        allocate_host(nnz, val);
+        if(found == false || nrow < 0 || ncol < 0 || nnz < 0)
+        {
+            LOG_INFO("ReadFileMTX: invalid matrix data");
+            return false;
+        }
+
+        mm_field field = mm_real;
 
-        // Read data
         if(!strncmp(b.matrix_type, "complex", 7))
         {
-            double real, imag;
-            for(int64_t i = 0; i < nnz; ++i)
+            field = mm_complex;
+        }
+        else if(!strncmp(b.matrix_type, "pattern", 7))
+        {
+            field = mm_pattern;
+        }
+
+        // Split the data into newline aligned chunks
+        _set_omp_backend_threads(*_get_backend_descriptor(), nnz);
+
+        int nchunks = 1;
+
+#ifdef _OPENMP
+        nchunks = 4 * omp_get_max_threads();
+#endif
+
+        std::vector<const char*> chunk(nchunks + 1);
+
+        chunk[0]       = p;
+        chunk[nchunks] = end;
+
+        for(int k = 1; k < nchunks; ++k)
+        {
+            const char* c = p + (end - p) * static_cast<int64_t>(k) / nchunks;
+
+            chunk[k] = (c <= chunk[k - 1]) ? chunk[k - 1] : mm_next_line(mm_line_end(c, end), end);
+        }
+
+        // Count the entries of each chunk
+        std::vector<int64_t> chunk_offset(nchunks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int k = 0; k < nchunks; ++k)
+        {
+            int64_t count = 0;
+
+            for(const char* l = chunk[k]; l < chunk[k + 1];)
             {
-                if(fscanf(fin, "%d %d %lg %lg", (*row) + i, (*col) + i, &real, &imag) != 4)
+                const char* le = mm_line_end(l, chunk[k + 1]);
+
+                if(mm_is_data_line(l, le) == true)
                 {
-                    return false;
+                    ++count;
                 }
-                --(*row)[i];
-                --(*col)[i];
-                (*val)[i] = read_complex<ValueType>(real, imag);
+
+                l = mm_next_line(le, chunk[k + 1]);
             }
+
+            chunk_offset[k + 1] = count;
         }
-        else if(!strncmp(b.matrix_type, "real", 4) || !strncmp(b.matrix_type, "integer", 7))
+
+        for(int k = 0; k < nchunks; ++k)
         {
-            double tmp;
-            for(int64_t i = 0; i < nnz; ++i)
+            chunk_offset[k + 1] += chunk_offset[k];
+        }
+
+        if(chunk_offset[nchunks] != nnz)
+        {
+            LOG_INFO("ReadFileMTX: invalid matrix data");
+            return false;
+        }
+
+        // Allocate arrays
+        allocate_host(nnz, row);
+        allocate_host(nnz, col);
+        allocate_host(nnz, val);
+
+        // Parse the entries of each chunk
+        std::vector<int> chunk_valid(nchunks, 1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int k = 0; k < nchunks; ++k)
+        {
+            int64_t idx = chunk_offset[k];
+
+            for(const char* l = chunk[k]; l < chunk[k + 1];)
             {
-                if(fscanf(fin, "%d %d %lg\n", (*row) + i, (*col) + i, &tmp) != 3)
+                const char* le = mm_line_end(l, chunk[k + 1]);
+
+                if(mm_is_data_line(l, le) == true)
                 {
-                    return false;
+                    if(mm_parse_entry(l, le, field, *row + idx, *col + idx, *val + idx) != true
+                       || (*row)[idx] < 0 || (*row)[idx] >= nrow || (*col)[idx] < 0
+                       || (*col)[idx] >= ncol)
+                    {
+                        chunk_valid[k] = 0;
+                        break;
+                    }
+
+                    ++idx;
                 }
-                --(*row)[i];
-                --(*col)[i];
-                (*val)[i] = read_complex<ValueType>(tmp, tmp);
+
+                l = mm_next_line(le, chunk[k + 1]);
             }
         }
-        else if(!strncmp(b.matrix_type, "pattern", 7))
+
+        for(int k = 0; k < nchunks; ++k)
         {
-            for(int64_t i = 0; i < nnz; ++i)
+            if(chunk_valid[k] == 0)
             {
-                if(fscanf(fin, "%d %d\n", (*row) + i, (*col) + i) != 2)
-                {
-                    return false;
-                }
-                --(*row)[i];
-                --(*col)[i];
-                (*val)[i] = static_cast<ValueType>(1);
+                LOG_INFO("ReadFileMTX: invalid matrix data");
+
+                free_host(row);
+                free_host(col);
+                free_host(val);
+
+                return false;
             }
         }
-        else
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool read_matrix_mtx(int&        nrow,
+                         int&        ncol,
+                         int64_t&    nnz,
+                         int**       row,
+                         int**       col,
+                         ValueType** val,
+                         const char* filename)
+    {
+        mm_banner b;
+
+        if(mm_read_coordinate(filename, b, nrow, ncol, nnz, row, col, val) != true)
         {
             return false;
         }
@@ -219,7 +568,7 @@ namespace rocalution
         if(strncmp(b.storage_type, "general", 7))
         {
             // Count diagonal entries
-            int ndiag = 0;
+            int64_t ndiag = 0;
             for(int64_t i = 0; i < nnz; ++i)
             {
                 if((*row)[i] == (*col)[i])
@@ -261,11 +610,6 @@ namespace rocalution
                 }
             }
 
-            if(idx != tot_nnz)
-            {
-                return false;
-            }
-
             nnz = tot_nnz;
 
             free_host(&sym_row);
@@ -276,45 +620,150 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType>
-    bool read_matrix_mtx(int&        nrow,
-                         int&        ncol,
-                         int64_t&    nnz,
-                         int**       row,
-                         int**       col,
-                         ValueType** val,
-                         const char* filename)
+    template <typename ValueType, typename PointerType>
+    bool read_matrix_mtx_csr(int&          nrow,
+                             int&          ncol,
+                             int64_t&      nnz,
+                             PointerType** ptr,
+                             int**         col,
+                             ValueType**   val,
+                             const char*   filename)
     {
-        FILE* file = fopen(filename, "r");
+        mm_banner b;
 
-        if(!file)
+        int64_t    coo_nnz;
+        int*       coo_row = NULL;
+        int*       coo_col = NULL;
+        ValueType* coo_val = NULL;
+
+        if(mm_read_coordinate(filename, b, nrow, ncol, coo_nnz, &coo_row, &coo_col, &coo_val)
+           != true)
         {
-            LOG_INFO("ReadFileMTX: cannot open file " << filename);
             return false;
         }
 
-        // read banner
-        mm_banner banner;
-        if(mm_read_banner(file, banner) != true)
+        // Symmetric and hermitian matrices are expanded during assembly
+        bool expand = (strncmp(b.storage_type, "general", 7) != 0);
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), coo_nnz);
+
+        // Count the entries of each row
+        int64_t* row_nnz = NULL;
+        allocate_host(nrow + 1, &row_nnz);
+        set_to_zero_host(nrow + 1, row_nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t i = 0; i < coo_nnz; ++i)
         {
-            LOG_INFO("ReadFileMTX: invalid matrix market banner");
-            return false;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            ++row_nnz[coo_row[i] + 1];
+
+            if(expand == true && coo_row[i] != coo_col[i])
+            {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                ++row_nnz[coo_col[i] + 1];
+            }
         }
 
-        if(strncmp(banner.array_type, "coordinate", 10))
+        // Exclusive scan
+        for(int i = 0; i < nrow; ++i)
+        {
+            row_nnz[i + 1] += row_nnz[i];
+        }
+
+        nnz = row_nnz[nrow];
+
+        if(nnz > std::numeric_limits<PointerType>::max())
         {
+            LOG_INFO("ReadFileMTX: number of non-zeros exceeds the pointer type");
+
+            free_host(&row_nnz);
+            free_host(&coo_row);
+            free_host(&coo_col);
+            free_host(&coo_val);
+
             return false;
         }
-        else
+
+        allocate_host(nrow + 1, ptr);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < nrow + 1; ++i)
+        {
+            (*ptr)[i] = static_cast<PointerType>(row_nnz[i]);
+        }
+
+        // Counting sort, scatter the entry ids into their rows. The lowest bit of an id
+        // marks the transposed entry of an expanded matrix.
+        int64_t* perm = NULL;
+        allocate_host(nnz, &perm);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t i = 0; i < coo_nnz; ++i)
         {
-            if(mm_read_coordinate(file, banner, nrow, ncol, nnz, row, col, val) != true)
+            int64_t pos;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            pos = row_nnz[coo_row[i]]++;
+
+            perm[pos] = 2 * i;
+
+            if(expand == true && coo_row[i] != coo_col[i])
             {
-                LOG_INFO("ReadFileMTX: invalid matrix data");
-                return false;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                pos = row_nnz[coo_col[i]]++;
+
+                perm[pos] = 2 * i + 1;
             }
         }
 
-        fclose(file);
+        free_host(&row_nnz);
+
+        allocate_host(nnz, col);
+        allocate_host(nnz, val);
+
+        // Sort each row by column, ties are broken by the entry id to keep the order of
+        // duplicate entries deterministic
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < nrow; ++i)
+        {
+            auto col_of
+                = [&](int64_t id) { return (id & 1) ? coo_row[id >> 1] : coo_col[id >> 1]; };
+
+            std::sort(perm + (*ptr)[i], perm + (*ptr)[i + 1], [&](int64_t a, int64_t b) {
+                int ca = col_of(a);
+                int cb = col_of(b);
+
+                return (ca < cb) || (ca == cb && a < b);
+            });
+
+            for(PointerType j = (*ptr)[i]; j < (*ptr)[i + 1]; ++j)
+            {
+                (*col)[j] = col_of(perm[j]);
+                (*val)[j] = coo_val[perm[j] >> 1];
+            }
+        }
+
+        free_host(&perm);
+        free_host(&coo_row);
+        free_host(&coo_col);
+        free_host(&coo_val);
 
         return true;
     }
@@ -609,6 +1058,180 @@ namespace rocalution
         return true;
     }
 
+    // Value type of the rocALUTION binary csr file
+    template <typename ValueType>
+    struct csr_file_value
+    {
+        typedef double type;
+    };
+
+    template <typename T>
+    struct csr_file_value<std::complex<T>>
+    {
+        typedef std::complex<double> type;
+    };
+
+    // Adopt an array of the mapped file if its type and alignment match, otherwise copy
+    // and convert it into a new buffer
+    template <typename FileType, typename DataType>
+    static void map_csr_array(void* mapping, const char* src, int64_t n, DataType** dst)
+    {
+        if(n <= 0)
+        {
+            return;
+        }
+
+        if(std::is_same<FileType, DataType>::value
+           && reinterpret_cast<uintptr_t>(src) % alignof(DataType) == 0)
+        {
+            *dst = reinterpret_cast<DataType*>(const_cast<char*>(src));
+            adopt_host_mapping(mapping, *dst);
+
+            return;
+        }
+
+        allocate_host(n, dst);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int64_t i = 0; i < n; ++i)
+        {
+            FileType tmp;
+            memcpy(&tmp, src + i * sizeof(FileType), sizeof(FileType));
+
+            (*dst)[i] = static_cast<DataType>(tmp);
+        }
+    }
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool map_matrix_csr(int64_t&      nrow,
+                        int64_t&      ncol,
+                        int64_t&      nnz,
+                        PointerType** ptr,
+                        IndexType**   col,
+                        ValueType**   val,
+                        const char*   filename)
+    {
+        size_t size;
+        char*  mapping = static_cast<char*>(map_host_file(filename, &size));
+
+        if(mapping == NULL)
+        {
+            LOG_VERBOSE_INFO(2, "MapFileCSR: cannot map file " << filename << ", reading it");
+
+            return read_matrix_csr(nrow, ncol, nnz, ptr, col, val, filename);
+        }
+
+        const char* end = mapping + size;
+        const char* p   = static_cast<const char*>(memchr(mapping, '\n', size));
+
+        // Header
+        if(p == NULL || std::string(mapping, p - mapping) != "#rocALUTION binary csr file")
+        {
+            LOG_INFO("MapFileCSR: invalid rocALUTION matrix header");
+            unmap_host_file(mapping);
+            return false;
+        }
+
+        ++p;
+
+        // rocALUTION version
+        int version;
+
+        if(p + sizeof(int) > end)
+        {
+            LOG_INFO("MapFileCSR: invalid matrix data");
+            unmap_host_file(mapping);
+            return false;
+        }
+
+        memcpy(&version, p, sizeof(int));
+        p += sizeof(int);
+
+        // Read sizes, row pointers are stored in 64 bit only if required by nnz
+        bool ptr64 = false;
+
+        if(version < 30000)
+        {
+            // 32 bit backward compatibility sizes
+            int sizes[3];
+
+            if(p + sizeof(sizes) > end)
+            {
+                LOG_INFO("MapFileCSR: invalid matrix data");
+                unmap_host_file(mapping);
+                return false;
+            }
+
+            memcpy(sizes, p, sizeof(sizes));
+            p += sizeof(sizes);
+
+            nrow = static_cast<int64_t>(sizes[0]);
+            ncol = static_cast<int64_t>(sizes[1]);
+            nnz  = static_cast<int64_t>(sizes[2]);
+        }
+        else
+        {
+            int64_t sizes[3];
+
+            if(p + sizeof(sizes) > end)
+            {
+                LOG_INFO("MapFileCSR: invalid matrix data");
+                unmap_host_file(mapping);
+                return false;
+            }
+
+            memcpy(sizes, p, sizeof(sizes));
+            p += sizeof(sizes);
+
+            nrow = sizes[0];
+            ncol = sizes[1];
+            nnz  = sizes[2];
+
+            ptr64 = (nnz >= std::numeric_limits<int>::max());
+        }
+
+        typedef typename csr_file_value<ValueType>::type FileValueType;
+
+        size_t ptr_bytes = (nrow + 1) * (ptr64 ? sizeof(int64_t) : sizeof(int));
+        size_t col_bytes = nnz * sizeof(int);
+        size_t val_bytes = nnz * sizeof(FileValueType);
+
+        if(nrow < 0 || ncol < 0 || nnz < 0
+           || static_cast<size_t>(end - p) < ptr_bytes + col_bytes + val_bytes)
+        {
+            LOG_INFO("MapFileCSR: invalid matrix data");
+            unmap_host_file(mapping);
+            return false;
+        }
+
+        if(ptr64 == true && sizeof(PointerType) < sizeof(int64_t))
+        {
+            // We cannot read without overflow, skip and throw warning
+            LOG_INFO("MapFileCSR: cannot read 64 bit sparsity pattern into 32 bit structure");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Adopt or copy the arrays
+        if(ptr64 == true)
+        {
+            map_csr_array<int64_t>(mapping, p, nrow + 1, ptr);
+        }
+        else
+        {
+            map_csr_array<int>(mapping, p, nrow + 1, ptr);
+        }
+
+        map_csr_array<int>(mapping, p + ptr_bytes, nnz, col);
+        map_csr_array<FileValueType>(mapping, p + ptr_bytes + col_bytes, nnz, val);
+
+        // Adopted arrays keep the mapping alive
+        unmap_host_file(mapping);
+
+        return true;
+    }
+
     template <typename T>
     rocsparseio_type type2rocsparseio_type();
 
@@ -766,6 +1389,24 @@ namespace rocalution
             return false;
         }
 
+        //
+        // Compressed csr files are decoded on the fly.
+        //
+        rocsparseio_format file_format;
+        status = rocsparseio_read_format(handle, &file_format);
+        if(status != rocsparseio_status_success)
+        {
+            LOG_INFO("ReadFileRSIO: rocsparseio_read_format failed");
+            rocsparseio_close(handle);
+            return false;
+        }
+
+        const bool compressed = (file_format == rocsparseio_format_sparse_zcsx);
+
+        auto read_metadata = compressed ? rocsparseiox_read_metadata_sparse_zcsx
+                                        : rocsparseiox_read_metadata_sparse_csx;
+        auto read_data = compressed ? rocsparseiox_read_sparse_zcsx : rocsparseiox_read_sparse_csx;
+
         rocsparseio_direction  file_direction;
         rocsparseio_index_base file_base;
         uint64_t               file_nrow;
@@ -778,18 +1419,18 @@ namespace rocalution
         //
         // Read meta-data from file.
         //
-        status = rocsparseiox_read_metadata_sparse_csx(handle,
-                                                       &file_direction,
-                                                       &file_nrow,
-                                                       &file_ncol,
-                                                       &file_nnz,
-                                                       &file_ptr_type,
-                                                       &file_ind_type,
-                                                       &file_val_type,
-                                                       &file_base);
+        status = read_metadata(handle,
+                               &file_direction,
+                               &file_nrow,
+                               &file_ncol,
+                               &file_nnz,
+                               &file_ptr_type,
+                               &file_ind_type,
+                               &file_val_type,
+                               &file_base);
         if(status != rocsparseio_status_success)
         {
-            LOG_INFO("ReadFileRSIO: rocsparseiox_read_metadata_sparse_csx failed");
+            LOG_INFO("ReadFileRSIO: reading csr metadata failed");
             rocsparseio_close(handle);
             return false;
         }
@@ -885,10 +1526,10 @@ namespace rocalution
 
         if(is_consistent)
         {
-            status = rocsparseiox_read_sparse_csx(handle, *ptr, *col, *val);
+            status = read_data(handle, *ptr, *col, *val);
             if(status != rocsparseio_status_success)
             {
-                LOG_INFO("ReadFileRSIO: rocsparseiox_read_sparse_csx failed");
+                LOG_INFO("ReadFileRSIO: reading csr data failed");
                 free_host(ptr);
                 free_host(col);
                 free_host(val);
@@ -922,10 +1563,10 @@ namespace rocalution
                 tmp_val = malloc(nnz * sizeof_val_type);
             }
 
-            status = rocsparseiox_read_sparse_csx(handle, tmp_ptr, tmp_ind, tmp_val);
+            status = read_data(handle, tmp_ptr, tmp_ind, tmp_val);
             if(status != rocsparseio_status_success)
             {
-                LOG_INFO("ReadFileRSIO: rocsparseiox_read_sparse_csx failed");
+                LOG_INFO("ReadFileRSIO: reading csr data failed");
                 free_host(ptr);
                 free_host(col);
                 free_host(val);
@@ -3341,6 +3982,61 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool write_matrix_csr_rocsparseio_compressed(int64_t            nrow,
+                                                 int64_t            ncol,
+                                                 int64_t            nnz,
+                                                 const PointerType* ptr,
+                                                 const IndexType*   col,
+                                                 const ValueType*   val,
+                                                 bool               compress_val,
+                                                 const char*        filename)
+    {
+        rocsparseio_handle handle;
+        rocsparseio_status io_status;
+        io_status = rocsparseio_open(&handle, rocsparseio_rwmode_write, filename);
+        if(io_status != rocsparseio_status_success)
+        {
+            LOG_INFO("write_matrix_csr_rocsparseio_compressed: cannot open file " << filename);
+            return false;
+        }
+
+        const rocsparseio_type ptr_type = type2rocsparseio_type<PointerType>();
+        const rocsparseio_type col_type = type2rocsparseio_type<IndexType>();
+        const rocsparseio_type val_type = type2rocsparseio_type<ValueType>();
+
+        static constexpr rocsparseio_direction  dir  = rocsparseio_direction_row;
+        static constexpr rocsparseio_index_base base = rocsparseio_index_base_zero;
+
+        const uint64_t save_m   = nrow;
+        const uint64_t save_n   = ncol;
+        const uint64_t save_nnz = nnz;
+
+        io_status = rocsparseio_write_sparse_zcsx(handle,
+                                                  dir,
+                                                  save_m,
+                                                  save_n,
+                                                  save_nnz,
+                                                  ptr_type,
+                                                  ptr,
+                                                  col_type,
+                                                  col,
+                                                  val_type,
+                                                  val,
+                                                  base,
+                                                  compress_val ? 1 : 0,
+                                                  filename);
+        if(io_status != rocsparseio_status_success)
+        {
+            LOG_INFO("write_matrix_csr_rocsparseio_compressed: cannot write file " << filename);
+            rocsparseio_close(handle);
+            return false;
+        }
+
+        rocsparseio_close(handle);
+        return true;
+    }
+
     template <typename ValueType, typename IndexType, typename PointerType>
     bool write_matrix_mcsr_rocsparseio(int64_t            nrow,
                                        int64_t            ncol,
@@ -3673,6 +4369,67 @@ namespace rocalution
                                   const char*            filename);
 #endif
 
+    template bool read_matrix_mtx_csr(int&        nrow,
+                                      int&        ncol,
+                                      int64_t&    nnz,
+                                      int**       ptr,
+                                      int**       col,
+                                      float**     val,
+                                      const char* filename);
+    template bool read_matrix_mtx_csr(int&        nrow,
+                                      int&        ncol,
+                                      int64_t&    nnz,
+                                      int**       ptr,
+                                      int**       col,
+                                      double**    val,
+                                      const char* filename);
+#ifdef SUPPORT_COMPLEX
+    template bool read_matrix_mtx_csr(int&                  nrow,
+                                      int&                  ncol,
+                                      int64_t&              nnz,
+                                      int**                 ptr,
+                                      int**                 col,
+                                      std::complex<float>** val,
+                                      const char*           filename);
+    template bool read_matrix_mtx_csr(int&                   nrow,
+                                      int&                   ncol,
+                                      int64_t&               nnz,
+                                      int**                  ptr,
+                                      int**                  col,
+                                      std::complex<double>** val,
+                                      const char*            filename);
+#endif
+    template bool read_matrix_mtx_csr(int&        nrow,
+                                      int&        ncol,
+                                      int64_t&    nnz,
+                                      int64_t**   ptr,
+                                      int**       col,
+                                      float**     val,
+                                      const char* filename);
+    template bool read_matrix_mtx_csr(int&        nrow,
+                                      int&        ncol,
+                                      int64_t&    nnz,
+                                      int64_t**   ptr,
+                                      int**       col,
+                                      double**    val,
+                                      const char* filename);
+#ifdef SUPPORT_COMPLEX
+    template bool read_matrix_mtx_csr(int&                  nrow,
+                                      int&                  ncol,
+                                      int64_t&              nnz,
+                                      int64_t**             ptr,
+                                      int**                 col,
+                                      std::complex<float>** val,
+                                      const char*           filename);
+    template bool read_matrix_mtx_csr(int&                   nrow,
+                                      int&                   ncol,
+                                      int64_t&               nnz,
+                                      int64_t**              ptr,
+                                      int**                  col,
+                                      std::complex<double>** val,
+                                      const char*            filename);
+#endif
+
     template bool write_matrix_mtx(int          nrow,
                                    int          ncol,
                                    int64_t      nnz,
@@ -3766,6 +4523,68 @@ namespace rocalution
                                   const char*            filename);
 #endif
 
+    template bool map_matrix_csr(int64_t&    nrow,
+                                 int64_t&    ncol,
+                                 int64_t&    nnz,
+                                 int**       ptr,
+                                 int**       col,
+                                 float**     val,
+                                 const char* filename);
+    template bool map_matrix_csr(int64_t&    nrow,
+                                 int64_t&    ncol,
+                                 int64_t&    nnz,
+                                 int**       ptr,
+                                 int**       col,
+                                 double**    val,
+                                 const char* filename);
+#ifdef SUPPORT_COMPLEX
+    template bool map_matrix_csr(int64_t&              nrow,
+                                 int64_t&              ncol,
+                                 int64_t&              nnz,
+                                 int**                 ptr,
+                                 int**                 col,
+                                 std::complex<float>** val,
+                                 const char*           filename);
+    template bool map_matrix_csr(int64_t&               nrow,
+                                 int64_t&               ncol,
+                                 int64_t&               nnz,
+                                 int**                  ptr,
+                                 int**                  col,
+                                 std::complex<double>** val,
+                                 const char*            filename);
+#endif
+
+    template bool map_matrix_csr(int64_t&    nrow,
+                                 int64_t&    ncol,
+                                 int64_t&    nnz,
+                                 int64_t**   ptr,
+                                 int**       col,
+                                 float**     val,
+                                 const char* filename);
+    template bool map_matrix_csr(int64_t&    nrow,
+                                 int64_t&    ncol,
+                                 int64_t&    nnz,
+                                 int64_t**   ptr,
+                                 int**       col,
+                                 double**    val,
+                                 const char* filename);
+#ifdef SUPPORT_COMPLEX
+    template bool map_matrix_csr(int64_t&              nrow,
+                                 int64_t&              ncol,
+                                 int64_t&              nnz,
+                                 int64_t**             ptr,
+                                 int**                 col,
+                                 std::complex<float>** val,
+                                 const char*           filename);
+    template bool map_matrix_csr(int64_t&               nrow,
+                                 int64_t&               ncol,
+                                 int64_t&               nnz,
+                                 int64_t**              ptr,
+                                 int**                  col,
+                                 std::complex<double>** val,
+                                 const char*            filename);
+#endif
+
     template bool write_matrix_csr(int64_t      nrow,
                                    int64_t      ncol,
                                    int64_t      nnz,
@@ -3952,6 +4771,76 @@ namespace rocalution
                                                const char*                 filename);
 #endif
 
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t      nrow,
+                                                          int64_t      ncol,
+                                                          int64_t      nnz,
+                                                          const int*   ptr,
+                                                          const int*   col,
+                                                          const float* val,
+                                                          bool         compress_val,
+                                                          const char*  filename);
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t       nrow,
+                                                          int64_t       ncol,
+                                                          int64_t       nnz,
+                                                          const int*    ptr,
+                                                          const int*    col,
+                                                          const double* val,
+                                                          bool          compress_val,
+                                                          const char*   filename);
+#ifdef SUPPORT_COMPLEX
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t                    nrow,
+                                                          int64_t                    ncol,
+                                                          int64_t                    nnz,
+                                                          const int*                 ptr,
+                                                          const int*                 col,
+                                                          const std::complex<float>* val,
+                                                          bool                       compress_val,
+                                                          const char*                filename);
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t                     nrow,
+                                                          int64_t                     ncol,
+                                                          int64_t                     nnz,
+                                                          const int*                  ptr,
+                                                          const int*                  col,
+                                                          const std::complex<double>* val,
+                                                          bool                        compress_val,
+                                                          const char*                 filename);
+#endif
+
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t        nrow,
+                                                          int64_t        ncol,
+                                                          int64_t        nnz,
+                                                          const int64_t* ptr,
+                                                          const int*     col,
+                                                          const float*   val,
+                                                          bool           compress_val,
+                                                          const char*    filename);
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t        nrow,
+                                                          int64_t        ncol,
+                                                          int64_t        nnz,
+                                                          const int64_t* ptr,
+                                                          const int*     col,
+                                                          const double*  val,
+                                                          bool           compress_val,
+                                                          const char*    filename);
+#ifdef SUPPORT_COMPLEX
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t                    nrow,
+                                                          int64_t                    ncol,
+                                                          int64_t                    nnz,
+                                                          const int64_t*             ptr,
+                                                          const int*                 col,
+                                                          const std::complex<float>* val,
+                                                          bool                       compress_val,
+                                                          const char*                filename);
+    template bool write_matrix_csr_rocsparseio_compressed(int64_t                     nrow,
+                                                          int64_t                     ncol,
+                                                          int64_t                     nnz,
+                                                          const int64_t*              ptr,
+                                                          const int*                  col,
+                                                          const std::complex<double>* val,
+                                                          bool                        compress_val,
+                                                          const char*                 filename);
+#endif
+
     template bool read_matrix_mcsr_rocsparseio(int64_t&    nrow,
                                                int64_t&    ncol,
                                                int64_t&    nnz,
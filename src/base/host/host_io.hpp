@@ -39,6 +39,15 @@ namespace rocalution
                          ValueType** val,
                          const char* filename);
 
+    template <typename ValueType, typename PointerType>
+    bool read_matrix_mtx_csr(int&          nrow,
+                             int&          ncol,
+                             int64_t&      nnz,
+                             PointerType** ptr,
+                             int**         col,
+                             ValueType**   val,
+                             const char*   filename);
+
     template <typename ValueType>
     bool write_matrix_mtx(int              nrow,
                           int              ncol,
@@ -57,6 +66,15 @@ namespace rocalution
                          ValueType**   val,
                          const char*   filename);
 
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool map_matrix_csr(int64_t&      nrow,
+                        int64_t&      ncol,
+                        int64_t&      nnz,
+                        PointerType** ptr,
+                        IndexType**   col,
+                        ValueType**   val,
+                        const char*   filename);
+
     template <typename ValueType, typename IndexType, typename PointerType>
     bool write_matrix_csr(int64_t            nrow,
                           int64_t            ncol,
@@ -84,6 +102,16 @@ namespace rocalution
                                       const ValueType*   val,
                                       const char*        filename);
 
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool write_matrix_csr_rocsparseio_compressed(int64_t            nrow,
+                                                 int64_t            ncol,
+                                                 int64_t            nnz,
+                                                 const PointerType* ptr,
+                                                 const IndexType*   col,
+                                                 const ValueType*   val,
+                                                 bool               compress_val,
+                                                 const char*        filename);
+
     template <typename ValueType, typename IndexType, typename PointerType>
     bool read_matrix_mcsr_rocsparseio(int64_t&      nrow,
                                       int64_t&      ncol,
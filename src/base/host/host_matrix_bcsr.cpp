@@ -31,8 +31,11 @@
 #include "host_matrix_csr.hpp"
 #include "host_vector.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <complex>
 #include <limits>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -62,6 +65,8 @@ namespace rocalution
         this->mat_.val        = NULL;
         this->mat_.blockdim   = blockdim;
 
+        this->inv_diag_ = NULL;
+
         this->set_backend(local_backend);
     }
 
@@ -86,6 +91,8 @@ namespace rocalution
         free_host(&this->mat_.col);
         free_host(&this->mat_.val);
 
+        free_host(&this->inv_diag_);
+
         this->nrow_ = 0;
         this->ncol_ = 0;
         this->nnz_  = 0;
@@ -176,6 +183,8 @@ namespace rocalution
         this->mat_.col        = NULL;
         this->mat_.val        = NULL;
 
+        free_host(&this->inv_diag_);
+
         blockdim = this->mat_.blockdim;
 
         this->mat_.blockdim = 0;
@@ -220,6 +229,18 @@ namespace rocalution
             copy_h2h(this->mat_.nnzb * this->mat_.blockdim * this->mat_.blockdim,
                      cast_mat->mat_.val,
                      this->mat_.val);
+
+            // Keep the inverted diagonal blocks of a block ILU(0) factorization
+            free_host(&this->inv_diag_);
+
+            if(cast_mat->inv_diag_ != NULL)
+            {
+                int64_t size = static_cast<int64_t>(this->mat_.nrowb) * this->mat_.blockdim
+                               * this->mat_.blockdim;
+
+                allocate_host(size, &this->inv_diag_);
+                copy_h2h(size, cast_mat->inv_diag_, this->inv_diag_);
+            }
         }
         else
         {
@@ -326,6 +347,426 @@ namespace rocalution
                                              filename.c_str());
     }
 
+    // Matrix-vector product y = alpha * A * x (+ y) with compile time block dimension, such
+    // that the block loops are unrolled and the products of a block column vectorized
+    template <int BLOCKDIM, typename ValueType>
+    static void bcsr_spmv(int              nrowb,
+                          const int*       row_offset,
+                          const int*       col,
+                          const ValueType* val,
+                          ValueType        alpha,
+                          bool             add,
+                          const ValueType* x,
+                          ValueType*       y)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            ValueType sum[BLOCKDIM];
+
+            for(int bi = 0; bi < BLOCKDIM; ++bi)
+            {
+                sum[bi] = static_cast<ValueType>(0);
+            }
+
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                const ValueType* block = val + static_cast<int64_t>(aj) * BLOCKDIM * BLOCKDIM;
+                const ValueType* xj    = x + static_cast<int64_t>(col[aj]) * BLOCKDIM;
+
+                for(int bj = 0; bj < BLOCKDIM; ++bj)
+                {
+                    for(int bi = 0; bi < BLOCKDIM; ++bi)
+                    {
+                        sum[bi] += block[BCSR_IND(0, bi, bj, BLOCKDIM)] * xj[bj];
+                    }
+                }
+            }
+
+            ValueType* yi = y + static_cast<int64_t>(ai) * BLOCKDIM;
+
+            for(int bi = 0; bi < BLOCKDIM; ++bi)
+            {
+                yi[bi] = add ? yi[bi] + alpha * sum[bi] : alpha * sum[bi];
+            }
+        }
+    }
+
+    // Dispatch the matrix-vector product for block dimensions 2 to 8, returns false for
+    // other block dimensions
+    template <typename ValueType>
+    static bool bcsr_spmv_dispatch(int              blockdim,
+                                   int              nrowb,
+                                   const int*       row_offset,
+                                   const int*       col,
+                                   const ValueType* val,
+                                   ValueType        alpha,
+                                   bool             add,
+                                   const ValueType* x,
+                                   ValueType*       y)
+    {
+        switch(blockdim)
+        {
+        case 2:
+            bcsr_spmv<2>(nrowb, row_offset, col, val, alpha, add, x, y);
+            return true;
+        case 3:
+            bcsr_spmv<3>(nrowb, row_offset, col, val, alpha, add, x, y);
+            return true;
+        case 4:
+            bcsr_spmv<4>(nrowb, row_offset, col, val, alpha, add, x, y);
+            return true;
+        case 5:
+            bcsr_spmv<5>(nrowb, row_offset, col, val, alpha, add, x, y);
+            return true;
+        case 6:
+            bcsr_spmv<6>(nrowb, row_offset, col, val, alpha, add, x, y);
+            return true;
+        case 7:
+            bcsr_spmv<7>(nrowb, row_offset, col, val, alpha, add, x, y);
+            return true;
+        case 8:
+            bcsr_spmv<8>(nrowb, row_offset, col, val, alpha, add, x, y);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Dense block kernels, BLOCKDIM > 0 fixes the block dimension at compile time, otherwise
+    // the runtime block dimension dim is used
+
+    // Invert the block A with Gauss-Jordan elimination and partial pivoting, work holds
+    // dim * dim values. Returns false if A is singular.
+    template <int BLOCKDIM, typename ValueType>
+    static bool bcsr_block_inverse(int dim_, const ValueType* A, ValueType* inv, ValueType* work)
+    {
+        const int dim = (BLOCKDIM > 0) ? BLOCKDIM : dim_;
+
+        for(int j = 0; j < dim; ++j)
+        {
+            for(int i = 0; i < dim; ++i)
+            {
+                work[BCSR_IND(0, i, j, dim)] = A[BCSR_IND(0, i, j, dim)];
+                inv[BCSR_IND(0, i, j, dim)]
+                    = (i == j) ? static_cast<ValueType>(1) : static_cast<ValueType>(0);
+            }
+        }
+
+        for(int c = 0; c < dim; ++c)
+        {
+            // Pivot row
+            int p = c;
+
+            for(int r = c + 1; r < dim; ++r)
+            {
+                if(std::abs(work[BCSR_IND(0, r, c, dim)]) > std::abs(work[BCSR_IND(0, p, c, dim)]))
+                {
+                    p = r;
+                }
+            }
+
+            if(p != c)
+            {
+                for(int j = 0; j < dim; ++j)
+                {
+                    std::swap(work[BCSR_IND(0, p, j, dim)], work[BCSR_IND(0, c, j, dim)]);
+                    std::swap(inv[BCSR_IND(0, p, j, dim)], inv[BCSR_IND(0, c, j, dim)]);
+                }
+            }
+
+            if(work[BCSR_IND(0, c, c, dim)] == static_cast<ValueType>(0))
+            {
+                return false;
+            }
+
+            ValueType scale = static_cast<ValueType>(1) / work[BCSR_IND(0, c, c, dim)];
+
+            for(int j = 0; j < dim; ++j)
+            {
+                work[BCSR_IND(0, c, j, dim)] *= scale;
+                inv[BCSR_IND(0, c, j, dim)] *= scale;
+            }
+
+            for(int r = 0; r < dim; ++r)
+            {
+                ValueType f = work[BCSR_IND(0, r, c, dim)];
+
+                if(r == c || f == static_cast<ValueType>(0))
+                {
+                    continue;
+                }
+
+                for(int j = 0; j < dim; ++j)
+                {
+                    work[BCSR_IND(0, r, j, dim)] -= f * work[BCSR_IND(0, c, j, dim)];
+                    inv[BCSR_IND(0, r, j, dim)] -= f * inv[BCSR_IND(0, c, j, dim)];
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Solve A * x = b in place of b with Gaussian elimination and partial pivoting, work
+    // holds dim * dim values
+    template <int BLOCKDIM, typename ValueType>
+    static void bcsr_block_solve(int dim_, const ValueType* A, ValueType* b, ValueType* work)
+    {
+        const int dim = (BLOCKDIM > 0) ? BLOCKDIM : dim_;
+
+        for(int k = 0; k < dim * dim; ++k)
+        {
+            work[k] = A[k];
+        }
+
+        for(int c = 0; c < dim; ++c)
+        {
+            int p = c;
+
+            for(int r = c + 1; r < dim; ++r)
+            {
+                if(std::abs(work[BCSR_IND(0, r, c, dim)]) > std::abs(work[BCSR_IND(0, p, c, dim)]))
+                {
+                    p = r;
+                }
+            }
+
+            if(p != c)
+            {
+                for(int j = c; j < dim; ++j)
+                {
+                    std::swap(work[BCSR_IND(0, p, j, dim)], work[BCSR_IND(0, c, j, dim)]);
+                }
+
+                std::swap(b[p], b[c]);
+            }
+
+            for(int r = c + 1; r < dim; ++r)
+            {
+                ValueType f = work[BCSR_IND(0, r, c, dim)] / work[BCSR_IND(0, c, c, dim)];
+
+                for(int j = c + 1; j < dim; ++j)
+                {
+                    work[BCSR_IND(0, r, j, dim)] -= f * work[BCSR_IND(0, c, j, dim)];
+                }
+
+                b[r] -= f * b[c];
+            }
+        }
+
+        for(int r = dim - 1; r >= 0; --r)
+        {
+            ValueType sum = b[r];
+
+            for(int j = r + 1; j < dim; ++j)
+            {
+                sum -= work[BCSR_IND(0, r, j, dim)] * b[j];
+            }
+
+            b[r] = sum / work[BCSR_IND(0, r, r, dim)];
+        }
+    }
+
+    // C = C - A * B
+    template <int BLOCKDIM, typename ValueType>
+    static void bcsr_block_gemm_sub(int dim_, const ValueType* A, const ValueType* B, ValueType* C)
+    {
+        const int dim = (BLOCKDIM > 0) ? BLOCKDIM : dim_;
+
+        for(int j = 0; j < dim; ++j)
+        {
+            for(int k = 0; k < dim; ++k)
+            {
+                ValueType b = B[BCSR_IND(0, k, j, dim)];
+
+                for(int i = 0; i < dim; ++i)
+                {
+                    C[BCSR_IND(0, i, j, dim)] -= A[BCSR_IND(0, i, k, dim)] * b;
+                }
+            }
+        }
+    }
+
+    // Block ILU(0) factorization in place, L is block unit lower triangular and U block upper
+    // triangular with the diagonal blocks of U stored as they are. diag holds the position of
+    // the diagonal block of each block row, inv_diag receives the inverses of the diagonal
+    // blocks of U. Returns the first block row with a singular diagonal block, or -1.
+    template <int BLOCKDIM, typename ValueType>
+    static int bcsr_ilu0(int        nrowb,
+                         int        dim_,
+                         const int* row_offset,
+                         const int* col,
+                         const int* diag,
+                         ValueType* val,
+                         ValueType* inv_diag)
+    {
+        const int     dim   = (BLOCKDIM > 0) ? BLOCKDIM : dim_;
+        const int64_t bsize = static_cast<int64_t>(dim) * dim;
+
+        std::vector<ValueType> work(bsize);
+        std::vector<ValueType> tmp(bsize);
+        std::vector<int>       marker(nrowb, -1);
+
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            int row_begin = row_offset[ai];
+            int row_end   = row_offset[ai + 1];
+
+            for(int aj = row_begin; aj < row_end; ++aj)
+            {
+                marker[col[aj]] = aj;
+            }
+
+            // Blocks left of the diagonal
+            for(int aj = row_begin; aj < diag[ai]; ++aj)
+            {
+                int        ak   = col[aj];
+                ValueType* L_ik = val + aj * bsize;
+
+                // L_ik = A_ik * U_kk^-1
+                for(int64_t k = 0; k < bsize; ++k)
+                {
+                    tmp[k]  = L_ik[k];
+                    L_ik[k] = static_cast<ValueType>(0);
+                }
+
+                bcsr_block_gemm_sub<BLOCKDIM>(dim, tmp.data(), &inv_diag[ak * bsize], L_ik);
+
+                for(int64_t k = 0; k < bsize; ++k)
+                {
+                    L_ik[k] = -L_ik[k];
+                }
+
+                // A_ij = A_ij - L_ik * U_kj for all blocks j of row k right of the diagonal
+                // that are part of row i
+                for(int kj = diag[ak] + 1; kj < row_offset[ak + 1]; ++kj)
+                {
+                    int pos = marker[col[kj]];
+
+                    if(pos != -1)
+                    {
+                        bcsr_block_gemm_sub<BLOCKDIM>(
+                            dim, L_ik, val + kj * bsize, val + pos * bsize);
+                    }
+                }
+            }
+
+            if(bcsr_block_inverse<BLOCKDIM>(
+                   dim, val + diag[ai] * bsize, &inv_diag[ai * bsize], work.data())
+               == false)
+            {
+                return ai;
+            }
+
+            for(int aj = row_begin; aj < row_end; ++aj)
+            {
+                marker[col[aj]] = -1;
+            }
+        }
+
+        return -1;
+    }
+
+    // Solve L * U * out = in, the factors are stored in place. The diagonal blocks of U are
+    // applied with their inverses, if available, otherwise they are solved for.
+    template <int BLOCKDIM, typename ValueType>
+    static bool bcsr_lusolve(int              nrowb,
+                             int              dim_,
+                             const int*       row_offset,
+                             const int*       col,
+                             const ValueType* val,
+                             const ValueType* inv_diag,
+                             const ValueType* in,
+                             ValueType*       out)
+    {
+        const int     dim   = (BLOCKDIM > 0) ? BLOCKDIM : dim_;
+        const int64_t bsize = static_cast<int64_t>(dim) * dim;
+
+        std::vector<ValueType> work(bsize);
+        std::vector<ValueType> tmp(dim);
+
+        // Solve L, with unit diagonal blocks
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            ValueType* xi = out + static_cast<int64_t>(ai) * dim;
+
+            for(int bi = 0; bi < dim; ++bi)
+            {
+                xi[bi] = in[static_cast<int64_t>(ai) * dim + bi];
+            }
+
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1] && col[aj] < ai; ++aj)
+            {
+                const ValueType* block = val + aj * bsize;
+                const ValueType* xj    = out + static_cast<int64_t>(col[aj]) * dim;
+
+                for(int bj = 0; bj < dim; ++bj)
+                {
+                    for(int bi = 0; bi < dim; ++bi)
+                    {
+                        xi[bi] -= block[BCSR_IND(0, bi, bj, dim)] * xj[bj];
+                    }
+                }
+            }
+        }
+
+        // Solve U
+        for(int ai = nrowb - 1; ai >= 0; --ai)
+        {
+            ValueType* xi = out + static_cast<int64_t>(ai) * dim;
+
+            int aj = row_offset[ai + 1] - 1;
+
+            for(; aj >= row_offset[ai] && col[aj] > ai; --aj)
+            {
+                const ValueType* block = val + aj * bsize;
+                const ValueType* xj    = out + static_cast<int64_t>(col[aj]) * dim;
+
+                for(int bj = 0; bj < dim; ++bj)
+                {
+                    for(int bi = 0; bi < dim; ++bi)
+                    {
+                        xi[bi] -= block[BCSR_IND(0, bi, bj, dim)] * xj[bj];
+                    }
+                }
+            }
+
+            // Diagonal block
+            if(aj < row_offset[ai] || col[aj] != ai)
+            {
+                return false;
+            }
+
+            if(inv_diag == NULL)
+            {
+                bcsr_block_solve<BLOCKDIM>(dim, val + aj * bsize, xi, work.data());
+                continue;
+            }
+
+            // x_i = U_ii^-1 * x_i
+            const ValueType* inv = inv_diag + ai * bsize;
+
+            for(int bi = 0; bi < dim; ++bi)
+            {
+                tmp[bi] = xi[bi];
+                xi[bi]  = static_cast<ValueType>(0);
+            }
+
+            for(int bj = 0; bj < dim; ++bj)
+            {
+                for(int bi = 0; bi < dim; ++bi)
+                {
+                    xi[bi] += inv[BCSR_IND(0, bi, bj, dim)] * tmp[bj];
+                }
+            }
+        }
+
+        return true;
+    }
+
     template <typename ValueType>
     void HostMatrixBCSR<ValueType>::Apply(const BaseVector<ValueType>& in,
                                           BaseVector<ValueType>*       out) const
@@ -347,6 +788,20 @@ namespace rocalution
 
             int bsrdim = this->mat_.blockdim;
 
+            if(bcsr_spmv_dispatch(bsrdim,
+                                  this->mat_.nrowb,
+                                  this->mat_.row_offset,
+                                  this->mat_.col,
+                                  this->mat_.val,
+                                  static_cast<ValueType>(1),
+                                  false,
+                                  cast_in->vec_,
+                                  cast_out->vec_)
+               == true)
+            {
+                return;
+            }
+
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -376,6 +831,74 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    bool HostMatrixBCSR<ValueType>::ApplyMulti(const BaseVector<ValueType>& in,
+                                               int                          num_vec,
+                                               BaseVector<ValueType>*       out) const
+    {
+        assert(num_vec > 0);
+        assert(in.GetSize() == static_cast<int64_t>(this->ncol_) * num_vec);
+        assert(out->GetSize() == static_cast<int64_t>(this->nrow_) * num_vec);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        if(this->nnz_ == 0)
+        {
+            cast_out->Zeros();
+
+            return true;
+        }
+
+        _set_omp_backend_threads(this->local_backend_, this->mat_.nrowb);
+
+        int     bsrdim = this->mat_.blockdim;
+        int64_t ldin   = this->ncol_;
+        int64_t ldout  = this->nrow_;
+
+        // Each block row is traversed once, every block is applied to all vectors
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->mat_.nrowb; ++ai)
+        {
+            int row_begin = this->mat_.row_offset[ai];
+            int row_end   = this->mat_.row_offset[ai + 1];
+
+            for(int c = 0; c < num_vec; ++c)
+            {
+                for(int bi = 0; bi < bsrdim; ++bi)
+                {
+                    cast_out->vec_[c * ldout + ai * bsrdim + bi] = static_cast<ValueType>(0);
+                }
+            }
+
+            for(int aj = row_begin; aj < row_end; ++aj)
+            {
+                int col = this->mat_.col[aj];
+
+                for(int bi = 0; bi < bsrdim; ++bi)
+                {
+                    for(int bj = 0; bj < bsrdim; ++bj)
+                    {
+                        ValueType val = this->mat_.val[BCSR_IND(aj, bi, bj, bsrdim)];
+
+                        for(int c = 0; c < num_vec; ++c)
+                        {
+                            cast_out->vec_[c * ldout + ai * bsrdim + bi]
+                                += val * cast_in->vec_[c * ldin + bsrdim * col + bj];
+                        }
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
     template <typename ValueType>
     void HostMatrixBCSR<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
                                              ValueType                    scalar,
@@ -399,6 +922,21 @@ namespace rocalution
             assert(this->nrow_ == this->ncol_);
 
             int bsrdim = this->mat_.blockdim;
+
+            if(bcsr_spmv_dispatch(bsrdim,
+                                  this->mat_.nrowb,
+                                  this->mat_.row_offset,
+                                  this->mat_.col,
+                                  this->mat_.val,
+                                  scalar,
+                                  true,
+                                  cast_in->vec_,
+                                  cast_out->vec_)
+               == true)
+            {
+                return;
+            }
+
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -428,6 +966,146 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    bool HostMatrixBCSR<ValueType>::ILU0Factorize(void)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        int nrowb = this->mat_.nrowb;
+
+        // Position of the diagonal blocks, the factorization requires sorted block rows
+        // with a diagonal block, otherwise it is performed in CSR format
+        std::vector<int> diag(nrowb, -1);
+
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                if(aj > this->mat_.row_offset[ai] && this->mat_.col[aj] <= this->mat_.col[aj - 1])
+                {
+                    return false;
+                }
+
+                if(this->mat_.col[aj] == ai)
+                {
+                    diag[ai] = aj;
+                }
+            }
+
+            if(diag[ai] == -1)
+            {
+                return false;
+            }
+        }
+
+        const int* ptr = this->mat_.row_offset;
+        const int* col = this->mat_.col;
+        ValueType* val = this->mat_.val;
+
+        int dim = this->mat_.blockdim;
+
+        free_host(&this->inv_diag_);
+        allocate_host(static_cast<int64_t>(nrowb) * dim * dim, &this->inv_diag_);
+
+        ValueType* inv  = this->inv_diag_;
+        int        fail = -1;
+
+        switch(dim)
+        {
+        case 2:
+            fail = bcsr_ilu0<2>(nrowb, 2, ptr, col, diag.data(), val, inv);
+            break;
+        case 3:
+            fail = bcsr_ilu0<3>(nrowb, 3, ptr, col, diag.data(), val, inv);
+            break;
+        case 4:
+            fail = bcsr_ilu0<4>(nrowb, 4, ptr, col, diag.data(), val, inv);
+            break;
+        case 5:
+            fail = bcsr_ilu0<5>(nrowb, 5, ptr, col, diag.data(), val, inv);
+            break;
+        case 6:
+            fail = bcsr_ilu0<6>(nrowb, 6, ptr, col, diag.data(), val, inv);
+            break;
+        case 7:
+            fail = bcsr_ilu0<7>(nrowb, 7, ptr, col, diag.data(), val, inv);
+            break;
+        case 8:
+            fail = bcsr_ilu0<8>(nrowb, 8, ptr, col, diag.data(), val, inv);
+            break;
+        default:
+            fail = bcsr_ilu0<0>(nrowb, dim, ptr, col, diag.data(), val, inv);
+            break;
+        }
+
+        if(fail != -1)
+        {
+            LOG_INFO("HostMatrixBCSR::ILU0Factorize() singular diagonal block in block row "
+                     << fail);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixBCSR<ValueType>::LUAnalyse(void)
+    {
+        // do nothing
+    }
+
+    template <typename ValueType>
+    void HostMatrixBCSR<ValueType>::LUAnalyseClear(void)
+    {
+        // do nothing
+    }
+
+    template <typename ValueType>
+    bool HostMatrixBCSR<ValueType>::LUSolve(const BaseVector<ValueType>& in,
+                                            BaseVector<ValueType>*       out) const
+    {
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        int        nrowb = this->mat_.nrowb;
+        const int* ptr   = this->mat_.row_offset;
+        const int* col   = this->mat_.col;
+
+        const ValueType* val = this->mat_.val;
+        const ValueType* inv = this->inv_diag_;
+        const ValueType* x   = cast_in->vec_;
+        ValueType*       y   = cast_out->vec_;
+
+        switch(this->mat_.blockdim)
+        {
+        case 2:
+            return bcsr_lusolve<2>(nrowb, 2, ptr, col, val, inv, x, y);
+        case 3:
+            return bcsr_lusolve<3>(nrowb, 3, ptr, col, val, inv, x, y);
+        case 4:
+            return bcsr_lusolve<4>(nrowb, 4, ptr, col, val, inv, x, y);
+        case 5:
+            return bcsr_lusolve<5>(nrowb, 5, ptr, col, val, inv, x, y);
+        case 6:
+            return bcsr_lusolve<6>(nrowb, 6, ptr, col, val, inv, x, y);
+        case 7:
+            return bcsr_lusolve<7>(nrowb, 7, ptr, col, val, inv, x, y);
+        case 8:
+            return bcsr_lusolve<8>(nrowb, 8, ptr, col, val, inv, x, y);
+        }
+
+        return bcsr_lusolve<0>(nrowb, this->mat_.blockdim, ptr, col, val, inv, x, y);
+    }
+
     template class HostMatrixBCSR<double>;
     template class HostMatrixBCSR<float>;
 #ifdef SUPPORT_COMPLEX
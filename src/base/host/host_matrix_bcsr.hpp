@@ -73,10 +73,22 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const;
+        virtual bool ApplyMulti(const BaseVector<ValueType>& in,
+                                int                          num_vec,
+                                BaseVector<ValueType>*       out) const;
+
+        virtual bool ILU0Factorize(void);
+
+        virtual void LUAnalyse(void);
+        virtual void LUAnalyseClear(void);
+        virtual bool LUSolve(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
 
     private:
         MatrixBCSR<ValueType, int> mat_;
 
+        // Inverted diagonal blocks of the block ILU(0) factor U
+        ValueType* inv_diag_;
+
         friend class BaseVector<ValueType>;
         friend class HostVector<ValueType>;
         friend class HostMatrixCSR<ValueType>;
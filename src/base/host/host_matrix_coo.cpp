@@ -34,6 +34,7 @@
 #include "host_conversion.hpp"
 #include "host_io.hpp"
 #include "host_matrix_csr.hpp"
+#include "host_sparse.hpp"
 #include "host_vector.hpp"
 
 #include <algorithm>
@@ -66,6 +67,10 @@ namespace rocalution
         this->mat_.row = NULL;
         this->mat_.col = NULL;
         this->mat_.val = NULL;
+
+        this->row_sorted_valid_ = false;
+        this->row_sorted_       = false;
+
         this->set_backend(local_backend);
     }
 
@@ -92,6 +97,8 @@ namespace rocalution
         this->nrow_ = 0;
         this->ncol_ = 0;
         this->nnz_  = 0;
+
+        this->row_sorted_valid_ = false;
     }
 
     template <typename ValueType>
@@ -160,6 +167,8 @@ namespace rocalution
         this->nrow_ = 0;
         this->ncol_ = 0;
         this->nnz_  = 0;
+
+        this->row_sorted_valid_ = false;
     }
 
     template <typename ValueType>
@@ -176,6 +185,8 @@ namespace rocalution
             copy_h2h(this->nnz_, row, this->mat_.row);
             copy_h2h(this->nnz_, col, this->mat_.col);
             copy_h2h(this->nnz_, val, this->mat_.val);
+
+            this->row_sorted_valid_ = false;
         }
     }
 
@@ -217,6 +228,9 @@ namespace rocalution
             copy_h2h(this->nnz_, cast_mat->mat_.row, this->mat_.row);
             copy_h2h(this->nnz_, cast_mat->mat_.col, this->mat_.col);
             copy_h2h(this->nnz_, cast_mat->mat_.val, this->mat_.val);
+
+            this->row_sorted_valid_ = cast_mat->row_sorted_valid_;
+            this->row_sorted_       = cast_mat->row_sorted_;
         }
         else
         {
@@ -367,13 +381,17 @@ namespace rocalution
 
         _set_omp_backend_threads(this->local_backend_, this->nnz_);
 
-        set_to_zero_host(this->nrow_, cast_out->vec_);
-
-        for(int64_t i = 0; i < this->nnz_; ++i)
-        {
-            cast_out->vec_[this->mat_.row[i]]
-                += this->mat_.val[i] * cast_in->vec_[this->mat_.col[i]];
-        }
+        host_coomv(this->nrow_,
+                   this->ncol_,
+                   this->nnz_,
+                   static_cast<ValueType>(1),
+                   this->mat_.val,
+                   this->mat_.row,
+                   this->mat_.col,
+                   cast_in->vec_,
+                   static_cast<ValueType>(0),
+                   cast_out->vec_,
+                   this->IsRowSorted_());
     }
 
     template <typename ValueType>
@@ -394,14 +412,34 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            for(int64_t i = 0; i < this->nnz_; ++i)
-            {
-                cast_out->vec_[this->mat_.row[i]]
-                    += scalar * this->mat_.val[i] * cast_in->vec_[this->mat_.col[i]];
-            }
+            _set_omp_backend_threads(this->local_backend_, this->nnz_);
+
+            host_coomv(this->nrow_,
+                       this->ncol_,
+                       this->nnz_,
+                       scalar,
+                       this->mat_.val,
+                       this->mat_.row,
+                       this->mat_.col,
+                       cast_in->vec_,
+                       static_cast<ValueType>(1),
+                       cast_out->vec_,
+                       this->IsRowSorted_());
         }
     }
 
+    template <typename ValueType>
+    bool HostMatrixCOO<ValueType>::IsRowSorted_(void) const
+    {
+        if(this->row_sorted_valid_ == false)
+        {
+            this->row_sorted_       = host_coo_is_row_sorted(this->nnz_, this->mat_.row);
+            this->row_sorted_valid_ = true;
+        }
+
+        return this->row_sorted_;
+    }
+
     template <typename ValueType>
     bool HostMatrixCOO<ValueType>::Sort(void)
     {
@@ -449,6 +487,9 @@ namespace rocalution
             free_host(&val);
         }
 
+        this->row_sorted_valid_ = true;
+        this->row_sorted_       = true;
+
         return true;
     }
 
@@ -476,6 +517,8 @@ namespace rocalution
             this->mat_.col[i] = cast_perm->vec_[src.mat_.col[i]];
         }
 
+        this->row_sorted_valid_ = false;
+
         return true;
     }
 
@@ -518,6 +561,8 @@ namespace rocalution
 
         free_host(&pb);
 
+        this->row_sorted_valid_ = false;
+
         return true;
     }
 
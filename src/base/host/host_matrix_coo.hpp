@@ -83,8 +83,16 @@ namespace rocalution
                               BaseVector<ValueType>*       out) const;
 
     private:
+        // Check (once per change of the structure) whether entries are sorted by row
+        bool IsRowSorted_(void) const;
+
         MatrixCOO<ValueType, int> mat_;
 
+        // Flag whether row_sorted_ is up to date
+        mutable bool row_sorted_valid_;
+        // Flag whether entries are sorted by row index
+        mutable bool row_sorted_;
+
         friend class BaseVector<ValueType>;
         friend class HostVector<ValueType>;
         friend class HostMatrixCSR<ValueType>;
@@ -28,6 +28,7 @@
 #include "../../utils/math_functions.hpp"
 #include "../matrix_formats_ind.hpp"
 #include "host_conversion.hpp"
+#include "host_graph.hpp"
 #include "host_io.hpp"
 #include "host_matrix_bcsr.hpp"
 #include "host_matrix_coo.hpp"
@@ -36,6 +37,7 @@
 #include "host_matrix_ell.hpp"
 #include "host_matrix_hyb.hpp"
 #include "host_matrix_mcsr.hpp"
+#include "host_matrix_sell.hpp"
 #include "host_sparse.hpp"
 #include "host_vector.hpp"
 #include "rocalution/utils/types.hpp"
@@ -48,6 +50,7 @@
 #include <map>
 #include <math.h>
 #include <numeric>
+#include <sstream>
 #include <string.h>
 #include <unordered_map>
 #include <unordered_set>
@@ -63,6 +66,12 @@
 #define omp_set_nested(num) ;
 #endif
 
+// Minimum average number of rows per level to use level scheduled triangular solves
+#define HOST_TRSV_MIN_LEVEL_SIZE 128
+
+// Number of rows of the blocks that are split independently in the first pass of HMIS
+#define HOST_HMIS_BLOCK_SIZE 16384
+
 namespace rocalution
 {
 
@@ -91,6 +100,18 @@ namespace rocalution
         this->mat_buffer_      = NULL;
 
         this->tmp_vec_ = NULL;
+
+        this->L_nlevel_    = 0;
+        this->L_level_ptr_ = NULL;
+        this->L_level_ind_ = NULL;
+
+        this->U_nlevel_    = 0;
+        this->U_level_ptr_ = NULL;
+        this->U_level_ind_ = NULL;
+
+        this->LT_row_ptr_ = NULL;
+        this->LT_col_     = NULL;
+        this->LT_perm_    = NULL;
     }
 
     template <typename ValueType>
@@ -116,6 +137,9 @@ namespace rocalution
         this->ItUAnalyseClear();
         this->ItLUAnalyseClear();
         this->ItLLAnalyseClear();
+
+        this->LevelAnalyseClear_(true);
+        this->LevelAnalyseClear_(false);
     }
 
     template <typename ValueType>
@@ -322,6 +346,9 @@ namespace rocalution
     {
         assert(row_offsets != NULL);
 
+        // Level schedules are bound to the pattern
+        this->LevelAnalyseCheckPattern_(row_offsets, col);
+
         copy_h2h(this->nrow_ + 1, row_offsets, this->mat_.row_offset);
 
         if(this->nnz_ > 0)
@@ -373,6 +400,9 @@ namespace rocalution
             assert(this->nrow_ == cast_mat->nrow_);
             assert(this->ncol_ == cast_mat->ncol_);
 
+            // Level schedules are bound to the pattern
+            this->LevelAnalyseCheckPattern_(cast_mat->mat_.row_offset, cast_mat->mat_.col);
+
             // Copy only if initialized
             if(cast_mat->mat_.row_offset != NULL)
             {
@@ -422,6 +452,28 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ReadFileMTX(const std::string& filename)
+    {
+        int     nrow;
+        int     ncol;
+        int64_t nnz;
+
+        PtrType*   ptr = NULL;
+        int*       col = NULL;
+        ValueType* val = NULL;
+
+        if(read_matrix_mtx_csr(nrow, ncol, nnz, &ptr, &col, &val, filename.c_str()) != true)
+        {
+            return false;
+        }
+
+        this->Clear();
+        this->SetDataPtrCSR(&ptr, &col, &val, nnz, nrow, ncol);
+
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::ReadFileCSR(const std::string& filename)
     {
@@ -448,6 +500,32 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::MapFileCSR(const std::string& filename)
+    {
+        int64_t nrow;
+        int64_t ncol;
+        int64_t nnz;
+
+        PtrType*   ptr = NULL;
+        int*       col = NULL;
+        ValueType* val = NULL;
+
+        if(map_matrix_csr(nrow, ncol, nnz, &ptr, &col, &val, filename.c_str()) != true)
+        {
+            return false;
+        }
+
+        // Number of rows and columns are expected to be within 32 bits locally
+        assert(nrow <= std::numeric_limits<int>::max());
+        assert(ncol <= std::numeric_limits<int>::max());
+
+        this->Clear();
+        this->SetDataPtrCSR(&ptr, &col, &val, nnz, static_cast<int>(nrow), static_cast<int>(ncol));
+
+        return true;
+    }
+
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::CopyFromHostCSR(const PtrType*   row_offset,
                                                    const int*       col,
@@ -497,6 +575,20 @@ namespace rocalution
                                             filename.c_str());
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::WriteFileRSIOCompressed(const std::string& filename,
+                                                           bool               compress_val) const
+    {
+        return write_matrix_csr_rocsparseio_compressed(this->nrow_,
+                                                       this->ncol_,
+                                                       this->nnz_,
+                                                       this->mat_.row_offset,
+                                                       this->mat_.col,
+                                                       this->mat_.val,
+                                                       compress_val,
+                                                       filename.c_str());
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::WriteFileCSR(const std::string& filename) const
     {
@@ -649,6 +741,29 @@ namespace rocalution
             }
         }
 
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->Clear();
+            int64_t nnz;
+
+            if(sell_to_csr(this->local_backend_.OpenMP_threads,
+                           cast_mat->nnz_,
+                           cast_mat->nrow_,
+                           cast_mat->ncol_,
+                           cast_mat->mat_,
+                           &this->mat_,
+                           &nnz)
+               == true)
+            {
+                this->nrow_ = cast_mat->nrow_;
+                this->ncol_ = cast_mat->ncol_;
+                this->nnz_  = nnz;
+
+                return true;
+            }
+        }
+
         if(const HostMatrixMCSR<ValueType>* cast_mat
            = dynamic_cast<const HostMatrixMCSR<ValueType>*>(&mat))
         {
@@ -715,22 +830,16 @@ namespace rocalution
 
         _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int ai = 0; ai < this->nrow_; ++ai)
-        {
-            ValueType sum     = static_cast<ValueType>(0);
-            PtrType   row_beg = this->mat_.row_offset[ai];
-            PtrType   row_end = this->mat_.row_offset[ai + 1];
-
-            for(PtrType aj = row_beg; aj < row_end; ++aj)
-            {
-                sum += this->mat_.val[aj] * cast_in->vec_[this->mat_.col[aj]];
-            }
-
-            cast_out->vec_[ai] = sum;
-        }
+        host_csrmv(this->nrow_,
+                   this->ncol_,
+                   static_cast<PtrType>(this->nnz_),
+                   static_cast<ValueType>(1),
+                   this->mat_.val,
+                   this->mat_.row_offset,
+                   this->mat_.col,
+                   cast_in->vec_,
+                   static_cast<ValueType>(0),
+                   cast_out->vec_);
     }
 
     template <typename ValueType>
@@ -753,19 +862,128 @@ namespace rocalution
 
             _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int ai = 0; ai < this->nrow_; ++ai)
-            {
-                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
-                    ++aj)
-                {
-                    cast_out->vec_[ai]
-                        += scalar * this->mat_.val[aj] * cast_in->vec_[this->mat_.col[aj]];
-                }
-            }
+            host_csrmv(this->nrow_,
+                       this->ncol_,
+                       static_cast<PtrType>(this->nnz_),
+                       scalar,
+                       this->mat_.val,
+                       this->mat_.row_offset,
+                       this->mat_.col,
+                       cast_in->vec_,
+                       static_cast<ValueType>(1),
+                       cast_out->vec_);
+        }
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ApplyMulti(const BaseVector<ValueType>& in,
+                                              int                          num_vec,
+                                              BaseVector<ValueType>*       out) const
+    {
+        assert(num_vec > 0);
+        assert(in.GetSize() == static_cast<int64_t>(this->ncol_) * num_vec);
+        assert(out->GetSize() == static_cast<int64_t>(this->nrow_) * num_vec);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        return host_csrmm(this->nrow_,
+                          this->ncol_,
+                          num_vec,
+                          static_cast<PtrType>(this->nnz_),
+                          static_cast<ValueType>(1),
+                          this->mat_.val,
+                          this->mat_.row_offset,
+                          this->mat_.col,
+                          cast_in->vec_,
+                          static_cast<ValueType>(0),
+                          cast_out->vec_);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::Residual(const BaseVector<ValueType>& rhs,
+                                            const BaseVector<ValueType>& x,
+                                            BaseVector<ValueType>*       res) const
+    {
+        assert(rhs.GetSize() == this->nrow_);
+        assert(x.GetSize() == this->ncol_);
+        assert(res->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_rhs = dynamic_cast<const HostVector<ValueType>*>(&rhs);
+        const HostVector<ValueType>* cast_x   = dynamic_cast<const HostVector<ValueType>*>(&x);
+        HostVector<ValueType>*       cast_res = dynamic_cast<HostVector<ValueType>*>(res);
+
+        assert(cast_rhs != NULL);
+        assert(cast_x != NULL);
+        assert(cast_res != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        return host_csrmv_residual(this->nrow_,
+                                   this->ncol_,
+                                   static_cast<PtrType>(this->nnz_),
+                                   this->mat_.val,
+                                   this->mat_.row_offset,
+                                   this->mat_.col,
+                                   cast_x->vec_,
+                                   cast_rhs->vec_,
+                                   cast_res->vec_);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ResidualRestrict(const BaseVector<ValueType>& rhs,
+                                                    const BaseVector<ValueType>& x,
+                                                    const BaseMatrix<ValueType>& restrict_mat,
+                                                    BaseVector<ValueType>*       res_coarse) const
+    {
+        const HostMatrixCSR<ValueType>* cast_restrict
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&restrict_mat);
+
+        if(cast_restrict == NULL)
+        {
+            return false;
+        }
+
+        // The fine residual is computed once per restriction entry, thus only fuse if the
+        // restriction has at most as many entries as there are fine rows (aggregation)
+        if(cast_restrict->nnz_ > this->nrow_)
+        {
+            return false;
         }
+
+        assert(rhs.GetSize() == this->nrow_);
+        assert(x.GetSize() == this->ncol_);
+        assert(cast_restrict->ncol_ == this->nrow_);
+        assert(res_coarse->GetSize() == cast_restrict->nrow_);
+
+        const HostVector<ValueType>* cast_rhs = dynamic_cast<const HostVector<ValueType>*>(&rhs);
+        const HostVector<ValueType>* cast_x   = dynamic_cast<const HostVector<ValueType>*>(&x);
+        HostVector<ValueType>*       cast_rc  = dynamic_cast<HostVector<ValueType>*>(res_coarse);
+
+        assert(cast_rhs != NULL);
+        assert(cast_x != NULL);
+        assert(cast_rc != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        return host_csrmv_residual_restrict(this->nrow_,
+                                            this->ncol_,
+                                            static_cast<PtrType>(this->nnz_),
+                                            this->mat_.val,
+                                            this->mat_.row_offset,
+                                            this->mat_.col,
+                                            cast_restrict->nrow_,
+                                            cast_restrict->mat_.val,
+                                            cast_restrict->mat_.row_offset,
+                                            cast_restrict->mat_.col,
+                                            cast_x->vec_,
+                                            cast_rhs->vec_,
+                                            cast_rc->vec_);
     }
 
     template <typename ValueType>
@@ -1174,6 +1392,76 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Level scheduled solve, if LUAnalyse() has built the schedules and threads are available
+        if(this->L_nlevel_ > 0 && this->U_nlevel_ > 0 && omp_get_max_threads() > 1)
+        {
+            const PtrType*   row_offset = this->mat_.row_offset;
+            const int*       col        = this->mat_.col;
+            const ValueType* val        = this->mat_.val;
+            const ValueType* x          = cast_in->vec_;
+            ValueType*       y          = cast_out->vec_;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                // Solve L, all rows of a level are independent
+                for(int l = 0; l < this->L_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                    for(int k = this->L_level_ptr_[l]; k < this->L_level_ptr_[l + 1]; ++k)
+                    {
+                        int       ai  = this->L_level_ind_[k];
+                        ValueType sum = x[ai];
+
+                        // CSR should be sorted
+                        for(PtrType aj = row_offset[ai];
+                            aj < row_offset[ai + 1] && col[aj] < ai;
+                            ++aj)
+                        {
+                            sum -= val[aj] * y[col[aj]];
+                        }
+
+                        y[ai] = sum;
+                    }
+                }
+
+                // Solve U
+                for(int l = 0; l < this->U_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                    for(int k = this->U_level_ptr_[l]; k < this->U_level_ptr_[l + 1]; ++k)
+                    {
+                        int       ai   = this->U_level_ind_[k];
+                        ValueType sum  = y[ai];
+                        ValueType diag = static_cast<ValueType>(1);
+
+                        for(PtrType aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+                        {
+                            if(col[aj] > ai)
+                            {
+                                sum -= val[aj] * y[col[aj]];
+                            }
+                            else if(col[aj] == ai)
+                            {
+                                diag = val[aj];
+                            }
+                        }
+
+                        y[ai] = sum / diag;
+                    }
+                }
+            }
+
+            return true;
+        }
+
         // Solve L
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
@@ -1220,28 +1508,169 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LevelAnalyse_(bool lower)
+    {
+        this->LevelAnalyseClear_(lower);
+
+        if(this->nrow_ == 0)
+        {
+            return;
+        }
+
+        int  nlevel;
+        int* level_ptr = NULL;
+        int* level_ind = NULL;
+
+        allocate_host(this->nrow_ + 1, &level_ptr);
+        allocate_host(this->nrow_, &level_ind);
+
+        host_csrsv_analysis(this->nrow_,
+                            this->mat_.row_offset,
+                            this->mat_.col,
+                            lower ? host_sparse_fill_mode_lower : host_sparse_fill_mode_upper,
+                            &nlevel,
+                            level_ptr,
+                            level_ind);
+
+        // Levels that are too small do not amortize the synchronization between the
+        // levels, the sequential solve is used instead
+        if(static_cast<int64_t>(nlevel) * HOST_TRSV_MIN_LEVEL_SIZE > this->nrow_)
+        {
+            free_host(&level_ptr);
+            free_host(&level_ind);
+
+            return;
+        }
+
+        if(lower == true)
+        {
+            this->L_nlevel_    = nlevel;
+            this->L_level_ptr_ = level_ptr;
+            this->L_level_ind_ = level_ind;
+        }
+        else
+        {
+            this->U_nlevel_    = nlevel;
+            this->U_level_ptr_ = level_ptr;
+            this->U_level_ind_ = level_ind;
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LevelAnalyseClear_(bool lower)
+    {
+        if(lower == true)
+        {
+            free_host(&this->L_level_ptr_);
+            free_host(&this->L_level_ind_);
+
+            free_host(&this->LT_row_ptr_);
+            free_host(&this->LT_col_);
+            free_host(&this->LT_perm_);
+
+            this->L_nlevel_ = 0;
+        }
+        else
+        {
+            free_host(&this->U_level_ptr_);
+            free_host(&this->U_level_ind_);
+
+            this->U_nlevel_ = 0;
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LevelAnalyseCheckPattern_(const PtrType* row_offset,
+                                                             const int*     col)
+    {
+        if(this->L_nlevel_ == 0 && this->U_nlevel_ == 0)
+        {
+            return;
+        }
+
+        // Drop the level schedules, if the new pattern differs from the analysed one
+        if(row_offset == NULL || col == NULL
+           || std::equal(row_offset, row_offset + this->nrow_ + 1, this->mat_.row_offset) == false
+           || std::equal(col, col + this->nnz_, this->mat_.col) == false)
+        {
+            this->LevelAnalyseClear_(true);
+            this->LevelAnalyseClear_(false);
+        }
+    }
+
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LLAnalyse(void)
     {
-        // do nothing
+        this->LevelAnalyse_(true);
+
+        if(this->L_nlevel_ == 0)
+        {
+            return;
+        }
+
+        // The L^T sweep processes the levels of L in reverse order. It requires the
+        // strictly lower triangular part transposed, the diagonal is the last entry of
+        // each row.
+        allocate_host(this->nrow_ + 1, &this->LT_row_ptr_);
+        allocate_host(this->nnz_, &this->LT_col_);
+        allocate_host(this->nnz_, &this->LT_perm_);
+
+        set_to_zero_host(this->nrow_ + 1, this->LT_row_ptr_);
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1] - 1;
+                ++aj)
+            {
+                ++this->LT_row_ptr_[this->mat_.col[aj] + 1];
+            }
+        }
+
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            this->LT_row_ptr_[i + 1] += this->LT_row_ptr_[i];
+        }
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1] - 1;
+                ++aj)
+            {
+                PtrType idx = this->LT_row_ptr_[this->mat_.col[aj]]++;
+
+                this->LT_col_[idx]  = ai;
+                this->LT_perm_[idx] = aj;
+            }
+        }
+
+        // Shift back the row offsets
+        for(int i = this->nrow_; i > 0; --i)
+        {
+            this->LT_row_ptr_[i] = this->LT_row_ptr_[i - 1];
+        }
+
+        this->LT_row_ptr_[0] = 0;
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LLAnalyseClear(void)
     {
-        // do nothing
+        this->LevelAnalyseClear_(true);
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LUAnalyse(void)
     {
-        // do nothing
+        this->LevelAnalyse_(true);
+        this->LevelAnalyse_(false);
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LUAnalyseClear(void)
     {
-        // do nothing
+        this->LevelAnalyseClear_(true);
+        this->LevelAnalyseClear_(false);
     }
 
     template <typename ValueType>
@@ -1259,13 +1688,74 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
-        // Solve L
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Level scheduled solve, if LLAnalyse() has built the schedule and threads are available.
+        // LAnalyse() builds the schedule of L without the transposed part for the L^T sweep.
+        if(this->L_nlevel_ > 0 && this->LT_row_ptr_ != NULL && omp_get_max_threads() > 1)
         {
-            ValueType value    = cast_in->vec_[ai];
-            PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
+            const PtrType*   row_offset = this->mat_.row_offset;
+            const int*       col        = this->mat_.col;
+            const ValueType* val        = this->mat_.val;
+            const ValueType* x          = cast_in->vec_;
+            ValueType*       y          = cast_out->vec_;
 
-            for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                // Solve L, all rows of a level are independent
+                for(int l = 0; l < this->L_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                    for(int k = this->L_level_ptr_[l]; k < this->L_level_ptr_[l + 1]; ++k)
+                    {
+                        int       ai       = this->L_level_ind_[k];
+                        PtrType   diag_idx = row_offset[ai + 1] - 1;
+                        ValueType sum      = x[ai];
+
+                        for(PtrType aj = row_offset[ai]; aj < diag_idx; ++aj)
+                        {
+                            sum -= val[aj] * y[col[aj]];
+                        }
+
+                        y[ai] = sum / val[diag_idx];
+                    }
+                }
+
+                // Solve L^T, the levels of L in reverse order
+                for(int l = this->L_nlevel_ - 1; l >= 0; --l)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                    for(int k = this->L_level_ptr_[l]; k < this->L_level_ptr_[l + 1]; ++k)
+                    {
+                        int       ai  = this->L_level_ind_[k];
+                        ValueType sum = y[ai];
+
+                        for(PtrType j = this->LT_row_ptr_[ai]; j < this->LT_row_ptr_[ai + 1]; ++j)
+                        {
+                            sum -= val[this->LT_perm_[j]] * y[this->LT_col_[j]];
+                        }
+
+                        y[ai] = sum / val[row_offset[ai + 1] - 1];
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // Solve L
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            ValueType value    = cast_in->vec_[ai];
+            PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
+
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
             {
                 value -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
             }
@@ -1309,6 +1799,68 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Level scheduled solve, if LLAnalyse() has built the schedule and threads are available.
+        // LAnalyse() builds the schedule of L without the transposed part for the L^T sweep.
+        if(this->L_nlevel_ > 0 && this->LT_row_ptr_ != NULL && omp_get_max_threads() > 1)
+        {
+            const PtrType*   row_offset = this->mat_.row_offset;
+            const int*       col        = this->mat_.col;
+            const ValueType* val        = this->mat_.val;
+            const ValueType* x          = cast_in->vec_;
+            const ValueType* inv_diag   = cast_diag->vec_;
+            ValueType*       y          = cast_out->vec_;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                // Solve L, all rows of a level are independent
+                for(int l = 0; l < this->L_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                    for(int k = this->L_level_ptr_[l]; k < this->L_level_ptr_[l + 1]; ++k)
+                    {
+                        int       ai       = this->L_level_ind_[k];
+                        PtrType   diag_idx = row_offset[ai + 1] - 1;
+                        ValueType sum      = x[ai];
+
+                        for(PtrType aj = row_offset[ai]; aj < diag_idx; ++aj)
+                        {
+                            sum -= val[aj] * y[col[aj]];
+                        }
+
+                        y[ai] = sum * inv_diag[ai];
+                    }
+                }
+
+                // Solve L^T, the levels of L in reverse order
+                for(int l = this->L_nlevel_ - 1; l >= 0; --l)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                    for(int k = this->L_level_ptr_[l]; k < this->L_level_ptr_[l + 1]; ++k)
+                    {
+                        int       ai  = this->L_level_ind_[k];
+                        ValueType sum = y[ai];
+
+                        for(PtrType j = this->LT_row_ptr_[ai]; j < this->LT_row_ptr_[ai + 1]; ++j)
+                        {
+                            sum -= val[this->LT_perm_[j]] * y[this->LT_col_[j]];
+                        }
+
+                        y[ai] = sum * inv_diag[ai];
+                    }
+                }
+            }
+
+            return true;
+        }
+
         // Solve L
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
@@ -1344,13 +1896,16 @@ namespace rocalution
     void HostMatrixCSR<ValueType>::LAnalyse(bool diag_unit)
     {
         this->L_diag_unit_ = diag_unit;
+
+        this->LevelAnalyse_(true);
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LAnalyseClear(void)
     {
-        // do nothing
         this->L_diag_unit_ = true;
+
+        this->LevelAnalyseClear_(true);
     }
 
     template <typename ValueType>
@@ -1368,6 +1923,52 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Level scheduled solve, if LAnalyse() has built the schedule and threads are available
+        if(this->L_nlevel_ > 0 && omp_get_max_threads() > 1)
+        {
+            const PtrType*   row_offset = this->mat_.row_offset;
+            const int*       col        = this->mat_.col;
+            const ValueType* val        = this->mat_.val;
+            const ValueType* x          = cast_in->vec_;
+            ValueType*       y          = cast_out->vec_;
+
+            bool diag_unit = this->L_diag_unit_;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for(int l = 0; l < this->L_nlevel_; ++l)
+            {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                for(int k = this->L_level_ptr_[l]; k < this->L_level_ptr_[l + 1]; ++k)
+                {
+                    int       ai  = this->L_level_ind_[k];
+                    ValueType sum = x[ai];
+                    PtrType   aj  = row_offset[ai];
+
+                    // CSR should be sorted
+                    for(; aj < row_offset[ai + 1] && col[aj] < ai; ++aj)
+                    {
+                        sum -= val[aj] * y[col[aj]];
+                    }
+
+                    if(diag_unit == false)
+                    {
+                        assert(col[aj] == ai);
+                        sum /= val[aj];
+                    }
+
+                    y[ai] = sum;
+                }
+            }
+
+            return true;
+        }
+
         PtrType diag_aj = 0;
 
         // Solve L
@@ -1407,13 +2008,16 @@ namespace rocalution
     void HostMatrixCSR<ValueType>::UAnalyse(bool diag_unit)
     {
         this->U_diag_unit_ = diag_unit;
+
+        this->LevelAnalyse_(false);
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::UAnalyseClear(void)
     {
-        // do nothing
         this->U_diag_unit_ = false;
+
+        this->LevelAnalyseClear_(false);
     }
 
     template <typename ValueType>
@@ -1431,6 +2035,52 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Level scheduled solve, if UAnalyse() has built the schedule and threads are available
+        if(this->U_nlevel_ > 0 && omp_get_max_threads() > 1)
+        {
+            const PtrType*   row_offset = this->mat_.row_offset;
+            const int*       col        = this->mat_.col;
+            const ValueType* val        = this->mat_.val;
+            const ValueType* x          = cast_in->vec_;
+            ValueType*       y          = cast_out->vec_;
+
+            bool diag_unit = this->U_diag_unit_;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for(int l = 0; l < this->U_nlevel_; ++l)
+            {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                for(int k = this->U_level_ptr_[l]; k < this->U_level_ptr_[l + 1]; ++k)
+                {
+                    int       ai   = this->U_level_ind_[k];
+                    ValueType sum  = x[ai];
+                    ValueType diag = static_cast<ValueType>(1);
+
+                    for(PtrType aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+                    {
+                        if(col[aj] > ai)
+                        {
+                            sum -= val[aj] * y[col[aj]];
+                        }
+                        else if(col[aj] == ai)
+                        {
+                            diag = val[aj];
+                        }
+                    }
+
+                    y[ai] = (diag_unit == false) ? sum / diag : sum;
+                }
+            }
+
+            return true;
+        }
+
         // last elements should the diagonal one (last)
         int64_t diag_aj = this->nnz_ - 1;
 
@@ -2475,94 +3125,130 @@ namespace rocalution
         HostVector<int>* cast_perm = dynamic_cast<HostVector<int>*>(permutation);
         assert(cast_perm != NULL);
 
-        /*
-        *   Create CSC
-        */
-        PtrType* csc_ptr = NULL;
-        int*     csc_ind = NULL;
-
-        allocate_host(this->ncol_ + 1, &csc_ptr);
-        allocate_host(this->nnz_, &csc_ind);
-
-        set_to_zero_host(this->nrow_ + 1, csc_ptr);
+        // node colors (init value = 0 i.e. no color)
+        int* color = NULL;
+        allocate_host(this->nrow_, &color);
 
-        for(PtrType i = 0; i < this->nnz_; ++i)
+        if(_get_backend_descriptor()->OpenMP_parallel_coloring == true)
         {
-            csc_ptr[this->mat_.col[i] + 1] += 1;
-        }
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-        for(int i = 1; i < this->nrow_ + 1; ++i)
-        {
-            csc_ptr[i] += csc_ptr[i - 1];
-        }
+            // Parallel Jones-Plassmann coloring of the graph of A + A^T
+            PtrType* t_row_offset = NULL;
+            int*     t_col        = NULL;
 
-        for(int i = 0; i < this->nrow_; ++i)
-        {
-            for(PtrType k = this->mat_.row_offset[i]; k < this->mat_.row_offset[i + 1]; ++k)
+            // The transposed pattern is only required for unsymmetric patterns
+            if(host_graph_is_symmetric(this->nrow_, this->mat_.row_offset, this->mat_.col)
+               == false)
             {
-                csc_ind[csc_ptr[this->mat_.col[k]]++] = i;
+                allocate_host(this->nrow_ + 1, &t_row_offset);
+                allocate_host(this->nnz_, &t_col);
+
+                host_graph_transpose(
+                    this->nrow_, this->mat_.row_offset, this->mat_.col, t_row_offset, t_col);
             }
+
+            // Fixed seed, such that the coloring is reproducible
+            host_graph_coloring(this->nrow_,
+                                this->mat_.row_offset,
+                                this->mat_.col,
+                                t_row_offset,
+                                t_col,
+                                0u,
+                                color,
+                                &num_colors);
+
+            free_host(&t_row_offset);
+            free_host(&t_col);
         }
-        for(int i = this->nrow_; i > 0; --i)
+        else
         {
-            csc_ptr[i] = csc_ptr[i - 1];
-        }
-        csc_ptr[0] = 0;
+            /*
+            *   Create CSC
+            */
+            PtrType* csc_ptr = NULL;
+            int*     csc_ind = NULL;
 
-        // node colors (init value = 0 i.e. no color)
-        int* color = NULL;
-        allocate_host(this->nrow_, &color);
+            allocate_host(this->ncol_ + 1, &csc_ptr);
+            allocate_host(this->nnz_, &csc_ind);
 
-        memset(color, 0, sizeof(int) * this->nrow_);
-        num_colors = 0;
-        std::vector<bool> row_col;
+            set_to_zero_host(this->nrow_ + 1, csc_ptr);
 
-        for(int ai = 0; ai < this->nrow_; ++ai)
-        {
-            color[ai] = 1;
-            row_col.clear();
-            row_col.reserve(num_colors + 2);
-            row_col.assign(num_colors + 2, false);
+            for(PtrType i = 0; i < this->nnz_; ++i)
+            {
+                csc_ptr[this->mat_.col[i] + 1] += 1;
+            }
 
-            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(int i = 1; i < this->nrow_ + 1; ++i)
             {
-                if(ai != this->mat_.col[aj])
-                {
-                    row_col[color[this->mat_.col[aj]]] = true;
-                }
+                csc_ptr[i] += csc_ptr[i - 1];
             }
 
-            for(PtrType aj = csc_ptr[ai]; aj < csc_ptr[ai + 1]; ++aj)
+            for(int i = 0; i < this->nrow_; ++i)
             {
-                if(ai != csc_ind[aj])
+                for(PtrType k = this->mat_.row_offset[i]; k < this->mat_.row_offset[i + 1]; ++k)
                 {
-                    row_col[color[csc_ind[aj]]] = true;
+                    csc_ind[csc_ptr[this->mat_.col[k]]++] = i;
                 }
             }
+            for(int i = this->nrow_; i > 0; --i)
+            {
+                csc_ptr[i] = csc_ptr[i - 1];
+            }
+            csc_ptr[0] = 0;
 
-            PtrType count = this->mat_.row_offset[ai + 1] - this->mat_.row_offset[ai]
-                            + csc_ptr[ai + 1] - csc_ptr[ai];
+            memset(color, 0, sizeof(int) * this->nrow_);
+            num_colors = 0;
+            std::vector<bool> row_col;
 
-            for(PtrType aj = 0; aj < count; ++aj)
+            for(int ai = 0; ai < this->nrow_; ++ai)
             {
-                if(row_col[color[ai]] == true)
+                color[ai] = 1;
+                row_col.clear();
+                row_col.reserve(num_colors + 2);
+                row_col.assign(num_colors + 2, false);
+
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
                 {
-                    ++color[ai];
+                    if(ai != this->mat_.col[aj])
+                    {
+                        row_col[color[this->mat_.col[aj]]] = true;
+                    }
                 }
-                else
+
+                for(PtrType aj = csc_ptr[ai]; aj < csc_ptr[ai + 1]; ++aj)
                 {
-                    break;
+                    if(ai != csc_ind[aj])
+                    {
+                        row_col[color[csc_ind[aj]]] = true;
+                    }
                 }
-            }
 
-            if(color[ai] > num_colors)
-            {
-                num_colors = color[ai];
+                PtrType count = this->mat_.row_offset[ai + 1] - this->mat_.row_offset[ai]
+                                + csc_ptr[ai + 1] - csc_ptr[ai];
+
+                for(PtrType aj = 0; aj < count; ++aj)
+                {
+                    if(row_col[color[ai]] == true)
+                    {
+                        ++color[ai];
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                if(color[ai] > num_colors)
+                {
+                    num_colors = color[ai];
+                }
             }
-        }
 
-        free_host(&csc_ptr);
-        free_host(&csc_ind);
+            free_host(&csc_ptr);
+            free_host(&csc_ind);
+        }
 
         allocate_host(num_colors, size_colors);
         set_to_zero_host(num_colors, *size_colors);
@@ -2610,25 +3296,77 @@ namespace rocalution
 
         int* mis = NULL;
         allocate_host(this->nrow_, &mis);
-        memset(mis, 0, sizeof(int) * this->nrow_);
 
-        size = 0;
+        if(_get_backend_descriptor()->OpenMP_parallel_coloring == true)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-        for(int ai = 0; ai < this->nrow_; ++ai)
+            // Parallel Luby independent set of the graph of A + A^T
+            PtrType* t_row_offset = NULL;
+            int*     t_col        = NULL;
+
+            // The transposed pattern is only required for unsymmetric patterns
+            if(host_graph_is_symmetric(this->nrow_, this->mat_.row_offset, this->mat_.col)
+               == false)
+            {
+                allocate_host(this->nrow_ + 1, &t_row_offset);
+                allocate_host(this->nnz_, &t_col);
+
+                host_graph_transpose(
+                    this->nrow_, this->mat_.row_offset, this->mat_.col, t_row_offset, t_col);
+            }
+
+            // Fixed seed, such that the independent set is reproducible
+            host_graph_mis(this->nrow_,
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           t_row_offset,
+                           t_col,
+                           0u,
+                           mis,
+                           &size);
+
+            free_host(&t_row_offset);
+            free_host(&t_col);
+        }
+        else
         {
-            if(mis[ai] == 0)
+            memset(mis, 0, sizeof(int) * this->nrow_);
+
+            size = 0;
+
+            for(int ai = 0; ai < this->nrow_; ++ai)
             {
-                // set the node
-                mis[ai] = 1;
-                ++size;
+                if(mis[ai] == 0)
+                {
+                    // for unsymmetric patterns, a nbh node might already be set
+                    for(PtrType aj = this->mat_.row_offset[ai];
+                        aj < this->mat_.row_offset[ai + 1];
+                        ++aj)
+                    {
+                        if(mis[this->mat_.col[aj]] == 1 && ai != this->mat_.col[aj])
+                        {
+                            mis[ai] = -1;
+                            break;
+                        }
+                    }
+                }
 
-                // remove all nbh nodes (without diagonal)
-                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
-                    ++aj)
+                if(mis[ai] == 0)
                 {
-                    if(ai != this->mat_.col[aj])
+                    // set the node
+                    mis[ai] = 1;
+                    ++size;
+
+                    // remove all nbh nodes (without diagonal)
+                    for(PtrType aj = this->mat_.row_offset[ai];
+                        aj < this->mat_.row_offset[ai + 1];
+                        ++aj)
                     {
-                        mis[this->mat_.col[aj]] = -1;
+                        if(ai != this->mat_.col[aj])
+                        {
+                            mis[this->mat_.col[aj]] = -1;
+                        }
                     }
                 }
             }
@@ -3069,49 +3807,298 @@ namespace rocalution
         return true;
     }
 
+    // Row-wise Galerkin product, the i-th row of R*A is accumulated into a sparse work row,
+    // which is then multiplied by P. Neither R*A nor A*P is stored.
+    // this = R * A * P
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::SymbolicPower(int p)
+    bool HostMatrixCSR<ValueType>::SymbolicTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                               const BaseMatrix<ValueType>& A,
+                                                               const BaseMatrix<ValueType>& P)
     {
-        assert(p > 1);
+        const HostMatrixCSR<ValueType>* cast_R = dynamic_cast<const HostMatrixCSR<ValueType>*>(&R);
+        const HostMatrixCSR<ValueType>* cast_A = dynamic_cast<const HostMatrixCSR<ValueType>*>(&A);
+        const HostMatrixCSR<ValueType>* cast_P = dynamic_cast<const HostMatrixCSR<ValueType>*>(&P);
 
-        // The optimal values for the firsts values
+        assert(cast_R != NULL);
+        assert(cast_A != NULL);
+        assert(cast_P != NULL);
+        assert(cast_R->ncol_ == cast_A->nrow_);
+        assert(cast_A->ncol_ == cast_P->nrow_);
 
-        if(p == 2)
-        {
-            this->SymbolicMatMatMult(*this);
-        }
+        int nrow  = cast_R->nrow_;
+        int nfine = cast_A->ncol_;
+        int ncol  = cast_P->ncol_;
 
-        if(p == 3)
-        {
-            HostMatrixCSR<ValueType> tmp(this->local_backend_);
-            tmp.CopyFrom(*this);
+        PtrType*   row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
 
-            this->SymbolicPower(2);
-            this->SymbolicMatMatMult(tmp);
-        }
+        allocate_host(nrow + 1, &row_offset);
+        set_to_zero_host(nrow + 1, row_offset);
 
-        if(p == 4)
-        {
-            this->SymbolicPower(2);
-            this->SymbolicPower(2);
-        }
+        _set_omp_backend_threads(this->local_backend_, nrow);
 
-        if(p == 5)
+        // The first pass counts the entries of each row, the second pass fills the rows
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
         {
-            HostMatrixCSR<ValueType> tmp(this->local_backend_);
-            tmp.CopyFrom(*this);
+            std::vector<int> fine_marker(nfine, -1);
+            std::vector<int> coarse_marker(ncol, -1);
+            std::vector<int> fine_list;
 
-            this->SymbolicPower(4);
-            this->SymbolicMatMatMult(tmp);
-        }
+            for(int pass = 0; pass < 2; ++pass)
+            {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+                for(int i = 0; i < nrow; ++i)
+                {
+                    // Columns of the i-th row of R*A
+                    fine_list.clear();
 
-        if(p == 6)
-        {
-            this->SymbolicPower(2);
-            this->SymbolicPower(3);
-        }
+                    for(PtrType k = cast_R->mat_.row_offset[i]; k < cast_R->mat_.row_offset[i + 1];
+                        ++k)
+                    {
+                        int rk = cast_R->mat_.col[k];
 
-        if(p == 7)
+                        for(PtrType l = cast_A->mat_.row_offset[rk];
+                            l < cast_A->mat_.row_offset[rk + 1];
+                            ++l)
+                        {
+                            int al = cast_A->mat_.col[l];
+
+                            if(fine_marker[al] != i)
+                            {
+                                fine_marker[al] = i;
+                                fine_list.push_back(al);
+                            }
+                        }
+                    }
+
+                    // Columns of the i-th row of R*A*P
+                    PtrType idx = (pass == 0) ? 0 : row_offset[i];
+
+                    for(size_t f = 0; f < fine_list.size(); ++f)
+                    {
+                        int pf = fine_list[f];
+
+                        for(PtrType j = cast_P->mat_.row_offset[pf];
+                            j < cast_P->mat_.row_offset[pf + 1];
+                            ++j)
+                        {
+                            int pj = cast_P->mat_.col[j];
+
+                            if(coarse_marker[pj] != i)
+                            {
+                                coarse_marker[pj] = i;
+
+                                if(pass == 1)
+                                {
+                                    col[idx] = pj;
+                                }
+
+                                ++idx;
+                            }
+                        }
+                    }
+
+                    if(pass == 0)
+                    {
+                        row_offset[i + 1] = idx;
+                    }
+                    else
+                    {
+                        std::sort(col + row_offset[i], col + row_offset[i + 1]);
+                    }
+                }
+
+                std::fill(fine_marker.begin(), fine_marker.end(), -1);
+                std::fill(coarse_marker.begin(), coarse_marker.end(), -1);
+
+                if(pass == 0)
+                {
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+                    {
+                        for(int i = 0; i < nrow; ++i)
+                        {
+                            row_offset[i + 1] += row_offset[i];
+                        }
+
+                        allocate_host(row_offset[nrow], &col);
+                        allocate_host(row_offset[nrow], &val);
+                    }
+                }
+            }
+        }
+
+        set_to_zero_host(row_offset[nrow], val);
+
+        this->SetDataPtrCSR(&row_offset, &col, &val, row_offset[nrow], nrow, ncol);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::NumericTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                              const BaseMatrix<ValueType>& A,
+                                                              const BaseMatrix<ValueType>& P)
+    {
+        const HostMatrixCSR<ValueType>* cast_R = dynamic_cast<const HostMatrixCSR<ValueType>*>(&R);
+        const HostMatrixCSR<ValueType>* cast_A = dynamic_cast<const HostMatrixCSR<ValueType>*>(&A);
+        const HostMatrixCSR<ValueType>* cast_P = dynamic_cast<const HostMatrixCSR<ValueType>*>(&P);
+
+        assert(cast_R != NULL);
+        assert(cast_A != NULL);
+        assert(cast_P != NULL);
+        assert(cast_R->ncol_ == cast_A->nrow_);
+        assert(cast_A->ncol_ == cast_P->nrow_);
+
+        if(this->nrow_ != cast_R->nrow_ || this->ncol_ != cast_P->ncol_)
+        {
+            return false;
+        }
+
+        int nrow  = cast_R->nrow_;
+        int nfine = cast_A->ncol_;
+        int ncol  = cast_P->ncol_;
+
+        // Set to false, if a product entry is not part of the structure of this
+        bool match = true;
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // Position of a fine column in the work row, validated against fine_list
+            std::vector<int>       fine_pos(nfine, -1);
+            std::vector<int>       fine_list;
+            std::vector<ValueType> fine_val;
+
+            // Position of a coarse column in the current row of this
+            std::vector<PtrType> coarse_pos(ncol, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64) reduction(&& : match)
+#endif
+            for(int i = 0; i < nrow; ++i)
+            {
+                // Work row, i-th row of R*A
+                fine_list.clear();
+                fine_val.clear();
+
+                for(PtrType k = cast_R->mat_.row_offset[i]; k < cast_R->mat_.row_offset[i + 1];
+                    ++k)
+                {
+                    int       rk = cast_R->mat_.col[k];
+                    ValueType rv = cast_R->mat_.val[k];
+
+                    for(PtrType l = cast_A->mat_.row_offset[rk];
+                        l < cast_A->mat_.row_offset[rk + 1];
+                        ++l)
+                    {
+                        int al  = cast_A->mat_.col[l];
+                        int pos = fine_pos[al];
+
+                        if(pos < 0 || pos >= static_cast<int>(fine_list.size())
+                           || fine_list[pos] != al)
+                        {
+                            fine_pos[al] = static_cast<int>(fine_list.size());
+                            fine_list.push_back(al);
+                            fine_val.push_back(rv * cast_A->mat_.val[l]);
+                        }
+                        else
+                        {
+                            fine_val[pos] += rv * cast_A->mat_.val[l];
+                        }
+                    }
+                }
+
+                PtrType row_begin = this->mat_.row_offset[i];
+                PtrType row_end   = this->mat_.row_offset[i + 1];
+
+                for(PtrType j = row_begin; j < row_end; ++j)
+                {
+                    coarse_pos[this->mat_.col[j]] = j;
+                    this->mat_.val[j]             = static_cast<ValueType>(0);
+                }
+
+                // Multiply the work row by P
+                for(size_t f = 0; f < fine_list.size(); ++f)
+                {
+                    int       pf = fine_list[f];
+                    ValueType fv = fine_val[f];
+
+                    for(PtrType j = cast_P->mat_.row_offset[pf]; j < cast_P->mat_.row_offset[pf + 1];
+                        ++j)
+                    {
+                        // Positions of previous rows are outside of [row_begin, row_end)
+                        PtrType pos = coarse_pos[cast_P->mat_.col[j]];
+
+                        if(pos >= row_begin && pos < row_end)
+                        {
+                            this->mat_.val[pos] += fv * cast_P->mat_.val[j];
+                        }
+                        else
+                        {
+                            match = false;
+                        }
+                    }
+                }
+            }
+        }
+
+        return match;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::SymbolicPower(int p)
+    {
+        assert(p > 1);
+
+        // The optimal values for the firsts values
+
+        if(p == 2)
+        {
+            this->SymbolicMatMatMult(*this);
+        }
+
+        if(p == 3)
+        {
+            HostMatrixCSR<ValueType> tmp(this->local_backend_);
+            tmp.CopyFrom(*this);
+
+            this->SymbolicPower(2);
+            this->SymbolicMatMatMult(tmp);
+        }
+
+        if(p == 4)
+        {
+            this->SymbolicPower(2);
+            this->SymbolicPower(2);
+        }
+
+        if(p == 5)
+        {
+            HostMatrixCSR<ValueType> tmp(this->local_backend_);
+            tmp.CopyFrom(*this);
+
+            this->SymbolicPower(4);
+            this->SymbolicMatMatMult(tmp);
+        }
+
+        if(p == 6)
+        {
+            this->SymbolicPower(2);
+            this->SymbolicPower(3);
+        }
+
+        if(p == 7)
         {
             HostMatrixCSR<ValueType> tmp(this->local_backend_);
             tmp.CopyFrom(*this);
@@ -3811,6 +4798,10 @@ namespace rocalution
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::Sort(void)
     {
+        // Level schedules refer to entry positions, which are reordered
+        this->LevelAnalyseClear_(true);
+        this->LevelAnalyseClear_(false);
+
         if(this->nnz_ > 0)
         {
 #ifdef _OPENMP
@@ -3849,6 +4840,10 @@ namespace rocalution
     {
         assert((permutation.GetSize() == this->nrow_) && (permutation.GetSize() == this->ncol_));
 
+        // Level schedules refer to the pattern, which is permuted
+        this->LevelAnalyseClear_(true);
+        this->LevelAnalyseClear_(false);
+
         if(this->nnz_ > 0)
         {
             const HostVector<int>* cast_perm = dynamic_cast<const HostVector<int>*>(&permutation);
@@ -3957,54 +4952,65 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::CMK(BaseVector<int>* permutation) const
+    // Bandwidth and profile of the matrix before and after applying the permutation
+    static std::string ordering_bandwidth_info(int            nrow,
+                                               const PtrType* row_offset,
+                                               const int*     col,
+                                               const int*     perm)
     {
-        assert(this->nnz_ > 0);
-        assert(permutation != NULL);
+        int64_t bandwidth;
+        int64_t profile;
+        int64_t perm_bandwidth;
+        int64_t perm_profile;
 
-        HostVector<int>* cast_perm = dynamic_cast<HostVector<int>*>(permutation);
-        assert(cast_perm != NULL);
+        host_graph_bandwidth(nrow, row_offset, col, (const int*)NULL, &bandwidth, &profile);
+        host_graph_bandwidth(nrow, row_offset, col, perm, &perm_bandwidth, &perm_profile);
 
-        cast_perm->Clear();
-        cast_perm->Allocate(this->nrow_);
+        std::ostringstream info;
+
+        info << "bandwidth " << bandwidth << " -> " << perm_bandwidth << ", profile " << profile
+             << " -> " << perm_profile;
+
+        return info.str();
+    }
 
-        int next   = 0;
-        int head   = 0;
-        int tmp    = 0;
-        int test   = 1;
-        int maxdeg = 0;
+    // Cuthill-McKee ordering by a sequential breadth-first search, starting from the
+    // first neighbor of the first row
+    static void host_csr_cuthill_mckee_sequential(int            nrow,
+                                                  const PtrType* row_offset,
+                                                  const int*     col,
+                                                  int*           perm)
+    {
+        int next = 0;
+        int head = 0;
+        int tmp  = 0;
+        int test = 1;
 
         int* nd         = NULL;
         int* marker     = NULL;
         int* levset     = NULL;
         int* nextlevset = NULL;
 
-        allocate_host(this->nrow_, &nd);
-        allocate_host(this->nrow_, &marker);
-        allocate_host(this->nrow_, &levset);
-        allocate_host(this->nrow_, &nextlevset);
+        allocate_host(nrow, &nd);
+        allocate_host(nrow, &marker);
+        allocate_host(nrow, &levset);
+        allocate_host(nrow, &nextlevset);
 
         int qlength = 1;
 
-        for(int k = 0; k < this->nrow_; ++k)
+        for(int k = 0; k < nrow; ++k)
         {
             marker[k] = 0;
-            nd[k] = static_cast<int>(this->mat_.row_offset[k + 1] - this->mat_.row_offset[k] - 1);
-
-            if(nd[k] > maxdeg)
-            {
-                maxdeg = nd[k];
-            }
+            nd[k]     = static_cast<int>(row_offset[k + 1] - row_offset[k] - 1);
         }
 
-        head               = this->mat_.col[0];
-        levset[0]          = head;
-        cast_perm->vec_[0] = 0;
+        head      = col[0];
+        levset[0] = head;
+        perm[0]   = 0;
         ++next;
         marker[head] = 1;
 
-        while(next < this->nrow_)
+        while(next < nrow)
         {
             int position = 0;
 
@@ -4012,16 +5018,15 @@ namespace rocalution
             {
                 head = levset[h];
 
-                for(PtrType k = this->mat_.row_offset[head]; k < this->mat_.row_offset[head + 1];
-                    ++k)
+                for(PtrType k = row_offset[head]; k < row_offset[head + 1]; ++k)
                 {
-                    tmp = this->mat_.col[k];
+                    tmp = col[k];
 
                     if((marker[tmp] == 0) && (tmp != head))
                     {
                         nextlevset[position] = tmp;
                         marker[tmp]          = 1;
-                        cast_perm->vec_[tmp] = next;
+                        perm[tmp]            = next;
                         ++next;
                         ++position;
                     }
@@ -4053,14 +5058,14 @@ namespace rocalution
 
             if(qlength == 0)
             {
-                for(int i = 0; i < this->nrow_; ++i)
+                for(int i = 0; i < nrow; ++i)
                 {
                     if(marker[i] == 0)
                     {
-                        levset[0]          = i;
-                        qlength            = 1;
-                        cast_perm->vec_[i] = next;
-                        marker[i]          = 1;
+                        levset[0] = i;
+                        qlength   = 1;
+                        perm[i]   = next;
+                        marker[i] = 1;
                         ++next;
                     }
                 }
@@ -4071,6 +5076,57 @@ namespace rocalution
         free_host(&marker);
         free_host(&levset);
         free_host(&nextlevset);
+    }
+
+    // Cuthill-McKee ordering of the symmetrized sparsity pattern
+    static void host_csr_cuthill_mckee(int nrow, const PtrType* row_offset, const int* col, int* perm)
+    {
+        if(host_graph_is_symmetric(nrow, row_offset, col) == true)
+        {
+            host_graph_cuthill_mckee(nrow, row_offset, col, perm);
+
+            return;
+        }
+
+        std::vector<PtrType> adj_ptr;
+        std::vector<int>     adj_ind;
+
+        host_graph_symmetrize(nrow, row_offset, col, adj_ptr, adj_ind);
+        host_graph_cuthill_mckee(nrow, adj_ptr.data(), adj_ind.data(), perm);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::CMK(BaseVector<int>* permutation) const
+    {
+        assert(this->nnz_ > 0);
+        assert(this->nrow_ == this->ncol_);
+        assert(permutation != NULL);
+
+        HostVector<int>* cast_perm = dynamic_cast<HostVector<int>*>(permutation);
+        assert(cast_perm != NULL);
+
+        cast_perm->Clear();
+        cast_perm->Allocate(this->nrow_);
+
+        if(_get_backend_descriptor()->OpenMP_parallel_ordering == true)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+            host_csr_cuthill_mckee(
+                this->nrow_, this->mat_.row_offset, this->mat_.col, cast_perm->vec_);
+        }
+        else
+        {
+            host_csr_cuthill_mckee_sequential(
+                this->nrow_, this->mat_.row_offset, this->mat_.col, cast_perm->vec_);
+        }
+
+        LOG_VERBOSE_INFO(4,
+                         "*** info: CMK "
+                             << ordering_bandwidth_info(this->nrow_,
+                                                        this->mat_.row_offset,
+                                                        this->mat_.col,
+                                                        cast_perm->vec_));
 
         return true;
     }
@@ -4078,21 +5134,43 @@ namespace rocalution
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::RCMK(BaseVector<int>* permutation) const
     {
+        assert(this->nnz_ > 0);
+        assert(this->nrow_ == this->ncol_);
+
         HostVector<int>* cast_perm = dynamic_cast<HostVector<int>*>(permutation);
         assert(cast_perm != NULL);
 
         cast_perm->Clear();
         cast_perm->Allocate(this->nrow_);
 
-        HostVector<int> tmp_perm(this->local_backend_);
+        if(_get_backend_descriptor()->OpenMP_parallel_ordering == true)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-        this->CMK(&tmp_perm);
+            host_csr_cuthill_mckee(
+                this->nrow_, this->mat_.row_offset, this->mat_.col, cast_perm->vec_);
+        }
+        else
+        {
+            host_csr_cuthill_mckee_sequential(
+                this->nrow_, this->mat_.row_offset, this->mat_.col, cast_perm->vec_);
+        }
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int i = 0; i < this->nrow_; ++i)
         {
-            cast_perm->vec_[i] = this->nrow_ - tmp_perm.vec_[i] - 1;
+            cast_perm->vec_[i] = this->nrow_ - cast_perm->vec_[i] - 1;
         }
 
+        LOG_VERBOSE_INFO(4,
+                         "*** info: RCMK "
+                             << ordering_bandwidth_info(this->nrow_,
+                                                        this->mat_.row_offset,
+                                                        this->mat_.col,
+                                                        cast_perm->vec_));
+
         return true;
     }
 
@@ -4123,6 +5201,37 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::LocalityOrder(BaseVector<int>* permutation, int window) const
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(window > 0);
+
+        HostVector<int>* cast_perm = dynamic_cast<HostVector<int>*>(permutation);
+        assert(cast_perm != NULL);
+
+        cast_perm->Clear();
+        cast_perm->Allocate(this->nrow_);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        std::vector<PtrType> adj_ptr;
+        std::vector<int>     adj_ind;
+
+        host_graph_symmetrize(this->nrow_, this->mat_.row_offset, this->mat_.col, adj_ptr, adj_ind);
+        host_graph_locality_order(
+            this->nrow_, adj_ptr.data(), adj_ind.data(), window, cast_perm->vec_);
+
+        LOG_VERBOSE_INFO(4,
+                         "*** info: LocalityOrder "
+                             << ordering_bandwidth_info(this->nrow_,
+                                                        this->mat_.row_offset,
+                                                        this->mat_.col,
+                                                        cast_perm->vec_));
+
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::CreateFromMap(const BaseVector<int>& map, int n, int m)
     {
@@ -6765,10 +7874,8 @@ namespace rocalution
 
     // ----------------------------------------------------------
     // original functions:
-    //   transfer_operators(const Matrix &A, const params &prm)
-    //   connect(backend::crs<Val, Col, Ptr> const &A,
-    //           float eps_strong,
-    //           backend::crs<char, Col, Ptr> &S,
+    //   cfsplit(backend::crs<Val, Col, Ptr> const &A,
+    //           backend::crs<char, Col, Ptr> const &S,
     //           std::vector<char> &cf)
     // ----------------------------------------------------------
     // Modified and adopted from AMGCL,
@@ -6777,133 +7884,56 @@ namespace rocalution
     // ----------------------------------------------------------
     // CHANGELOG
     // - adopted interface
+    // - restricted to a range of rows
     // ----------------------------------------------------------
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::RSCoarsening(float             eps,
-                                                BaseVector<int>*  CFmap,
-                                                BaseVector<bool>* S) const
+    // Classical Ruge Stueben C/F splitting of the rows [begin, end), taking only strong
+    // connections within this range into account. On entry, cf is either undecided (0)
+    // or fine (2). Vertices that are still undecided, once no undecided vertex is
+    // influencing others anymore, become coarse if remaining_coarse is set, and stay
+    // undecided otherwise.
+    static void rs_cf_splitting(int            begin,
+                                int            end,
+                                const PtrType* row_offset,
+                                const int*     col,
+                                const bool*    S,
+                                int*           cf,
+                                bool           remaining_coarse)
     {
-        assert(CFmap != NULL);
-        assert(S != NULL);
+        int n = end - begin;
 
-        HostVector<int>*  cast_cf = dynamic_cast<HostVector<int>*>(CFmap);
-        HostVector<bool>* cast_S  = dynamic_cast<HostVector<bool>*>(S);
+        // Transpose S, restricted to the range, with local indices
+        std::vector<PtrType> S_row_offset(n + 1, 0);
 
-        assert(cast_cf != NULL);
-        assert(cast_S != NULL);
+        for(int i = begin; i < end; ++i)
+        {
+            for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                if(S[j] && col[j] >= begin && col[j] < end)
+                {
+                    S_row_offset[col[j] - begin + 1]++;
+                }
+            }
+        }
 
-        // Allocate CF mapping
-        cast_cf->Clear();
-        cast_cf->Allocate(this->nrow_);
-
-        // Mark all vertices as undecided
-        cast_cf->Zeros();
-
-        // Allocate S
-        // S is the auxiliary strength matrix such that
-        //
-        // S_ij = { 1   if i != j and -a_ij > eps * max(-a_ik) for k != i
-        //        { 0   otherwise
-        //
-        // This means, S_ij is 1, only if i strongly depends on j.
-        // S has been extended to also work with matrices that do not have
-        // fully non-positive off-diagonal entries.
-
-        cast_S->Clear();
-        cast_S->Allocate(this->nnz_);
-
-        // Initialize S to false (no dependencies)
-        cast_S->Zeros();
-
-        // Array of strong couplings S
-        PtrType* S_row_offset = NULL;
-        int*     S_col        = NULL;
-
-        allocate_host(this->nrow_ + 1, &S_row_offset);
-        set_to_zero_host(this->nrow_ + 1, S_row_offset);
-
-// Determine strong influences in matrix (Ruge Stuben approach)
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(int i = 0; i < this->nrow_; ++i)
-        {
-            // Determine minimum and maximum off-diagonal of the current row
-            ValueType min_a_ik = static_cast<ValueType>(0);
-            ValueType max_a_ik = static_cast<ValueType>(0);
-
-            PtrType row_begin = this->mat_.row_offset[i];
-            PtrType row_end   = this->mat_.row_offset[i + 1];
-
-            // True, if the diagonal element is negative
-            bool sign = false;
-
-            // Determine diagonal sign and min/max
-            for(PtrType j = row_begin; j < row_end; ++j)
-            {
-                int       col = this->mat_.col[j];
-                ValueType val = this->mat_.val[j];
-
-                if(col == i)
-                {
-                    // Get diagonal entry sign
-                    sign = val < static_cast<ValueType>(0);
-                }
-                else
-                {
-                    // Get min / max entries
-                    min_a_ik = (min_a_ik < val) ? min_a_ik : val;
-                    max_a_ik = (max_a_ik > val) ? max_a_ik : val;
-                }
-            }
-
-            // Threshold to check for strength of connection
-            ValueType cond = (sign ? max_a_ik : min_a_ik) * static_cast<ValueType>(eps);
-
-            // Fill S
-            for(PtrType j = row_begin; j < row_end; ++j)
-            {
-                int       col = this->mat_.col[j];
-                ValueType val = this->mat_.val[j];
-
-                cast_S->vec_[j] = (col != i) && (val < cond);
-            }
-
-            // If cond is zero -> i is independent of other grid points
-            if(cond == static_cast<ValueType>(0))
-            {
-                cast_cf->vec_[i] = 2;
-            }
-        }
-
-        // Transpose S
-        for(int64_t i = 0; i < this->nnz_; ++i)
-        {
-            if(cast_S->vec_[i])
-            {
-                S_row_offset[this->mat_.col[i] + 1]++;
-            }
-        }
-
-        for(int i = 0; i < this->nrow_; ++i)
+        for(int i = 0; i < n; ++i)
         {
             S_row_offset[i + 1] += S_row_offset[i];
         }
 
-        allocate_host(S_row_offset[this->nrow_], &S_col);
+        std::vector<int> S_col(S_row_offset[n]);
 
-        for(int i = 0; i < this->nrow_; ++i)
+        for(int i = begin; i < end; ++i)
         {
-            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
             {
-                if(cast_S->vec_[j])
+                if(S[j] && col[j] >= begin && col[j] < end)
                 {
-                    S_col[S_row_offset[this->mat_.col[j]]++] = i;
+                    S_col[S_row_offset[col[j] - begin]++] = i - begin;
                 }
             }
         }
 
-        for(int i = this->nrow_; i > 0; --i)
+        for(int i = n; i > 0; --i)
         {
             S_row_offset[i] = S_row_offset[i - 1];
         }
@@ -6911,25 +7941,25 @@ namespace rocalution
         S_row_offset[0] = 0;
 
         // Split into C and F
-        std::vector<int> lambda(this->nrow_);
+        std::vector<int> lambda(n);
 
-        for(int i = 0; i < this->nrow_; ++i)
+        for(int i = 0; i < n; ++i)
         {
             int temp = 0;
             for(PtrType j = S_row_offset[i]; j < S_row_offset[i + 1]; ++j)
             {
-                temp += (cast_cf->vec_[S_col[j]] == 0 ? 1 : 2);
+                temp += (cf[begin + S_col[j]] == 0 ? 1 : 2);
             }
 
             lambda[i] = temp;
         }
 
-        std::vector<int> ptr(this->nrow_ + 1, static_cast<int>(0));
-        std::vector<int> cnt(this->nrow_, static_cast<int>(0));
-        std::vector<int> i2n(this->nrow_);
-        std::vector<int> n2i(this->nrow_);
+        std::vector<int> ptr(n + 1, static_cast<int>(0));
+        std::vector<int> cnt(n, static_cast<int>(0));
+        std::vector<int> i2n(n);
+        std::vector<int> n2i(n);
 
-        for(int i = 0; i < this->nrow_; ++i)
+        for(int i = 0; i < n; ++i)
         {
             ptr[lambda[i] + 1]++;
         }
@@ -6939,7 +7969,7 @@ namespace rocalution
             ptr[i] += ptr[i - 1];
         }
 
-        for(int i = 0; i < this->nrow_; ++i)
+        for(int i = 0; i < n; ++i)
         {
             int lam  = lambda[i];
             int idx  = ptr[lam] + cnt[lam]++;
@@ -6947,18 +7977,21 @@ namespace rocalution
             n2i[i]   = idx;
         }
 
-        for(int top = this->nrow_ - 1; top >= 0; --top)
+        for(int top = n - 1; top >= 0; --top)
         {
             int i   = i2n[top];
             int lam = lambda[i];
 
             if(lam == 0)
             {
-                for(int ai = 0; ai < this->nrow_; ++ai)
+                if(remaining_coarse == true)
                 {
-                    if(cast_cf->vec_[ai] == 0)
+                    for(int ai = begin; ai < end; ++ai)
                     {
-                        cast_cf->vec_[ai] = 1;
+                        if(cf[ai] == 0)
+                        {
+                            cf[ai] = 1;
+                        }
                     }
                 }
 
@@ -6967,37 +8000,37 @@ namespace rocalution
 
             cnt[lam]--;
 
-            if(cast_cf->vec_[i] == 2)
+            if(cf[begin + i] == 2)
             {
                 continue;
             }
 
-            assert(cast_cf->vec_[i] == 0);
+            assert(cf[begin + i] == 0);
 
-            cast_cf->vec_[i] = 1;
+            cf[begin + i] = 1;
 
             for(PtrType j = S_row_offset[i]; j < S_row_offset[i + 1]; ++j)
             {
                 int c = S_col[j];
 
-                if(cast_cf->vec_[c] != 0)
+                if(cf[begin + c] != 0)
                 {
                     continue;
                 }
 
-                cast_cf->vec_[c] = 2;
+                cf[begin + c] = 2;
 
-                for(PtrType jj = this->mat_.row_offset[c]; jj < this->mat_.row_offset[c + 1]; ++jj)
+                for(PtrType jj = row_offset[begin + c]; jj < row_offset[begin + c + 1]; ++jj)
                 {
-                    if(!cast_S->vec_[jj])
+                    if(!S[jj] || col[jj] < begin || col[jj] >= end)
                     {
                         continue;
                     }
 
-                    int cc     = this->mat_.col[jj];
+                    int cc     = col[jj] - begin;
                     int lam_cc = lambda[cc];
 
-                    if(cast_cf->vec_[cc] != 0 || lam_cc >= this->nrow_ - 1)
+                    if(cf[begin + cc] != 0 || lam_cc >= n - 1)
                     {
                         continue;
                     }
@@ -7018,17 +8051,17 @@ namespace rocalution
                 }
             }
 
-            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = row_offset[begin + i]; j < row_offset[begin + i + 1]; ++j)
             {
-                if(!cast_S->vec_[j])
+                if(!S[j] || col[j] < begin || col[j] >= end)
                 {
                     continue;
                 }
 
-                int c   = this->mat_.col[j];
+                int c   = col[j] - begin;
                 int lam = lambda[c];
 
-                if(cast_cf->vec_[c] != 0 || lam == 0)
+                if(cf[begin + c] != 0 || lam == 0)
                 {
                     continue;
                 }
@@ -7049,10 +8082,122 @@ namespace rocalution
                 assert(ptr[lam - 1] == ptr[lam] - cnt[lam - 1]);
             }
         }
+    }
+
+    // ----------------------------------------------------------
+    // original functions:
+    //   transfer_operators(const Matrix &A, const params &prm)
+    //   connect(backend::crs<Val, Col, Ptr> const &A,
+    //           float eps_strong,
+    //           backend::crs<char, Col, Ptr> &S,
+    //           std::vector<char> &cf)
+    // ----------------------------------------------------------
+    // Modified and adopted from AMGCL,
+    // https://github.com/ddemidov/amgcl
+    // MIT License
+    // ----------------------------------------------------------
+    // CHANGELOG
+    // - adopted interface
+    // ----------------------------------------------------------
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::RSCoarsening(float             eps,
+                                                BaseVector<int>*  CFmap,
+                                                BaseVector<bool>* S) const
+    {
+        assert(CFmap != NULL);
+        assert(S != NULL);
+
+        HostVector<int>*  cast_cf = dynamic_cast<HostVector<int>*>(CFmap);
+        HostVector<bool>* cast_S  = dynamic_cast<HostVector<bool>*>(S);
+
+        assert(cast_cf != NULL);
+        assert(cast_S != NULL);
+
+        // Allocate CF mapping
+        cast_cf->Clear();
+        cast_cf->Allocate(this->nrow_);
+
+        // Mark all vertices as undecided
+        cast_cf->Zeros();
+
+        // Allocate S
+        // S is the auxiliary strength matrix such that
+        //
+        // S_ij = { 1   if i != j and -a_ij > eps * max(-a_ik) for k != i
+        //        { 0   otherwise
+        //
+        // This means, S_ij is 1, only if i strongly depends on j.
+        // S has been extended to also work with matrices that do not have
+        // fully non-positive off-diagonal entries.
+
+        cast_S->Clear();
+        cast_S->Allocate(this->nnz_);
+
+        // Initialize S to false (no dependencies)
+        cast_S->Zeros();
+
+// Determine strong influences in matrix (Ruge Stuben approach)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            // Determine minimum and maximum off-diagonal of the current row
+            ValueType min_a_ik = static_cast<ValueType>(0);
+            ValueType max_a_ik = static_cast<ValueType>(0);
+
+            PtrType row_begin = this->mat_.row_offset[i];
+            PtrType row_end   = this->mat_.row_offset[i + 1];
+
+            // True, if the diagonal element is negative
+            bool sign = false;
+
+            // Determine diagonal sign and min/max
+            for(PtrType j = row_begin; j < row_end; ++j)
+            {
+                int       col = this->mat_.col[j];
+                ValueType val = this->mat_.val[j];
+
+                if(col == i)
+                {
+                    // Get diagonal entry sign
+                    sign = val < static_cast<ValueType>(0);
+                }
+                else
+                {
+                    // Get min / max entries
+                    min_a_ik = (min_a_ik < val) ? min_a_ik : val;
+                    max_a_ik = (max_a_ik > val) ? max_a_ik : val;
+                }
+            }
+
+            // Threshold to check for strength of connection
+            ValueType cond = (sign ? max_a_ik : min_a_ik) * static_cast<ValueType>(eps);
+
+            // Fill S
+            for(PtrType j = row_begin; j < row_end; ++j)
+            {
+                int       col = this->mat_.col[j];
+                ValueType val = this->mat_.val[j];
+
+                cast_S->vec_[j] = (col != i) && (val < cond);
+            }
+
+            // If cond is zero -> i is independent of other grid points
+            if(cond == static_cast<ValueType>(0))
+            {
+                cast_cf->vec_[i] = 2;
+            }
+        }
 
-        // Clean up
-        free_host(&S_row_offset);
-        free_host(&S_col);
+        // Split into C and F
+        rs_cf_splitting(0,
+                        this->nrow_,
+                        this->mat_.row_offset,
+                        this->mat_.col,
+                        cast_S->vec_,
+                        cast_cf->vec_,
+                        true);
 
         return true;
     }
@@ -7096,6 +8241,9 @@ namespace rocalution
         cast_S->Zeros();
 
         // Sample some numbers using hash function to initialize omega
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t i = 0; i < this->nrow_; ++i)
         {
             cast_w->vec_[i] = hash(i + global_row_offset);
@@ -7320,6 +8468,9 @@ namespace rocalution
                                 // The diagonal entry has more edges and will remain
                                 // a coarse point, whereas this vertex gets reverted
                                 // back to undecided, for further processing.
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
                                 cast_cf->vec_[col] = 0;
                             }
                             else if(omega_row < omega_col)
@@ -7328,6 +8479,9 @@ namespace rocalution
                                 // reverted back to undecided for further processing,
                                 // whereas this vertex stays
                                 // a coarse one.
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
                                 cast_cf->vec_[i] = 0;
                             }
                         }
@@ -7360,6 +8514,9 @@ namespace rocalution
                                     // The diagonal entry has more edges and will remain
                                     // a coarse point, whereas this vertex gets reverted
                                     // back to undecided, for further processing.
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
                                     cast_cf->vec_[col + this->nrow_] = 0;
                                 }
                                 else if(omega_row < omega_col)
@@ -7368,6 +8525,9 @@ namespace rocalution
                                     // reverted back to undecided for further processing,
                                     // whereas this vertex stays
                                     // a coarse one.
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
                                     cast_cf->vec_[i] = 0;
                                 }
                             }
@@ -7466,18 +8626,76 @@ namespace rocalution
 
         assert(cast_cf != NULL);
 
-        undecided = false;
+        bool found = false;
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(static) reduction(|| : found)
 #endif
         for(int i = 0; i < this->nrow_; ++i)
         {
             // Check whether this vertex is undecided or not
             if(cast_cf->vec_[i] == 0)
             {
-                undecided = true;
-                i         = this->nrow_;
+                found = true;
+            }
+        }
+
+        undecided = found;
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::RSHMISFirstPass(BaseVector<int>*        CFmap,
+                                                   const BaseVector<bool>& S) const
+    {
+        assert(CFmap != NULL);
+
+        HostVector<int>*        cast_cf = dynamic_cast<HostVector<int>*>(CFmap);
+        const HostVector<bool>* cast_S  = dynamic_cast<const HostVector<bool>*>(&S);
+
+        assert(cast_cf != NULL);
+        assert(cast_S != NULL);
+        assert(cast_cf->size_ >= this->nrow_);
+        assert(cast_S->size_ >= this->nnz_);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Rows are split into blocks of fixed size, such that the resulting splitting
+        // does not depend on the number of threads. Each block is split independently,
+        // using only strong connections within the block.
+        int nblocks = (this->nrow_ + HOST_HMIS_BLOCK_SIZE - 1) / HOST_HMIS_BLOCK_SIZE;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int b = 0; b < nblocks; ++b)
+        {
+            int begin = b * HOST_HMIS_BLOCK_SIZE;
+            int end   = std::min(begin + HOST_HMIS_BLOCK_SIZE, static_cast<int>(this->nrow_));
+
+            // Vertices of the block start undecided
+            for(int i = begin; i < end; ++i)
+            {
+                cast_cf->vec_[i] = 0;
+            }
+
+            rs_cf_splitting(begin,
+                            end,
+                            this->mat_.row_offset,
+                            this->mat_.col,
+                            cast_S->vec_,
+                            cast_cf->vec_,
+                            false);
+
+            // Keep the coarse vertices only, fine vertices are determined by the
+            // subsequent PMIS iterations, taking connections across blocks into account
+            for(int i = begin; i < end; ++i)
+            {
+                if(cast_cf->vec_[i] == 2)
+                {
+                    cast_cf->vec_[i] = 0;
+                }
             }
         }
 
@@ -8180,225 +9398,248 @@ namespace rocalution
         }
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
 #endif
-        // Determine number of non-zeros for P
-        for(int row = 0; row < this->nrow_; ++row)
         {
-            // Coarse points generate a single entry
-            if(cast_cf->vec_[row] == 1)
-            {
-                // Set this points state to coarse
-                cast_f2c->vec_[row] = 1;
-
-                // Set row nnz
-                cast_pi->mat_.row_offset[row] = 1;
+            // Marker, to discard duplicated interior column entries
+            std::vector<int> marker(this->nrow_, -1);
 
-                if(global == true)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+            // Determine number of non-zeros for P
+            for(int row = 0; row < this->nrow_; ++row)
+            {
+                // Coarse points generate a single entry
+                if(cast_cf->vec_[row] == 1)
                 {
-                    cast_pg->mat_.row_offset[row] = 0;
-                }
-
-                continue;
-            }
+                    // Set this points state to coarse
+                    cast_f2c->vec_[row] = 1;
 
-            // Set, to discard duplicated column entries (no need to be ordered)
-            std::unordered_set<int>     int_set;
-            std::unordered_set<int64_t> gst_set;
+                    // Set row nnz
+                    cast_pi->mat_.row_offset[row] = 1;
 
-            // Row entry and exit points
-            PtrType row_begin = this->mat_.row_offset[row];
-            PtrType row_end   = this->mat_.row_offset[row + 1];
+                    if(global == true)
+                    {
+                        cast_pg->mat_.row_offset[row] = 0;
+                    }
 
-            // Loop over all columns of the i-th row, whereas each lane processes a column
-            for(PtrType j = row_begin; j < row_end; ++j)
-            {
-                // Skip points that do not influence the current point
-                if(cast_S->vec_[j] == false)
-                {
                     continue;
                 }
 
-                // Get the column index
-                int col_j = this->mat_.col[j];
+                // Number of interior entries, duplicates are discarded using the marker
+                int int_nnz = 0;
 
-                // Skip diagonal entries (i does not influence itself)
-                if(col_j == row)
-                {
-                    continue;
-                }
+                // Set, to discard duplicated ghost column entries (no need to be ordered)
+                std::unordered_set<int64_t> gst_set;
 
-                // Switch between coarse and fine points that influence the i-th point
-                if(cast_cf->vec_[col_j] == 1)
-                {
-                    // This is a coarse point and thus contributes, count it for the row nnz
-                    // We need to use a set here, to discard duplicates.
-                    int_set.insert(col_j);
-                }
-                else
+                // Row entry and exit points
+                PtrType row_begin = this->mat_.row_offset[row];
+                PtrType row_end   = this->mat_.row_offset[row + 1];
+
+                // Loop over all columns of the i-th row, whereas each lane processes a column
+                for(PtrType j = row_begin; j < row_end; ++j)
                 {
-                    // This is a fine point, check for strongly connected coarse points
+                    // Skip points that do not influence the current point
+                    if(cast_S->vec_[j] == false)
+                    {
+                        continue;
+                    }
 
-                    bool skip_ghost = false;
+                    // Get the column index
+                    int col_j = this->mat_.col[j];
 
-                    // Row entry and exit of this fine point
-                    PtrType row_begin_j = this->mat_.row_offset[col_j];
-                    PtrType row_end_j   = this->mat_.row_offset[col_j + 1];
+                    // Skip diagonal entries (i does not influence itself)
+                    if(col_j == row)
+                    {
+                        continue;
+                    }
 
-                    // Loop over all columns of the fine point
-                    for(PtrType k = row_begin_j; k < row_end_j; ++k)
+                    // Switch between coarse and fine points that influence the i-th point
+                    if(cast_cf->vec_[col_j] == 1)
                     {
-                        // Skip points that do not influence the fine point
-                        if(cast_S->vec_[k] == false)
+                        // This is a coarse point and thus contributes, count it for the row nnz
+                        // The marker discards duplicates.
+                        if(marker[col_j] != row)
                         {
-                            continue;
+                            marker[col_j] = row;
+                            ++int_nnz;
                         }
+                    }
+                    else
+                    {
+                        // This is a fine point, check for strongly connected coarse points
 
-                        // Get the column index
-                        int col_k = this->mat_.col[k];
+                        bool skip_ghost = false;
 
-                        // Skip diagonal entries (the fine point does not influence itself)
-                        if(col_k == col_j)
-                        {
-                            continue;
-                        }
+                        // Row entry and exit of this fine point
+                        PtrType row_begin_j = this->mat_.row_offset[col_j];
+                        PtrType row_end_j   = this->mat_.row_offset[col_j + 1];
 
-                        // Check whether k is a coarse point
-                        if(cast_cf->vec_[col_k] == 1)
+                        // Loop over all columns of the fine point
+                        for(PtrType k = row_begin_j; k < row_end_j; ++k)
                         {
-                            // This is a coarse point, it contributes, count it for the row nnz
-                            // We need to use a set here, to discard duplicates.
-                            int_set.insert(col_k);
-
-                            // Stop if FF interpolation is limited
-                            if(FF1 == true)
+                            // Skip points that do not influence the fine point
+                            if(cast_S->vec_[k] == false)
                             {
-                                skip_ghost = true;
-                                break;
+                                continue;
                             }
-                        }
-                    }
 
-                    if(skip_ghost == false && global == true)
-                    {
-                        // Row entry and exit of this fine point
-                        row_begin_j = cast_gst->mat_.row_offset[col_j];
-                        row_end_j   = cast_gst->mat_.row_offset[col_j + 1];
+                            // Get the column index
+                            int col_k = this->mat_.col[k];
 
-                        // Ghost iterate over the range of columns of B.
-                        for(PtrType k = row_begin_j; k < row_end_j; ++k)
-                        {
-                            // Skip points that do not influence the fine point
-                            if(cast_S->vec_[k + this->nnz_] == false)
+                            // Skip diagonal entries (the fine point does not influence itself)
+                            if(col_k == col_j)
                             {
                                 continue;
                             }
 
                             // Check whether k is a coarse point
-                            int col_k = cast_gst->mat_.col[k];
+                            if(cast_cf->vec_[col_k] == 1)
+                            {
+                                // This is a coarse point, it contributes, count it for the row nnz
+                                // The marker discards duplicates.
+                                if(marker[col_k] != row)
+                                {
+                                    marker[col_k] = row;
+                                    ++int_nnz;
+                                }
 
-                            // Check whether k is a coarse point
-                            if(cast_cf->vec_[col_k + this->nrow_] == 1)
+                                // Stop if FF interpolation is limited
+                                if(FF1 == true)
+                                {
+                                    skip_ghost = true;
+                                    break;
+                                }
+                            }
+                        }
+
+                        if(skip_ghost == false && global == true)
+                        {
+                            // Row entry and exit of this fine point
+                            row_begin_j = cast_gst->mat_.row_offset[col_j];
+                            row_end_j   = cast_gst->mat_.row_offset[col_j + 1];
+
+                            // Ghost iterate over the range of columns of B.
+                            for(PtrType k = row_begin_j; k < row_end_j; ++k)
                             {
-                                // Get (global) column index
-                                int64_t gcol_k = cast_l2g->vec_[col_k] + global_column_end
-                                                 - global_column_begin;
+                                // Skip points that do not influence the fine point
+                                if(cast_S->vec_[k + this->nnz_] == false)
+                                {
+                                    continue;
+                                }
+
+                                // Check whether k is a coarse point
+                                int col_k = cast_gst->mat_.col[k];
+
+                                // Check whether k is a coarse point
+                                if(cast_cf->vec_[col_k + this->nrow_] == 1)
+                                {
+                                    // Get (global) column index
+                                    int64_t gcol_k = cast_l2g->vec_[col_k] + global_column_end
+                                                     - global_column_begin;
 
-                                // This is a coarse point, it contributes, count it for the row int_nnz
-                                // We need to use a set here, to discard duplicates.
-                                gst_set.insert(gcol_k);
+                                    // This is a coarse point, it contributes, count it for the row int_nnz
+                                    // We need to use a set here, to discard duplicates.
+                                    gst_set.insert(gcol_k);
+                                }
                             }
                         }
                     }
                 }
-            }
-
-            if(global == true)
-            {
-                // Row entry and exit points
-                row_begin = cast_gst->mat_.row_offset[row];
-                row_end   = cast_gst->mat_.row_offset[row + 1];
 
-                // Loop over all columns of the i-th row, whereas each lane processes a column
-                for(PtrType j = row_begin; j < row_end; ++j)
+                if(global == true)
                 {
-                    // Skip points that do not influence the current point
-                    if(cast_S->vec_[j + this->nnz_] == false)
-                    {
-                        continue;
-                    }
-
-                    // Get the column index
-                    int col_j = cast_gst->mat_.col[j];
+                    // Row entry and exit points
+                    row_begin = cast_gst->mat_.row_offset[row];
+                    row_end   = cast_gst->mat_.row_offset[row + 1];
 
-                    // Switch between coarse and fine points that influence the i-th point
-                    if(cast_cf->vec_[col_j + this->nrow_] == 1)
+                    // Loop over all columns of the i-th row, whereas each lane processes a column
+                    for(PtrType j = row_begin; j < row_end; ++j)
                     {
-                        // Get (global) column index
-                        int64_t gcol_j
-                            = cast_l2g->vec_[col_j] + global_column_end - global_column_begin;
+                        // Skip points that do not influence the current point
+                        if(cast_S->vec_[j + this->nnz_] == false)
+                        {
+                            continue;
+                        }
 
-                        // This is a coarse point and thus contributes, count it for the row int_nnz
-                        // We need to use a set here, to discard duplicates.
-                        gst_set.insert(gcol_j);
-                    }
-                    else
-                    {
-                        // This is a fine point, check for strongly connected coarse points
+                        // Get the column index
+                        int col_j = cast_gst->mat_.col[j];
 
-                        // Row entry and exit of this fine point
-                        PtrType row_begin_j = cast_ptr->vec_[col_j];
-                        PtrType row_end_j   = cast_ptr->vec_[col_j + 1];
+                        // Switch between coarse and fine points that influence the i-th point
+                        if(cast_cf->vec_[col_j + this->nrow_] == 1)
+                        {
+                            // Get (global) column index
+                            int64_t gcol_j
+                                = cast_l2g->vec_[col_j] + global_column_end - global_column_begin;
 
-                        // Loop over all columns of the fine point
-                        for(PtrType k = row_begin_j; k < row_end_j; ++k)
+                            // This is a coarse point and thus contributes, count it for the row int_nnz
+                            // We need to use a set here, to discard duplicates.
+                            gst_set.insert(gcol_j);
+                        }
+                        else
                         {
-                            // Get the (global) column index
-                            int64_t gcol_k = cast_col->vec_[k];
+                            // This is a fine point, check for strongly connected coarse points
 
-                            // Differentiate between local and ghost column
-                            if(gcol_k >= global_column_begin && gcol_k < global_column_end)
-                            {
-                                // Get (local) column index
-                                int col_k = static_cast<int>(gcol_k - global_column_begin);
+                            // Row entry and exit of this fine point
+                            PtrType row_begin_j = cast_ptr->vec_[col_j];
+                            PtrType row_end_j   = cast_ptr->vec_[col_j + 1];
 
-                                // This is a coarse point, it contributes, count it for the row nnz
-                                // We need to use a set here, to discard duplicates.
-                                int_set.insert(col_k);
+                            // Loop over all columns of the fine point
+                            for(PtrType k = row_begin_j; k < row_end_j; ++k)
+                            {
+                                // Get the (global) column index
+                                int64_t gcol_k = cast_col->vec_[k];
 
-                                // Stop if FF interpolation is limited
-                                if(FF1 == true)
+                                // Differentiate between local and ghost column
+                                if(gcol_k >= global_column_begin && gcol_k < global_column_end)
                                 {
-                                    break;
-                                }
-                            }
-                            else
-                            {
-                                // This is a coarse point, it contributes, count it for the row nnz
-                                // We need to use a set here, to discard duplicates.
-                                gst_set.insert(gcol_k + global_column_end - global_column_begin);
+                                    // Get (local) column index
+                                    int col_k = static_cast<int>(gcol_k - global_column_begin);
 
-                                // Stop if FF interpolation is limited
-                                if(FF1 == true)
+                                    // This is a coarse point, it contributes, count it for the row nnz
+                                    // The marker discards duplicates.
+                                    if(marker[col_k] != row)
+                                    {
+                                        marker[col_k] = row;
+                                        ++int_nnz;
+                                    }
+
+                                    // Stop if FF interpolation is limited
+                                    if(FF1 == true)
+                                    {
+                                        break;
+                                    }
+                                }
+                                else
                                 {
-                                    break;
+                                    // This is a coarse point, it contributes, count it for the row nnz
+                                    // We need to use a set here, to discard duplicates.
+                                    gst_set.insert(gcol_k + global_column_end
+                                                   - global_column_begin);
+
+                                    // Stop if FF interpolation is limited
+                                    if(FF1 == true)
+                                    {
+                                        break;
+                                    }
                                 }
                             }
                         }
                     }
                 }
-            }
 
-            // Write row nnz back to global memory
-            cast_pi->mat_.row_offset[row] = int_set.size();
+                // Write row nnz back to global memory
+                cast_pi->mat_.row_offset[row] = int_nnz;
 
-            if(global == true)
-            {
-                cast_pg->mat_.row_offset[row] = gst_set.size();
-            }
+                if(global == true)
+                {
+                    cast_pg->mat_.row_offset[row] = gst_set.size();
+                }
 
-            // Set this points state to fine
-            cast_f2c->vec_[row] = 0;
+                // Set this points state to fine
+                cast_f2c->vec_[row] = 0;
+            }
         }
 
         cast_f2c->ExclusiveSum(*cast_f2c);
@@ -8521,489 +9762,543 @@ namespace rocalution
         this->ExtractDiagonal(&diag);
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
 #endif
-        // Fill column indices and values of P
-        for(int row = 0; row < this->nrow_; ++row)
         {
-            // Some helpers for readability
-            constexpr ValueType zero = static_cast<ValueType>(0);
+            // Marker and position in P of interior column entries
+            std::vector<int>     marker(this->nrow_, -1);
+            std::vector<PtrType> int_pos(this->nrow_);
 
-            // Coarse points generate a single entry
-            if(cast_cf->vec_[row] == 1)
-            {
-                // Get index into P
-                PtrType idx = cast_pi->mat_.row_offset[row];
-
-                // Single entry in this row (coarse point)
-                cast_pi->mat_.col[idx] = cast_f2c->vec_[row];
-                cast_pi->mat_.val[idx] = static_cast<ValueType>(1);
-
-                continue;
-            }
-
-            // Hash table
-            std::map<int, ValueType>     int_table;
-            std::map<int64_t, ValueType> gst_table;
-
-            // Fill the hash table according to the nnz pattern of P
-            // This is identical to the nnz per row part
-
-            // Row entry and exit points
-            PtrType row_begin = this->mat_.row_offset[row];
-            PtrType row_end   = this->mat_.row_offset[row + 1];
+            // Interior entries of the current row, for sorting
+            std::vector<std::pair<int, ValueType>> int_row;
 
-            // Loop over all columns of the i-th row
-            for(PtrType k = row_begin; k < row_end; ++k)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+            // Fill column indices and values of P
+            for(int row = 0; row < this->nrow_; ++row)
             {
-                // Skip points that do not influence the current point
-                if(cast_S->vec_[k] == false)
+                // Some helpers for readability
+                constexpr ValueType zero = static_cast<ValueType>(0);
+
+                // Coarse points generate a single entry
+                if(cast_cf->vec_[row] == 1)
                 {
-                    continue;
-                }
+                    // Get index into P
+                    PtrType idx = cast_pi->mat_.row_offset[row];
 
-                // Get the column index
-                int col_ik = this->mat_.col[k];
+                    // Single entry in this row (coarse point)
+                    cast_pi->mat_.col[idx] = cast_f2c->vec_[row];
+                    cast_pi->mat_.val[idx] = static_cast<ValueType>(1);
 
-                // Skip diagonal entries (i does not influence itself)
-                if(col_ik == row)
-                {
                     continue;
                 }
 
-                // Switch between coarse and fine points that influence the i-th point
-                if(cast_cf->vec_[col_ik] == 1)
-                {
-                    // This is a coarse point and thus contributes
-                    int_table[col_ik] = zero;
-                }
-                else
-                {
-                    // This is a fine point, check for strongly connected coarse points
+                // Next free position in the interior part of P
+                PtrType int_idx = cast_pi->mat_.row_offset[row];
+
+                // Hash table
+                std::map<int64_t, ValueType> gst_table;
 
-                    bool skip_ghost = false;
+                // Fill the interior row of P and the hash table according to the nnz
+                // pattern of P. This is identical to the nnz per row part
 
-                    // Row entry and exit of this fine point
-                    PtrType row_begin_k = this->mat_.row_offset[col_ik];
-                    PtrType row_end_k   = this->mat_.row_offset[col_ik + 1];
+                // Row entry and exit points
+                PtrType row_begin = this->mat_.row_offset[row];
+                PtrType row_end   = this->mat_.row_offset[row + 1];
 
-                    // Loop over all columns of the fine point
-                    for(PtrType l = row_begin_k; l < row_end_k; ++l)
+                // Loop over all columns of the i-th row
+                for(PtrType k = row_begin; k < row_end; ++k)
+                {
+                    // Skip points that do not influence the current point
+                    if(cast_S->vec_[k] == false)
                     {
-                        // Skip points that do not influence the fine point
-                        if(cast_S->vec_[l] == false)
-                        {
-                            continue;
-                        }
+                        continue;
+                    }
 
-                        // Get the column index
-                        int col_kl = this->mat_.col[l];
+                    // Get the column index
+                    int col_ik = this->mat_.col[k];
 
-                        // Skip diagonal entries (the fine point does not influence itself)
-                        if(col_kl == col_ik)
-                        {
-                            continue;
-                        }
+                    // Skip diagonal entries (i does not influence itself)
+                    if(col_ik == row)
+                    {
+                        continue;
+                    }
 
-                        // Check whether l is a coarse point
-                        if(cast_cf->vec_[col_kl] == 1)
+                    // Switch between coarse and fine points that influence the i-th point
+                    if(cast_cf->vec_[col_ik] == 1)
+                    {
+                        // This is a coarse point and thus contributes
+                        if(marker[col_ik] != row)
                         {
-                            // This is a coarse point, it contributes
-                            int_table[col_kl] = zero;
+                            marker[col_ik]  = row;
+                            int_pos[col_ik] = int_idx;
 
-                            // Stop if FF interpolation is limited
-                            if(FF1 == true)
-                            {
-                                skip_ghost = true;
-                                break;
-                            }
+                            cast_pi->mat_.col[int_idx] = col_ik;
+                            cast_pi->mat_.val[int_idx] = zero;
+                            ++int_idx;
                         }
                     }
-
-                    if(skip_ghost == false && global == true)
+                    else
                     {
-                        // Loop over all ghost columns of the fine point
-                        for(PtrType l = cast_gst->mat_.row_offset[col_ik];
-                            l < cast_gst->mat_.row_offset[col_ik + 1];
-                            ++l)
+                        // This is a fine point, check for strongly connected coarse points
+
+                        bool skip_ghost = false;
+
+                        // Row entry and exit of this fine point
+                        PtrType row_begin_k = this->mat_.row_offset[col_ik];
+                        PtrType row_end_k   = this->mat_.row_offset[col_ik + 1];
+
+                        // Loop over all columns of the fine point
+                        for(PtrType l = row_begin_k; l < row_end_k; ++l)
                         {
-                            if(cast_S->vec_[l + this->nnz_] == false)
+                            // Skip points that do not influence the fine point
+                            if(cast_S->vec_[l] == false)
                             {
                                 continue;
                             }
 
                             // Get the column index
-                            int col_kl = cast_gst->mat_.col[l];
+                            int col_kl = this->mat_.col[l];
 
-                            // Check whether l is a coarse point
-                            if(cast_cf->vec_[col_kl + this->nrow_] == 1)
+                            // Skip diagonal entries (the fine point does not influence itself)
+                            if(col_kl == col_ik)
                             {
-                                // This is a coarse point, it contributes
-
-                                // Global column shifted by local columns
-                                int64_t gcol_kl = cast_l2g->vec_[col_kl] + global_column_end
-                                                  - global_column_begin;
-                                gst_table[gcol_kl] = zero;
+                                continue;
                             }
-                        }
-                    }
-                }
-            }
-
-            if(global == true)
-            {
-                for(PtrType k = cast_gst->mat_.row_offset[row];
-                    k < cast_gst->mat_.row_offset[row + 1];
-                    ++k)
-                {
-                    // Skip points that do not influence the current point
-                    if(cast_S->vec_[k + this->nnz_] == false)
-                    {
-                        continue;
-                    }
-
-                    // Get the column index
-                    int col_ik = cast_gst->mat_.col[k];
-
-                    // Switch between coarse and fine points that influence the i-th point
-                    if(cast_cf->vec_[col_ik + this->nrow_] == 1)
-                    {
-                        // Explicitly create an entry in the hash table
-                        gst_table[cast_l2g->vec_[col_ik] + global_column_end - global_column_begin]
-                            = zero;
-                    }
-                    else
-                    {
-                        for(PtrType l = cast_ptr->vec_[col_ik]; l < cast_ptr->vec_[col_ik + 1]; ++l)
-                        {
-                            // Get the (global) column index
-                            int64_t gcol_kl = cast_col->vec_[l];
 
-                            // Differentiate between local and ghost column
-                            if(gcol_kl >= global_column_begin && gcol_kl < global_column_end)
+                            // Check whether l is a coarse point
+                            if(cast_cf->vec_[col_kl] == 1)
                             {
-                                int col_kl = static_cast<int>(gcol_kl - global_column_begin);
+                                // This is a coarse point, it contributes
+                                if(marker[col_kl] != row)
+                                {
+                                    marker[col_kl]  = row;
+                                    int_pos[col_kl] = int_idx;
 
-                                // This is a coarse point, it contributes, count it for the row nnz
-                                // We need to use a set here, to discard duplicates.
-                                int_table[col_kl] = zero;
+                                    cast_pi->mat_.col[int_idx] = col_kl;
+                                    cast_pi->mat_.val[int_idx] = zero;
+                                    ++int_idx;
+                                }
 
                                 // Stop if FF interpolation is limited
                                 if(FF1 == true)
                                 {
+                                    skip_ghost = true;
                                     break;
                                 }
                             }
-                            else
+                        }
+
+                        if(skip_ghost == false && global == true)
+                        {
+                            // Loop over all ghost columns of the fine point
+                            for(PtrType l = cast_gst->mat_.row_offset[col_ik];
+                                l < cast_gst->mat_.row_offset[col_ik + 1];
+                                ++l)
                             {
-                                // This is a coarse point, it contributes, count it for the row nnz
-                                // We need to use a set here, to discard duplicates.
-                                gst_table[gcol_kl + global_column_end - global_column_begin] = zero;
+                                if(cast_S->vec_[l + this->nnz_] == false)
+                                {
+                                    continue;
+                                }
 
-                                // Stop if FF interpolation is limited
-                                if(FF1 == true)
+                                // Get the column index
+                                int col_kl = cast_gst->mat_.col[l];
+
+                                // Check whether l is a coarse point
+                                if(cast_cf->vec_[col_kl + this->nrow_] == 1)
                                 {
-                                    break;
+                                    // This is a coarse point, it contributes
+
+                                    // Global column shifted by local columns
+                                    int64_t gcol_kl = cast_l2g->vec_[col_kl] + global_column_end
+                                                      - global_column_begin;
+                                    gst_table[gcol_kl] = zero;
                                 }
                             }
                         }
                     }
                 }
-            }
 
-            // Now, we need to do the numerical part
+                if(global == true)
+                {
+                    for(PtrType k = cast_gst->mat_.row_offset[row];
+                        k < cast_gst->mat_.row_offset[row + 1];
+                        ++k)
+                    {
+                        // Skip points that do not influence the current point
+                        if(cast_S->vec_[k + this->nnz_] == false)
+                        {
+                            continue;
+                        }
 
-            // Diagonal entry of i-th row
-            ValueType val_ii = diag.vec_[row];
+                        // Get the column index
+                        int col_ik = cast_gst->mat_.col[k];
 
-            // Sign of diagonal entry of i-th row
-            bool pos_ii = val_ii >= zero;
+                        // Switch between coarse and fine points that influence the i-th point
+                        if(cast_cf->vec_[col_ik + this->nrow_] == 1)
+                        {
+                            // Explicitly create an entry in the hash table
+                            gst_table[cast_l2g->vec_[col_ik] + global_column_end
+                                      - global_column_begin]
+                                = zero;
+                        }
+                        else
+                        {
+                            for(PtrType l = cast_ptr->vec_[col_ik]; l < cast_ptr->vec_[col_ik + 1];
+                                ++l)
+                            {
+                                // Get the (global) column index
+                                int64_t gcol_kl = cast_col->vec_[l];
+
+                                // Differentiate between local and ghost column
+                                if(gcol_kl >= global_column_begin && gcol_kl < global_column_end)
+                                {
+                                    int col_kl = static_cast<int>(gcol_kl - global_column_begin);
 
-            // Accumulators
-            ValueType sum_k = zero;
-            ValueType sum_n = zero;
+                                    // This is a coarse point, it contributes, count it for the row nnz
+                                    // We need to use a set here, to discard duplicates.
+                                    if(marker[col_kl] != row)
+                                    {
+                                        marker[col_kl]  = row;
+                                        int_pos[col_kl] = int_idx;
 
-            // Loop over all columns of the i-th row
-            for(PtrType k = row_begin; k < row_end; ++k)
-            {
-                // Get the column index
-                int col_ik = this->mat_.col[k];
+                                        cast_pi->mat_.col[int_idx] = col_kl;
+                                        cast_pi->mat_.val[int_idx] = zero;
+                                        ++int_idx;
+                                    }
 
-                // Skip diagonal entries (i does not influence itself)
-                if(col_ik == row)
-                {
-                    continue;
+                                    // Stop if FF interpolation is limited
+                                    if(FF1 == true)
+                                    {
+                                        break;
+                                    }
+                                }
+                                else
+                                {
+                                    // This is a coarse point, it contributes, count it for the row nnz
+                                    // We need to use a set here, to discard duplicates.
+                                    gst_table[gcol_kl + global_column_end - global_column_begin]
+                                        = zero;
+
+                                    // Stop if FF interpolation is limited
+                                    if(FF1 == true)
+                                    {
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+                    }
                 }
 
-                // Get the column value
-                ValueType val_ik = this->mat_.val[k];
+                // Now, we need to do the numerical part
 
-                // Check, whether the k-th entry of the row is a fine point and strongly
-                // connected to the i-th point (e.g. k \in F^S_i)
-                if(cast_S->vec_[k] == true && cast_cf->vec_[col_ik] == 2)
-                {
-                    // Accumulator for the sum over l
-                    ValueType sum_l = zero;
+                // Diagonal entry of i-th row
+                ValueType val_ii = diag.vec_[row];
 
-                    // Diagonal entry of k-th row
-                    ValueType val_kk = diag.vec_[col_ik];
+                // Sign of diagonal entry of i-th row
+                bool pos_ii = val_ii >= zero;
 
-                    // Store a_ki, if present
-                    ValueType val_ki = zero;
+                // Accumulators
+                ValueType sum_k = zero;
+                ValueType sum_n = zero;
 
-                    // Row entry and exit of this fine point
-                    PtrType row_begin_k = this->mat_.row_offset[col_ik];
-                    PtrType row_end_k   = this->mat_.row_offset[col_ik + 1];
+                // Loop over all columns of the i-th row
+                for(PtrType k = row_begin; k < row_end; ++k)
+                {
+                    // Get the column index
+                    int col_ik = this->mat_.col[k];
 
-                    // Loop over all columns of the fine point
-                    for(PtrType l = row_begin_k; l < row_end_k; ++l)
+                    // Skip diagonal entries (i does not influence itself)
+                    if(col_ik == row)
                     {
-                        // Get the column index
-                        int col_kl = this->mat_.col[l];
+                        continue;
+                    }
 
-                        // Get the column value
-                        ValueType val_kl = this->mat_.val[l];
+                    // Get the column value
+                    ValueType val_ik = this->mat_.val[k];
 
-                        // Sign of a_kl
-                        bool pos_kl = val_kl >= zero;
+                    // Check, whether the k-th entry of the row is a fine point and strongly
+                    // connected to the i-th point (e.g. k \in F^S_i)
+                    if(cast_S->vec_[k] == true && cast_cf->vec_[col_ik] == 2)
+                    {
+                        // Accumulator for the sum over l
+                        ValueType sum_l = zero;
 
-                        // Differentiate between diagonal and off-diagonal
-                        if(col_kl == row)
-                        {
-                            // Column that matches the i-th row
-                            // Since we sum up all l in C^hat_i and i, the diagonal need to
-                            // be added to the sum over l, e.g. a^bar_kl
-                            // a^bar contributes only, if the sign is different to the
-                            // i-th row diagonal sign.
-                            if(pos_ii != pos_kl)
-                            {
-                                sum_l += val_kl;
-                            }
+                        // Diagonal entry of k-th row
+                        ValueType val_kk = diag.vec_[col_ik];
 
-                            // If a_ki exists, keep it for later
-                            val_ki = val_kl;
-                        }
-                        else if(cast_cf->vec_[col_kl] == 1)
-                        {
-                            // Check if sign is different from i-th row diagonal
-                            if(pos_ii != pos_kl)
-                            {
-                                // Entry contributes only, if it is a coarse point
-                                // and part of C^hat (e.g. we need to check the hash table)
-                                if(int_table.find(col_kl) != int_table.end())
-                                {
-                                    sum_l += val_kl;
-                                }
-                            }
-                        }
-                    }
+                        // Store a_ki, if present
+                        ValueType val_ki = zero;
+
+                        // Row entry and exit of this fine point
+                        PtrType row_begin_k = this->mat_.row_offset[col_ik];
+                        PtrType row_end_k   = this->mat_.row_offset[col_ik + 1];
 
-                    if(global == true)
-                    {
                         // Loop over all columns of the fine point
-                        for(PtrType l = cast_gst->mat_.row_offset[col_ik];
-                            l < cast_gst->mat_.row_offset[col_ik + 1];
-                            ++l)
+                        for(PtrType l = row_begin_k; l < row_end_k; ++l)
                         {
                             // Get the column index
-                            int col_kl = cast_gst->mat_.col[l];
-
-                            // Get the (global) column index
-                            int64_t gcol_kl
-                                = cast_l2g->vec_[col_kl] + global_column_end - global_column_begin;
+                            int col_kl = this->mat_.col[l];
 
                             // Get the column value
-                            ValueType val_kl = cast_gst->mat_.val[l];
+                            ValueType val_kl = this->mat_.val[l];
 
                             // Sign of a_kl
                             bool pos_kl = val_kl >= zero;
 
-                            // Only coarse points contribute
-                            if(cast_cf->vec_[col_kl + this->nrow_] == 1)
+                            // Differentiate between diagonal and off-diagonal
+                            if(col_kl == row)
+                            {
+                                // Column that matches the i-th row
+                                // Since we sum up all l in C^hat_i and i, the diagonal need to
+                                // be added to the sum over l, e.g. a^bar_kl
+                                // a^bar contributes only, if the sign is different to the
+                                // i-th row diagonal sign.
+                                if(pos_ii != pos_kl)
+                                {
+                                    sum_l += val_kl;
+                                }
+
+                                // If a_ki exists, keep it for later
+                                val_ki = val_kl;
+                            }
+                            else if(cast_cf->vec_[col_kl] == 1)
                             {
                                 // Check if sign is different from i-th row diagonal
                                 if(pos_ii != pos_kl)
                                 {
-                                    // Entry contributes only if it is part of C^hat
-                                    // (e.g. we need to check the hash table)
-                                    if(gst_table.find(gcol_kl) != gst_table.end())
+                                    // Entry contributes only, if it is a coarse point
+                                    // and part of C^hat (e.g. we need to check the hash table)
+                                    if(marker[col_kl] == row)
                                     {
                                         sum_l += val_kl;
                                     }
                                 }
                             }
                         }
-                    }
-
-                    // Update sum over l with a_ik
-                    sum_l = val_ik / sum_l;
 
-                    // Compute the sign of a_kk and a_ki, we need this for a_bar
-                    bool pos_kk = val_kk >= zero;
-                    bool pos_ki = val_ki >= zero;
-
-                    // Additionally, for eq19 we need to add all coarse points in row k,
-                    // if they have different sign than the diagonal a_kk
-                    for(PtrType l = row_begin_k; l < row_end_k; ++l)
-                    {
-                        // Get the column index
-                        int col_kl = this->mat_.col[l];
-
-                        // Only coarse points contribute
-                        if(cast_cf->vec_[col_kl] != 1)
+                        if(global == true)
                         {
-                            continue;
-                        }
+                            // Loop over all columns of the fine point
+                            for(PtrType l = cast_gst->mat_.row_offset[col_ik];
+                                l < cast_gst->mat_.row_offset[col_ik + 1];
+                                ++l)
+                            {
+                                // Get the column index
+                                int col_kl = cast_gst->mat_.col[l];
 
-                        // Get the column value
-                        ValueType val_kl = this->mat_.val[l];
+                                // Get the (global) column index
+                                int64_t gcol_kl = cast_l2g->vec_[col_kl] + global_column_end
+                                                  - global_column_begin;
 
-                        // Compute the sign of a_kl
-                        bool pos_kl = val_kl >= zero;
+                                // Get the column value
+                                ValueType val_kl = cast_gst->mat_.val[l];
 
-                        // Check for different sign
-                        if(pos_kk != pos_kl)
-                        {
-                            if(int_table.find(col_kl) != int_table.end())
-                            {
-                                int_table[col_kl] += val_kl * sum_l;
+                                // Sign of a_kl
+                                bool pos_kl = val_kl >= zero;
+
+                                // Only coarse points contribute
+                                if(cast_cf->vec_[col_kl + this->nrow_] == 1)
+                                {
+                                    // Check if sign is different from i-th row diagonal
+                                    if(pos_ii != pos_kl)
+                                    {
+                                        // Entry contributes only if it is part of C^hat
+                                        // (e.g. we need to check the hash table)
+                                        if(gst_table.find(gcol_kl) != gst_table.end())
+                                        {
+                                            sum_l += val_kl;
+                                        }
+                                    }
+                                }
                             }
                         }
-                    }
 
-                    if(global == true)
-                    {
-                        // Row entry and exit of this fine point
-                        row_begin_k = cast_gst->mat_.row_offset[col_ik];
-                        row_end_k   = cast_gst->mat_.row_offset[col_ik + 1];
+                        // Update sum over l with a_ik
+                        sum_l = val_ik / sum_l;
+
+                        // Compute the sign of a_kk and a_ki, we need this for a_bar
+                        bool pos_kk = val_kk >= zero;
+                        bool pos_ki = val_ki >= zero;
 
                         // Additionally, for eq19 we need to add all coarse points in row k,
                         // if they have different sign than the diagonal a_kk
                         for(PtrType l = row_begin_k; l < row_end_k; ++l)
                         {
                             // Get the column index
-                            int col_kl = cast_gst->mat_.col[l];
+                            int col_kl = this->mat_.col[l];
+
+                            // Only coarse points contribute
+                            if(cast_cf->vec_[col_kl] != 1)
+                            {
+                                continue;
+                            }
+
+                            // Get the column value
+                            ValueType val_kl = this->mat_.val[l];
+
+                            // Compute the sign of a_kl
+                            bool pos_kl = val_kl >= zero;
+
+                            // Check for different sign
+                            if(pos_kk != pos_kl)
+                            {
+                                if(marker[col_kl] == row)
+                                {
+                                    cast_pi->mat_.val[int_pos[col_kl]] += val_kl * sum_l;
+                                }
+                            }
+                        }
+
+                        if(global == true)
+                        {
+                            // Row entry and exit of this fine point
+                            row_begin_k = cast_gst->mat_.row_offset[col_ik];
+                            row_end_k   = cast_gst->mat_.row_offset[col_ik + 1];
+
+                            // Additionally, for eq19 we need to add all coarse points in row k,
+                            // if they have different sign than the diagonal a_kk
+                            for(PtrType l = row_begin_k; l < row_end_k; ++l)
+                            {
+                                // Get the column index
+                                int col_kl = cast_gst->mat_.col[l];
 
-                            // Get the (global) column index
-                            int64_t gcol_kl
-                                = cast_l2g->vec_[col_kl] + global_column_end - global_column_begin;
+                                // Get the (global) column index
+                                int64_t gcol_kl = cast_l2g->vec_[col_kl] + global_column_end
+                                                  - global_column_begin;
 
-                            // Get the column value
-                            ValueType val_kl = cast_gst->mat_.val[l];
+                                // Get the column value
+                                ValueType val_kl = cast_gst->mat_.val[l];
 
-                            // Compute the sign of a_kl
-                            bool pos_kl = val_kl >= zero;
+                                // Compute the sign of a_kl
+                                bool pos_kl = val_kl >= zero;
 
-                            // Check for different sign
-                            if(pos_kk != pos_kl)
-                            {
-                                if(gst_table.find(gcol_kl) != gst_table.end())
+                                // Check for different sign
+                                if(pos_kk != pos_kl)
                                 {
-                                    gst_table[gcol_kl] += val_kl * sum_l;
+                                    if(gst_table.find(gcol_kl) != gst_table.end())
+                                    {
+                                        gst_table[gcol_kl] += val_kl * sum_l;
+                                    }
                                 }
                             }
                         }
-                    }
 
-                    // If sign of a_ki and a_kk are different, a_ki contributes to the
-                    // sum over k in F^S_i
-                    if(pos_kk != pos_ki)
-                    {
-                        sum_k += val_ki * sum_l;
+                        // If sign of a_ki and a_kk are different, a_ki contributes to the
+                        // sum over k in F^S_i
+                        if(pos_kk != pos_ki)
+                        {
+                            sum_k += val_ki * sum_l;
+                        }
                     }
-                }
 
-                // Boolean, to flag whether a_ik is in C hat or not
-                // (we can query the hash table for it)
-                bool in_C_hat = false;
+                    // Boolean, to flag whether a_ik is in C hat or not
+                    // (we can query the hash table for it)
+                    bool in_C_hat = false;
 
-                // a_ik can only be in C^hat if it is coarse
-                if(cast_cf->vec_[col_ik] == 1)
-                {
-                    // Check, whether col_ik is in C hat or not
-                    if(int_table.find(col_ik) != int_table.end())
+                    // a_ik can only be in C^hat if it is coarse
+                    if(cast_cf->vec_[col_ik] == 1)
                     {
-                        // Append a_ik to the sum of eq19
-                        int_table[col_ik] += val_ik;
+                        // Check, whether col_ik is in C hat or not
+                        if(marker[col_ik] == row)
+                        {
+                            // Append a_ik to the sum of eq19
+                            cast_pi->mat_.val[int_pos[col_ik]] += val_ik;
 
-                        in_C_hat = true;
+                            in_C_hat = true;
+                        }
                     }
-                }
 
-                // If a_ik is not in C^hat and does not strongly influence i, it contributes
-                // to sum_n
-                if(in_C_hat == false && cast_S->vec_[k] == false)
-                {
-                    sum_n += val_ik;
+                    // If a_ik is not in C^hat and does not strongly influence i, it contributes
+                    // to sum_n
+                    if(in_C_hat == false && cast_S->vec_[k] == false)
+                    {
+                        sum_n += val_ik;
+                    }
                 }
-            }
 
-            if(global == true)
-            {
-                // Loop over all columns of the i-th row
-                for(PtrType k = cast_gst->mat_.row_offset[row];
-                    k < cast_gst->mat_.row_offset[row + 1];
-                    ++k)
+                if(global == true)
                 {
-                    // Get the column index
-                    int col_ik = cast_gst->mat_.col[k];
-
-                    // Get the column value
-                    ValueType val_ik = cast_gst->mat_.val[k];
-
-                    // Check, whether the k-th entry of the row is a fine point and strongly
-                    // connected to the i-th point (e.g. k \in F^S_i)
-                    if(cast_S->vec_[k + this->nnz_] == true
-                       && cast_cf->vec_[col_ik + this->nrow_] == 2)
+                    // Loop over all columns of the i-th row
+                    for(PtrType k = cast_gst->mat_.row_offset[row];
+                        k < cast_gst->mat_.row_offset[row + 1];
+                        ++k)
                     {
-                        // Accumulator for the sum over l
-                        ValueType sum_l = zero;
-
-                        // Diagonal element of k-th row
-                        ValueType val_kk = zero;
-
-                        // Global column index
-                        int64_t grow_k = cast_l2g->vec_[col_ik];
+                        // Get the column index
+                        int col_ik = cast_gst->mat_.col[k];
 
-                        // Row entry and exit of this fine point
-                        PtrType row_begin_k = cast_ext_ptr->vec_[col_ik];
-                        PtrType row_end_k   = cast_ext_ptr->vec_[col_ik + 1];
+                        // Get the column value
+                        ValueType val_ik = cast_gst->mat_.val[k];
 
-                        // Loop over all columns of the fine point
-                        for(PtrType l = row_begin_k; l < row_end_k; ++l)
+                        // Check, whether the k-th entry of the row is a fine point and strongly
+                        // connected to the i-th point (e.g. k \in F^S_i)
+                        if(cast_S->vec_[k + this->nnz_] == true
+                           && cast_cf->vec_[col_ik + this->nrow_] == 2)
                         {
-                            // Get the (global) column index
-                            int64_t gcol_kl = cast_ext_col->vec_[l];
+                            // Accumulator for the sum over l
+                            ValueType sum_l = zero;
 
-                            // Get the column value
-                            ValueType val_kl = cast_ext_val->vec_[l];
+                            // Diagonal element of k-th row
+                            ValueType val_kk = zero;
 
-                            // Sign of a_kl
-                            bool pos_kl = val_kl >= zero;
+                            // Global column index
+                            int64_t grow_k = cast_l2g->vec_[col_ik];
 
-                            // Extract diagonal value
-                            if(grow_k == gcol_kl)
-                            {
-                                val_kk = val_kl;
-                            }
+                            // Row entry and exit of this fine point
+                            PtrType row_begin_k = cast_ext_ptr->vec_[col_ik];
+                            PtrType row_end_k   = cast_ext_ptr->vec_[col_ik + 1];
 
-                            // Differentiate between local and ghost column
-                            if(gcol_kl >= global_column_begin && gcol_kl < global_column_end)
+                            // Loop over all columns of the fine point
+                            for(PtrType l = row_begin_k; l < row_end_k; ++l)
                             {
-                                // Get the (local) column index
-                                int col_kl = static_cast<int>(gcol_kl - global_column_begin);
+                                // Get the (global) column index
+                                int64_t gcol_kl = cast_ext_col->vec_[l];
+
+                                // Get the column value
+                                ValueType val_kl = cast_ext_val->vec_[l];
 
-                                // Differentiate between diagonal and off-diagonal
-                                if(col_kl == row)
+                                // Sign of a_kl
+                                bool pos_kl = val_kl >= zero;
+
+                                // Extract diagonal value
+                                if(grow_k == gcol_kl)
                                 {
-                                    // Column that matches the i-th row
-                                    // Since we sum up all l in C^hat_i and i, the diagonal need to
-                                    // be added to the sum over l, e.g. a^bar_kl
-                                    // a^bar contributes only, if the sign is different to the
-                                    // i-th row diagonal sign.
-                                    if(pos_ii != pos_kl)
+                                    val_kk = val_kl;
+                                }
+
+                                // Differentiate between local and ghost column
+                                if(gcol_kl >= global_column_begin && gcol_kl < global_column_end)
+                                {
+                                    // Get the (local) column index
+                                    int col_kl = static_cast<int>(gcol_kl - global_column_begin);
+
+                                    // Differentiate between diagonal and off-diagonal
+                                    if(col_kl == row)
                                     {
-                                        sum_l += val_kl;
+                                        // Column that matches the i-th row
+                                        // Since we sum up all l in C^hat_i and i, the diagonal need to
+                                        // be added to the sum over l, e.g. a^bar_kl
+                                        // a^bar contributes only, if the sign is different to the
+                                        // i-th row diagonal sign.
+                                        if(pos_ii != pos_kl)
+                                        {
+                                            sum_l += val_kl;
+                                        }
+                                    }
+                                    else
+                                    {
+                                        // Check if sign is different from i-th row diagonal
+                                        if(pos_ii != pos_kl)
+                                        {
+                                            // Entry contributes only if it is part of C^hat
+                                            // (e.g. we need to check the hash table)
+                                            if(marker[col_kl] == row)
+                                            {
+                                                sum_l += val_kl;
+                                            }
+                                        }
                                     }
                                 }
                                 else
@@ -9011,140 +10306,142 @@ namespace rocalution
                                     // Check if sign is different from i-th row diagonal
                                     if(pos_ii != pos_kl)
                                     {
-                                        // Entry contributes only if it is part of C^hat
-                                        // (e.g. we need to check the hash table)
-                                        if(int_table.find(col_kl) != int_table.end())
+                                        if(gst_table.find(gcol_kl + global_column_end
+                                                          - global_column_begin)
+                                           != gst_table.end())
                                         {
                                             sum_l += val_kl;
                                         }
                                     }
                                 }
                             }
-                            else
-                            {
-                                // Check if sign is different from i-th row diagonal
-                                if(pos_ii != pos_kl)
-                                {
-                                    if(gst_table.find(gcol_kl + global_column_end
-                                                      - global_column_begin)
-                                       != gst_table.end())
-                                    {
-                                        sum_l += val_kl;
-                                    }
-                                }
-                            }
-                        }
-
-                        // Store a_ki, if present
-                        ValueType val_ki = zero;
-
-                        // Compute the k-th sum
-                        sum_l = val_ik / sum_l;
-
-                        // Loop over all columns of A ext
-                        for(PtrType l = row_begin_k; l < row_end_k; ++l)
-                        {
-                            // Get the (global) column index
-                            int64_t gcol_kl = cast_ext_col->vec_[l];
 
-                            // Get the column value
-                            ValueType val_kl = cast_ext_val->vec_[l];
+                            // Store a_ki, if present
+                            ValueType val_ki = zero;
 
-                            // Sign of a_kl
-                            bool pos_kl = val_kl >= zero;
+                            // Compute the k-th sum
+                            sum_l = val_ik / sum_l;
 
-                            if((val_kk >= zero) == pos_kl)
+                            // Loop over all columns of A ext
+                            for(PtrType l = row_begin_k; l < row_end_k; ++l)
                             {
-                                val_kl = zero;
-                            }
+                                // Get the (global) column index
+                                int64_t gcol_kl = cast_ext_col->vec_[l];
 
-                            // Differentiate between local and ghost column
-                            if(gcol_kl >= global_column_begin && gcol_kl < global_column_end)
-                            {
-                                // Get the (local) column index
-                                int col_kl = static_cast<int>(gcol_kl - global_column_begin);
+                                // Get the column value
+                                ValueType val_kl = cast_ext_val->vec_[l];
+
+                                // Sign of a_kl
+                                bool pos_kl = val_kl >= zero;
 
-                                // Differentiate between diagonal and off-diagonal
-                                if(row == col_kl)
+                                if((val_kk >= zero) == pos_kl)
                                 {
-                                    // If a_ki exists, keep it for later
-                                    val_ki = val_kl;
+                                    val_kl = zero;
                                 }
 
-                                // Entry contributes only if it is part of the hash table
-                                if(int_table.find(col_kl) != int_table.end())
+                                // Differentiate between local and ghost column
+                                if(gcol_kl >= global_column_begin && gcol_kl < global_column_end)
                                 {
-                                    int_table[col_kl] += val_kl * sum_l;
+                                    // Get the (local) column index
+                                    int col_kl = static_cast<int>(gcol_kl - global_column_begin);
+
+                                    // Differentiate between diagonal and off-diagonal
+                                    if(row == col_kl)
+                                    {
+                                        // If a_ki exists, keep it for later
+                                        val_ki = val_kl;
+                                    }
+
+                                    // Entry contributes only if it is part of the hash table
+                                    if(marker[col_kl] == row)
+                                    {
+                                        cast_pi->mat_.val[int_pos[col_kl]] += val_kl * sum_l;
+                                    }
                                 }
-                            }
-                            else
-                            {
-                                // Global column
-                                if(gst_table.find(gcol_kl + global_column_end - global_column_begin)
-                                   != gst_table.end())
+                                else
                                 {
-                                    gst_table[gcol_kl + global_column_end - global_column_begin]
-                                        += val_kl * sum_l;
+                                    // Global column
+                                    if(gst_table.find(gcol_kl + global_column_end
+                                                      - global_column_begin)
+                                       != gst_table.end())
+                                    {
+                                        gst_table[gcol_kl + global_column_end - global_column_begin]
+                                            += val_kl * sum_l;
+                                    }
                                 }
                             }
-                        }
 
-                        sum_n += val_ki * sum_l;
-                    }
+                            sum_n += val_ki * sum_l;
+                        }
 
-                    // Map global id
-                    int64_t gcol_ik
-                        = cast_l2g->vec_[col_ik] + global_column_end - global_column_begin;
+                        // Map global id
+                        int64_t gcol_ik
+                            = cast_l2g->vec_[col_ik] + global_column_end - global_column_begin;
 
-                    // Boolean, to flag whether a_ik is in C hat or not
-                    // (we can query the hash table for it)
-                    bool in_C_hat = false;
+                        // Boolean, to flag whether a_ik is in C hat or not
+                        // (we can query the hash table for it)
+                        bool in_C_hat = false;
 
-                    // Check, whether global col_ik is in C hat or not
-                    if(gst_table.find(gcol_ik) != gst_table.end())
-                    {
-                        // Append a_ik to the sum of eq19
-                        gst_table[gcol_ik] += val_ik;
+                        // Check, whether global col_ik is in C hat or not
+                        if(gst_table.find(gcol_ik) != gst_table.end())
+                        {
+                            // Append a_ik to the sum of eq19
+                            gst_table[gcol_ik] += val_ik;
 
-                        in_C_hat = true;
-                    }
+                            in_C_hat = true;
+                        }
 
-                    // If a_ik is not in C^hat and does not strongly influence i, it contributes
-                    // to the sum
-                    if(cast_S->vec_[k + this->nnz_] == false && in_C_hat == false)
-                    {
-                        sum_k += val_ik;
+                        // If a_ik is not in C^hat and does not strongly influence i, it contributes
+                        // to the sum
+                        if(cast_S->vec_[k + this->nnz_] == false && in_C_hat == false)
+                        {
+                            sum_k += val_ik;
+                        }
                     }
                 }
-            }
 
-            // Precompute a_ii_tilde
-            ValueType a_ii_tilde = static_cast<ValueType>(-1) / (sum_n + sum_k + val_ii);
+                // Precompute a_ii_tilde
+                ValueType a_ii_tilde = static_cast<ValueType>(-1) / (sum_n + sum_k + val_ii);
 
-            // Entry point into P (interior)
-            PtrType int_idx = cast_pi->mat_.row_offset[row];
+                // All interior entries of the row have been created
+                assert(int_idx == cast_pi->mat_.row_offset[row + 1]);
 
-            // Finally, extract the numerical values from the hash table and fill P such
-            // that the resulting matrix is sorted by columns
-            for(auto it = int_table.begin(); it != int_table.end(); ++it)
-            {
-                cast_pi->mat_.col[int_idx] = cast_f2c->vec_[it->first];
-                cast_pi->mat_.val[int_idx] = a_ii_tilde * it->second;
-                ++int_idx;
-            }
+                // Finally, sort the interior row by columns, map them to coarse columns
+                // and scale the numerical values
+                PtrType int_begin = cast_pi->mat_.row_offset[row];
 
-            if(global == true)
-            {
-                // Entry point into P (ghost)
-                PtrType gst_idx = cast_pg->mat_.row_offset[row];
+                int_row.clear();
+
+                for(PtrType j = int_begin; j < int_idx; ++j)
+                {
+                    int_row.push_back(std::make_pair(cast_pi->mat_.col[j], cast_pi->mat_.val[j]));
+                }
 
-                // Finally, extract the numerical values from the hash table and fill P such
-                // that the resulting matrix is sorted by columns
-                for(auto it = gst_table.begin(); it != gst_table.end(); ++it)
+                std::sort(int_row.begin(),
+                          int_row.end(),
+                          [](const std::pair<int, ValueType>& x,
+                             const std::pair<int, ValueType>& y) { return x.first < y.first; });
+
+                for(size_t j = 0; j < int_row.size(); ++j)
+                {
+                    cast_pi->mat_.col[int_begin + j] = cast_f2c->vec_[int_row[j].first];
+                    cast_pi->mat_.val[int_begin + j] = a_ii_tilde * int_row[j].second;
+                }
+
+                if(global == true)
                 {
-                    cast_glo->vec_[gst_idx] = it->first - global_column_end + global_column_begin;
-                    cast_pg->mat_.val[gst_idx] = a_ii_tilde * it->second;
-                    ++gst_idx;
+                    // Entry point into P (ghost)
+                    PtrType gst_idx = cast_pg->mat_.row_offset[row];
+
+                    // Finally, extract the numerical values from the hash table and fill P such
+                    // that the resulting matrix is sorted by columns
+                    for(auto it = gst_table.begin(); it != gst_table.end(); ++it)
+                    {
+                        cast_glo->vec_[gst_idx]
+                            = it->first - global_column_end + global_column_begin;
+                        cast_pg->mat_.val[gst_idx] = a_ii_tilde * it->second;
+                        ++gst_idx;
+                    }
                 }
             }
         }
@@ -10246,6 +11543,218 @@ namespace rocalution
         return true;
     }
 
+    // Mix function of the sparsity pattern hash (splitmix64 finalizer)
+    static inline uint64_t pattern_hash_mix(uint64_t x)
+    {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+
+        return x ^ (x >> 31);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::SparsityInfo(MatrixSparsityInfo* info) const
+    {
+        assert(info != NULL);
+
+        int nrow = this->nrow_;
+        int ncol = this->ncol_;
+
+        info->nrow = nrow;
+        info->ncol = ncol;
+        info->nnz  = this->nnz_;
+
+        for(int b = 0; b < 32; ++b)
+        {
+            info->row_nnz_histogram[b] = 0;
+        }
+
+        for(int b = 0; b < 7; ++b)
+        {
+            info->block_fill[b] = 0.0;
+        }
+
+        if(nrow == 0 || ncol == 0)
+        {
+            info->min_row_nnz    = 0;
+            info->max_row_nnz    = 0;
+            info->mean_row_nnz   = 0.0;
+            info->stddev_row_nnz = 0.0;
+            info->num_diag       = 0;
+            info->full_diag      = false;
+            info->pattern_hash   = pattern_hash_mix(0);
+            info->bandwidth      = 0;
+            info->profile        = 0;
+
+            return true;
+        }
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+        // Occupied diagonals, diagonal offset d is stored at nrow - 1 + d
+        std::vector<char> diag_used(nrow + ncol - 1, 0);
+
+        int64_t  min_row_nnz = std::numeric_limits<int64_t>::max();
+        int64_t  max_row_nnz = 0;
+        double   sum_sq      = 0.0;
+        bool     full_diag   = true;
+        uint64_t hash        = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int64_t histogram[32] = {0};
+
+#ifdef _OPENMP
+#pragma omp for reduction(min : min_row_nnz) reduction(max : max_row_nnz) reduction(+ : sum_sq, hash) reduction(&& : full_diag)
+#endif
+            for(int i = 0; i < nrow; ++i)
+            {
+                PtrType row_begin = this->mat_.row_offset[i];
+                PtrType row_end   = this->mat_.row_offset[i + 1];
+                int64_t row_nnz   = row_end - row_begin;
+
+                min_row_nnz = std::min(min_row_nnz, row_nnz);
+                max_row_nnz = std::max(max_row_nnz, row_nnz);
+                sum_sq += static_cast<double>(row_nnz) * static_cast<double>(row_nnz);
+
+                // Bucket b holds row lengths in [2^(b-1), 2^b)
+                int bucket = 0;
+
+                for(int64_t len = row_nnz; len > 0 && bucket < 31; len >>= 1)
+                {
+                    ++bucket;
+                }
+
+                ++histogram[bucket];
+
+                bool     has_diag = (i >= ncol);
+                uint64_t row_hash = pattern_hash_mix(i);
+
+                for(PtrType j = row_begin; j < row_end; ++j)
+                {
+                    int c = this->mat_.col[j];
+
+                    if(c == i)
+                    {
+                        has_diag = true;
+                    }
+
+                    // Read first, such that threads do not keep writing to shared cache lines
+                    int  d = nrow - 1 + c - i;
+                    char used;
+
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+                    used = diag_used[d];
+
+                    if(used == 0)
+                    {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                        diag_used[d] = 1;
+                    }
+
+                    row_hash = pattern_hash_mix(row_hash ^ static_cast<uint64_t>(c));
+                }
+
+                // Rows are combined in an order independent way
+                hash += row_hash;
+                full_diag = full_diag && has_diag;
+            }
+
+            for(int b = 0; b < 32; ++b)
+            {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                info->row_nnz_histogram[b] += histogram[b];
+            }
+        }
+
+        int64_t num_diag = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : num_diag)
+#endif
+        for(int d = 0; d < nrow + ncol - 1; ++d)
+        {
+            num_diag += diag_used[d];
+        }
+
+        double mean = static_cast<double>(this->nnz_) / nrow;
+
+        info->min_row_nnz    = min_row_nnz;
+        info->max_row_nnz    = max_row_nnz;
+        info->mean_row_nnz   = mean;
+        info->stddev_row_nnz = std::sqrt(std::max(0.0, sum_sq / nrow - mean * mean));
+        info->num_diag       = num_diag;
+        info->full_diag      = full_diag;
+        info->pattern_hash   = pattern_hash_mix(
+            hash ^ pattern_hash_mix((static_cast<uint64_t>(nrow) << 32) | ncol));
+
+        host_graph_bandwidth(nrow,
+                             this->mat_.row_offset,
+                             this->mat_.col,
+                             (const int*)NULL,
+                             &info->bandwidth,
+                             &info->profile);
+
+        // Block fill for block dimensions 2 to 8
+        for(int blockdim = 2; blockdim <= 8; ++blockdim)
+        {
+            if(this->nnz_ == 0)
+            {
+                break;
+            }
+
+            int nrowb = (nrow + blockdim - 1) / blockdim;
+            int ncolb = (ncol + blockdim - 1) / blockdim;
+
+            int64_t nnzb = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                std::vector<int> marker(ncolb, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024) reduction(+ : nnzb)
+#endif
+                for(int bi = 0; bi < nrowb; ++bi)
+                {
+                    int row_begin = bi * blockdim;
+                    int row_end   = std::min(row_begin + blockdim, nrow);
+
+                    for(int i = row_begin; i < row_end; ++i)
+                    {
+                        for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1];
+                            ++j)
+                        {
+                            int bj = this->mat_.col[j] / blockdim;
+
+                            if(marker[bj] != bi)
+                            {
+                                marker[bj] = bi;
+                                ++nnzb;
+                            }
+                        }
+                    }
+                }
+            }
+
+            info->block_fill[blockdim - 2]
+                = static_cast<double>(this->nnz_) / (static_cast<double>(nnzb) * blockdim * blockdim);
+        }
+
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::ReplaceColumnVector(int idx, const BaseVector<ValueType>& vec)
     {
@@ -89,6 +89,12 @@ namespace rocalution
                                         const BaseMatrix<ValueType>& B);
         virtual bool NumericMatMatMult(const BaseMatrix<ValueType>& A,
                                        const BaseMatrix<ValueType>& B);
+        virtual bool SymbolicTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                 const BaseMatrix<ValueType>& A,
+                                                 const BaseMatrix<ValueType>& P);
+        virtual bool NumericTripleMatrixProduct(const BaseMatrix<ValueType>& R,
+                                                const BaseMatrix<ValueType>& A,
+                                                const BaseMatrix<ValueType>& P);
 
         virtual bool DiagonalMatrixMultR(const BaseVector<ValueType>& diag);
         virtual bool DiagonalMatrixMultL(const BaseVector<ValueType>& diag);
@@ -103,6 +109,7 @@ namespace rocalution
         virtual bool CMK(BaseVector<int>* permutation) const;
         virtual bool RCMK(BaseVector<int>* permutation) const;
         virtual bool ConnectivityOrder(BaseVector<int>* permutation) const;
+        virtual bool LocalityOrder(BaseVector<int>* permutation, int window) const;
 
         virtual bool ConvertFrom(const BaseMatrix<ValueType>& mat);
 
@@ -120,11 +127,14 @@ namespace rocalution
                                      int              nrow,
                                      int              ncol);
 
+        virtual bool ReadFileMTX(const std::string& filename);
         virtual bool ReadFileCSR(const std::string& filename);
+        virtual bool MapFileCSR(const std::string& filename);
         virtual bool WriteFileCSR(const std::string& filename) const;
 
         virtual bool ReadFileRSIO(const std::string& filename);
         virtual bool WriteFileRSIO(const std::string& filename) const;
+        virtual bool WriteFileRSIOCompressed(const std::string& filename, bool compress_val) const;
 
         virtual bool CreateFromMap(const BaseVector<int>& map, int n, int m);
         virtual bool
@@ -205,12 +215,23 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const;
+        virtual bool ApplyMulti(const BaseVector<ValueType>& in,
+                                int                          num_vec,
+                                BaseVector<ValueType>*       out) const;
+        virtual bool Residual(const BaseVector<ValueType>& rhs,
+                              const BaseVector<ValueType>& x,
+                              BaseVector<ValueType>*       res) const;
+        virtual bool ResidualRestrict(const BaseVector<ValueType>& rhs,
+                                      const BaseVector<ValueType>& x,
+                                      const BaseMatrix<ValueType>& restrict_mat,
+                                      BaseVector<ValueType>*       res_coarse) const;
 
         virtual bool Compress(double drop_off);
         virtual bool Transpose(void);
         virtual bool Transpose(BaseMatrix<ValueType>* T) const;
         virtual bool Sort(void);
         virtual bool Key(long int& row_key, long int& col_key, long int& val_key) const;
+        virtual bool SparsityInfo(MatrixSparsityInfo* info) const;
 
         virtual bool ReplaceColumnVector(int idx, const BaseVector<ValueType>& vec);
         virtual bool ExtractColumnVector(int idx, BaseVector<ValueType>* vec) const;
@@ -385,6 +406,7 @@ namespace rocalution
                                              const BaseVector<bool>&      S,
                                              const BaseMatrix<ValueType>& ghost) const;
         virtual bool RSPMISCheckUndecided(bool& undecided, const BaseVector<int>& CFmap) const;
+        virtual bool RSHMISFirstPass(BaseVector<int>* CFmap, const BaseVector<bool>& S) const;
 
         virtual bool RSDirectProlongNnz(const BaseVector<int>&       CFmap,
                                         const BaseVector<bool>&      S,
@@ -520,11 +542,32 @@ namespace rocalution
                                  BaseVector<int64_t>*         global_col);
 
     private:
+        // Build / free the level schedule of the lower (L) or upper (U) triangular part
+        void LevelAnalyse_(bool lower);
+        void LevelAnalyseClear_(bool lower);
+        // Free the level schedules, if the given pattern differs from the current one
+        void LevelAnalyseCheckPattern_(const PtrType* row_offset, const int* col);
+
         MatrixCSR<ValueType, int, PtrType> mat_;
 
         bool L_diag_unit_;
         bool U_diag_unit_;
 
+        // Level schedules of the triangular solves (LAnalyse, UAnalyse, LUAnalyse, LLAnalyse)
+        int  L_nlevel_;
+        int* L_level_ptr_;
+        int* L_level_ind_;
+
+        int  U_nlevel_;
+        int* U_level_ptr_;
+        int* U_level_ind_;
+
+        // Transposed strictly lower triangular part for the L^T sweep (LLAnalyse),
+        // LT_perm_ maps each entry to its position in mat_.val
+        PtrType* LT_row_ptr_;
+        int*     LT_col_;
+        PtrType* LT_perm_;
+
         // Matrix buffer (itcsrsv)
         size_t mat_buffer_size_;
         char*  mat_buffer_;
@@ -540,6 +583,7 @@ namespace rocalution
         friend class HostMatrixDENSE<ValueType>;
         friend class HostMatrixMCSR<ValueType>;
         friend class HostMatrixBCSR<ValueType>;
+        friend class HostMatrixSELL<ValueType>;
 
         friend class HIPAcceleratorMatrixCSR<ValueType>;
     };
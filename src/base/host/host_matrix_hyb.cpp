@@ -29,6 +29,7 @@
 #include "host_conversion.hpp"
 #include "host_io.hpp"
 #include "host_matrix_csr.hpp"
+#include "host_sparse.hpp"
 #include "host_vector.hpp"
 
 #include <complex>
@@ -66,6 +67,9 @@ namespace rocalution
         this->ell_nnz_ = 0;
         this->coo_nnz_ = 0;
 
+        this->coo_row_sorted_valid_ = false;
+        this->coo_row_sorted_       = false;
+
         this->set_backend(local_backend);
     }
 
@@ -101,6 +105,8 @@ namespace rocalution
         this->nrow_ = 0;
         this->ncol_ = 0;
         this->nnz_  = 0;
+
+        this->coo_row_sorted_valid_ = false;
     }
 
     template <typename ValueType>
@@ -175,6 +181,9 @@ namespace rocalution
             copy_h2h(this->coo_nnz_, cast_mat->mat_.COO.row, this->mat_.COO.row);
             copy_h2h(this->coo_nnz_, cast_mat->mat_.COO.col, this->mat_.COO.col);
             copy_h2h(this->coo_nnz_, cast_mat->mat_.COO.val, this->mat_.COO.val);
+
+            this->coo_row_sorted_valid_ = cast_mat->coo_row_sorted_valid_;
+            this->coo_row_sorted_       = cast_mat->coo_row_sorted_;
         }
         else
         {
@@ -236,6 +245,10 @@ namespace rocalution
                 this->ell_nnz_ = ell_nnz;
                 this->coo_nnz_ = coo_nnz;
 
+                // The COO part is filled row by row
+                this->coo_row_sorted_valid_ = true;
+                this->coo_row_sorted_       = true;
+
                 return true;
             }
         }
@@ -354,14 +367,21 @@ namespace rocalution
                 }
             }
 
-            // COO
+            // COO, overwrites the output if there is no ELL part
             if(this->coo_nnz_ > 0)
             {
-                for(int64_t i = 0; i < this->coo_nnz_; ++i)
-                {
-                    cast_out->vec_[this->mat_.COO.row[i]]
-                        += this->mat_.COO.val[i] * cast_in->vec_[this->mat_.COO.col[i]];
-                }
+                host_coomv(this->nrow_,
+                           this->ncol_,
+                           this->coo_nnz_,
+                           static_cast<ValueType>(1),
+                           this->mat_.COO.val,
+                           this->mat_.COO.row,
+                           this->mat_.COO.col,
+                           cast_in->vec_,
+                           (this->ell_nnz_ > 0) ? static_cast<ValueType>(1)
+                                                : static_cast<ValueType>(0),
+                           cast_out->vec_,
+                           this->IsCOORowSorted_());
             }
         }
     }
@@ -410,15 +430,34 @@ namespace rocalution
             // COO
             if(this->coo_nnz_ > 0)
             {
-                for(int64_t i = 0; i < this->coo_nnz_; ++i)
-                {
-                    cast_out->vec_[this->mat_.COO.row[i]]
-                        += scalar * this->mat_.COO.val[i] * cast_in->vec_[this->mat_.COO.col[i]];
-                }
+                host_coomv(this->nrow_,
+                           this->ncol_,
+                           this->coo_nnz_,
+                           scalar,
+                           this->mat_.COO.val,
+                           this->mat_.COO.row,
+                           this->mat_.COO.col,
+                           cast_in->vec_,
+                           static_cast<ValueType>(1),
+                           cast_out->vec_,
+                           this->IsCOORowSorted_());
             }
         }
     }
 
+    template <typename ValueType>
+    bool HostMatrixHYB<ValueType>::IsCOORowSorted_(void) const
+    {
+        if(this->coo_row_sorted_valid_ == false)
+        {
+            this->coo_row_sorted_
+                = host_coo_is_row_sorted(this->coo_nnz_, this->mat_.COO.row);
+            this->coo_row_sorted_valid_ = true;
+        }
+
+        return this->coo_row_sorted_;
+    }
+
     template class HostMatrixHYB<double>;
     template class HostMatrixHYB<float>;
 #ifdef SUPPORT_COMPLEX
@@ -76,10 +76,18 @@ namespace rocalution
                               BaseVector<ValueType>*       out) const;
 
     private:
+        // Check (once per change of the structure) whether COO entries are sorted by row
+        bool IsCOORowSorted_(void) const;
+
         MatrixHYB<ValueType, int> mat_;
         int64_t                   ell_nnz_;
         int64_t                   coo_nnz_;
 
+        // Flag whether coo_row_sorted_ is up to date
+        mutable bool coo_row_sorted_valid_;
+        // Flag whether COO entries are sorted by row index
+        mutable bool coo_row_sorted_;
+
         friend class BaseVector<ValueType>;
         friend class HostVector<ValueType>;
         friend class HostMatrixCSR<ValueType>;
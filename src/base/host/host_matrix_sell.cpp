@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_matrix_sell.hpp"
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/log.hpp"
+#include "../matrix_formats_ind.hpp"
+#include "host_conversion.hpp"
+#include "host_matrix_csr.hpp"
+#include "host_vector.hpp"
+
+#include <complex>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_set_num_threads(num) ;
+#endif
+
+namespace rocalution
+{
+    // y = alpha * A * x + beta * y
+    template <typename ValueType>
+    static void host_sellmv(const MatrixSELL<ValueType, int, PtrType>& mat,
+                            int                                        nrow,
+                            ValueType                                  alpha,
+                            ValueType                                  beta,
+                            const ValueType*                           x,
+                            ValueType*                                 y)
+    {
+        int  C         = mat.slice_size;
+        bool zero_beta = (beta == static_cast<ValueType>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // Per thread accumulators for the rows of a slice
+            std::vector<ValueType> sum(C);
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int s = 0; s < mat.nslice; ++s)
+            {
+                PtrType offset = mat.slice_offset[s];
+                int     width  = static_cast<int>((mat.slice_offset[s + 1] - offset) / C);
+
+                for(int r = 0; r < C; ++r)
+                {
+                    sum[r] = static_cast<ValueType>(0);
+                }
+
+                // Slices are stored column-major, such that the rows of a slice
+                // are processed in SIMD lanes
+                for(int n = 0; n < width; ++n)
+                {
+                    const int*       col = mat.col + SELL_IND(offset, 0, n, C);
+                    const ValueType* val = mat.val + SELL_IND(offset, 0, n, C);
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for(int r = 0; r < C; ++r)
+                    {
+                        if(col[r] >= 0)
+                        {
+                            sum[r] += val[r] * x[col[r]];
+                        }
+                    }
+                }
+
+                for(int r = 0; r < C; ++r)
+                {
+                    int row = s * C + r;
+
+                    if(row < nrow)
+                    {
+                        int i = mat.perm[row];
+                        y[i]  = zero_beta ? alpha * sum[r] : alpha * sum[r] + beta * y[i];
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::HostMatrixSELL()
+    {
+        // no default constructors
+        LOG_INFO("no default constructor");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::HostMatrixSELL(const Rocalution_Backend_Descriptor& local_backend)
+    {
+        log_debug(this, "HostMatrixSELL::HostMatrixSELL()", "constructor with local_backend");
+
+        // Slice size matches the SIMD width of common host architectures, rows are
+        // sorted within windows of 32 slices
+        this->mat_.slice_size   = 8;
+        this->mat_.sigma        = 256;
+        this->mat_.nslice       = 0;
+        this->mat_.slice_offset = NULL;
+        this->mat_.perm         = NULL;
+        this->mat_.col          = NULL;
+        this->mat_.val          = NULL;
+
+        this->set_backend(local_backend);
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::~HostMatrixSELL()
+    {
+        log_debug(this, "HostMatrixSELL::~HostMatrixSELL()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Info(void) const
+    {
+        LOG_INFO("HostMatrixSELL<ValueType>, C=" << this->mat_.slice_size
+                                                 << " sigma=" << this->mat_.sigma);
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Clear()
+    {
+        free_host(&this->mat_.slice_offset);
+        free_host(&this->mat_.perm);
+        free_host(&this->mat_.col);
+        free_host(&this->mat_.val);
+
+        this->mat_.nslice = 0;
+
+        this->nrow_ = 0;
+        this->ncol_ = 0;
+        this->nnz_  = 0;
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::CopyFrom(const BaseMatrix<ValueType>& mat)
+    {
+        // copy only in the same format
+        assert(this->GetMatFormat() == mat.GetMatFormat());
+
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            if(this->nnz_ == 0)
+            {
+                this->Clear();
+
+                this->mat_.slice_size = cast_mat->mat_.slice_size;
+                this->mat_.sigma      = cast_mat->mat_.sigma;
+                this->mat_.nslice     = cast_mat->mat_.nslice;
+
+                if(cast_mat->nnz_ > 0)
+                {
+                    allocate_host(this->mat_.nslice + 1, &this->mat_.slice_offset);
+                    allocate_host(cast_mat->nrow_, &this->mat_.perm);
+                    allocate_host(cast_mat->nnz_, &this->mat_.col);
+                    allocate_host(cast_mat->nnz_, &this->mat_.val);
+                }
+
+                this->nrow_ = cast_mat->nrow_;
+                this->ncol_ = cast_mat->ncol_;
+                this->nnz_  = cast_mat->nnz_;
+            }
+
+            assert(this->nnz_ == cast_mat->nnz_);
+            assert(this->nrow_ == cast_mat->nrow_);
+            assert(this->ncol_ == cast_mat->ncol_);
+            assert(this->mat_.nslice == cast_mat->mat_.nslice);
+            assert(this->mat_.slice_size == cast_mat->mat_.slice_size);
+
+            if(this->nnz_ > 0)
+            {
+                copy_h2h(this->mat_.nslice + 1,
+                         cast_mat->mat_.slice_offset,
+                         this->mat_.slice_offset);
+                copy_h2h(this->nrow_, cast_mat->mat_.perm, this->mat_.perm);
+                copy_h2h(this->nnz_, cast_mat->mat_.col, this->mat_.col);
+                copy_h2h(this->nnz_, cast_mat->mat_.val, this->mat_.val);
+            }
+        }
+        else
+        {
+            // Host matrix knows only host matrices
+            // -> dispatching
+            mat.CopyTo(this);
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::CopyTo(BaseMatrix<ValueType>* mat) const
+    {
+        mat->CopyFrom(*this);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixSELL<ValueType>::ConvertFrom(const BaseMatrix<ValueType>& mat)
+    {
+        this->Clear();
+
+        // Empty matrix
+        if(mat.GetNnz() == 0)
+        {
+            this->nrow_ = mat.GetM();
+            this->ncol_ = mat.GetN();
+
+            return true;
+        }
+
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->CopyFrom(*cast_mat);
+            return true;
+        }
+
+        if(const HostMatrixCSR<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixCSR<ValueType>*>(&mat))
+        {
+            this->Clear();
+            int64_t nnz = 0;
+
+            if(csr_to_sell(this->local_backend_.OpenMP_threads,
+                           cast_mat->nnz_,
+                           cast_mat->nrow_,
+                           cast_mat->ncol_,
+                           cast_mat->mat_,
+                           &this->mat_,
+                           &nnz)
+               == true)
+            {
+                this->nrow_ = cast_mat->nrow_;
+                this->ncol_ = cast_mat->ncol_;
+                this->nnz_  = nnz;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Apply(const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            assert(in.GetSize() == this->ncol_);
+            assert(out->GetSize() == this->nrow_);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+            host_sellmv(this->mat_,
+                        this->nrow_,
+                        static_cast<ValueType>(1),
+                        static_cast<ValueType>(0),
+                        cast_in->vec_,
+                        cast_out->vec_);
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
+                                             ValueType                    scalar,
+                                             BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            assert(in.GetSize() == this->ncol_);
+            assert(out->GetSize() == this->nrow_);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+            host_sellmv(this->mat_,
+                        this->nrow_,
+                        scalar,
+                        static_cast<ValueType>(1),
+                        cast_in->vec_,
+                        cast_out->vec_);
+        }
+    }
+
+    template class HostMatrixSELL<double>;
+    template class HostMatrixSELL<float>;
+#ifdef SUPPORT_COMPLEX
+    template class HostMatrixSELL<std::complex<double>>;
+    template class HostMatrixSELL<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -29,10 +29,615 @@
 #include "rocalution/utils/types.hpp"
 
 #include <algorithm>
+#include <complex>
 #include <limits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#define omp_get_thread_num() 0
+#endif
 
 namespace rocalution
 {
+    // Partial dot product of a CSR row segment with x
+    template <typename I, typename J, typename T>
+    static inline T host_csr_row_dot(I begin, I end, const T* val, const J* col, const T* x)
+    {
+        T sum = static_cast<T>(0);
+
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum)
+#endif
+        for(I j = begin; j < end; ++j)
+        {
+            sum += val[j] * x[col[j]];
+        }
+
+        return sum;
+    }
+
+    // std::complex cannot be used in a simd reduction, thus we accumulate
+    // real and imaginary parts separately
+    template <typename I, typename J, typename T>
+    static inline std::complex<T> host_csr_row_dot(
+        I begin, I end, const std::complex<T>* val, const J* col, const std::complex<T>* x)
+    {
+        const T* v  = reinterpret_cast<const T*>(val);
+        const T* xx = reinterpret_cast<const T*>(x);
+
+        T re = static_cast<T>(0);
+        T im = static_cast<T>(0);
+
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : re, im)
+#endif
+        for(I j = begin; j < end; ++j)
+        {
+            J c  = col[j];
+            T vr = v[2 * j];
+            T vi = v[2 * j + 1];
+            T xr = xx[2 * c];
+            T xi = xx[2 * c + 1];
+
+            re += vr * xr - vi * xi;
+            im += vr * xi + vi * xr;
+        }
+
+        return std::complex<T>(re, im);
+    }
+
+    // Find the merge path coordinate (row, nnz) of a given diagonal, where the
+    // merge path is spanned by the row end offsets and the non-zero indices
+    template <typename I, typename J>
+    static inline void host_csrmv_merge_path_search(
+        int64_t diagonal, J m, I nnz, const I* csr_row_ptr, J* row, I* idx)
+    {
+        int64_t lo = std::max(diagonal - static_cast<int64_t>(nnz), static_cast<int64_t>(0));
+        int64_t hi = std::min(diagonal, static_cast<int64_t>(m));
+
+        while(lo < hi)
+        {
+            int64_t mid = (lo + hi) / 2;
+
+            if(csr_row_ptr[mid + 1] <= diagonal - mid - 1)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        *row = static_cast<J>(lo);
+        *idx = static_cast<I>(diagonal - lo);
+    }
+
+    // y = alpha * A * x + beta * y
+    // Each thread processes an equal share of rows plus non-zeros (merge path),
+    // such that long rows do not stall the remaining threads. Rows that are split
+    // between threads are fixed up after the parallel region.
+    template <typename I, typename J, typename T>
+    bool host_csrmv(J        m,
+                    J        n,
+                    I        nnz,
+                    T        alpha,
+                    const T* csr_val,
+                    const I* csr_row_ptr,
+                    const J* csr_col_ind,
+                    const T* x,
+                    T        beta,
+                    T*       y)
+    {
+        if(m == 0)
+        {
+            return true;
+        }
+
+        assert(csr_row_ptr != NULL);
+        assert(y != NULL);
+
+        int     nthreads   = std::max(omp_get_max_threads(), 1);
+        int64_t total_work = static_cast<int64_t>(m) + static_cast<int64_t>(nnz);
+
+        // Avoid threads without any work
+        nthreads = static_cast<int>(std::min(static_cast<int64_t>(nthreads), total_work));
+
+        std::vector<J> carry_row(nthreads, m);
+        std::vector<T> carry_val(nthreads, static_cast<T>(0));
+
+        bool zero_beta = (beta == static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+        {
+            int     tid          = omp_get_thread_num();
+            int64_t items_per_th = (total_work + nthreads - 1) / nthreads;
+
+            int64_t diag_begin = std::min(items_per_th * tid, total_work);
+            int64_t diag_end   = std::min(diag_begin + items_per_th, total_work);
+
+            J row_begin;
+            J row_end;
+            I idx_begin;
+            I idx_end;
+
+            host_csrmv_merge_path_search(diag_begin, m, nnz, csr_row_ptr, &row_begin, &idx_begin);
+            host_csrmv_merge_path_search(diag_end, m, nnz, csr_row_ptr, &row_end, &idx_end);
+
+            I idx = idx_begin;
+
+            // Rows that end within this partition
+            for(J row = row_begin; row < row_end; ++row)
+            {
+                I next = csr_row_ptr[row + 1];
+                T sum  = host_csr_row_dot(idx, next, csr_val, csr_col_ind, x);
+
+                y[row] = zero_beta ? alpha * sum : alpha * sum + beta * y[row];
+
+                idx = next;
+            }
+
+            // Trailing part of a row that continues in the next partition
+            carry_row[tid] = row_end;
+            carry_val[tid] = host_csr_row_dot(idx, idx_end, csr_val, csr_col_ind, x);
+        }
+
+        // Fix up split rows
+        for(int t = 0; t < nthreads; ++t)
+        {
+            if(carry_row[t] < m)
+            {
+                y[carry_row[t]] += alpha * carry_val[t];
+            }
+        }
+
+        return true;
+    }
+
+    // r = b - A * x
+    // Same merge path partitioning as host_csrmv, such that the residual is computed
+    // in a single pass instead of a product followed by a vector update.
+    template <typename I, typename J, typename T>
+    bool host_csrmv_residual(J        m,
+                             J        n,
+                             I        nnz,
+                             const T* csr_val,
+                             const I* csr_row_ptr,
+                             const J* csr_col_ind,
+                             const T* x,
+                             const T* b,
+                             T*       r)
+    {
+        if(m == 0)
+        {
+            return true;
+        }
+
+        assert(csr_row_ptr != NULL);
+        assert(b != NULL);
+        assert(r != NULL);
+
+        int     nthreads   = std::max(omp_get_max_threads(), 1);
+        int64_t total_work = static_cast<int64_t>(m) + static_cast<int64_t>(nnz);
+
+        // Avoid threads without any work
+        nthreads = static_cast<int>(std::min(static_cast<int64_t>(nthreads), total_work));
+
+        std::vector<J> carry_row(nthreads, m);
+        std::vector<T> carry_val(nthreads, static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+        {
+            int     tid          = omp_get_thread_num();
+            int64_t items_per_th = (total_work + nthreads - 1) / nthreads;
+
+            int64_t diag_begin = std::min(items_per_th * tid, total_work);
+            int64_t diag_end   = std::min(diag_begin + items_per_th, total_work);
+
+            J row_begin;
+            J row_end;
+            I idx_begin;
+            I idx_end;
+
+            host_csrmv_merge_path_search(diag_begin, m, nnz, csr_row_ptr, &row_begin, &idx_begin);
+            host_csrmv_merge_path_search(diag_end, m, nnz, csr_row_ptr, &row_end, &idx_end);
+
+            I idx = idx_begin;
+
+            // Rows that end within this partition
+            for(J row = row_begin; row < row_end; ++row)
+            {
+                I next = csr_row_ptr[row + 1];
+
+                r[row] = b[row] - host_csr_row_dot(idx, next, csr_val, csr_col_ind, x);
+
+                idx = next;
+            }
+
+            // Trailing part of a row that continues in the next partition
+            carry_row[tid] = row_end;
+            carry_val[tid] = host_csr_row_dot(idx, idx_end, csr_val, csr_col_ind, x);
+        }
+
+        // Fix up split rows
+        for(int t = 0; t < nthreads; ++t)
+        {
+            if(carry_row[t] < m)
+            {
+                r[carry_row[t]] -= carry_val[t];
+            }
+        }
+
+        return true;
+    }
+
+    // rc = R * (b - A * x)
+    // Each coarse row computes the residual of the fine rows it restricts on the fly,
+    // such that the fine residual is never stored and read back. Fine rows that are
+    // restricted by multiple coarse rows are computed multiple times, thus this pays off
+    // for aggregation type restrictions with at most one entry per fine row.
+    template <typename I, typename J, typename T>
+    bool host_csrmv_residual_restrict(J        m,
+                                      J        n,
+                                      I        nnz,
+                                      const T* csr_val,
+                                      const I* csr_row_ptr,
+                                      const J* csr_col_ind,
+                                      J        mc,
+                                      const T* restrict_val,
+                                      const I* restrict_row_ptr,
+                                      const J* restrict_col_ind,
+                                      const T* x,
+                                      const T* b,
+                                      T*       rc)
+    {
+        if(mc == 0)
+        {
+            return true;
+        }
+
+        assert(csr_row_ptr != NULL);
+        assert(restrict_row_ptr != NULL);
+        assert(b != NULL);
+        assert(rc != NULL);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for(J j = 0; j < mc; ++j)
+        {
+            T sum = static_cast<T>(0);
+
+            for(I k = restrict_row_ptr[j]; k < restrict_row_ptr[j + 1]; ++k)
+            {
+                J i = restrict_col_ind[k];
+
+                T res = b[i]
+                        - host_csr_row_dot(
+                            csr_row_ptr[i], csr_row_ptr[i + 1], csr_val, csr_col_ind, x);
+
+                sum += restrict_val[k] * res;
+            }
+
+            rc[j] = sum;
+        }
+
+        return true;
+    }
+
+    // Check whether the COO entries are sorted by row index
+    template <typename I, typename J>
+    bool host_coo_is_row_sorted(I nnz, const J* coo_row_ind)
+    {
+        bool sorted = true;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : sorted)
+#endif
+        for(I i = 1; i < nnz; ++i)
+        {
+            sorted = sorted && (coo_row_ind[i - 1] <= coo_row_ind[i]);
+        }
+
+        return sorted;
+    }
+
+    // y = alpha * A * x + beta * y, where A is in COO format
+    // Each thread processes an equal share of the non-zeros. Rows that lie entirely
+    // within a share are written directly, the first and last row of each share can
+    // be split between threads and are fixed up after the parallel region. This
+    // requires row sorted entries, as reported by the caller through sorted (see
+    // host_coo_is_row_sorted). Unsorted entries are accumulated sequentially.
+    template <typename I, typename J, typename T>
+    bool host_coomv(J        m,
+                    J        n,
+                    I        nnz,
+                    T        alpha,
+                    const T* coo_val,
+                    const J* coo_row_ind,
+                    const J* coo_col_ind,
+                    const T* x,
+                    T        beta,
+                    T*       y,
+                    bool     sorted)
+    {
+        if(m == 0)
+        {
+            return true;
+        }
+
+        assert(y != NULL);
+
+        int nthreads = std::max(omp_get_max_threads(), 1);
+
+        // Avoid threads without any work
+        nthreads = static_cast<int>(
+            std::max(std::min(static_cast<int64_t>(nthreads), static_cast<int64_t>(nnz)),
+                     static_cast<int64_t>(1)));
+
+        std::vector<J> carry_row(2 * nthreads, m);
+        std::vector<T> carry_val(2 * nthreads, static_cast<T>(0));
+
+        bool zero_beta = (beta == static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+        {
+            int tid = omp_get_thread_num();
+
+            // Scale y, rows without non-zeros are not visited below
+            if(beta != static_cast<T>(1))
+            {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                for(J i = 0; i < m; ++i)
+                {
+                    y[i] = zero_beta ? static_cast<T>(0) : beta * y[i];
+                }
+            }
+
+            if(sorted == false)
+            {
+#ifdef _OPENMP
+#pragma omp single
+#endif
+                for(I i = 0; i < nnz; ++i)
+                {
+                    y[coo_row_ind[i]] += alpha * coo_val[i] * x[coo_col_ind[i]];
+                }
+            }
+            else
+            {
+                int64_t items_per_th = (static_cast<int64_t>(nnz) + nthreads - 1) / nthreads;
+
+                int64_t share_begin = std::min(items_per_th * tid, static_cast<int64_t>(nnz));
+                int64_t share_end = std::min(share_begin + items_per_th, static_cast<int64_t>(nnz));
+
+                I idx     = static_cast<I>(share_begin);
+                I idx_end = static_cast<I>(share_end);
+
+                bool first = true;
+
+                while(idx < idx_end)
+                {
+                    J row  = coo_row_ind[idx];
+                    I next = idx + 1;
+
+                    while(next < idx_end && coo_row_ind[next] == row)
+                    {
+                        ++next;
+                    }
+
+                    T sum = host_csr_row_dot(idx, next, coo_val, coo_col_ind, x);
+
+                    if(first == true)
+                    {
+                        // Leading row, can continue from the previous share
+                        carry_row[2 * tid] = row;
+                        carry_val[2 * tid] = sum;
+
+                        first = false;
+                    }
+                    else if(next == idx_end)
+                    {
+                        // Trailing row, can continue in the next share
+                        carry_row[2 * tid + 1] = row;
+                        carry_val[2 * tid + 1] = sum;
+                    }
+                    else
+                    {
+                        y[row] += alpha * sum;
+                    }
+
+                    idx = next;
+                }
+            }
+        }
+
+        // Fix up split rows
+        for(int t = 0; t < 2 * nthreads; ++t)
+        {
+            if(carry_row[t] < m)
+            {
+                y[carry_row[t]] += alpha * carry_val[t];
+            }
+        }
+
+        return true;
+    }
+
+    // Y = alpha * A * X + beta * Y, where X (n x num_vec) and Y (m x num_vec) are
+    // stored column-major. The non-zeros of a row are loaded once for a chunk of
+    // up to HOST_CSRMM_CHUNK columns, such that all columns share a single pass
+    // over the matrix for typical numbers of right-hand sides.
+#define HOST_CSRMM_CHUNK 8
+    template <typename I, typename J, typename T>
+    bool host_csrmm(J        m,
+                    J        n,
+                    J        num_vec,
+                    I        nnz,
+                    T        alpha,
+                    const T* csr_val,
+                    const I* csr_row_ptr,
+                    const J* csr_col_ind,
+                    const T* x,
+                    T        beta,
+                    T*       y)
+    {
+        if(m == 0 || num_vec == 0)
+        {
+            return true;
+        }
+
+        assert(csr_row_ptr != NULL);
+        assert(x != NULL);
+        assert(y != NULL);
+
+        bool zero_beta = (beta == static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(J row = 0; row < m; ++row)
+        {
+            I row_begin = csr_row_ptr[row];
+            I row_end   = csr_row_ptr[row + 1];
+
+            for(J c0 = 0; c0 < num_vec; c0 += HOST_CSRMM_CHUNK)
+            {
+                J nc = std::min(num_vec - c0, static_cast<J>(HOST_CSRMM_CHUNK));
+
+                T sum[HOST_CSRMM_CHUNK];
+
+                for(J c = 0; c < nc; ++c)
+                {
+                    sum[c] = static_cast<T>(0);
+                }
+
+                for(I j = row_begin; j < row_end; ++j)
+                {
+                    T        v  = csr_val[j];
+                    const T* xc = x + csr_col_ind[j] + static_cast<int64_t>(c0) * n;
+
+                    for(J c = 0; c < nc; ++c)
+                    {
+                        sum[c] += v * xc[static_cast<int64_t>(c) * n];
+                    }
+                }
+
+                T* yc = y + row + static_cast<int64_t>(c0) * m;
+
+                for(J c = 0; c < nc; ++c)
+                {
+                    int64_t idx = static_cast<int64_t>(c) * m;
+
+                    yc[idx] = zero_beta ? alpha * sum[c] : alpha * sum[c] + beta * yc[idx];
+                }
+            }
+        }
+
+        return true;
+    }
+#undef HOST_CSRMM_CHUNK
+
+    // Level scheduling of a sparse triangular solve. Row i of the lower (upper) triangular
+    // part depends on all rows j < i (j > i) with a non-zero entry in column j. The level
+    // of a row is the length of its longest dependency chain, such that all rows of a
+    // level can be solved concurrently once the previous levels are done. Entries of the
+    // other triangular part are ignored, thus a combined LU matrix can be analysed.
+    // level_ptr (m + 1 entries) holds the start of each level in level_ind (m entries),
+    // rows of a level are in ascending order.
+    template <typename I, typename J>
+    bool host_csrsv_analysis(J                     m,
+                             const I*              csr_row_ptr,
+                             const J*              csr_col_ind,
+                             host_sparse_fill_mode fill_mode,
+                             J*                    nlevel,
+                             J*                    level_ptr,
+                             J*                    level_ind)
+    {
+        assert(nlevel != NULL);
+
+        *nlevel = 0;
+
+        if(m == 0)
+        {
+            return true;
+        }
+
+        assert(csr_row_ptr != NULL);
+        assert(level_ptr != NULL);
+        assert(level_ind != NULL);
+
+        std::vector<J> depth(m);
+
+        bool lower = (fill_mode == host_sparse_fill_mode_lower);
+
+        J max_depth = 0;
+
+        // Dependencies have to be processed first, thus sweep in solve order
+        for(J k = 0; k < m; ++k)
+        {
+            J row = lower ? k : m - 1 - k;
+            J d   = 0;
+
+            for(I j = csr_row_ptr[row]; j < csr_row_ptr[row + 1]; ++j)
+            {
+                J col = csr_col_ind[j];
+
+                if((lower && col < row) || (!lower && col > row))
+                {
+                    d = std::max(d, depth[col] + 1);
+                }
+            }
+
+            depth[row] = d;
+            max_depth  = std::max(max_depth, d);
+        }
+
+        *nlevel = max_depth + 1;
+
+        // Bucket the rows by level
+        for(J l = 0; l < *nlevel + 1; ++l)
+        {
+            level_ptr[l] = 0;
+        }
+
+        for(J row = 0; row < m; ++row)
+        {
+            ++level_ptr[depth[row] + 1];
+        }
+
+        for(J l = 0; l < *nlevel; ++l)
+        {
+            level_ptr[l + 1] += level_ptr[l];
+        }
+
+        for(J row = 0; row < m; ++row)
+        {
+            level_ind[level_ptr[depth[row]]++] = row;
+        }
+
+        // Shift back the level offsets
+        for(J l = *nlevel; l > 0; --l)
+        {
+            level_ptr[l] = level_ptr[l - 1];
+        }
+
+        level_ptr[0] = 0;
+
+        return true;
+    }
+
     template <typename I, typename J, typename T>
     bool host_csritsv_buffer_size(host_sparse_operation   trans,
                                   J                       m,
@@ -524,6 +1129,66 @@ namespace rocalution
     }
 
 #define INSTANTIATE_T(TTYPE)                                                                         \
+    template bool host_csrmv<PtrType, int, TTYPE>(int            m,                                  \
+                                                  int            n,                                  \
+                                                  PtrType        nnz,                                \
+                                                  TTYPE          alpha,                              \
+                                                  const TTYPE*   csr_val,                            \
+                                                  const PtrType* csr_row_ptr,                        \
+                                                  const int*     csr_col_ind,                        \
+                                                  const TTYPE*   x,                                  \
+                                                  TTYPE          beta,                               \
+                                                  TTYPE*         y);                                 \
+                                                                                                     \
+    template bool host_csrmm<PtrType, int, TTYPE>(int            m,                                  \
+                                                  int            n,                                  \
+                                                  int            num_vec,                            \
+                                                  PtrType        nnz,                                \
+                                                  TTYPE          alpha,                              \
+                                                  const TTYPE*   csr_val,                            \
+                                                  const PtrType* csr_row_ptr,                        \
+                                                  const int*     csr_col_ind,                        \
+                                                  const TTYPE*   x,                                  \
+                                                  TTYPE          beta,                               \
+                                                  TTYPE*         y);                                 \
+                                                                                                     \
+    template bool host_csrmv_residual<PtrType, int, TTYPE>(int            m,                         \
+                                                           int            n,                         \
+                                                           PtrType        nnz,                       \
+                                                           const TTYPE*   csr_val,                   \
+                                                           const PtrType* csr_row_ptr,               \
+                                                           const int*     csr_col_ind,               \
+                                                           const TTYPE*   x,                         \
+                                                           const TTYPE*   b,                         \
+                                                           TTYPE*         r);                        \
+                                                                                                     \
+    template bool host_csrmv_residual_restrict<PtrType, int, TTYPE>(                                 \
+        int            m,                                                                            \
+        int            n,                                                                            \
+        PtrType        nnz,                                                                          \
+        const TTYPE*   csr_val,                                                                      \
+        const PtrType* csr_row_ptr,                                                                  \
+        const int*     csr_col_ind,                                                                  \
+        int            mc,                                                                           \
+        const TTYPE*   restrict_val,                                                                 \
+        const PtrType* restrict_row_ptr,                                                             \
+        const int*     restrict_col_ind,                                                             \
+        const TTYPE*   x,                                                                            \
+        const TTYPE*   b,                                                                            \
+        TTYPE*         rc);                                                                          \
+                                                                                                     \
+    template bool host_coomv<int64_t, int, TTYPE>(int          m,                                    \
+                                                  int          n,                                    \
+                                                  int64_t      nnz,                                  \
+                                                  TTYPE        alpha,                                \
+                                                  const TTYPE* coo_val,                              \
+                                                  const int*   coo_row_ind,                          \
+                                                  const int*   coo_col_ind,                          \
+                                                  const TTYPE* x,                                    \
+                                                  TTYPE        beta,                                 \
+                                                  TTYPE*       y,                                    \
+                                                  bool         sorted);                              \
+                                                                                                     \
     template bool host_csritsv_buffer_size<PtrType, int, TTYPE>(host_sparse_operation   trans,       \
                                                                 int                     m,           \
                                                                 PtrType                 nnz,         \
@@ -553,6 +1218,16 @@ namespace rocalution
                                                           void*                    temp_buffer,      \
                                                           int*                     zero_pivot)
 
+    template bool host_coo_is_row_sorted<int64_t, int>(int64_t nnz, const int* coo_row_ind);
+
+    template bool host_csrsv_analysis<PtrType, int>(int                   m,
+                                                    const PtrType*        csr_row_ptr,
+                                                    const int*            csr_col_ind,
+                                                    host_sparse_fill_mode fill_mode,
+                                                    int*                  nlevel,
+                                                    int*                  level_ptr,
+                                                    int*                  level_ind);
+
     INSTANTIATE_T(float);
     INSTANTIATE_T(double);
 #ifdef SUPPORT_COMPLEX
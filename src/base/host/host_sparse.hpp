@@ -57,6 +57,82 @@ typedef enum host_sparse_fill_mode_
 
 namespace rocalution
 {
+    template <typename I, typename J, typename T>
+    bool host_csrmv(J        m,
+                    J        n,
+                    I        nnz,
+                    T        alpha,
+                    const T* csr_val,
+                    const I* csr_row_ptr,
+                    const J* csr_col_ind,
+                    const T* x,
+                    T        beta,
+                    T*       y);
+
+    template <typename I, typename J, typename T>
+    bool host_csrmm(J        m,
+                    J        n,
+                    J        num_vec,
+                    I        nnz,
+                    T        alpha,
+                    const T* csr_val,
+                    const I* csr_row_ptr,
+                    const J* csr_col_ind,
+                    const T* x,
+                    T        beta,
+                    T*       y);
+
+    template <typename I, typename J, typename T>
+    bool host_csrmv_residual(J        m,
+                             J        n,
+                             I        nnz,
+                             const T* csr_val,
+                             const I* csr_row_ptr,
+                             const J* csr_col_ind,
+                             const T* x,
+                             const T* b,
+                             T*       r);
+
+    template <typename I, typename J, typename T>
+    bool host_csrmv_residual_restrict(J        m,
+                                      J        n,
+                                      I        nnz,
+                                      const T* csr_val,
+                                      const I* csr_row_ptr,
+                                      const J* csr_col_ind,
+                                      J        mc,
+                                      const T* restrict_val,
+                                      const I* restrict_row_ptr,
+                                      const J* restrict_col_ind,
+                                      const T* x,
+                                      const T* b,
+                                      T*       rc);
+
+    template <typename I, typename J, typename T>
+    bool host_coomv(J        m,
+                    J        n,
+                    I        nnz,
+                    T        alpha,
+                    const T* coo_val,
+                    const J* coo_row_ind,
+                    const J* coo_col_ind,
+                    const T* x,
+                    T        beta,
+                    T*       y,
+                    bool     sorted);
+
+    template <typename I, typename J>
+    bool host_coo_is_row_sorted(I nnz, const J* coo_row_ind);
+
+    template <typename I, typename J>
+    bool host_csrsv_analysis(J                     m,
+                             const I*              csr_row_ptr,
+                             const J*              csr_col_ind,
+                             host_sparse_fill_mode fill_mode,
+                             J*                    nlevel,
+                             J*                    level_ptr,
+                             J*                    level_ind);
+
     template <typename I, typename J, typename T>
     bool host_csritsv_buffer_size(host_sparse_operation   trans,
                                   J                       m,
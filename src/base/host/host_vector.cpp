@@ -29,6 +29,7 @@
 #include "../../utils/def.hpp"
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/type_traits.hpp"
 #include "../base_vector.hpp"
 #include "rocalution/version.hpp"
 
@@ -40,6 +41,7 @@
 #include <numeric>
 #include <typeindex>
 #include <typeinfo>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -746,6 +748,124 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    ValueType HostVector<ValueType>::AddScaleNormSquared(const BaseVector<ValueType>& x,
+                                                         ValueType                    alpha)
+    {
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(this->size_ == cast_x->size_);
+
+        numeric_traits_t<ValueType> norm2 = static_cast<numeric_traits_t<ValueType>>(0);
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : norm2)
+#endif
+        for(int64_t i = 0; i < this->size_; ++i)
+        {
+            ValueType val = this->vec_[i] + alpha * cast_x->vec_[i];
+
+            this->vec_[i] = val;
+            norm2 += std::norm(val);
+        }
+
+        return static_cast<ValueType>(norm2);
+    }
+
+    template <>
+    bool HostVector<bool>::AddScaleNormSquared(const BaseVector<bool>& x, bool alpha)
+    {
+        LOG_INFO("What is bool HostVector<ValueType>::AddScaleNormSquared()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int HostVector<int>::AddScaleNormSquared(const BaseVector<int>& x, int alpha)
+    {
+        LOG_INFO("What is int HostVector<ValueType>::AddScaleNormSquared()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int64_t HostVector<int64_t>::AddScaleNormSquared(const BaseVector<int64_t>& x, int64_t alpha)
+    {
+        LOG_INFO("What is int64_t HostVector<ValueType>::AddScaleNormSquared()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    ValueType HostVector<ValueType>::AddScalePairNormSquared(const BaseVector<ValueType>& x,
+                                                             ValueType                    alpha,
+                                                             BaseVector<ValueType>*       y,
+                                                             const BaseVector<ValueType>& z,
+                                                             ValueType                    beta)
+    {
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+        HostVector<ValueType>*       cast_y = dynamic_cast<HostVector<ValueType>*>(y);
+        const HostVector<ValueType>* cast_z = dynamic_cast<const HostVector<ValueType>*>(&z);
+
+        assert(cast_x != NULL);
+        assert(cast_y != NULL);
+        assert(cast_z != NULL);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ == cast_y->size_);
+        assert(this->size_ == cast_z->size_);
+
+        numeric_traits_t<ValueType> norm2 = static_cast<numeric_traits_t<ValueType>>(0);
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : norm2)
+#endif
+        for(int64_t i = 0; i < this->size_; ++i)
+        {
+            ValueType val = cast_y->vec_[i] + beta * cast_z->vec_[i];
+
+            this->vec_[i]   = this->vec_[i] + alpha * cast_x->vec_[i];
+            cast_y->vec_[i] = val;
+            norm2 += std::norm(val);
+        }
+
+        return static_cast<ValueType>(norm2);
+    }
+
+    template <>
+    bool HostVector<bool>::AddScalePairNormSquared(const BaseVector<bool>& x,
+                                                   bool                    alpha,
+                                                   BaseVector<bool>*       y,
+                                                   const BaseVector<bool>& z,
+                                                   bool                    beta)
+    {
+        LOG_INFO("What is bool HostVector<ValueType>::AddScalePairNormSquared()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int HostVector<int>::AddScalePairNormSquared(const BaseVector<int>& x,
+                                                 int                    alpha,
+                                                 BaseVector<int>*       y,
+                                                 const BaseVector<int>& z,
+                                                 int                    beta)
+    {
+        LOG_INFO("What is int HostVector<ValueType>::AddScalePairNormSquared()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    int64_t HostVector<int64_t>::AddScalePairNormSquared(const BaseVector<int64_t>& x,
+                                                         int64_t                    alpha,
+                                                         BaseVector<int64_t>*       y,
+                                                         const BaseVector<int64_t>& z,
+                                                         int64_t                    beta)
+    {
+        LOG_INFO("What is int64_t HostVector<ValueType>::AddScalePairNormSquared()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     void HostVector<ValueType>::Scale(ValueType alpha)
     {
@@ -912,6 +1032,164 @@ namespace rocalution
         return std::complex<double>(dot_real, dot_imag);
     }
 
+    // Dot products of num_vec contiguous blocks of size n. All blocks are traversed in a
+    // single sweep, each thread accumulates its partial dot products locally
+    template <bool CONJ, typename ValueType>
+    static void host_dot_batched(
+        int64_t n, int num_vec, const ValueType* x, const ValueType* y, ValueType* result)
+    {
+        for(int j = 0; j < num_vec; ++j)
+        {
+            result[j] = static_cast<ValueType>(0);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<ValueType> partial(num_vec, static_cast<ValueType>(0));
+
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+            for(int64_t i = 0; i < n; ++i)
+            {
+                for(int j = 0; j < num_vec; ++j)
+                {
+                    ValueType xi = x[j * n + i];
+
+                    partial[j] += (CONJ ? rocalution_conj(xi) : xi) * y[j * n + i];
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            for(int j = 0; j < num_vec; ++j)
+            {
+                result[j] += partial[j];
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void HostVector<ValueType>::DotBatched(const BaseVector<ValueType>& x,
+                                           int                          num_vec,
+                                           ValueType*                   result) const
+    {
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(result != NULL);
+        assert(num_vec > 0);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vec == 0);
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+        host_dot_batched<true>(this->size_ / num_vec, num_vec, this->vec_, cast_x->vec_, result);
+    }
+
+    template <>
+    void HostVector<bool>::DotBatched(const BaseVector<bool>& x, int num_vec, bool* result) const
+    {
+        LOG_INFO("What is bool HostVector<ValueType>::DotBatched()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HostVector<int>::DotBatched(const BaseVector<int>& x, int num_vec, int* result) const
+    {
+        LOG_INFO("What is int HostVector<ValueType>::DotBatched()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HostVector<int64_t>::DotBatched(const BaseVector<int64_t>& x,
+                                         int                        num_vec,
+                                         int64_t*                   result) const
+    {
+        LOG_INFO("What is int64_t HostVector<ValueType>::DotBatched()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void HostVector<ValueType>::DotNonConjBatched(const BaseVector<ValueType>& x,
+                                                  int                          num_vec,
+                                                  ValueType*                   result) const
+    {
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(result != NULL);
+        assert(num_vec > 0);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vec == 0);
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+        host_dot_batched<false>(this->size_ / num_vec, num_vec, this->vec_, cast_x->vec_, result);
+    }
+
+    template <>
+    void HostVector<bool>::DotNonConjBatched(const BaseVector<bool>& x,
+                                             int                     num_vec,
+                                             bool*                   result) const
+    {
+        LOG_INFO("What is bool HostVector<ValueType>::DotNonConjBatched()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HostVector<int>::DotNonConjBatched(const BaseVector<int>& x,
+                                            int                    num_vec,
+                                            int*                   result) const
+    {
+        LOG_INFO("What is int HostVector<ValueType>::DotNonConjBatched()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HostVector<int64_t>::DotNonConjBatched(const BaseVector<int64_t>& x,
+                                                int                        num_vec,
+                                                int64_t*                   result) const
+    {
+        LOG_INFO("What is int64_t HostVector<ValueType>::DotNonConjBatched()?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void HostVector<ValueType>::ScaleAddScaleBatched(const ValueType*             alpha,
+                                                     const BaseVector<ValueType>& x,
+                                                     const ValueType*             beta,
+                                                     int                          num_vec)
+    {
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(alpha != NULL);
+        assert(beta != NULL);
+        assert(num_vec > 0);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vec == 0);
+
+        int64_t n = this->size_ / num_vec;
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t i = 0; i < n; ++i)
+        {
+            for(int j = 0; j < num_vec; ++j)
+            {
+                this->vec_[j * n + i]
+                    = alpha[j] * this->vec_[j * n + i] + beta[j] * cast_x->vec_[j * n + i];
+            }
+        }
+    }
+
     template <typename ValueType>
     ValueType HostVector<ValueType>::Asum(void) const
     {
@@ -26,20 +26,27 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profile.hpp"
 #include "../utils/rocsparseio.h"
+#include "../utils/time_functions.hpp"
 #include "backend_manager.hpp"
 #include "base_matrix.hpp"
 #include "base_vector.hpp"
 #include "host/host_matrix_coo.hpp"
 #include "host/host_matrix_csr.hpp"
 #include "host/host_vector.hpp"
+#include "local_multi_vector.hpp"
 #include "local_vector.hpp"
 
 #include <algorithm>
 #include <complex>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string.h>
+#include <tuple>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -1418,6 +1425,59 @@ namespace rocalution
         LOG_INFO("ReadFileCSR: filename=" << filename << "; done");
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::MapFileCSR(const std::string& filename)
+    {
+        log_debug(this, "LocalMatrix::MapFileCSR()", filename);
+
+        LOG_INFO("MapFileCSR: filename=" << filename << "; mapping...");
+
+        this->Clear();
+
+        bool err = this->matrix_->MapFileCSR(filename);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+        {
+            LOG_INFO("Execution of LocalMatrix::MapFileCSR() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            // Move to host
+            bool is_accel = this->is_accel_();
+            this->MoveToHost();
+
+            // Convert to CSR
+            unsigned int format   = this->GetFormat();
+            int          blockdim = this->GetBlockDimension();
+            this->ConvertToCSR();
+
+            if(this->matrix_->MapFileCSR(filename) == false)
+            {
+                LOG_INFO("Execution of LocalMatrix::MapFileCSR() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(is_accel == true)
+            {
+                this->MoveToAccelerator();
+            }
+
+            this->ConvertTo(format, blockdim);
+        }
+
+        this->object_name_ = filename;
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        LOG_INFO("MapFileCSR: filename=" << filename << "; done");
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::ReadFileRSIO(const std::string& filename,
                                               bool               maintain_initial_format)
@@ -1483,6 +1543,12 @@ namespace rocalution
             this->ConvertToCSR();
             break;
         }
+        case rocsparseio_format_sparse_zcsx:
+        {
+            LOG_INFO("ReadFileRSIO: filename=" << filename << "; format=CSR (compressed)");
+            this->ConvertToCSR();
+            break;
+        }
         case rocsparseio_format_sparse_gebsx:
         {
             LOG_INFO("ReadFileRSIO: filename=" << filename << "; format=BCSR");
@@ -1656,6 +1722,48 @@ namespace rocalution
         LOG_INFO("WriteFileRSIO: filename=" << filename << "; done");
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::WriteFileRSIOCompressed(const std::string& filename,
+                                                         bool               compress_val) const
+    {
+        log_debug(this, "LocalMatrix::WriteFileRSIOCompressed()", filename, compress_val);
+
+        LOG_INFO("WriteFileRSIOCompressed: filename=" << filename << "; writing...");
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        bool err = this->matrix_->WriteFileRSIOCompressed(filename, compress_val);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+        {
+            LOG_INFO("Execution of LocalMatrix::WriteFileRSIOCompressed() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            // Move to host
+            LocalMatrix<ValueType> mat_host;
+            mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+            mat_host.CopyFrom(*this);
+
+            // Convert to CSR
+            mat_host.ConvertToCSR();
+
+            if(mat_host.matrix_->WriteFileRSIOCompressed(filename, compress_val) == false)
+            {
+                LOG_INFO("Execution of LocalMatrix::WriteFileRSIOCompressed() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+        }
+
+        LOG_INFO("WriteFileRSIOCompressed: filename=" << filename << "; done");
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::CopyFrom(const LocalMatrix<ValueType>& src)
     {
@@ -1866,6 +1974,12 @@ namespace rocalution
 
         if((_rocalution_available_accelerator()) && (this->matrix_ == this->matrix_host_))
         {
+            // SELL is a host only format
+            if(this->GetFormat() == SELL)
+            {
+                this->ConvertToCSR();
+            }
+
             this->matrix_accel_ = _rocalution_init_base_backend_matrix<ValueType>(
                 this->local_backend_, this->GetFormat(), this->GetBlockDimension());
             this->matrix_accel_->CopyFrom(*this->matrix_host_);
@@ -1924,6 +2038,12 @@ namespace rocalution
 
         if((_rocalution_available_accelerator()) && (this->matrix_ == this->matrix_host_))
         {
+            // SELL is a host only format
+            if(this->GetFormat() == SELL)
+            {
+                this->ConvertToCSR();
+            }
+
             this->matrix_accel_ = _rocalution_init_base_backend_matrix<ValueType>(
                 this->local_backend_, this->GetFormat(), this->GetBlockDimension());
             this->matrix_accel_->CopyFromAsync(*this->matrix_host_);
@@ -2027,6 +2147,27 @@ namespace rocalution
     template <typename ValueType>
     void LocalMatrix<ValueType>::ConvertToBCSR(int blockdim)
     {
+        if(blockdim <= 0)
+        {
+            log_debug(this, "LocalMatrix::ConvertToBCSR()", blockdim);
+
+            blockdim = this->DetectBlockDimension();
+
+            if(blockdim < 2)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::ConvertToBCSR() no block structure "
+                                 "detected, matrix format is kept");
+                return;
+            }
+        }
+
+        // Change of the block dimension
+        if(this->GetFormat() == BCSR && this->GetBlockDimension() != blockdim)
+        {
+            this->ConvertToCSR();
+        }
+
         this->ConvertTo(BCSR, blockdim);
     }
 
@@ -2060,6 +2201,12 @@ namespace rocalution
         this->ConvertTo(DENSE);
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ConvertToSELL(void)
+    {
+        this->ConvertTo(SELL);
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::ConvertTo(unsigned int matrix_format, int blockdim)
     {
@@ -2067,7 +2214,7 @@ namespace rocalution
 
         assert((matrix_format == DENSE) || (matrix_format == CSR) || (matrix_format == MCSR)
                || (matrix_format == BCSR) || (matrix_format == COO) || (matrix_format == DIA)
-               || (matrix_format == ELL) || (matrix_format == HYB));
+               || (matrix_format == ELL) || (matrix_format == HYB) || (matrix_format == SELL));
 
         LOG_VERBOSE_INFO(5,
                          "Converting " << _matrix_format_names[matrix_format] << " <- "
@@ -2116,6 +2263,18 @@ namespace rocalution
                 this->matrix_host_ = new_mat;
                 this->matrix_      = this->matrix_host_;
             }
+            else if(matrix_format == SELL)
+            {
+                // SELL is a host only format, keep the accelerator matrix in CSR
+                if(this->GetFormat() != CSR)
+                {
+                    this->ConvertToCSR();
+                }
+
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::ConvertTo() SELL is not supported on "
+                                 "the accelerator, falling back to CSR format");
+            }
             else
             {
                 // Accelerator Matrix
@@ -2130,24 +2289,374 @@ namespace rocalution
                 {
                     delete new_mat;
 
-                    this->MoveToHost();
-                    this->ConvertTo(matrix_format, blockdim);
-                    this->MoveToAccelerator();
+                    this->MoveToHost();
+                    this->ConvertTo(matrix_format, blockdim);
+                    this->MoveToAccelerator();
+
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ConvertTo() is performed on the host");
+                }
+                else
+                {
+                    delete this->matrix_accel_;
+
+                    this->matrix_accel_ = new_mat;
+                    this->matrix_       = this->matrix_accel_;
+                }
+            }
+
+            assert(this->GetFormat() == matrix_format || this->GetFormat() == CSR);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::GetSparsityInfo(MatrixSparsityInfo* info) const
+    {
+        log_debug(this, "LocalMatrix::GetSparsityInfo()", info);
+
+        assert(info != NULL);
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        bool err = this->matrix_->SparsityInfo(info);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::GetSparsityInfo() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            // Move to host
+            LocalMatrix<ValueType> mat_host;
+            mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+            mat_host.CopyFrom(*this);
+
+            // Convert to CSR
+            mat_host.ConvertToCSR();
+
+            if(mat_host.matrix_->SparsityInfo(info) == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::GetSparsityInfo() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->GetFormat() != CSR)
+            {
+                LOG_VERBOSE_INFO(
+                    2, "*** warning: LocalMatrix::GetSparsityInfo() is performed in CSR format");
+            }
+
+            if(this->is_accel_() == true)
+            {
+                LOG_VERBOSE_INFO(
+                    2, "*** warning: LocalMatrix::GetSparsityInfo() is performed on the host");
+            }
+        }
+    }
+
+    template <typename ValueType>
+    int LocalMatrix<ValueType>::DetectBlockDimension(double min_fill) const
+    {
+        log_debug(this, "LocalMatrix::DetectBlockDimension()", min_fill);
+
+        assert(min_fill > 0.0);
+        assert(min_fill <= 1.0);
+
+        if(this->GetNnz() == 0)
+        {
+            return 1;
+        }
+
+        MatrixSparsityInfo info;
+        this->GetSparsityInfo(&info);
+
+        // Largest block dimension that divides the matrix and has sufficient fill, such
+        // that e.g. a 6 x 6 block structure is not detected as 2 x 2 or 3 x 3
+        for(int b = 8; b >= 2; --b)
+        {
+            if(info.nrow % b == 0 && info.ncol % b == 0 && info.block_fill[b - 2] >= min_fill)
+            {
+                return b;
+            }
+        }
+
+        return 1;
+    }
+
+    // Candidate format of LocalMatrix::AutoFormat()
+    struct AutoFormatCandidate
+    {
+        unsigned int format;
+        int          blockdim;
+
+        // Estimated number of bytes moved by a matrix-vector product
+        double bytes;
+    };
+
+    // Collect the formats that the matrix can be converted to, together with the estimated
+    // number of bytes their matrix-vector product moves. CSR is always the first candidate.
+    template <typename ValueType>
+    static void auto_format_candidates(const MatrixSparsityInfo&         info,
+                                       bool                              host,
+                                       std::vector<AutoFormatCandidate>* candidates)
+    {
+        double val_size = static_cast<double>(sizeof(ValueType));
+        double idx_size = static_cast<double>(sizeof(int));
+        double ptr_size = static_cast<double>(sizeof(PtrType));
+
+        double nrow = static_cast<double>(info.nrow);
+        double ncol = static_cast<double>(info.ncol);
+        double nnz  = static_cast<double>(info.nnz);
+        double size = std::min(nrow, ncol);
+
+        // Input and output vector
+        double vec = (nrow + ncol) * val_size;
+
+        AutoFormatCandidate c;
+
+        // CSR
+        c.format   = CSR;
+        c.blockdim = 1;
+        c.bytes    = nnz * (val_size + idx_size) + (nrow + 1) * ptr_size + vec;
+        candidates->push_back(c);
+
+        // MCSR stores the diagonal separately
+        if(info.full_diag == true && info.nrow == info.ncol)
+        {
+            c.format   = MCSR;
+            c.blockdim = 1;
+            c.bytes    = nnz * val_size + (nnz - nrow) * idx_size + (nrow + 1) * idx_size + vec;
+            candidates->push_back(c);
+        }
+
+        // DIA, same limit as the conversion
+        if(info.num_diag <= 5 * (info.nnz / std::max(info.nrow, static_cast<int64_t>(1))))
+        {
+            c.format   = DIA;
+            c.blockdim = 1;
+            c.bytes    = info.num_diag * (size * val_size + idx_size) + vec;
+            candidates->push_back(c);
+        }
+
+        // ELL
+        c.format   = ELL;
+        c.blockdim = 1;
+        c.bytes    = info.max_row_nnz * nrow * (val_size + idx_size) + vec;
+        candidates->push_back(c);
+
+        // HYB, with the ELL width of the conversion and the COO part estimated from the
+        // row length histogram
+        if(host == false)
+        {
+            double width    = std::ceil(nnz / nrow);
+            double overflow = 0.0;
+
+            for(int b = 1; b < 32; ++b)
+            {
+                double row_nnz = 1.5 * std::ldexp(1.0, b - 1);
+                overflow += info.row_nnz_histogram[b] * std::max(0.0, row_nnz - width);
+            }
+
+            overflow = std::min(overflow, nnz);
+
+            c.format   = HYB;
+            c.blockdim = 1;
+            c.bytes = nrow * width * (val_size + idx_size) + overflow * (val_size + 2 * idx_size)
+                      + vec;
+            candidates->push_back(c);
+        }
+
+        // BCSR with the block dimension of best fill
+        int    blockdim   = 0;
+        double block_fill = 0.0;
+
+        for(int b = 2; b <= 8; ++b)
+        {
+            // BCSR requires the matrix dimensions to be multiples of the block dimension
+            if(info.nrow % b != 0 || info.ncol % b != 0)
+            {
+                continue;
+            }
+
+            // Prefer larger blocks for equal fill
+            if(info.block_fill[b - 2] >= block_fill)
+            {
+                blockdim   = b;
+                block_fill = info.block_fill[b - 2];
+            }
+        }
+
+        if(block_fill >= 0.5)
+        {
+            double nnzb  = nnz / (block_fill * blockdim * blockdim);
+            double nrowb = std::ceil(nrow / blockdim);
+
+            c.format   = BCSR;
+            c.blockdim = blockdim;
+            c.bytes    = nnzb * (blockdim * blockdim * val_size + idx_size)
+                      + (nrowb + 1) * idx_size + vec;
+            candidates->push_back(c);
+        }
+
+        // SELL pads within slices only, it is not rated better than CSR
+        if(host == true)
+        {
+            c.format   = SELL;
+            c.blockdim = 1;
+            c.bytes    = candidates->front().bytes;
+            candidates->push_back(c);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::AutoFormat(bool benchmark)
+    {
+        log_debug(this, "LocalMatrix::AutoFormat()", benchmark);
+
+        // Number of timed matrix-vector products per candidate
+        const int num_apply = 10;
+
+        // A format is only preferred over CSR if it is estimated to save this fraction
+        const double min_saving = 0.1;
+
+        // Format decisions per matrix signature (host, benchmark, pattern hash, nrow,
+        // ncol, nnz)
+        typedef std::tuple<bool, bool, uint64_t, int64_t, int64_t, int64_t> Signature;
+
+        static std::map<Signature, std::pair<unsigned int, int>> cache;
+        static std::mutex                                        cache_mutex;
+
+        if(this->GetNnz() == 0)
+        {
+            return;
+        }
+
+        MatrixSparsityInfo info;
+        this->GetSparsityInfo(&info);
+
+        bool host = this->is_host_();
+
+        Signature key(host, benchmark, info.pattern_hash, info.nrow, info.ncol, info.nnz);
+
+        unsigned int format   = CSR;
+        int          blockdim = 1;
+        bool         cached   = false;
+
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+
+            typename std::map<Signature, std::pair<unsigned int, int>>::const_iterator it
+                = cache.find(key);
+
+            if(it != cache.end())
+            {
+                format   = it->second.first;
+                blockdim = it->second.second;
+                cached   = true;
+            }
+        }
+
+        if(cached == false)
+        {
+            std::vector<AutoFormatCandidate> candidates;
+            auto_format_candidates<ValueType>(info, host, &candidates);
+
+            double csr_bytes = candidates[0].bytes;
+
+            if(benchmark == false)
+            {
+                double best = (1.0 - min_saving) * csr_bytes;
+
+                for(size_t i = 1; i < candidates.size(); ++i)
+                {
+                    if(candidates[i].bytes < best)
+                    {
+                        best     = candidates[i].bytes;
+                        format   = candidates[i].format;
+                        blockdim = candidates[i].blockdim;
+                    }
+                }
+            }
+            else
+            {
+                LocalVector<ValueType> x;
+                LocalVector<ValueType> y;
+
+                x.CloneBackend(*this);
+                y.CloneBackend(*this);
+
+                x.Allocate("x", this->GetN());
+                y.Allocate("y", this->GetM());
+
+                x.Ones();
+
+                double best = std::numeric_limits<double>::max();
+
+                for(size_t i = 0; i < candidates.size(); ++i)
+                {
+                    // Skip formats that are rated much worse than CSR
+                    if(candidates[i].bytes > 1.5 * csr_bytes)
+                    {
+                        continue;
+                    }
+
+                    LocalMatrix<ValueType> mat;
+                    mat.CloneFrom(*this);
+                    mat.ConvertTo(candidates[i].format, candidates[i].blockdim);
+
+                    // Conversion failed
+                    if(mat.GetFormat() != candidates[i].format)
+                    {
+                        continue;
+                    }
+
+                    // Warm up
+                    mat.Apply(x, &y);
+
+                    double time = rocalution_time();
+
+                    for(int k = 0; k < num_apply; ++k)
+                    {
+                        mat.Apply(x, &y);
+                    }
+
+                    time = (rocalution_time() - time) / num_apply;
 
-                    LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ConvertTo() is performed on the host");
-                }
-                else
-                {
-                    delete this->matrix_accel_;
+                    LOG_VERBOSE_INFO(4,
+                                     "LocalMatrix::AutoFormat() "
+                                         << _matrix_format_names[candidates[i].format] << " "
+                                         << time << " usec");
 
-                    this->matrix_accel_ = new_mat;
-                    this->matrix_       = this->matrix_accel_;
+                    if(time < best)
+                    {
+                        best     = time;
+                        format   = candidates[i].format;
+                        blockdim = candidates[i].blockdim;
+                    }
                 }
             }
 
-            assert(this->GetFormat() == matrix_format || this->GetFormat() == CSR);
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            cache[key] = std::make_pair(format, blockdim);
+        }
+
+        LOG_VERBOSE_INFO(4,
+                         "LocalMatrix::AutoFormat() selected "
+                             << _matrix_format_names[format] << (cached ? " (cached)" : ""));
+
+        // ConvertTo() does not change the block dimension of a BCSR matrix
+        if(this->GetFormat() == BCSR && this->GetBlockDimension() != blockdim)
+        {
+            this->ConvertToCSR();
         }
+
+        this->ConvertTo(format, blockdim);
     }
 
     template <typename ValueType>
@@ -2156,6 +2665,8 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::Apply()", (const void*&)in, out);
 
+        ProfileRegion region(ProfilePhase_SpMV);
+
         assert(out != NULL);
 
 #ifdef DEBUG_MODE
@@ -2181,6 +2692,155 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::Apply(const LocalMultiVector<ValueType>& in,
+                                       LocalMultiVector<ValueType>*       out) const
+    {
+        log_debug(this, "LocalMatrix::Apply()", (const void*&)in, out);
+
+        ProfileRegion region(ProfilePhase_SpMV);
+
+        assert(out != NULL);
+        assert(in.GetSize() == this->GetN());
+        assert(out->GetSize() == this->GetM());
+        assert(in.GetNumVectors() == out->GetNumVectors());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(in.GetNumVectors() == 0)
+        {
+            return;
+        }
+
+        assert(((this->matrix_ == this->matrix_host_) && (in.vec_.vector_ == in.vec_.vector_host_)
+                && (out->vec_.vector_ == out->vec_.vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (in.vec_.vector_ == in.vec_.vector_accel_)
+                   && (out->vec_.vector_ == out->vec_.vector_accel_)));
+
+        if(this->GetNnz() > 0)
+        {
+            if(this->matrix_->ApplyMulti(*in.vec_.vector_, in.GetNumVectors(), out->vec_.vector_)
+               == false)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::Apply() is performed column by column "
+                                 "for multi-vectors in this format");
+
+                LocalVector<ValueType> x;
+                LocalVector<ValueType> y;
+
+                x.CloneBackend(*this);
+                y.CloneBackend(*this);
+
+                x.Allocate("x", this->GetN());
+                y.Allocate("y", this->GetM());
+
+                for(int j = 0; j < in.GetNumVectors(); ++j)
+                {
+                    in.GetColumn(j, &x);
+                    this->Apply(x, &y);
+                    out->SetColumn(j, y);
+                }
+            }
+        }
+        else
+        {
+            // If matrix is empty, but not a 0x0 matrix, output vectors need to be set to zero
+            out->vec_.vector_->Zeros();
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::Residual(const LocalVector<ValueType>& rhs,
+                                          const LocalVector<ValueType>& x,
+                                          LocalVector<ValueType>*       res) const
+    {
+        log_debug(this, "LocalMatrix::Residual()", (const void*&)rhs, (const void*&)x, res);
+
+        assert(res != NULL);
+        assert(rhs.GetSize() == this->GetM());
+        assert(x.GetSize() == this->GetN());
+        assert(res->GetSize() == this->GetM());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            assert(((this->matrix_ == this->matrix_host_) && (rhs.vector_ == rhs.vector_host_)
+                    && (x.vector_ == x.vector_host_) && (res->vector_ == res->vector_host_))
+                   || ((this->matrix_ == this->matrix_accel_)
+                       && (rhs.vector_ == rhs.vector_accel_) && (x.vector_ == x.vector_accel_)
+                       && (res->vector_ == res->vector_accel_)));
+
+            ProfileRegion region(ProfilePhase_SpMV);
+
+            if(this->matrix_->Residual(*rhs.vector_, *x.vector_, res->vector_) == true)
+            {
+                return;
+            }
+
+            // Product and update
+            this->matrix_->Apply(*x.vector_, res->vector_);
+        }
+        else
+        {
+            res->vector_->Zeros();
+        }
+
+        res->ScaleAdd(static_cast<ValueType>(-1), rhs);
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ResidualRestrict(const LocalVector<ValueType>& rhs,
+                                                  const LocalVector<ValueType>& x,
+                                                  const Operator<ValueType>&    R,
+                                                  LocalVector<ValueType>*       res,
+                                                  LocalVector<ValueType>*       res_coarse) const
+    {
+        log_debug(this,
+                  "LocalMatrix::ResidualRestrict()",
+                  (const void*&)rhs,
+                  (const void*&)x,
+                  (const void*&)R,
+                  res,
+                  res_coarse);
+
+        assert(res != NULL);
+        assert(res_coarse != NULL);
+        assert(rhs.GetSize() == this->GetM());
+        assert(x.GetSize() == this->GetN());
+        assert(R.GetN() == this->GetM());
+        assert(res_coarse->GetSize() == R.GetM());
+
+        const LocalMatrix<ValueType>* cast_R = dynamic_cast<const LocalMatrix<ValueType>*>(&R);
+
+        // Fused for host CSR matrices with aggregation based restriction
+        if(cast_R != NULL && this->GetNnz() > 0 && cast_R->GetNnz() > 0
+           && cast_R->GetNnz() <= this->GetM() && this->GetFormat() == CSR
+           && cast_R->GetFormat() == CSR && this->is_host_() == true
+           && cast_R->is_host_() == true && rhs.vector_ == rhs.vector_host_
+           && x.vector_ == x.vector_host_ && res_coarse->vector_ == res_coarse->vector_host_)
+        {
+            ProfileRegion region(ProfilePhase_SpMV);
+
+            if(this->matrix_->ResidualRestrict(
+                   *rhs.vector_, *x.vector_, *cast_R->matrix_, res_coarse->vector_)
+               == true)
+            {
+                return;
+            }
+        }
+
+        // Residual and restriction
+        this->Residual(rhs, x, res);
+        R.Apply(*res, res_coarse);
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::ApplyAdd(const LocalVector<ValueType>& in,
                                           ValueType                     scalar,
@@ -2188,6 +2848,8 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::ApplyAdd()", (const void*&)in, scalar, out);
 
+        ProfileRegion region(ProfilePhase_SpMV);
+
         assert(out != NULL);
 
 #ifdef DEBUG_MODE
@@ -3733,24 +4395,41 @@ namespace rocalution
                 bool is_accel = this->is_accel_();
                 this->MoveToHost();
 
-                // Convert to CSR
                 unsigned int format   = this->GetFormat();
                 int          blockdim = this->GetBlockDimension();
-                this->ConvertToCSR();
 
-                if(this->matrix_->ILU0Factorize() == false)
+                // Block ILU(0) factors have their own layout, a CSR factorization that is
+                // converted back to BCSR cannot be used by the BCSR triangular solves
+                if(format == BCSR)
                 {
-                    LOG_INFO("Computation of LocalMatrix::ILU0Factorize() failed");
-                    this->Info();
-                    FATAL_ERROR(__FILE__, __LINE__);
+                    if(this->matrix_->ILU0Factorize() == false)
+                    {
+                        LOG_INFO("LocalMatrix::ILU0Factorize() in BCSR format requires sorted "
+                                 "block rows with a diagonal block");
+                        this->Info();
+                        FATAL_ERROR(__FILE__, __LINE__);
+                    }
                 }
-
-                if(format != CSR)
+                else
                 {
-                    LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ILU0Factorize() is performed in CSR format");
+                    // Convert to CSR
+                    this->ConvertToCSR();
 
-                    this->ConvertTo(format, blockdim);
+                    if(this->matrix_->ILU0Factorize() == false)
+                    {
+                        LOG_INFO("Computation of LocalMatrix::ILU0Factorize() failed");
+                        this->Info();
+                        FATAL_ERROR(__FILE__, __LINE__);
+                    }
+
+                    if(format != CSR)
+                    {
+                        LOG_VERBOSE_INFO(
+                            2,
+                            "*** warning: LocalMatrix::ILU0Factorize() is performed in CSR format");
+
+                        this->ConvertTo(format, blockdim);
+                    }
                 }
 
                 if(is_accel == true)
@@ -4864,6 +5543,75 @@ namespace rocalution
         permutation->object_name_ = vec_name;
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::LocalityOrder(LocalVector<int>* permutation, int window) const
+    {
+        log_debug(this, "LocalMatrix::LocalityOrder()", permutation, window);
+
+        assert(permutation != NULL);
+        assert(window > 0);
+
+        assert(((this->matrix_ == this->matrix_host_)
+                && (permutation->vector_ == permutation->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (permutation->vector_ == permutation->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->LocalityOrder(permutation->vector_, window);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::LocalityOrder() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                // Move to host
+                permutation->MoveToHost();
+
+                // Convert to CSR
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->LocalityOrder(permutation->vector_, window) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::LocalityOrder() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2,
+                        "*** warning: LocalMatrix::LocalityOrder() is performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2,
+                        "*** warning: LocalMatrix::LocalityOrder() is performed on the host");
+
+                    permutation->MoveToAccelerator();
+                }
+            }
+        }
+
+        std::string vec_name      = "LocalityOrder permutation of " + this->object_name_;
+        permutation->object_name_ = vec_name;
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::SymbolicPower(int p)
     {
@@ -5514,13 +6262,15 @@ namespace rocalution
     template <typename ValueType>
     void LocalMatrix<ValueType>::TripleMatrixProduct(const LocalMatrix<ValueType>& R,
                                                      const LocalMatrix<ValueType>& A,
-                                                     const LocalMatrix<ValueType>& P)
+                                                     const LocalMatrix<ValueType>& P,
+                                                     bool                          reuse)
     {
         log_debug(this,
                   "LocalMatrix::TripleMatrixProduct()",
                   (const void*&)R,
                   (const void*&)A,
-                  (const void*&)P);
+                  (const void*&)P,
+                  reuse);
 
         assert(&R != this);
         assert(&A != this);
@@ -5569,13 +6319,46 @@ namespace rocalution
         unsigned int format   = this->GetFormat();
         int          blockdim = this->GetBlockDimension();
 
-        this->ConvertToCSR();
+        // Try to recompute the values only, using the current structure of this
+        bool computed = false;
+
+        if(reuse == true && format == CSR && this->GetNnz() > 0)
+        {
+            computed = this->matrix_->NumericTripleMatrixProduct(
+                *R_ptr->matrix_, *A_ptr->matrix_, *P_ptr->matrix_);
+
+            if(computed == false)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::TripleMatrixProduct() structure "
+                                 "cannot be reused");
+            }
+        }
+
+        if(computed == false)
+        {
+            this->ConvertToCSR();
+
+            // Fused product without intermediate matrix
+            if(this->matrix_->SymbolicTripleMatrixProduct(
+                   *R_ptr->matrix_, *A_ptr->matrix_, *P_ptr->matrix_)
+               == true)
+            {
+                computed = this->matrix_->NumericTripleMatrixProduct(
+                    *R_ptr->matrix_, *A_ptr->matrix_, *P_ptr->matrix_);
 
-        LocalMatrix<ValueType> tmp;
-        tmp.CloneBackend(*this);
+                assert(computed == true);
+            }
+        }
+
+        if(computed == false)
+        {
+            LocalMatrix<ValueType> tmp;
+            tmp.CloneBackend(*this);
 
-        tmp.MatrixMult(*R_ptr, *A_ptr);
-        this->MatrixMult(tmp, *P_ptr);
+            tmp.MatrixMult(*R_ptr, *A_ptr);
+            this->MatrixMult(tmp, *P_ptr);
+        }
 
         if(format != CSR || R.GetFormat() != CSR || A.GetFormat() != CSR || P.GetFormat() != CSR)
         {
@@ -7019,6 +7802,75 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::RSPMISCoarsening()", eps, CFmap, S);
 
+        this->RSPMISCoarsening_(eps, false, CFmap, S);
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSHMISCoarsening(float              eps,
+                                                  LocalVector<int>*  CFmap,
+                                                  LocalVector<bool>* S) const
+    {
+        log_debug(this, "LocalMatrix::RSHMISCoarsening()", eps, CFmap, S);
+
+        this->RSPMISCoarsening_(eps, true, CFmap, S);
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSHMISFirstPass_(LocalVector<int>*        CFmap,
+                                                  const LocalVector<bool>& S) const
+    {
+        log_debug(this, "LocalMatrix::RSHMISFirstPass_()", CFmap, (const void*&)S);
+
+        assert(CFmap != NULL);
+        assert(this->GetFormat() == CSR);
+        assert(this->is_host_() == CFmap->is_host_());
+        assert(this->is_host_() == S.is_host_());
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->RSHMISFirstPass(CFmap->vector_, *S.vector_);
+
+            if((err == false) && (this->is_host_() == true))
+            {
+                LOG_INFO("Computation of LocalMatrix::RSHMISCoarsening() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.CopyFrom(*this);
+
+                LocalVector<bool> S_host;
+                S_host.Allocate("S", S.GetSize());
+                S_host.CopyFrom(S);
+
+                // Move to host
+                CFmap->MoveToHost();
+
+                if(mat_host.matrix_->RSHMISFirstPass(CFmap->vector_, *S_host.vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::RSHMISCoarsening() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                LOG_VERBOSE_INFO(
+                    2,
+                    "*** warning: LocalMatrix::RSHMISCoarsening() first pass is performed on the host");
+
+                CFmap->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSPMISCoarsening_(float              eps,
+                                                   bool               hmis,
+                                                   LocalVector<int>*  CFmap,
+                                                   LocalVector<bool>* S) const
+    {
         assert(eps < 1.0f);
         assert(eps > 0.0f);
         assert(CFmap != NULL);
@@ -7073,6 +7925,17 @@ namespace rocalution
             // Mark all vertices as undecided
             CFmap->Zeros();
 
+            // HMIS starts with the coarse vertices of a block wise Ruge Stueben splitting,
+            // which are then augmented by PMIS
+            if(hmis == true)
+            {
+                csr_ptr->RSHMISFirstPass_(CFmap, *S);
+
+                // Mark undecided vertices that strongly depend on a coarse vertex as fine
+                csr_ptr->matrix_->RSPMISCoarseEdgesToFine(
+                    CFmap->vector_, *S->vector_, *zero.matrix_);
+            }
+
             LocalVector<bool> marked;
             marked.CloneBackend(*this);
             marked.Allocate("marked coarse", csr_ptr->GetM());
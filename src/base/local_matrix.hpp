@@ -41,6 +41,8 @@ namespace rocalution
     template <typename ValueType>
     class LocalVector;
     template <typename ValueType>
+    class LocalMultiVector;
+    template <typename ValueType>
     class GlobalVector;
 
     template <typename ValueType>
@@ -57,7 +59,7 @@ namespace rocalution
   * \tparam ValueType - can be int, float, double, std::complex<float> and
   *                     std::complex<double>
   *
-  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, and DENSE.
+  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, SELL, and DENSE.
   * \note For CSR type matrices, the column indices must be sorted in increasing order. For COO matrices, the row
   * indices must be sorted in increasing order. The function \p Check can be used to check whether a matrix
   * contains valid data. For CSR and COO matrices, the function \p Sort can be used to sort the row or column
@@ -355,6 +357,11 @@ namespace rocalution
         /** \brief Create permutation vector for CMK reordering of the matrix
       * \details
       * The Cuthill-McKee ordering minimize the bandwidth of a given sparse matrix.
+      * On the host, a sequential breadth-first search or a parallel level synchronous
+      * search on the symmetrized sparsity pattern \f$|A| + |A^T|\f$, starting from
+      * pseudo-peripheral nodes, is performed, see set_omp_parallel_ordering_rocalution().
+      * The bandwidth and profile before and after reordering are reported at verbose
+      * level 4, see also GetSparsityInfo().
       *
       * @param[out]
       * permutation permutation vector for CMK reordering
@@ -408,10 +415,40 @@ namespace rocalution
         ROCALUTION_EXPORT
         void ConnectivityOrder(LocalVector<int>* permutation) const;
 
+        /** \brief Create permutation vector for a cache-oriented reordering of the matrix
+      * \details
+      * Locality ordering is a greedy graph ordering (Gorder), that places vertices
+      * with many common neighbors close to each other. Each next row is chosen to
+      * maximize the number of neighbors and siblings (rows sharing a neighbor) among
+      * the last \p window rows, such that the entries of the vector accessed by
+      * consecutive rows of a matrix-vector product are likely to be found in cache.
+      * In contrast to the Cuthill-McKee ordering, it does not target the bandwidth.
+      * The ordering is computed sequentially on the host, on the symmetrized sparsity
+      * pattern, and is more expensive than RCMK(). The bandwidth and profile before
+      * and after reordering are reported at verbose level 4.
+      *
+      * @param[out]
+      * permutation permutation vector for locality reordering
+      * @param[in]
+      * window      number of previously placed rows that are considered.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalVector<int> perm;
+      *
+      *   mat.LocalityOrder(&perm);
+      *   mat.Permute(perm);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void LocalityOrder(LocalVector<int>* permutation, int window = 5) const;
+
         /** \brief Perform multi-coloring decomposition of the matrix
       * \details
       * The Multi-Coloring algorithm builds a permutation (coloring of the matrix) in a
       * way such that no two adjacent nodes in the sparse matrix have the same color.
+      * On the host, a parallel or the sequential greedy coloring is performed, see
+      * set_omp_parallel_coloring_rocalution().
       *
       * @param[out]
       * num_colors  number of colors
@@ -437,6 +474,8 @@ namespace rocalution
       * \details
       * The Maximal Independent Set algorithm finds a set with maximal size, that
       * contains elements that do not depend on other elements in this set.
+      * On the host, a parallel or the sequential greedy algorithm is performed, see
+      * set_omp_parallel_coloring_rocalution().
       *
       * @param[out]
       * size        number of independent sets
@@ -709,6 +748,40 @@ namespace rocalution
         ROCALUTION_EXPORT
         void ReadFileCSR(const std::string& filename);
 
+        /** \brief Map matrix from CSR (rocALUTION binary format) file
+      * \details
+      * Load a CSR matrix from binary file, see ReadFileCSR(). Instead of reading the
+      * file into newly allocated arrays, the file is mapped into host memory and the
+      * arrays of the matrix are taken directly from the mapping, if their precision and
+      * alignment match. Arrays that do not match (e.g. single precision values, which are
+      * stored in double precision) are converted into newly allocated arrays. Loading a
+      * matrix that resides in the page cache is therefore almost instantaneous.
+      *
+      * The arrays are stored without padding. Double precision values of a file written
+      * by WriteFileCSR() are aligned, and thus taken from the mapping, only if the number
+      * of rows plus the number of non-zero entries is odd. is_host_mapping() tells which
+      * path has been taken.
+      *
+      * The mapping is private, the file is never modified. Pages that are modified by
+      * the matrix are copied on write.
+      *
+      * \note
+      * Memory mapping is available for Unix-like OS only, otherwise the file is read.
+      * Arrays obtained from the matrix (e.g. by LeaveDataPtrCSR()) must be released with
+      * free_host().
+      *
+      * @param[in]
+      * filename    name of the file containing the data.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalMatrix<ValueType> mat;
+      *   mat.MapFileCSR("my_matrix.csr");
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void MapFileCSR(const std::string& filename);
+
         /** \brief Read a matrix from a binary file using rocsparse I/O format
         * \details
         * Read a matrix from a binary file using rocsparse I/O format.
@@ -806,6 +879,37 @@ namespace rocalution
         ROCALUTION_EXPORT
         void WriteFileRSIO(const std::string& filename) const;
 
+        /** \brief Write a matrix to a compressed binary file using rocsparse I/O format
+        * \details
+        * Write a matrix to a binary file using the compressed CSR variant of the rocsparse
+        * I/O format. Column indices are delta and varint encoded row by row, values are
+        * optionally byte-shuffled and LZ compressed. The matrix is split into blocks of
+        * rows that are encoded and decoded in parallel. Files are read back with
+        * ReadFileRSIO().
+        *
+        * Matrices that are not in CSR format are converted on the host prior to writing.
+        *
+        * @param[in]
+        * filename        name of the file to write the data to.
+        * @param[in]
+        * compress_val    compress the values in addition to the column indices.
+        *
+        * \par Example
+        * \code{.cpp}
+        *   LocalMatrix<ValueType> mat;
+        *
+        *   // Allocate and fill mat
+        *   // ...
+        *
+        *   mat.WriteFileRSIOCompressed("my_matrix.rsio");
+        *
+        *   LocalMatrix<ValueType> mat2;
+        *   mat2.ReadFileRSIO("my_matrix.rsio");
+        * \endcode
+        */
+        ROCALUTION_EXPORT
+        void WriteFileRSIOCompressed(const std::string& filename, bool compress_val = true) const;
+
         /** \brief Move all data (i.e. move the matrix) to the accelerator */
         ROCALUTION_EXPORT
         virtual void MoveToAccelerator(void);
@@ -961,7 +1065,12 @@ namespace rocalution
         /** \brief Convert the matrix to MCSR structure */
         ROCALUTION_EXPORT
         void ConvertToMCSR(void);
-        /** \brief Convert the matrix to BCSR structure */
+        /** \brief Convert the matrix to BCSR structure
+        * \details
+        * If \p blockdim is zero or negative, the block dimension is detected with
+        * DetectBlockDimension(). If no block structure is detected, the matrix format is
+        * kept.
+        */
         ROCALUTION_EXPORT
         void ConvertToBCSR(int blockdim);
         /** \brief Convert the matrix to COO structure */
@@ -979,10 +1088,86 @@ namespace rocalution
         /** \brief Convert the matrix to DENSE structure */
         ROCALUTION_EXPORT
         void ConvertToDENSE(void);
+        /** \brief Convert the matrix to SELL-C-sigma structure
+        * \details
+        * The sliced ELL format groups rows into slices, that are sorted by their length
+        * and padded to the longest row of each slice. SELL is a host only format, on the
+        * accelerator the matrix is kept in CSR format.
+        */
+        ROCALUTION_EXPORT
+        void ConvertToSELL(void);
         /** \brief Convert the matrix to specified matrix ID format */
         ROCALUTION_EXPORT
         void ConvertTo(unsigned int matrix_format, int blockdim = 1);
 
+        /** \brief Compute sparsity statistics of the matrix
+        * \details
+        * Gathers the row length distribution, the number of occupied diagonals, the
+        * fill of dense blocks for block dimensions 2 to 8 and a hash of the sparsity
+        * pattern, see MatrixSparsityInfo. This requires about eight passes over the
+        * sparsity pattern: one for the row statistics, the diagonals and the hash, one
+        * for the bandwidth and one for each block dimension.
+        *
+        * @param[out]
+        * info  sparsity statistics of the matrix.
+        */
+        ROCALUTION_EXPORT
+        void GetSparsityInfo(MatrixSparsityInfo* info) const;
+
+        /** \brief Detect the block dimension of a multi-DOF matrix
+        * \details
+        * Returns the largest block dimension between 2 and 8 that divides the matrix
+        * size and for which the dense blocks covering the sparsity pattern are filled
+        * by at least \p min_fill (see MatrixSparsityInfo::block_fill), or 1 if there
+        * is no such block dimension. The result can be passed to ConvertToBCSR().
+        *
+        * @param[in]
+        * min_fill  minimum fill of the blocks, in (0, 1].
+        *
+        * \par Example
+        * \code{.cpp}
+        *   int blockdim = mat.DetectBlockDimension();
+        *
+        *   if(blockdim > 1)
+        *   {
+        *       mat.ConvertToBCSR(blockdim);
+        *   }
+        * \endcode
+        */
+        ROCALUTION_EXPORT
+        int DetectBlockDimension(double min_fill = 0.9) const;
+
+        /** \brief Convert the matrix to the format that is expected to give the fastest
+        * matrix-vector product
+        * \details
+        * The candidate formats are rated by the number of bytes a matrix-vector
+        * product moves in each format, estimated from the sparsity statistics of the
+        * matrix (see GetSparsityInfo()). A format other than CSR is only selected, if
+        * it saves at least 10%. If \p benchmark is true, Apply() is timed instead for
+        * each candidate that is not rated much worse than CSR, which requires a
+        * temporary copy of the matrix. The decision is cached per matrix signature
+        * (sparsity pattern, size, backend and value type). The sparsity statistics are
+        * computed on every call, as the signature depends on them, but subsequent calls
+        * on matrices with the same structure skip the rating and the timing of the
+        * candidates.
+        *
+        * @param[in]
+        * benchmark  time the matrix-vector product of the candidate formats.
+        *
+        * \par Example
+        * \code{.cpp}
+        *   LocalMatrix<ValueType> mat;
+        *   mat.ReadFileMTX("my_matrix.mtx");
+        *   mat.MoveToAccelerator();
+        *
+        *   mat.AutoFormat(true);
+        *   std::cout << "Selected format: " << _matrix_format_names[mat.GetFormat()]
+        *             << std::endl;
+        * \endcode
+        */
+        ROCALUTION_EXPORT
+        void AutoFormat(bool benchmark = false);
+
         /** \brief Perform matrix-vector multiplication, out = this * in;
       * \par Example
       * \code{.cpp}
@@ -1028,6 +1213,69 @@ namespace rocalution
                               ValueType                     scalar,
                               LocalVector<ValueType>*       out) const;
 
+        /** \brief Perform matrix-multi-vector multiplication, out_j = this * in_j;
+      * \details
+      * All vectors are multiplied within a single pass over the matrix (SpMM). Formats
+      * without a dedicated multi-vector kernel fall back to one matrix-vector product per
+      * vector.
+      * \par Example
+      * \code{.cpp}
+      * // rocALUTION structures
+      * LocalMatrix<T> A;
+      * LocalMultiVector<T> X;
+      * LocalMultiVector<T> Y;
+      *
+      * // Allocate matrix and four right-hand sides
+      * A.AllocateCSR("my CSR matrix", 456, 100, 100);
+      * X.Allocate("X", A.GetN(), 4);
+      * Y.Allocate("Y", A.GetM(), 4);
+      *
+      * // Fill data in A matrix and X multi-vector
+      *
+      * A.Apply(X, &Y);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        virtual void Apply(const LocalMultiVector<ValueType>& in,
+                           LocalMultiVector<ValueType>*       out) const;
+
+        /** \brief Compute the residual, res = rhs - this * x
+        * \details
+        * Host CSR matrices compute the residual in a single pass over the matrix and the
+        * vectors. Other formats and backends perform a matrix-vector product followed by
+        * a vector update.
+        */
+        ROCALUTION_EXPORT
+        virtual void Residual(const LocalVector<ValueType>& rhs,
+                              const LocalVector<ValueType>& x,
+                              LocalVector<ValueType>*       res) const;
+
+        /** \brief Compute the restricted residual, res_coarse = R * (rhs - this * x)
+        * \details
+        * If this and \p R are host CSR matrices and \p R has at most one entry per fine
+        * row on average (aggregation based restriction), each coarse row computes the
+        * residual of its fine rows on the fly, such that the fine residual is neither
+        * stored nor read back. Otherwise, the residual is computed into \p res and
+        * restricted afterwards. The content of \p res is undefined on return.
+        *
+        * @param[in]
+        * rhs         right-hand side.
+        * @param[in]
+        * x           solution.
+        * @param[in]
+        * R           restriction operator.
+        * @param[inout]
+        * res         workspace of size GetM().
+        * @param[out]
+        * res_coarse  restricted residual.
+        */
+        ROCALUTION_EXPORT
+        virtual void ResidualRestrict(const LocalVector<ValueType>& rhs,
+                                      const LocalVector<ValueType>& x,
+                                      const Operator<ValueType>&    R,
+                                      LocalVector<ValueType>*       res,
+                                      LocalVector<ValueType>*       res_coarse) const;
+
         /** \brief Perform symbolic computation (structure only) of \f$|this|^p\f$ */
         ROCALUTION_EXPORT
         void SymbolicPower(int p);
@@ -1064,10 +1312,18 @@ namespace rocalution
         ROCALUTION_EXPORT
         void DiagonalMatrixMultR(const LocalVector<ValueType>& diag);
 
-        /** \brief Triple matrix product C=RAP */
+        /** \brief Triple matrix product C=RAP
+      * \details
+      * If \p reuse is true and the matrix already holds the product of matrices with the
+      * same structure (e.g. from a previous call with different values), only the values
+      * are recomputed. If the structure does not contain the product, the full product
+      * is computed.
+      */
+        ROCALUTION_EXPORT
         void TripleMatrixProduct(const LocalMatrix<ValueType>& R,
                                  const LocalMatrix<ValueType>& A,
-                                 const LocalMatrix<ValueType>& P);
+                                 const LocalMatrix<ValueType>& P,
+                                 bool                          reuse = false);
 
         /** \brief Compute the spectrum approximation with Gershgorin circles theorem */
         ROCALUTION_EXPORT
@@ -1214,6 +1470,16 @@ namespace rocalution
         /** \brief Parallel maximal independent set coarsening for RS AMG*/
         ROCALUTION_EXPORT
         void RSPMISCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
+        /** \brief Hybrid maximal independent set (HMIS) coarsening for RS AMG
+        * \details
+        * The rows are split into blocks of fixed size and a classical Ruge Stueben
+        * splitting is computed for each block in parallel, using only strong connections
+        * within the block. Its coarse vertices are then augmented by PMIS iterations over
+        * the full matrix. The resulting grids are close to those of RSCoarsening(), while
+        * all steps run in parallel. The result does not depend on the number of threads.
+        */
+        ROCALUTION_EXPORT
+        void RSHMISCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
 
         /** \brief Ruge Stueben Direct Interpolation */
         ROCALUTION_EXPORT
@@ -1332,6 +1598,14 @@ namespace rocalution
         virtual bool is_accel_(void) const;
 
     private:
+        // PMIS coarsening, optionally started from the first pass of HMIS
+        void RSPMISCoarsening_(float              eps,
+                               bool               hmis,
+                               LocalVector<int>*  CFmap,
+                               LocalVector<bool>* S) const;
+        // First pass of HMIS coarsening, falls back to the host if not supported
+        void RSHMISFirstPass_(LocalVector<int>* CFmap, const LocalVector<bool>& S) const;
+
         // Pointer from the base matrix class to the current
         // allocated matrix (host_ or accel_)
         BaseMatrix<ValueType>* matrix_;
@@ -0,0 +1,405 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "local_matrix_assembler.hpp"
+#include "../utils/allocate_free.hpp"
+#include "../utils/def.hpp"
+#include "../utils/log.hpp"
+#include "local_matrix.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // Buffers are not compressed before they hold at least this many entries
+    static const size_t ASSEMBLER_MIN_COMPRESS_SIZE = 1 << 14;
+
+    template <typename ValueType>
+    LocalMatrixAssembler<ValueType>::LocalMatrixAssembler()
+    {
+        log_debug(this, "LocalMatrixAssembler::LocalMatrixAssembler()");
+
+        this->nrow_ = 0;
+        this->ncol_ = 0;
+    }
+
+    template <typename ValueType>
+    LocalMatrixAssembler<ValueType>::~LocalMatrixAssembler()
+    {
+        log_debug(this, "LocalMatrixAssembler::~LocalMatrixAssembler()");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void LocalMatrixAssembler<ValueType>::Clear(void)
+    {
+        log_debug(this, "LocalMatrixAssembler::Clear()");
+
+        std::vector<Buffer>().swap(this->buffers_);
+
+        this->nrow_ = 0;
+        this->ncol_ = 0;
+    }
+
+    template <typename ValueType>
+    void LocalMatrixAssembler<ValueType>::Init(int64_t nrow, int64_t ncol)
+    {
+        log_debug(this, "LocalMatrixAssembler::Init()", nrow, ncol);
+
+        assert(nrow >= 0);
+        assert(ncol >= 0);
+        assert(nrow <= std::numeric_limits<int>::max());
+        assert(ncol <= std::numeric_limits<int>::max());
+
+        this->Clear();
+
+        this->nrow_ = nrow;
+        this->ncol_ = ncol;
+
+#ifdef _OPENMP
+        this->buffers_.resize(omp_get_max_threads());
+#else
+        this->buffers_.resize(1);
+#endif
+
+        for(size_t i = 0; i < this->buffers_.size(); ++i)
+        {
+            this->buffers_[i].compressed_size = 0;
+        }
+    }
+
+    template <typename ValueType>
+    typename LocalMatrixAssembler<ValueType>::Buffer& LocalMatrixAssembler<ValueType>::GetBuffer_(void)
+    {
+#ifdef _OPENMP
+        size_t tid = omp_get_thread_num();
+#else
+        size_t tid = 0;
+#endif
+
+        if(tid >= this->buffers_.size())
+        {
+            LOG_INFO("LocalMatrixAssembler: no buffer for thread " << tid
+                                                                    << ", was Init() called?");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        return this->buffers_[tid];
+    }
+
+    template <typename ValueType>
+    void LocalMatrixAssembler<ValueType>::CompressBufferIfNeeded_(Buffer& buf) const
+    {
+        // Amortized, each compression at least halves the entries added since the last one
+        if(buf.entry.size() >= ASSEMBLER_MIN_COMPRESS_SIZE
+           && buf.entry.size() >= 2 * buf.compressed_size)
+        {
+            this->CompressBuffer_(buf);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrixAssembler<ValueType>::CompressBuffer_(Buffer& buf) const
+    {
+        std::vector<Entry>& e = buf.entry;
+
+        if(e.empty() == true)
+        {
+            return;
+        }
+
+        // Stable, such that duplicates are summed in the order they have been added
+        std::stable_sort(e.begin(), e.end(), [](const Entry& a, const Entry& b) {
+            return (a.row < b.row) || (a.row == b.row && a.col < b.col);
+        });
+
+        size_t n = 0;
+
+        for(size_t i = 1; i < e.size(); ++i)
+        {
+            if(e[i].row == e[n].row && e[i].col == e[n].col)
+            {
+                e[n].val += e[i].val;
+            }
+            else
+            {
+                e[++n] = e[i];
+            }
+        }
+
+        e.resize(n + 1);
+
+        buf.compressed_size = e.size();
+    }
+
+    template <typename ValueType>
+    void LocalMatrixAssembler<ValueType>::Add(int64_t          nnz,
+                                              const int*       row,
+                                              const int*       col,
+                                              const ValueType* val)
+    {
+        assert(nnz >= 0);
+
+        if(nnz == 0)
+        {
+            return;
+        }
+
+        assert(row != NULL);
+        assert(col != NULL);
+        assert(val != NULL);
+
+        Buffer& buf = this->GetBuffer_();
+
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            assert(row[i] >= 0 && row[i] < this->nrow_);
+            assert(col[i] >= 0 && col[i] < this->ncol_);
+
+            Entry e;
+            e.row = row[i];
+            e.col = col[i];
+            e.val = val[i];
+
+            buf.entry.push_back(e);
+        }
+
+        this->CompressBufferIfNeeded_(buf);
+    }
+
+    template <typename ValueType>
+    void LocalMatrixAssembler<ValueType>::AddRows(int64_t          row_begin,
+                                                  int64_t          nrow,
+                                                  const PtrType*   row_offset,
+                                                  const int*       col,
+                                                  const ValueType* val)
+    {
+        assert(row_begin >= 0);
+        assert(nrow >= 0);
+        assert(row_begin + nrow <= this->nrow_);
+
+        if(nrow == 0)
+        {
+            return;
+        }
+
+        assert(row_offset != NULL);
+        assert(row_offset[0] == 0);
+
+        Buffer& buf = this->GetBuffer_();
+
+        buf.entry.reserve(buf.entry.size() + row_offset[nrow]);
+
+        for(int64_t i = 0; i < nrow; ++i)
+        {
+            for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                assert(col[j] >= 0 && col[j] < this->ncol_);
+
+                Entry e;
+                e.row = static_cast<int>(row_begin + i);
+                e.col = col[j];
+                e.val = val[j];
+
+                buf.entry.push_back(e);
+            }
+        }
+
+        this->CompressBufferIfNeeded_(buf);
+    }
+
+    template <typename ValueType>
+    int64_t LocalMatrixAssembler<ValueType>::GetBufferedNnz(void) const
+    {
+        int64_t nnz = 0;
+
+        for(size_t i = 0; i < this->buffers_.size(); ++i)
+        {
+            nnz += this->buffers_[i].entry.size();
+        }
+
+        return nnz;
+    }
+
+    template <typename ValueType>
+    void LocalMatrixAssembler<ValueType>::Finalize(const std::string&      name,
+                                                   LocalMatrix<ValueType>* mat)
+    {
+        log_debug(this, "LocalMatrixAssembler::Finalize()", name, mat);
+
+        assert(mat != NULL);
+
+        int nbuf = static_cast<int>(this->buffers_.size());
+
+        // Sort each buffer by row and column and sum its duplicates
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int b = 0; b < nbuf; ++b)
+        {
+            this->CompressBuffer_(this->buffers_[b]);
+        }
+
+        int64_t nrow = this->nrow_;
+
+        PtrType*   row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+
+        allocate_host(nrow + 1, &row_offset);
+
+        row_offset[0] = 0;
+
+        // Rows are split into contiguous blocks, each thread merges the entries of its
+        // rows from all buffers. The first pass counts the unique columns of each row,
+        // the second pass writes the rows into the final arrays.
+        for(int pass = 0; pass < 2; ++pass)
+        {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+#ifdef _OPENMP
+                int nthreads = omp_get_num_threads();
+                int tid      = omp_get_thread_num();
+#else
+                int nthreads = 1;
+                int tid      = 0;
+#endif
+
+                int row_begin = static_cast<int>(nrow * tid / nthreads);
+                int row_end   = static_cast<int>(nrow * (tid + 1) / nthreads);
+
+                // Current position of this thread in each buffer
+                std::vector<size_t> pos(nbuf);
+
+                for(int b = 0; b < nbuf; ++b)
+                {
+                    const std::vector<Entry>& e = this->buffers_[b].entry;
+
+                    pos[b] = std::lower_bound(e.begin(),
+                                              e.end(),
+                                              row_begin,
+                                              [](const Entry& a, int r) { return a.row < r; })
+                             - e.begin();
+                }
+
+                std::vector<Entry> row_entries;
+
+                for(int i = row_begin; i < row_end; ++i)
+                {
+                    // Gather the row from all buffers, each buffer is sorted and unique
+                    row_entries.clear();
+
+                    for(int b = 0; b < nbuf; ++b)
+                    {
+                        const std::vector<Entry>& e = this->buffers_[b].entry;
+
+                        while(pos[b] < e.size() && e[pos[b]].row == i)
+                        {
+                            row_entries.push_back(e[pos[b]++]);
+                        }
+                    }
+
+                    if(nbuf > 1)
+                    {
+                        std::stable_sort(row_entries.begin(),
+                                         row_entries.end(),
+                                         [](const Entry& a, const Entry& b) {
+                                             return a.col < b.col;
+                                         });
+                    }
+
+                    if(pass == 0)
+                    {
+                        PtrType row_nnz = 0;
+
+                        for(size_t j = 0; j < row_entries.size(); ++j)
+                        {
+                            if(j == 0 || row_entries[j].col != row_entries[j - 1].col)
+                            {
+                                ++row_nnz;
+                            }
+                        }
+
+                        row_offset[i + 1] = row_nnz;
+                    }
+                    else
+                    {
+                        PtrType idx = row_offset[i] - 1;
+
+                        for(size_t j = 0; j < row_entries.size(); ++j)
+                        {
+                            if(j == 0 || row_entries[j].col != row_entries[j - 1].col)
+                            {
+                                ++idx;
+                                col[idx] = row_entries[j].col;
+                                val[idx] = row_entries[j].val;
+                            }
+                            else
+                            {
+                                val[idx] += row_entries[j].val;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if(pass == 0)
+            {
+                for(int64_t i = 0; i < nrow; ++i)
+                {
+                    row_offset[i + 1] += row_offset[i];
+                }
+
+                allocate_host(row_offset[nrow], &col);
+                allocate_host(row_offset[nrow], &val);
+            }
+        }
+
+        int64_t nnz  = row_offset[nrow];
+        int64_t ncol = this->ncol_;
+
+        this->Clear();
+
+        mat->Clear();
+        mat->MoveToHost();
+        mat->SetDataPtrCSR(&row_offset, &col, &val, name, nnz, nrow, ncol);
+    }
+
+    template class LocalMatrixAssembler<double>;
+    template class LocalMatrixAssembler<float>;
+#ifdef SUPPORT_COMPLEX
+    template class LocalMatrixAssembler<std::complex<double>>;
+    template class LocalMatrixAssembler<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_LOCAL_MATRIX_ASSEMBLER_HPP_
+#define ROCALUTION_LOCAL_MATRIX_ASSEMBLER_HPP_
+
+#include "base_rocalution.hpp"
+#include "rocalution/export.hpp"
+#include "rocalution/utils/types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class LocalMatrix;
+
+    /** \ingroup op_vec_module
+  * \class LocalMatrixAssembler
+  * \brief LocalMatrixAssembler class
+  * \details
+  * A LocalMatrixAssembler builds a LocalMatrix incrementally from batches of
+  * (row, column, value) triples or blocks of CSR rows, such that the caller never needs
+  * to hold the full COO or CSR arrays. Each OpenMP thread appends to its own buffer,
+  * thus batches can be added concurrently from within an OpenMP parallel region.
+  * Duplicate entries are summed. Buffers are compressed (sorted and duplicates summed)
+  * whenever they have grown by a factor of two, which bounds their size for typical
+  * finite element assembly, where most entries are added multiple times.
+  *
+  * Finalize() merges all buffers into a sorted CSR matrix with exactly one allocation
+  * per CSR array and hands the arrays to the LocalMatrix.
+  *
+  * \par Example
+  * \code{.cpp}
+  *   LocalMatrixAssembler<ValueType> assembler;
+  *   assembler.Init(nrow, ncol);
+  *
+  *   #pragma omp parallel for
+  *   for(int e = 0; e < nelem; ++e)
+  *   {
+  *       // Element contributions
+  *       assembler.Add(nentries, elem_row, elem_col, elem_val);
+  *   }
+  *
+  *   LocalMatrix<ValueType> mat;
+  *   assembler.Finalize("my matrix", &mat);
+  * \endcode
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> and
+  *                     std::complex<double>
+  */
+    template <typename ValueType>
+    class LocalMatrixAssembler : public RocalutionObj
+    {
+    public:
+        ROCALUTION_EXPORT
+        LocalMatrixAssembler();
+        ROCALUTION_EXPORT
+        virtual ~LocalMatrixAssembler();
+
+        /** \brief Clear (free) all buffers */
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Initialize the assembler for a matrix of given size
+        * \details
+        * One buffer is set up for each OpenMP thread. Previously added entries are
+        * discarded.
+        *
+        * @param[in]
+        * nrow  number of rows of the matrix.
+        * @param[in]
+        * ncol  number of columns of the matrix.
+        */
+        ROCALUTION_EXPORT
+        void Init(int64_t nrow, int64_t ncol);
+
+        /** \brief Add a batch of (row, column, value) triples
+        * \details
+        * Indices are zero based. Entries with the same row and column are summed. The
+        * batch is appended to the buffer of the calling OpenMP thread, thus different
+        * threads of the same parallel region can add entries concurrently. Calls from
+        * threads that are not managed by OpenMP must be serialized.
+        *
+        * @param[in]
+        * nnz   number of entries in the batch.
+        * @param[in]
+        * row   row indices of the entries.
+        * @param[in]
+        * col   column indices of the entries.
+        * @param[in]
+        * val   values of the entries.
+        */
+        ROCALUTION_EXPORT
+        void Add(int64_t nnz, const int* row, const int* col, const ValueType* val);
+
+        /** \brief Add a block of consecutive CSR rows
+        * \details
+        * Same as Add(), with the entries given as a block of rows in CSR format. The row
+        * offsets of the block start at zero.
+        *
+        * @param[in]
+        * row_begin   first row of the block.
+        * @param[in]
+        * nrow        number of rows in the block.
+        * @param[in]
+        * row_offset  row offsets of the block, of size nrow + 1.
+        * @param[in]
+        * col         column indices of the block.
+        * @param[in]
+        * val         values of the block.
+        */
+        ROCALUTION_EXPORT
+        void AddRows(int64_t          row_begin,
+                     int64_t          nrow,
+                     const PtrType*   row_offset,
+                     const int*       col,
+                     const ValueType* val);
+
+        /** \brief Return the number of entries currently held in all buffers */
+        ROCALUTION_EXPORT
+        int64_t GetBufferedNnz(void) const;
+
+        /** \brief Assemble the matrix
+        * \details
+        * Merges all buffers into a CSR matrix with sorted column indices and summed
+        * duplicates, and sets it as data of mat (on the host). The buffers are released
+        * afterwards and the assembler can be re-initialized.
+        *
+        * @param[in]
+        * name  object name of the matrix.
+        * @param[out]
+        * mat   assembled matrix.
+        */
+        ROCALUTION_EXPORT
+        void Finalize(const std::string& name, LocalMatrix<ValueType>* mat);
+
+    private:
+        // Single entry of a buffer
+        struct Entry
+        {
+            int       row;
+            int       col;
+            ValueType val;
+        };
+
+        // Per thread buffer
+        struct Buffer
+        {
+            std::vector<Entry> entry;
+            size_t             compressed_size;
+        };
+
+        // Return the buffer of the calling thread
+        Buffer& GetBuffer_(void);
+        // Compress the buffer, if it has grown sufficiently since its last compression
+        void CompressBufferIfNeeded_(Buffer& buf) const;
+        // Sort the buffer by row and column and sum duplicates
+        void CompressBuffer_(Buffer& buf) const;
+
+        int64_t nrow_;
+        int64_t ncol_;
+
+        std::vector<Buffer> buffers_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_LOCAL_MATRIX_ASSEMBLER_HPP_
@@ -0,0 +1,392 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "local_multi_vector.hpp"
+#include "../utils/def.hpp"
+#include "../utils/log.hpp"
+#include "../utils/profile.hpp"
+#include "backend_manager.hpp"
+#include "base_vector.hpp"
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    LocalMultiVector<ValueType>::LocalMultiVector()
+    {
+        log_debug(this, "LocalMultiVector::LocalMultiVector()");
+
+        this->object_name_ = "";
+
+        this->size_    = 0;
+        this->num_vec_ = 0;
+    }
+
+    template <typename ValueType>
+    LocalMultiVector<ValueType>::~LocalMultiVector()
+    {
+        log_debug(this, "LocalMultiVector::~LocalMultiVector()");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToAccelerator(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToAccelerator()");
+
+        this->vec_.MoveToAccelerator();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToAcceleratorAsync(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToAcceleratorAsync()");
+
+        this->vec_.MoveToAcceleratorAsync();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToHost(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToHost()");
+
+        this->vec_.MoveToHost();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToHostAsync(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToHostAsync()");
+
+        this->vec_.MoveToHostAsync();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Sync(void)
+    {
+        log_debug(this, "LocalMultiVector::Sync()");
+
+        this->vec_.Sync();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::CloneBackend(const BaseRocalution<ValueType>& src)
+    {
+        log_debug(this, "LocalMultiVector::CloneBackend()", (const void*&)src);
+
+        assert(this != &src);
+
+        // The underlying vector carries the actual backend data
+        this->vec_.CloneBackend(src);
+
+        BaseRocalution<ValueType>::CloneBackend(src);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Info(void) const
+    {
+        std::string current_backend_name;
+
+        if(this->is_host_() == true)
+        {
+            current_backend_name = _rocalution_host_name[0];
+        }
+        else
+        {
+            assert(this->is_accel_() == true);
+            current_backend_name = _rocalution_backend_name[this->local_backend_.backend];
+        }
+
+        LOG_INFO("LocalMultiVector"
+                 << " name=" << this->object_name_ << ";"
+                 << " size=" << this->size_ << ";"
+                 << " vectors=" << this->num_vec_ << ";"
+                 << " prec=" << 8 * sizeof(ValueType) << "bit;"
+                 << " host backend={" << _rocalution_host_name[0] << "};"
+                 << " accelerator backend={"
+                 << _rocalution_backend_name[this->local_backend_.backend] << "};"
+                 << " current=" << current_backend_name);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Clear(void)
+    {
+        log_debug(this, "LocalMultiVector::Clear()");
+
+        this->vec_.Clear();
+
+        this->size_    = 0;
+        this->num_vec_ = 0;
+    }
+
+    template <typename ValueType>
+    int64_t LocalMultiVector<ValueType>::GetSize(void) const
+    {
+        return this->size_;
+    }
+
+    template <typename ValueType>
+    int LocalMultiVector<ValueType>::GetNumVectors(void) const
+    {
+        return this->num_vec_;
+    }
+
+    template <typename ValueType>
+    bool LocalMultiVector<ValueType>::Check(void) const
+    {
+        log_debug(this, "LocalMultiVector::Check()");
+
+        return this->vec_.Check();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Allocate(std::string name, int64_t size, int num_vec)
+    {
+        log_debug(this, "LocalMultiVector::Allocate()", name, size, num_vec);
+
+        assert(size >= 0);
+        assert(num_vec >= 0);
+
+        this->Clear();
+
+        this->object_name_ = name;
+
+        this->vec_.Allocate(name, size * num_vec);
+
+        this->size_    = size;
+        this->num_vec_ = num_vec;
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Zeros(void)
+    {
+        log_debug(this, "LocalMultiVector::Zeros()");
+
+        this->vec_.Zeros();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Ones(void)
+    {
+        log_debug(this, "LocalMultiVector::Ones()");
+
+        this->vec_.Ones();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::SetValues(ValueType val)
+    {
+        log_debug(this, "LocalMultiVector::SetValues()", val);
+
+        this->vec_.SetValues(val);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::SetRandomUniform(unsigned long long seed,
+                                                       ValueType          a,
+                                                       ValueType          b)
+    {
+        log_debug(this, "LocalMultiVector::SetRandomUniform()", seed, a, b);
+
+        this->vec_.SetRandomUniform(seed, a, b);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::CopyFrom(const LocalMultiVector<ValueType>& src)
+    {
+        log_debug(this, "LocalMultiVector::CopyFrom()", (const void*&)src);
+
+        assert(this != &src);
+        assert(this->size_ == src.size_);
+        assert(this->num_vec_ == src.num_vec_);
+
+        this->vec_.CopyFrom(src.vec_);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::GetColumn(int j, LocalVector<ValueType>* vec) const
+    {
+        log_debug(this, "LocalMultiVector::GetColumn()", j, vec);
+
+        assert(vec != NULL);
+        assert(j >= 0 && j < this->num_vec_);
+        assert(this->is_host_() == vec->is_host_());
+
+        if(vec->GetSize() != this->size_)
+        {
+            vec->Clear();
+            vec->Allocate(this->object_name_ + " column", this->size_);
+        }
+
+        if(this->size_ > 0)
+        {
+            vec->CopyFrom(this->vec_, j * this->size_, 0, this->size_);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::SetColumn(int j, const LocalVector<ValueType>& vec)
+    {
+        log_debug(this, "LocalMultiVector::SetColumn()", j, (const void*&)vec);
+
+        assert(j >= 0 && j < this->num_vec_);
+        assert(vec.GetSize() == this->size_);
+
+        if(this->size_ > 0)
+        {
+            this->vec_.CopyFrom(vec, 0, j * this->size_, this->size_);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::ScaleAddScale(const ValueType*                   alpha,
+                                                    const LocalMultiVector<ValueType>& x,
+                                                    const ValueType*                   beta)
+    {
+        log_debug(this, "LocalMultiVector::ScaleAddScale()", alpha, (const void*&)x, beta);
+
+        assert(alpha != NULL);
+        assert(beta != NULL);
+        assert(this->size_ == x.size_);
+        assert(this->num_vec_ == x.num_vec_);
+        assert(((this->is_host_() == true) && (x.is_host_() == true))
+               || ((this->is_accel_() == true) && (x.is_accel_() == true)));
+
+        if(this->size_ > 0 && this->num_vec_ > 0)
+        {
+            this->vec_.vector_->ScaleAddScaleBatched(alpha, *x.vec_.vector_, beta, this->num_vec_);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::AddScale(const LocalMultiVector<ValueType>& x,
+                                               const ValueType*                   alpha)
+    {
+        log_debug(this, "LocalMultiVector::AddScale()", (const void*&)x, alpha);
+
+        std::vector<ValueType> one(this->num_vec_, static_cast<ValueType>(1));
+
+        this->ScaleAddScale(one.data(), x, alpha);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::ScaleAdd(const ValueType*                   alpha,
+                                               const LocalMultiVector<ValueType>& x)
+    {
+        log_debug(this, "LocalMultiVector::ScaleAdd()", alpha, (const void*&)x);
+
+        std::vector<ValueType> one(this->num_vec_, static_cast<ValueType>(1));
+
+        this->ScaleAddScale(alpha, x, one.data());
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Scale(const ValueType* alpha)
+    {
+        log_debug(this, "LocalMultiVector::Scale()", alpha);
+
+        std::vector<ValueType> zero(this->num_vec_, static_cast<ValueType>(0));
+
+        this->ScaleAddScale(alpha, *this, zero.data());
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Dot(const LocalMultiVector<ValueType>& x,
+                                          ValueType*                         result) const
+    {
+        log_debug(this, "LocalMultiVector::Dot()", (const void*&)x, result);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        assert(result != NULL);
+        assert(this->size_ == x.size_);
+        assert(this->num_vec_ == x.num_vec_);
+        assert(((this->is_host_() == true) && (x.is_host_() == true))
+               || ((this->is_accel_() == true) && (x.is_accel_() == true)));
+
+        if(this->num_vec_ > 0)
+        {
+            this->vec_.vector_->DotBatched(*x.vec_.vector_, this->num_vec_, result);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::DotNonConj(const LocalMultiVector<ValueType>& x,
+                                                 ValueType*                         result) const
+    {
+        log_debug(this, "LocalMultiVector::DotNonConj()", (const void*&)x, result);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        assert(result != NULL);
+        assert(this->size_ == x.size_);
+        assert(this->num_vec_ == x.num_vec_);
+        assert(((this->is_host_() == true) && (x.is_host_() == true))
+               || ((this->is_accel_() == true) && (x.is_accel_() == true)));
+
+        if(this->num_vec_ > 0)
+        {
+            this->vec_.vector_->DotNonConjBatched(*x.vec_.vector_, this->num_vec_, result);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Norm(ValueType* result) const
+    {
+        log_debug(this, "LocalMultiVector::Norm()", result);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        this->Dot(*this, result);
+
+        for(int j = 0; j < this->num_vec_; ++j)
+        {
+            result[j] = static_cast<ValueType>(std::sqrt(std::real(result[j])));
+        }
+    }
+
+    template <typename ValueType>
+    bool LocalMultiVector<ValueType>::is_host_(void) const
+    {
+        return this->vec_.is_host_();
+    }
+
+    template <typename ValueType>
+    bool LocalMultiVector<ValueType>::is_accel_(void) const
+    {
+        return this->vec_.is_accel_();
+    }
+
+    template class LocalMultiVector<double>;
+    template class LocalMultiVector<float>;
+#ifdef SUPPORT_COMPLEX
+    template class LocalMultiVector<std::complex<double>>;
+    template class LocalMultiVector<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_LOCAL_MULTI_VECTOR_HPP_
+#define ROCALUTION_LOCAL_MULTI_VECTOR_HPP_
+
+#include "base_rocalution.hpp"
+#include "local_vector.hpp"
+#include "rocalution/export.hpp"
+
+#include <string>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class LocalMatrix;
+
+    /** \ingroup op_vec_module
+  * \class LocalMultiVector
+  * \brief LocalMultiVector class
+  * \details
+  * A LocalMultiVector holds a fixed number of vectors of equal size, e.g. the
+  * right-hand sides and solutions of several linear systems that share the same matrix.
+  * The vectors are stored column-major, i.e. one after the other in a single contiguous
+  * LocalVector, such that matrix products and reductions can process all columns within
+  * a single pass over the matrix.
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> and
+  *                     std::complex<double>
+  */
+    template <typename ValueType>
+    class LocalMultiVector : public BaseRocalution<ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        LocalMultiVector();
+        ROCALUTION_EXPORT
+        virtual ~LocalMultiVector();
+
+        /** \brief Move all data (i.e. move the vectors) to the accelerator */
+        ROCALUTION_EXPORT
+        virtual void MoveToAccelerator(void);
+        /** \brief Move all data (i.e. move the vectors) to the accelerator asynchronously */
+        ROCALUTION_EXPORT
+        virtual void MoveToAcceleratorAsync(void);
+        /** \brief Move all data (i.e. move the vectors) to the host */
+        ROCALUTION_EXPORT
+        virtual void MoveToHost(void);
+        /** \brief Move all data (i.e. move the vectors) to the host asynchronously */
+        ROCALUTION_EXPORT
+        virtual void MoveToHostAsync(void);
+        /** \brief Synchronize the vectors */
+        ROCALUTION_EXPORT
+        virtual void Sync(void);
+
+        /** \brief Clone the backend descriptor from another object */
+        ROCALUTION_EXPORT
+        virtual void CloneBackend(const BaseRocalution<ValueType>& src);
+
+        /** \brief Shows simple info about the multi-vector. */
+        ROCALUTION_EXPORT
+        virtual void Info(void) const;
+        /** \brief Clear (free) the multi-vector */
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Return the size of each vector. */
+        ROCALUTION_EXPORT
+        int64_t GetSize(void) const;
+        /** \brief Return the number of vectors. */
+        ROCALUTION_EXPORT
+        int GetNumVectors(void) const;
+
+        /** \brief Perform a sanity check of the multi-vector
+        * \details
+        * Checks, if the multi-vector contains valid data, i.e. if the values are not
+        * infinity and not NaN (not a number).
+        *
+        * \retval true if the multi-vector is ok (empty multi-vector is also ok).
+        * \retval false if there is something wrong with the values.
+        */
+        ROCALUTION_EXPORT
+        bool Check(void) const;
+
+        /** \brief Allocate a local multi-vector with name, size and number of vectors
+      * \details
+      * @param[in]
+      * name    object name
+      * @param[in]
+      * size    number of elements in each vector
+      * @param[in]
+      * num_vec number of vectors
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalMultiVector<ValueType> vec;
+      *
+      *   // Four vectors of size 100
+      *   vec.Allocate("my multi-vector", 100, 4);
+      *   vec.Clear();
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void Allocate(std::string name, int64_t size, int num_vec);
+
+        /** \brief Set the values of all vectors to zero */
+        ROCALUTION_EXPORT
+        void Zeros(void);
+        /** \brief Set the values of all vectors to one */
+        ROCALUTION_EXPORT
+        void Ones(void);
+        /** \brief Set the values of all vectors to given argument */
+        ROCALUTION_EXPORT
+        void SetValues(ValueType val);
+        /** \brief Set the values of all vectors to random uniformly distributed values */
+        ROCALUTION_EXPORT
+        void SetRandomUniform(unsigned long long seed,
+                              ValueType          a = static_cast<ValueType>(-1),
+                              ValueType          b = static_cast<ValueType>(1));
+
+        /** \brief Copy multi-vector from another multi-vector */
+        ROCALUTION_EXPORT
+        void CopyFrom(const LocalMultiVector<ValueType>& src);
+
+        /** \brief Copy the j-th vector into a LocalVector
+      * \details
+      * \p vec is (re-)allocated if its size does not match. Both objects need to reside on
+      * the same backend.
+      */
+        ROCALUTION_EXPORT
+        void GetColumn(int j, LocalVector<ValueType>* vec) const;
+        /** \brief Overwrite the j-th vector with the content of a LocalVector */
+        ROCALUTION_EXPORT
+        void SetColumn(int j, const LocalVector<ValueType>& vec);
+
+        /** \brief Perform the column-wise update this_j = alpha[j]*this_j + beta[j]*x_j */
+        ROCALUTION_EXPORT
+        void ScaleAddScale(const ValueType*                   alpha,
+                           const LocalMultiVector<ValueType>& x,
+                           const ValueType*                   beta);
+        /** \brief Perform the column-wise update this_j = this_j + alpha[j]*x_j */
+        ROCALUTION_EXPORT
+        void AddScale(const LocalMultiVector<ValueType>& x, const ValueType* alpha);
+        /** \brief Perform the column-wise update this_j = alpha[j]*this_j + x_j */
+        ROCALUTION_EXPORT
+        void ScaleAdd(const ValueType* alpha, const LocalMultiVector<ValueType>& x);
+        /** \brief Perform the column-wise scaling this_j = alpha[j]*this_j */
+        ROCALUTION_EXPORT
+        void Scale(const ValueType* alpha);
+
+        /** \brief Compute the column-wise dot products result[j] = this_j^T x_j
+      * \details
+      * All columns are reduced within a single pass over both multi-vectors. \p result
+      * must hold GetNumVectors() entries.
+      */
+        ROCALUTION_EXPORT
+        void Dot(const LocalMultiVector<ValueType>& x, ValueType* result) const;
+        /** \brief Compute the column-wise non-conjugated dot products result[j] = this_j^T x_j */
+        ROCALUTION_EXPORT
+        void DotNonConj(const LocalMultiVector<ValueType>& x, ValueType* result) const;
+        /** \brief Compute the L2 norm of each vector, result[j] = sqrt(this_j^T this_j) */
+        ROCALUTION_EXPORT
+        void Norm(ValueType* result) const;
+
+    protected:
+        /** \brief Return true if the object is on the host */
+        virtual bool is_host_(void) const;
+        /** \brief Return true if the object is on the accelerator */
+        virtual bool is_accel_(void) const;
+
+    private:
+        // Column-major storage of all vectors
+        LocalVector<ValueType> vec_;
+
+        // Size of each vector
+        int64_t size_;
+        // Number of vectors
+        int num_vec_;
+
+        friend class LocalMatrix<ValueType>;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_LOCAL_MULTI_VECTOR_HPP_
@@ -29,6 +29,7 @@
 #include "stencil_types.hpp"
 
 #include "../utils/log.hpp"
+#include "../utils/profile.hpp"
 
 #include <complex>
 
@@ -122,6 +123,8 @@ namespace rocalution
     {
         log_debug(this, "LocalStencil::Apply()", (const void*&)in, out);
 
+        ProfileRegion region(ProfilePhase_SpMV);
+
         assert(out != NULL);
 
         assert(((this->stencil_ == this->stencil_host_) && (in.vector_ == in.vector_host_)
@@ -139,6 +142,8 @@ namespace rocalution
     {
         log_debug(this, "LocalStencil::ApplyAdd()", (const void*&)in, scalar, out);
 
+        ProfileRegion region(ProfilePhase_SpMV);
+
         assert(out != NULL);
 
         assert(((this->stencil_ == this->stencil_host_) && (in.vector_ == in.vector_host_)
@@ -26,6 +26,7 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profile.hpp"
 #include "backend_manager.hpp"
 #include "base_vector.hpp"
 #include "host/host_vector.hpp"
@@ -703,6 +704,66 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    ValueType LocalVector<ValueType>::AddScaleNormSquared(const LocalVector<ValueType>& x,
+                                                          ValueType                     alpha)
+    {
+        log_debug(this, "LocalVector::AddScaleNormSquared()", (const void*&)x, alpha);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        assert(this->GetSize() == x.GetSize());
+        assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
+               || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
+
+        if(this->GetSize() > 0)
+        {
+            return this->vector_->AddScaleNormSquared(*x.vector_, alpha);
+        }
+        else
+        {
+            return static_cast<ValueType>(0);
+        }
+    }
+
+    template <typename ValueType>
+    ValueType LocalVector<ValueType>::AddScalePairNormSquared(const LocalVector<ValueType>& x,
+                                                              ValueType                     alpha,
+                                                              LocalVector<ValueType>*       y,
+                                                              const LocalVector<ValueType>& z,
+                                                              ValueType                     beta)
+    {
+        log_debug(this,
+                  "LocalVector::AddScalePairNormSquared()",
+                  (const void*&)x,
+                  alpha,
+                  y,
+                  (const void*&)z,
+                  beta);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        assert(y != NULL);
+        assert(y != this);
+        assert(this->GetSize() == x.GetSize());
+        assert(this->GetSize() == y->GetSize());
+        assert(this->GetSize() == z.GetSize());
+        assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_)
+                && (y->vector_ == y->vector_host_) && (z.vector_ == z.vector_host_))
+               || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)
+                   && (y->vector_ == y->vector_accel_) && (z.vector_ == z.vector_accel_)));
+
+        if(this->GetSize() > 0)
+        {
+            return this->vector_->AddScalePairNormSquared(
+                *x.vector_, alpha, y->vector_, *z.vector_, beta);
+        }
+        else
+        {
+            return static_cast<ValueType>(0);
+        }
+    }
+
     template <typename ValueType>
     void LocalVector<ValueType>::Scale(ValueType alpha)
     {
@@ -719,6 +780,8 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Dot()", (const void*&)x);
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -738,6 +801,8 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::DotNonConj()", (const void*&)x);
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -752,11 +817,45 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotAsync(int                                  n,
+                                          const LocalVector<ValueType>* const* x,
+                                          const LocalVector<ValueType>* const* y,
+                                          ValueType*                           result)
+    {
+        log_debug(this, "LocalVector::DotAsync()", n, x, y, result);
+
+        ProfileRegion region(ProfilePhase_Reduction);
+
+        assert(n > 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        for(int i = 0; i < n; ++i)
+        {
+            assert(x[i] != NULL);
+            assert(y[i] != NULL);
+
+            result[i] = x[i]->Dot(*y[i]);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotSync(void)
+    {
+        log_debug(this, "LocalVector::DotSync()");
+
+        // Nothing to do, results of DotAsync() are available immediately
+    }
+
     template <typename ValueType>
     ValueType LocalVector<ValueType>::Norm(void) const
     {
         log_debug(this, "LocalVector::Norm()");
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         if(this->GetSize() > 0)
         {
             return this->vector_->Norm();
@@ -772,6 +871,8 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Reduce()");
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         if(this->GetSize() > 0)
         {
             return this->vector_->Reduce();
@@ -825,6 +926,8 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Asum()");
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         if(this->GetSize() > 0)
         {
             return this->vector_->Asum();
@@ -840,6 +943,8 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Amax()", value);
 
+        ProfileRegion region(ProfilePhase_Reduction);
+
         if(this->GetSize() > 0)
         {
             return this->vector_->Amax(value);
@@ -43,6 +43,9 @@ namespace rocalution
     template <typename ValueType>
     class LocalStencil;
 
+    template <typename ValueType>
+    class LocalMultiVector;
+
     /** \ingroup op_vec_module
   * \class LocalVector
   * \brief LocalVector class
@@ -427,6 +430,32 @@ namespace rocalution
                                ValueType                     gamma);
         /**@}*/
 
+        /** \brief Perform fused vector updates and compute the squared \f$L_2\f$ norm
+      * \details
+      * \p AddScaleNormSquared performs the vector update this = this + alpha * x and
+      * returns \f$\|this\|_2^2\f$ of the updated vector. \p AddScalePairNormSquared
+      * performs the two vector updates this = this + alpha * x and y = y + beta * z and
+      * returns \f$\|y\|_2^2\f$ of the updated vector y. Both run in a single sweep over
+      * the involved vectors and are typically used to update the solution and residual
+      * in the inner loop of Krylov subspace solvers.
+      *
+      * \par Example
+      * \code{.cpp}
+      * // x = x + alpha * p, r = r - alpha * q, res = ||r||_2
+      * T res = std::sqrt(x.AddScalePairNormSquared(p, alpha, &r, q, -alpha));
+      * \endcode
+      */
+        /**@{*/
+        ROCALUTION_EXPORT
+        virtual ValueType AddScaleNormSquared(const LocalVector<ValueType>& x, ValueType alpha);
+        ROCALUTION_EXPORT
+        virtual ValueType AddScalePairNormSquared(const LocalVector<ValueType>& x,
+                                                  ValueType                     alpha,
+                                                  LocalVector<ValueType>*       y,
+                                                  const LocalVector<ValueType>& z,
+                                                  ValueType                     beta);
+        /**@}*/
+
         /** \brief Scale vector, this = alpha * this;
       * \par Example
       * \code{.cpp}
@@ -489,6 +518,33 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual ValueType DotNonConj(const LocalVector<ValueType>& x) const;
 
+        /** \brief Perform multiple dot products with a merged reduction
+      * \details
+      * \p DotAsync computes the n dot products \f$result_{i} = x_{i}^{H} y_{i}\f$. For a
+      * LocalVector the results are available on return. The function exists to share
+      * the interface with GlobalVector::DotAsync(), where the global reduction is
+      * non-blocking and has to be completed with DotSync() before the results can be
+      * accessed.
+      *
+      * @param[in]
+      * n       number of dot products.
+      * @param[in]
+      * x       array of \p n pointers to the first operands.
+      * @param[in]
+      * y       array of \p n pointers to the second operands.
+      * @param[out]
+      * result  array of \p n dot products.
+      */
+        /**@{*/
+        ROCALUTION_EXPORT
+        void DotAsync(int                                  n,
+                      const LocalVector<ValueType>* const* x,
+                      const LocalVector<ValueType>* const* y,
+                      ValueType*                           result);
+        ROCALUTION_EXPORT
+        void DotSync(void);
+        /**@}*/
+
         /** \brief Compute L2 (Euclidean) norm of vector
       * \par Example
       * \code{.cpp}
@@ -716,6 +772,7 @@ namespace rocalution
         friend class GlobalVector<ValueType>;
         friend class LocalMatrix<ValueType>;
         friend class GlobalMatrix<ValueType>;
+        friend class LocalMultiVector<ValueType>;
     };
 
 } // namespace rocalution
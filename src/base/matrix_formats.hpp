@@ -31,8 +31,8 @@ namespace rocalution
 {
 
     // Matrix Names
-    const std::string _matrix_format_names[8]
-        = {"DENSE", "CSR", "MCSR", "BCSR", "COO", "DIA", "ELL", "HYB"};
+    const std::string _matrix_format_names[9]
+        = {"DENSE", "CSR", "MCSR", "BCSR", "COO", "DIA", "ELL", "HYB", "SELL"};
 
     // Matrix Enumeration
     enum _matrix_format
@@ -44,7 +44,8 @@ namespace rocalution
         COO   = 4,
         DIA   = 5,
         ELL   = 6,
-        HYB   = 7
+        HYB   = 7,
+        SELL  = 8
     };
 
     // Sparse Matrix - Sparse Compressed Row Format CSR
@@ -148,6 +149,69 @@ namespace rocalution
         MatrixCOO<ValueType, IndexType>        COO;
     };
 
+    // Sparse Matrix - Sliced ELL Format SELL-C-sigma (see SELL_IND for indexing)
+    template <typename ValueType, typename IndexType, typename PointerType = IndexType>
+    struct MatrixSELL
+    {
+        // Number of rows per slice (C)
+        IndexType slice_size;
+
+        // Number of rows that are sorted by length (sigma)
+        IndexType sigma;
+
+        // Number of slices
+        IndexType nslice;
+
+        // Slice offsets (slice ptr)
+        PointerType* slice_offset;
+
+        // Slice row to original row mapping
+        IndexType* perm;
+
+        // Column index
+        IndexType* col;
+
+        // Values
+        ValueType* val;
+    };
+
+    // Sparsity statistics of a matrix (see LocalMatrix::GetSparsityInfo)
+    struct MatrixSparsityInfo
+    {
+        // Matrix size
+        int64_t nrow;
+        int64_t ncol;
+        int64_t nnz;
+
+        // Number of entries per row
+        int64_t min_row_nnz;
+        int64_t max_row_nnz;
+        double  mean_row_nnz;
+        double  stddev_row_nnz;
+
+        // Number of rows with k entries, where 2^(b-1) <= k < 2^b for bucket b > 0,
+        // bucket 0 counts empty rows and the last bucket all longer rows
+        int64_t row_nnz_histogram[32];
+
+        // Number of occupied diagonals
+        int64_t num_diag;
+
+        // True, if all diagonal entries are stored
+        bool full_diag;
+
+        // Ratio of the number of entries to the number of values stored in BCSR format
+        // with block dimension b, at index b - 2 for b = 2, ..., 8
+        double block_fill[7];
+
+        // Hash of the sparsity pattern
+        uint64_t pattern_hash;
+
+        // Bandwidth max |i - j| and profile sum_i (i - min_j j), where the minimum is
+        // taken over all entries (i, j) with j <= i
+        int64_t bandwidth;
+        int64_t profile;
+    };
+
     // Dense Matrix (see DENSE_IND for indexing)
     template <typename ValueType>
     struct MatrixDENSE
@@ -104,6 +104,16 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Operator<ValueType>::Apply(const LocalMultiVector<ValueType>& in,
+                                    LocalMultiVector<ValueType>*       out) const
+    {
+        LOG_INFO("Operator<ValueType>::Apply(const LocalMultiVector<ValueType>& in, "
+                 "LocalMultiVector<ValueType> *out) not implemented for this operator");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     void Operator<ValueType>::Apply(const LocalVector<ValueType>& in,
                                     LocalVector<ValueType>*       out) const
@@ -146,6 +156,46 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Operator<ValueType>::Residual(const LocalVector<ValueType>& rhs,
+                                       const LocalVector<ValueType>& x,
+                                       LocalVector<ValueType>*       res) const
+    {
+        this->Apply(x, res);
+        res->ScaleAdd(static_cast<ValueType>(-1), rhs);
+    }
+
+    template <typename ValueType>
+    void Operator<ValueType>::Residual(const GlobalVector<ValueType>& rhs,
+                                       const GlobalVector<ValueType>& x,
+                                       GlobalVector<ValueType>*       res) const
+    {
+        this->Apply(x, res);
+        res->ScaleAdd(static_cast<ValueType>(-1), rhs);
+    }
+
+    template <typename ValueType>
+    void Operator<ValueType>::ResidualRestrict(const LocalVector<ValueType>& rhs,
+                                               const LocalVector<ValueType>& x,
+                                               const Operator<ValueType>&    R,
+                                               LocalVector<ValueType>*       res,
+                                               LocalVector<ValueType>*       res_coarse) const
+    {
+        this->Residual(rhs, x, res);
+        R.Apply(*res, res_coarse);
+    }
+
+    template <typename ValueType>
+    void Operator<ValueType>::ResidualRestrict(const GlobalVector<ValueType>& rhs,
+                                               const GlobalVector<ValueType>& x,
+                                               const Operator<ValueType>&     R,
+                                               GlobalVector<ValueType>*       res,
+                                               GlobalVector<ValueType>*       res_coarse) const
+    {
+        this->Residual(rhs, x, res);
+        R.Apply(*res, res_coarse);
+    }
+
     template class Operator<double>;
     template class Operator<float>;
 #ifdef SUPPORT_COMPLEX
@@ -38,6 +38,8 @@ namespace rocalution
     class GlobalVector;
     template <typename ValueType>
     class LocalVector;
+    template <typename ValueType>
+    class LocalMultiVector;
 
     /** \ingroup op_vec_module
   * \class Operator
@@ -116,6 +118,53 @@ namespace rocalution
         virtual void ApplyAdd(const GlobalVector<ValueType>& in,
                               ValueType                      scalar,
                               GlobalVector<ValueType>*       out) const;
+
+        /** \brief Apply the operator to all vectors of a multi-vector, out_j = Operator(in_j),
+      * where in and out are local multi-vectors
+      */
+        ROCALUTION_EXPORT
+        virtual void Apply(const LocalMultiVector<ValueType>& in,
+                           LocalMultiVector<ValueType>*       out) const;
+
+        /** \brief Compute the residual, res = rhs - Operator(x), where rhs, x and res are
+      * local vectors
+      */
+        ROCALUTION_EXPORT
+        virtual void Residual(const LocalVector<ValueType>& rhs,
+                              const LocalVector<ValueType>& x,
+                              LocalVector<ValueType>*       res) const;
+
+        /** \brief Compute the residual, res = rhs - Operator(x), where rhs, x and res are
+      * global vectors
+      */
+        ROCALUTION_EXPORT
+        virtual void Residual(const GlobalVector<ValueType>& rhs,
+                              const GlobalVector<ValueType>& x,
+                              GlobalVector<ValueType>*       res) const;
+
+        /** \brief Compute the restricted residual, res_coarse = R(rhs - Operator(x)), where
+      * all vectors are local vectors
+      * \details
+      * \p res is a workspace of the size of \p rhs, its content is undefined on return.
+      */
+        ROCALUTION_EXPORT
+        virtual void ResidualRestrict(const LocalVector<ValueType>& rhs,
+                                      const LocalVector<ValueType>& x,
+                                      const Operator<ValueType>&    R,
+                                      LocalVector<ValueType>*       res,
+                                      LocalVector<ValueType>*       res_coarse) const;
+
+        /** \brief Compute the restricted residual, res_coarse = R(rhs - Operator(x)), where
+      * all vectors are global vectors
+      * \details
+      * \p res is a workspace of the size of \p rhs, its content is undefined on return.
+      */
+        ROCALUTION_EXPORT
+        virtual void ResidualRestrict(const GlobalVector<ValueType>& rhs,
+                                      const GlobalVector<ValueType>& x,
+                                      const Operator<ValueType>&     R,
+                                      GlobalVector<ValueType>*       res,
+                                      GlobalVector<ValueType>*       res_coarse) const;
     };
 
 } // namespace rocalution
@@ -402,6 +402,62 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    ValueType Vector<ValueType>::AddScaleNormSquared(const LocalVector<ValueType>& x,
+                                                     ValueType                     alpha)
+    {
+        LOG_INFO("AddScaleNormSquared(const LocalVector<ValueType>& x, ValueType alpha)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    ValueType Vector<ValueType>::AddScaleNormSquared(const GlobalVector<ValueType>& x,
+                                                     ValueType                      alpha)
+    {
+        LOG_INFO("AddScaleNormSquared(const GlobalVector<ValueType>& x, ValueType alpha)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    ValueType Vector<ValueType>::AddScalePairNormSquared(const LocalVector<ValueType>& x,
+                                                         ValueType                     alpha,
+                                                         LocalVector<ValueType>*       y,
+                                                         const LocalVector<ValueType>& z,
+                                                         ValueType                     beta)
+    {
+        LOG_INFO("AddScalePairNormSquared(const LocalVector<ValueType>& x, ValueType alpha, "
+                 "LocalVector<ValueType>* y, const LocalVector<ValueType>& z, ValueType beta)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        y->Info();
+        z.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    ValueType Vector<ValueType>::AddScalePairNormSquared(const GlobalVector<ValueType>& x,
+                                                         ValueType                      alpha,
+                                                         GlobalVector<ValueType>*       y,
+                                                         const GlobalVector<ValueType>& z,
+                                                         ValueType                      beta)
+    {
+        LOG_INFO("AddScalePairNormSquared(const GlobalVector<ValueType>& x, ValueType alpha, "
+                 "GlobalVector<ValueType>* y, const GlobalVector<ValueType>& z, ValueType beta)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        y->Info();
+        z.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template class Vector<double>;
     template class Vector<float>;
 #ifdef SUPPORT_COMPLEX
@@ -337,6 +337,36 @@ namespace rocalution
                                const GlobalVector<ValueType>& y,
                                ValueType                      gamma);
 
+        /** \brief Perform vector update of type this = this + alpha * x and return the
+      * squared \f$L_2\f$ norm of the updated vector
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType AddScaleNormSquared(const LocalVector<ValueType>& x, ValueType alpha);
+        /** \brief Perform vector update of type this = this + alpha * x and return the
+      * squared \f$L_2\f$ norm of the updated vector
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType AddScaleNormSquared(const GlobalVector<ValueType>& x, ValueType alpha);
+
+        /** \brief Perform vector updates of type this = this + alpha * x and
+      * y = y + beta * z and return the squared \f$L_2\f$ norm of the updated y
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType AddScalePairNormSquared(const LocalVector<ValueType>& x,
+                                                  ValueType                     alpha,
+                                                  LocalVector<ValueType>*       y,
+                                                  const LocalVector<ValueType>& z,
+                                                  ValueType                     beta);
+        /** \brief Perform vector updates of type this = this + alpha * x and
+      * y = y + beta * z and return the squared \f$L_2\f$ norm of the updated y
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType AddScalePairNormSquared(const GlobalVector<ValueType>& x,
+                                                  ValueType                      alpha,
+                                                  GlobalVector<ValueType>*       y,
+                                                  const GlobalVector<ValueType>& z,
+                                                  ValueType                      beta);
+
         /** \brief Perform vector scaling this = alpha * this */
         virtual void Scale(ValueType alpha) = 0;
 
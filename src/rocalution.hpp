@@ -38,9 +38,11 @@
 
 #include "base/global_matrix.hpp"
 #include "base/local_matrix.hpp"
+#include "base/local_matrix_assembler.hpp"
 #include "base/matrix_formats.hpp"
 
 #include "base/global_vector.hpp"
+#include "base/local_multi_vector.hpp"
 #include "base/local_vector.hpp"
 
 #include "base/local_stencil.hpp"
@@ -59,6 +61,7 @@
 #include "solvers/krylov/fgmres.hpp"
 #include "solvers/krylov/gmres.hpp"
 #include "solvers/krylov/idr.hpp"
+#include "solvers/krylov/pipecg.hpp"
 #include "solvers/krylov/qmrcgstab.hpp"
 #include "solvers/mixed_precision.hpp"
 #include "solvers/multigrid/base_amg.hpp"
@@ -82,6 +85,7 @@
 #include "solvers/preconditioners/preconditioner_saddlepoint.hpp"
 
 #include "utils/allocate_free.hpp"
+#include "utils/profile.hpp"
 #include "utils/time_functions.hpp"
 #include "utils/types.hpp"
 
@@ -47,6 +47,7 @@ namespace rocalution
         log_debug(this, "Chebyshev::Chebyshev()");
 
         this->init_lambda_ = false;
+        this->zero_init_   = false;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -115,6 +116,8 @@ namespace rocalution
     {
         log_debug(this, "Chebyshev::Build()");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -195,6 +198,22 @@ namespace rocalution
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Chebyshev<OperatorType, VectorType, ValueType>::SolveZeroSol(const VectorType& rhs,
+                                                                      VectorType*       x)
+    {
+        log_debug(this, "Chebyshev::SolveZeroSol()", (const void*&)rhs, x);
+
+        assert(x != NULL);
+
+        // With x = 0, the initial residual is rhs and its SpMV can be skipped
+        x->Zeros();
+
+        this->zero_init_ = true;
+        this->Solve(rhs, x);
+        this->zero_init_ = false;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void Chebyshev<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
     {
@@ -253,8 +272,14 @@ namespace rocalution
         ValueType c = (this->lambda_max_ - this->lambda_min_) / two;
 
         // initial residual = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        if(this->zero_init_ == true)
+        {
+            r->CopyFrom(rhs);
+        }
+        else
+        {
+            op->Residual(rhs, *x, r);
+        }
 
         ValueType res = this->Norm_(*r);
 
@@ -274,8 +299,7 @@ namespace rocalution
         x->AddScale(*p, alpha);
 
         // compute residual = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        op->Residual(rhs, *x, r);
 
         res = this->Norm_(*r);
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
@@ -291,8 +315,7 @@ namespace rocalution
             x->AddScale(*p, alpha);
 
             // compute residual = b - Ax
-            op->Apply(*x, r);
-            r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+            op->Residual(rhs, *x, r);
             res = this->Norm_(*r);
         }
 
@@ -324,8 +347,14 @@ namespace rocalution
         ValueType c = (this->lambda_max_ - this->lambda_min_) / two;
 
         // initial residual = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        if(this->zero_init_ == true)
+        {
+            r->CopyFrom(rhs);
+        }
+        else
+        {
+            op->Residual(rhs, *x, r);
+        }
 
         ValueType res = this->Norm_(*r);
 
@@ -348,8 +377,7 @@ namespace rocalution
         x->AddScale(*p, alpha);
 
         // compute residual = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        op->Residual(rhs, *x, r);
         res = this->Norm_(*r);
 
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
@@ -368,8 +396,7 @@ namespace rocalution
             x->AddScale(*p, alpha);
 
             // compute residual = b - Ax
-            op->Apply(*x, r);
-            r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+            op->Residual(rhs, *x, r);
             res = this->Norm_(*r);
         }
 
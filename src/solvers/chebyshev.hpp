@@ -67,6 +67,13 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Clear(void);
 
+        /** \brief Solve Operator x = rhs, setting initial x = 0
+        * \details
+        * The initial residual is set to rhs, without computing the matrix-vector product.
+        */
+        ROCALUTION_EXPORT
+        virtual void SolveZeroSol(const VectorType& rhs, VectorType* x);
+
     protected:
         virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
         virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
@@ -79,6 +86,7 @@ namespace rocalution
 
     private:
         bool      init_lambda_;
+        bool      zero_init_;
         ValueType lambda_min_, lambda_max_;
 
         VectorType r_, z_;
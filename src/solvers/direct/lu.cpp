@@ -73,6 +73,8 @@ namespace rocalution
     {
         log_debug(this, "LU::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
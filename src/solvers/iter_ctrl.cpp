@@ -64,6 +64,7 @@ namespace rocalution
     void IterationControl::Clear(void)
     {
         this->residual_history_.clear();
+        this->initial_residuals_.clear();
         this->iteration_ = 0;
 
         this->init_res_ = false;
@@ -121,6 +122,14 @@ namespace rocalution
         return true;
     }
 
+    bool IterationControl::InitResidual(const std::vector<double>& res)
+    {
+        this->initial_residuals_ = res;
+
+        // All systems meet the absolute tolerance if the largest residual does
+        return this->InitResidual(this->CheckResidualMulti_(res, NULL, NULL));
+    }
+
     void IterationControl::InitTolerance(double abs, double rel, double div)
     {
         this->absolute_tol_   = abs;
@@ -253,6 +262,61 @@ namespace rocalution
         return this->CheckResidual(res);
     }
 
+    bool IterationControl::CheckResidual(const std::vector<double>& res, int64_t index)
+    {
+        assert(this->init_res_ == true);
+        assert(res.size() == this->initial_residuals_.size());
+
+        int    converged;
+        bool   diverged;
+        double res_max = this->CheckResidualMulti_(res, &converged, &diverged);
+
+        this->iteration_++;
+        this->current_res_   = res_max;
+        this->current_index_ = index;
+
+        if(this->verb_ > 1)
+        {
+            LOG_INFO("IterationControl iter=" << this->iteration_ << "; residual=" << res_max);
+        }
+
+        if(this->rec_ == true)
+        {
+            this->residual_history_.push_back(res_max);
+        }
+
+        if((res_max == std::numeric_limits<double>::infinity()) || // infinity
+           (res_max != res_max))
+        { // not a number (NaN)
+
+            LOG_INFO("Residual = " << res_max << " !!!");
+            return true;
+        }
+
+        if(this->iteration_ >= this->minimum_iter_)
+        {
+            if(converged != 0)
+            {
+                this->reached_ = converged;
+                return true;
+            }
+
+            if(this->iteration_ >= this->maximum_iter_)
+            {
+                this->reached_ = 4;
+                return true;
+            }
+        }
+
+        if(diverged == true)
+        {
+            this->reached_ = 3;
+            return true;
+        }
+
+        return false;
+    }
+
     bool IterationControl::CheckResidualNoCount(double res)
     {
         assert(this->init_res_ == true);
@@ -292,6 +356,107 @@ namespace rocalution
         return false;
     }
 
+    bool IterationControl::CheckResidualNoCount(const std::vector<double>& res)
+    {
+        assert(this->init_res_ == true);
+        assert(res.size() == this->initial_residuals_.size());
+
+        int    converged;
+        bool   diverged;
+        double res_max = this->CheckResidualMulti_(res, &converged, &diverged);
+
+        if((res_max == std::numeric_limits<double>::infinity()) || // infinity
+           (res_max != res_max))
+        { // not a number (NaN)
+
+            LOG_INFO("Residual = " << res_max << " !!!");
+            return true;
+        }
+
+        if(converged != 0)
+        {
+            this->reached_ = converged;
+            return true;
+        }
+
+        if(diverged == true)
+        {
+            this->reached_ = 3;
+            return true;
+        }
+
+        if(this->iteration_ >= this->maximum_iter_)
+        {
+            this->reached_ = 4;
+            return true;
+        }
+
+        return false;
+    }
+
+    double IterationControl::CheckResidualMulti_(const std::vector<double>& res,
+                                                 int*                       converged,
+                                                 bool*                      diverged) const
+    {
+        // The largest residual is reported, NaN is propagated
+        double res_max = 0.0;
+
+        for(size_t j = 0; j < res.size(); ++j)
+        {
+            if(res[j] != res[j] || std::abs(res[j]) > res_max)
+            {
+                res_max = std::abs(res[j]);
+            }
+
+            if(res_max != res_max)
+            {
+                break;
+            }
+        }
+
+        // Every system has to meet its own absolute or relative tolerance
+        if(converged != NULL)
+        {
+            bool abs_reached = true;
+            bool all_reached = true;
+
+            for(size_t j = 0; j < res.size(); ++j)
+            {
+                if(std::abs(res[j]) <= this->absolute_tol_)
+                {
+                    continue;
+                }
+
+                abs_reached = false;
+
+                if(res[j] / this->initial_residuals_[j] > this->relative_tol_)
+                {
+                    all_reached = false;
+                    break;
+                }
+            }
+
+            *converged = (all_reached == false) ? 0 : (abs_reached == true) ? 1 : 2;
+        }
+
+        // A single diverging system stops all systems
+        if(diverged != NULL)
+        {
+            *diverged = false;
+
+            for(size_t j = 0; j < res.size(); ++j)
+            {
+                if(res[j] / this->initial_residuals_[j] >= this->divergence_tol_)
+                {
+                    *diverged = true;
+                    break;
+                }
+            }
+        }
+
+        return res_max;
+    }
+
     bool IterationControl::CheckMaximumIterNoCount(void)
     {
         assert(this->init_res_ == true);
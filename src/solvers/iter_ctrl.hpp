@@ -66,6 +66,9 @@ namespace rocalution
         // Initialize the initial residual
         bool InitResidual(double res);
 
+        // Initialize the initial residuals of multiple systems
+        bool InitResidual(const std::vector<double>& res);
+
         // Clear (reset)
         void Clear(void);
 
@@ -76,9 +79,17 @@ namespace rocalution
         // (this count also the number of iterations)
         bool CheckResidual(double res, int64_t index);
 
+        // Check the residuals of multiple systems, each against its own initial residual
+        // (this count also the number of iterations)
+        bool CheckResidual(const std::vector<double>& res, int64_t index);
+
         // Check the residual (without counting the number of iterations)
         bool CheckResidualNoCount(double res);
 
+        // Check the residuals of multiple systems, each against its own initial residual
+        // (without counting the number of iterations)
+        bool CheckResidualNoCount(const std::vector<double>& res);
+
         // Check for maximum iterations (without counting the number of iterations)
         bool CheckMaximumIterNoCount(void);
 
@@ -110,6 +121,14 @@ namespace rocalution
         int64_t GetAmaxResidualIndex(void) const;
 
     private:
+        // Return the largest residual of multiple systems (NaN is propagated). Optionally,
+        // converged is set to 1 (absolute) or 2 (relative) if every system meets a tolerance
+        // and to 0 otherwise, and diverged is set if any system exceeds the divergence
+        // tolerance, each system is checked against its own initial residual
+        double CheckResidualMulti_(const std::vector<double>& res,
+                                   int*                       converged,
+                                   bool*                      diverged) const;
+
         // Verbose flag
         // verb == 0 no output
         // verb == 1 print info about the solver (start,end);
@@ -125,6 +144,9 @@ namespace rocalution
         // Initial residual
         double initial_residual_;
 
+        // Initial residuals of multiple systems (obtained via InitResidual())
+        std::vector<double> initial_residuals_;
+
         // Absolute tolerance
         double absolute_tol_;
         // Relative tolerance
@@ -102,6 +102,8 @@ namespace rocalution
     {
         log_debug(this, "BiCGStab::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -331,10 +333,10 @@ namespace rocalution
             x->ScaleAdd2(static_cast<ValueType>(1), *p, alpha, *r, omega);
 
             // r = r - omega * t
-            r->AddScale(*t, -omega);
+            ValueType norm2 = r->AddScaleNormSquared(*t, -omega);
 
             // Check convergence
-            res_norm = this->Norm_(*r);
+            res_norm = this->Norm_(*r, norm2);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
@@ -456,10 +458,10 @@ namespace rocalution
             x->ScaleAdd2(static_cast<ValueType>(1), *z, alpha, *v, omega);
 
             // r = r - omega * t
-            r->AddScale(*t, -omega);
+            ValueType norm2 = r->AddScaleNormSquared(*t, -omega);
 
             // Check convergence
-            res_norm = this->Norm_(*r);
+            res_norm = this->Norm_(*r, norm2);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
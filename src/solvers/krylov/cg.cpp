@@ -26,6 +26,7 @@
 #include "../iter_ctrl.hpp"
 
 #include "../../base/local_matrix.hpp"
+#include "../../base/local_multi_vector.hpp"
 #include "../../base/local_stencil.hpp"
 #include "../../base/local_vector.hpp"
 
@@ -34,9 +35,12 @@
 
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/type_traits.hpp"
 
 #include <complex>
 #include <math.h>
+#include <vector>
+#include <type_traits>
 
 namespace rocalution
 {
@@ -101,6 +105,8 @@ namespace rocalution
     {
         log_debug(this, "CG::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -215,6 +221,11 @@ namespace rocalution
             this->p_.Clear();
             this->q_.Clear();
 
+            this->mr_.Clear();
+            this->mz_.Clear();
+            this->mp_.Clear();
+            this->mq_.Clear();
+
             this->iter_ctrl_.Clear();
 
             this->build_ = false;
@@ -257,6 +268,11 @@ namespace rocalution
             this->p_.MoveToHost();
             this->q_.MoveToHost();
 
+            this->mr_.MoveToHost();
+            this->mz_.MoveToHost();
+            this->mp_.MoveToHost();
+            this->mq_.MoveToHost();
+
             if(this->precond_ != NULL)
             {
                 this->z_.MoveToHost();
@@ -276,6 +292,11 @@ namespace rocalution
             this->p_.MoveToAccelerator();
             this->q_.MoveToAccelerator();
 
+            this->mr_.MoveToAccelerator();
+            this->mz_.MoveToAccelerator();
+            this->mp_.MoveToAccelerator();
+            this->mq_.MoveToAccelerator();
+
             if(this->precond_ != NULL)
             {
                 this->z_.MoveToAccelerator();
@@ -337,22 +358,21 @@ namespace rocalution
             // alpha = rho / (p,q)
             alpha = rho / p->DotNonConj(*q);
 
-            // x = x + alpha*p
-            x->AddScale(*p, alpha);
-
-            // r = r - alpha*q
-            r->AddScale(*q, -alpha);
+            // x = x + alpha*p, r = r - alpha*q and |r|^2 in a single sweep
+            ValueType norm2 = x->AddScalePairNormSquared(*p, alpha, r, *q, -alpha);
 
             // Check convergence
-            res_norm = this->Norm_(*r);
+            res_norm = this->Norm_(*r, norm2);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
             }
 
-            // rho = (r,r)
+            // rho = (r,r), which is |r|^2 for real types
             rho_old = rho;
-            rho     = r->DotNonConj(*r);
+            rho     = std::is_same<ValueType, numeric_traits_t<ValueType>>::value
+                          ? norm2
+                          : r->DotNonConj(*r);
 
             // p = beta*p + r
             beta = rho / rho_old;
@@ -417,14 +437,11 @@ namespace rocalution
             // alpha = rho / (p,q)
             alpha = rho / p->DotNonConj(*q);
 
-            // x = x + alpha*p
-            x->AddScale(*p, alpha);
-
-            // r = r - alpha*q
-            r->AddScale(*q, -alpha);
+            // x = x + alpha*p, r = r - alpha*q and |r|^2 in a single sweep
+            ValueType norm2 = x->AddScalePairNormSquared(*p, alpha, r, *q, -alpha);
 
             // Check convergence
-            res_norm = this->Norm_(*r);
+            res_norm = this->Norm_(*r, norm2);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
@@ -445,6 +462,231 @@ namespace rocalution
         log_debug(this, "CG::SolvePrecond_()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void CG<OperatorType, VectorType, ValueType>::AllocateMulti_(int num_vec)
+    {
+        log_debug(this, "CG::AllocateMulti_()", num_vec);
+
+        // Keep the work space of previous solves with the same number of vectors
+        if(this->mr_.GetNumVectors() == num_vec && this->mr_.GetSize() == this->op_->GetM()
+           && (this->precond_ == NULL || this->mz_.GetNumVectors() == num_vec))
+        {
+            return;
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->mz_.CloneBackend(*this->op_);
+            this->mz_.Allocate("z", this->op_->GetM(), num_vec);
+        }
+
+        this->mr_.CloneBackend(*this->op_);
+        this->mr_.Allocate("r", this->op_->GetM(), num_vec);
+
+        this->mp_.CloneBackend(*this->op_);
+        this->mp_.Allocate("p", this->op_->GetM(), num_vec);
+
+        this->mq_.CloneBackend(*this->op_);
+        this->mq_.Allocate("q", this->op_->GetM(), num_vec);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void CG<OperatorType, VectorType, ValueType>::SolveMultiNonPrecond_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "CG::SolveMultiNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+
+        int num_vec = rhs.GetNumVectors();
+
+        this->AllocateMulti_(num_vec);
+
+        const Operator<ValueType>* op = this->op_;
+
+        LocalMultiVector<ValueType>* r = &this->mr_;
+        LocalMultiVector<ValueType>* p = &this->mp_;
+        LocalMultiVector<ValueType>* q = &this->mq_;
+
+        std::vector<ValueType> alpha(num_vec), beta(num_vec);
+        std::vector<ValueType> rho(num_vec), rho_old(num_vec), pq(num_vec);
+        std::vector<ValueType> minus_one(num_vec, static_cast<ValueType>(-1));
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(minus_one.data(), rhs);
+
+        // Initial residual norm |b-Ax0| of each system
+        std::vector<double> res_norm;
+        this->NormMulti_(*r, &res_norm);
+
+        if(this->iter_ctrl_.InitResidual(res_norm) == false)
+        {
+            log_debug(this, "CG::SolveMultiNonPrecond_()", " #*# end");
+            return;
+        }
+
+        // p = r
+        p->CopyFrom(*r);
+
+        // rho = (r,r)
+        r->DotNonConj(*r, rho.data());
+
+        while(true)
+        {
+            // q=Ap for all systems in a single pass over the operator
+            op->Apply(*p, q);
+
+            // alpha = rho / (p,q), systems that already reached an exact solution stay put
+            p->DotNonConj(*q, pq.data());
+
+            for(int j = 0; j < num_vec; ++j)
+            {
+                alpha[j] = (pq[j] != static_cast<ValueType>(0)) ? rho[j] / pq[j]
+                                                                : static_cast<ValueType>(0);
+            }
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha.data());
+
+            // r = r - alpha*q
+            for(int j = 0; j < num_vec; ++j)
+            {
+                alpha[j] = -alpha[j];
+            }
+
+            r->AddScale(*q, alpha.data());
+
+            // Check convergence
+            this->NormMulti_(*r, &res_norm);
+            if(this->iter_ctrl_.CheckResidual(res_norm, this->index_))
+            {
+                break;
+            }
+
+            // rho = (r,r)
+            rho_old = rho;
+            r->DotNonConj(*r, rho.data());
+
+            // p = beta*p + r
+            for(int j = 0; j < num_vec; ++j)
+            {
+                beta[j] = (rho_old[j] != static_cast<ValueType>(0)) ? rho[j] / rho_old[j]
+                                                                    : static_cast<ValueType>(0);
+            }
+
+            p->ScaleAdd(beta.data(), *r);
+        }
+
+        log_debug(this, "CG::SolveMultiNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void CG<OperatorType, VectorType, ValueType>::SolveMultiPrecond_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "CG::SolveMultiPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+
+        int num_vec = rhs.GetNumVectors();
+
+        this->AllocateMulti_(num_vec);
+
+        const Operator<ValueType>* op = this->op_;
+
+        LocalMultiVector<ValueType>* r = &this->mr_;
+        LocalMultiVector<ValueType>* z = &this->mz_;
+        LocalMultiVector<ValueType>* p = &this->mp_;
+        LocalMultiVector<ValueType>* q = &this->mq_;
+
+        std::vector<ValueType> alpha(num_vec), beta(num_vec);
+        std::vector<ValueType> rho(num_vec), rho_old(num_vec), pq(num_vec);
+        std::vector<ValueType> minus_one(num_vec, static_cast<ValueType>(-1));
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(minus_one.data(), rhs);
+
+        // Initial residual norm |b-Ax0| of each system
+        std::vector<double> res_norm;
+        this->NormMulti_(*r, &res_norm);
+
+        if(this->iter_ctrl_.InitResidual(res_norm) == false)
+        {
+            log_debug(this, "CG::SolveMultiPrecond_()", " #*# end");
+            return;
+        }
+
+        // Solve Mz=r
+        this->precond_->SolveMultiZeroSol(*r, z);
+
+        // p = z
+        p->CopyFrom(*z);
+
+        // rho = (r,z)
+        r->DotNonConj(*z, rho.data());
+
+        while(true)
+        {
+            // q=Ap for all systems in a single pass over the operator
+            op->Apply(*p, q);
+
+            // alpha = rho / (p,q), systems that already reached an exact solution stay put
+            p->DotNonConj(*q, pq.data());
+
+            for(int j = 0; j < num_vec; ++j)
+            {
+                alpha[j] = (pq[j] != static_cast<ValueType>(0)) ? rho[j] / pq[j]
+                                                                : static_cast<ValueType>(0);
+            }
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha.data());
+
+            // r = r - alpha*q
+            for(int j = 0; j < num_vec; ++j)
+            {
+                alpha[j] = -alpha[j];
+            }
+
+            r->AddScale(*q, alpha.data());
+
+            // Check convergence
+            this->NormMulti_(*r, &res_norm);
+            if(this->iter_ctrl_.CheckResidual(res_norm, this->index_))
+            {
+                break;
+            }
+
+            // Solve Mz=r
+            this->precond_->SolveMultiZeroSol(*r, z);
+
+            // rho = (r,z)
+            rho_old = rho;
+            r->DotNonConj(*z, rho.data());
+
+            // p = beta*p + z
+            for(int j = 0; j < num_vec; ++j)
+            {
+                beta[j] = (rho_old[j] != static_cast<ValueType>(0)) ? rho[j] / rho_old[j]
+                                                                    : static_cast<ValueType>(0);
+            }
+
+            p->ScaleAdd(beta.data(), *z);
+        }
+
+        log_debug(this, "CG::SolveMultiPrecond_()", " #*# end");
+    }
+
     template class CG<LocalMatrix<double>, LocalVector<double>, double>;
     template class CG<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -43,6 +43,11 @@ namespace rocalution
   * the approximation should also be SPD.
   * \cite SAAD
   *
+  * Multiple right-hand sides can be solved at once with SolveMulti(). The systems
+  * perform independent CG recurrences, but share every operator application and
+  * reduction, such that each iteration passes over the matrix only once. The iteration
+  * stops when the largest residual norm of all systems satisfies the stopping criteria.
+  *
   * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
   * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
@@ -76,6 +81,11 @@ namespace rocalution
         virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
         virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
 
+        virtual void SolveMultiNonPrecond_(const LocalMultiVector<ValueType>& rhs,
+                                           LocalMultiVector<ValueType>*       x);
+        virtual void SolveMultiPrecond_(const LocalMultiVector<ValueType>& rhs,
+                                        LocalMultiVector<ValueType>*       x);
+
         virtual void PrintStart_(void) const;
         virtual void PrintEnd_(void) const;
 
@@ -83,8 +93,14 @@ namespace rocalution
         virtual void MoveToAcceleratorLocalData_(void);
 
     private:
+        // Allocate the multi-vector work space for num_vec right-hand sides
+        void AllocateMulti_(int num_vec);
+
         VectorType r_, z_;
         VectorType p_, q_;
+
+        LocalMultiVector<ValueType> mr_, mz_;
+        LocalMultiVector<ValueType> mp_, mq_;
     };
 
 } // namespace rocalution
@@ -101,6 +101,8 @@ namespace rocalution
     {
         log_debug(this, "CRG::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -290,13 +292,10 @@ namespace rocalution
         // alpha = rho / (q,q)
         alpha = rho / q->DotNonConj(*q);
 
-        // x = x + alpha * p
-        x->AddScale(*p, alpha);
+        // x = x + alpha * p, r = r - alpha * q
+        ValueType norm2 = x->AddScalePairNormSquared(*p, alpha, r, *q, -alpha);
 
-        // r = r - alpha * q
-        r->AddScale(*q, -alpha);
-
-        res_norm = this->Norm_(*r);
+        res_norm = this->Norm_(*r, norm2);
 
         while(!this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
         {
@@ -319,13 +318,10 @@ namespace rocalution
             // alpha = rho / (q,q)
             alpha = rho / q->DotNonConj(*q);
 
-            // x = x + alpha * p
-            x->AddScale(*p, alpha);
-
-            // r = r - alpha * q
-            r->AddScale(*q, -alpha);
+            // x = x + alpha * p, r = r - alpha * q
+            norm2 = x->AddScalePairNormSquared(*p, alpha, r, *q, -alpha);
 
-            res_norm = this->Norm_(*r);
+            res_norm = this->Norm_(*r, norm2);
         }
 
         log_debug(this, "CR::SolveNonPrecond_()", " #*# end");
@@ -399,13 +395,10 @@ namespace rocalution
         // x = x + alpha * p
         x->AddScale(*p, alpha);
 
-        // r = r - alpha * z
-        r->AddScale(*z, -alpha);
+        // r = r - alpha * z, t = t - alpha * q
+        ValueType norm2 = r->AddScalePairNormSquared(*z, -alpha, t, *q, -alpha);
 
-        // t = t - alpha * q
-        t->AddScale(*q, -alpha);
-
-        res_norm = this->Norm_(*t);
+        res_norm = this->Norm_(*t, norm2);
 
         while(!this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
         {
@@ -434,13 +427,10 @@ namespace rocalution
             // x = x + alpha * p
             x->AddScale(*p, alpha);
 
-            // r = r - alpha * z
-            r->AddScale(*z, -alpha);
-
-            // t = t - alpha * q
-            t->AddScale(*q, -alpha);
+            // r = r - alpha * z, t = t - alpha * q
+            norm2 = r->AddScalePairNormSquared(*z, -alpha, t, *q, -alpha);
 
-            res_norm = this->Norm_(*t);
+            res_norm = this->Norm_(*t, norm2);
         }
 
         log_debug(this, "CR::SolvePrecond_()", " #*# end");
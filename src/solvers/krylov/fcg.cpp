@@ -101,6 +101,8 @@ namespace rocalution
     {
         log_debug(this, "FCG::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -281,13 +283,10 @@ namespace rocalution
         // rho = beta
         rho = beta;
 
-        // x = x + alpha/rho * p
-        x->AddScale(*p, alpha / rho);
-
-        // r = r - alpha/rho * q
-        r->AddScale(*q, -alpha / rho);
+        // x = x + alpha/rho * p, r = r - alpha/rho * q
+        ValueType norm2 = x->AddScalePairNormSquared(*p, alpha / rho, r, *q, -alpha / rho);
 
-        res = this->Norm_(*r);
+        res = this->Norm_(*r, norm2);
 
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
         {
@@ -310,16 +309,13 @@ namespace rocalution
             // rho = beta + gamma^2 / rho
             rho = beta + gamma * gamma_rho;
 
-            // alpha = (r,r) / rho
-            alpha = r->Dot(*r) / rho;
-
-            // x = x + alpha*p
-            x->AddScale(*p, alpha);
+            // alpha = (r,r) / rho, where (r,r) is known from the last update of r
+            alpha = norm2 / rho;
 
-            // r = r - alpha*q
-            r->AddScale(*q, -alpha);
+            // x = x + alpha*p, r = r - alpha*q
+            norm2 = x->AddScalePairNormSquared(*p, alpha, r, *q, -alpha);
 
-            res = this->Norm_(*r);
+            res = this->Norm_(*r, norm2);
         }
 
         log_debug(this, "FCG::SolveNonPrecond_()", " #*# end");
@@ -378,13 +374,10 @@ namespace rocalution
         // rho = beta
         rho = beta;
 
-        // x = x + alpha/rho * p
-        x->AddScale(*p, alpha / rho);
+        // x = x + alpha/rho * p, r = r - alpha/rho * q
+        ValueType norm2 = x->AddScalePairNormSquared(*p, alpha / rho, r, *q, -alpha / rho);
 
-        // r = r - alpha/rho * q
-        r->AddScale(*q, -alpha / rho);
-
-        res = this->Norm_(*r);
+        res = this->Norm_(*r, norm2);
 
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
         {
@@ -413,13 +406,10 @@ namespace rocalution
             // alpha = (z,r) / rho
             alpha = z->Dot(*r) / rho;
 
-            // x = x + alpha*p
-            x->AddScale(*p, alpha);
-
-            // r = r - alpha*q
-            r->AddScale(*q, -alpha);
+            // x = x + alpha*p, r = r - alpha*q
+            norm2 = x->AddScalePairNormSquared(*p, alpha, r, *q, -alpha);
 
-            res = this->Norm_(*r);
+            res = this->Norm_(*r, norm2);
         }
 
         log_debug(this, "FCG::SolvePrecond_()", " #*# end");
@@ -112,6 +112,8 @@ namespace rocalution
     {
         log_debug(this, "FGMRES::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
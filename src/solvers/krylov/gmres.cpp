@@ -26,6 +26,7 @@
 #include "../iter_ctrl.hpp"
 
 #include "../../base/local_matrix.hpp"
+#include "../../base/local_multi_vector.hpp"
 #include "../../base/local_stencil.hpp"
 #include "../../base/local_vector.hpp"
 #include "../../base/matrix_formats_ind.hpp"
@@ -37,8 +38,10 @@
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <math.h>
+#include <vector>
 
 namespace rocalution
 {
@@ -55,6 +58,8 @@ namespace rocalution
         this->r_ = NULL;
         this->H_ = NULL;
         this->v_ = NULL;
+
+        this->mv_ = NULL;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -111,6 +116,8 @@ namespace rocalution
     {
         log_debug(this, "GMRES::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -184,6 +191,18 @@ namespace rocalution
             delete[] this->v_;
             this->v_ = NULL;
 
+            if(this->mv_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_ + 1; ++i)
+                {
+                    delete this->mv_[i];
+                }
+                delete[] this->mv_;
+                this->mv_ = NULL;
+            }
+
+            this->mz_.Clear();
+
             this->iter_ctrl_.Clear();
 
             this->build_ = false;
@@ -228,6 +247,16 @@ namespace rocalution
                 this->v_[i]->MoveToHost();
             }
 
+            if(this->mv_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_ + 1; ++i)
+                {
+                    this->mv_[i]->MoveToHost();
+                }
+            }
+
+            this->mz_.MoveToHost();
+
             if(this->precond_ != NULL)
             {
                 this->z_.MoveToHost();
@@ -248,6 +277,16 @@ namespace rocalution
                 this->v_[i]->MoveToAccelerator();
             }
 
+            if(this->mv_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_ + 1; ++i)
+                {
+                    this->mv_[i]->MoveToAccelerator();
+                }
+            }
+
+            this->mz_.MoveToAccelerator();
+
             if(this->precond_ != NULL)
             {
                 this->z_.MoveToAccelerator();
@@ -561,6 +600,265 @@ namespace rocalution
         log_debug(this, "GMRES::SolvePrecond_()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GMRES<OperatorType, VectorType, ValueType>::SolveMultiNonPrecond_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "GMRES::SolveMultiNonPrecond_()", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        this->SolveMulti_(rhs, x);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GMRES<OperatorType, VectorType, ValueType>::SolveMultiPrecond_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "GMRES::SolveMultiPrecond_()", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        this->SolveMulti_(rhs, x);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GMRES<OperatorType, VectorType, ValueType>::SolveMulti_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "GMRES::SolveMulti_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->size_basis_ > 0);
+        assert(this->res_norm_type_ == 2);
+
+        int size    = this->size_basis_;
+        int num_vec = rhs.GetNumVectors();
+
+        // Allocate the multi-vector basis for the given number of right-hand sides
+        if(this->mv_ == NULL)
+        {
+            this->mv_ = new LocalMultiVector<ValueType>*[size + 1];
+
+            for(int i = 0; i < size + 1; ++i)
+            {
+                this->mv_[i] = new LocalMultiVector<ValueType>;
+            }
+        }
+
+        if(this->mz_.GetNumVectors() != num_vec || this->mz_.GetSize() != this->op_->GetM())
+        {
+            for(int i = 0; i < size + 1; ++i)
+            {
+                this->mv_[i]->CloneBackend(*this->op_);
+                this->mv_[i]->Allocate("v", this->op_->GetM(), num_vec);
+            }
+
+            this->mz_.CloneBackend(*this->op_);
+            this->mz_.Allocate("z", this->op_->GetM(), num_vec);
+        }
+
+        const Operator<ValueType>* op = this->op_;
+
+        LocalMultiVector<ValueType>*  z = &this->mz_;
+        LocalMultiVector<ValueType>** v = this->mv_;
+
+        // Givens rotations, residuals and Hessenberg matrices of all systems,
+        // stored one after the other
+        std::vector<ValueType> c(size * num_vec);
+        std::vector<ValueType> s(size * num_vec);
+        std::vector<ValueType> r((size + 1) * num_vec);
+        std::vector<ValueType> H((size + 1) * size * num_vec);
+
+        std::vector<ValueType> alpha(num_vec);
+        std::vector<ValueType> minus_one(num_vec, static_cast<ValueType>(-1));
+
+        // Residual norms of all systems, each system is checked against its own tolerance
+        std::vector<double> res_norm(num_vec);
+
+        ValueType zero = static_cast<ValueType>(0);
+        ValueType one  = static_cast<ValueType>(1);
+
+        // Initial residual
+        op->Apply(*x, z);
+        z->ScaleAdd(minus_one.data(), rhs);
+
+        bool first = true;
+
+        while(true)
+        {
+            // Solve Mv_0 = z
+            if(this->precond_ != NULL)
+            {
+                this->precond_->SolveMultiZeroSol(*z, v[0]);
+            }
+            else
+            {
+                v[0]->CopyFrom(*z);
+            }
+
+            // r = 0
+            std::fill(r.begin(), r.end(), zero);
+
+            // r_0 = ||v_0|| for each system
+            v[0]->Norm(alpha.data());
+
+            for(int j = 0; j < num_vec; ++j)
+            {
+                r[j * (size + 1)] = alpha[j];
+                res_norm[j]       = std::abs(alpha[j]);
+            }
+
+            if(first == true)
+            {
+                // Initial residual
+                if(this->iter_ctrl_.InitResidual(res_norm) == false)
+                {
+                    break;
+                }
+
+                first = false;
+            }
+            else
+            {
+                // Check convergence
+                if(this->iter_ctrl_.CheckResidualNoCount(res_norm))
+                {
+                    break;
+                }
+            }
+
+            // Normalize v_0, systems that are solved exactly are not updated anymore
+            for(int j = 0; j < num_vec; ++j)
+            {
+                alpha[j] = (r[j * (size + 1)] != zero) ? one / r[j * (size + 1)] : zero;
+            }
+
+            v[0]->Scale(alpha.data());
+
+            // Arnoldi iteration
+            int i = 0;
+            while(i < size)
+            {
+                // v_i+1 = M^-1 Av_i
+                if(this->precond_ != NULL)
+                {
+                    op->Apply(*v[i], z);
+                    this->precond_->SolveMultiZeroSol(*z, v[i + 1]);
+                }
+                else
+                {
+                    op->Apply(*v[i], v[i + 1]);
+                }
+
+                // Build Hessenberg matrices H
+                for(int k = 0; k <= i; ++k)
+                {
+                    int idx = DENSE_IND(k, i, size + 1, size);
+
+                    // H_ki = <v_k,v_i+1>
+                    v[k]->Dot(*v[i + 1], alpha.data());
+
+                    for(int j = 0; j < num_vec; ++j)
+                    {
+                        H[j * (size + 1) * size + idx] = alpha[j];
+                        alpha[j]                       = -alpha[j];
+                    }
+
+                    // v_i+1 -= H_ki * v_k
+                    v[i + 1]->AddScale(*v[k], alpha.data());
+                }
+
+                // H_i+1i = ||v_i+1||
+                v[i + 1]->Norm(alpha.data());
+
+                for(int j = 0; j < num_vec; ++j)
+                {
+                    ValueType* Hj = &H[j * (size + 1) * size];
+                    ValueType* cj = &c[j * size];
+                    ValueType* sj = &s[j * size];
+                    ValueType* rj = &r[j * (size + 1)];
+
+                    // Precompute some indices
+                    int ii   = DENSE_IND(i, i, size + 1, size);
+                    int ip1i = DENSE_IND(i + 1, i, size + 1, size);
+
+                    Hj[ip1i] = alpha[j];
+
+                    // v_i+1 /= H_i+1i
+                    alpha[j] = (Hj[ip1i] != zero) ? one / Hj[ip1i] : zero;
+
+                    // Apply Givens rotation J(0),...,J(j-1) on (H(0,i),...,H(i,i))
+                    for(int k = 0; k < i; ++k)
+                    {
+                        int ki   = DENSE_IND(k, i, size + 1, size);
+                        int kp1i = DENSE_IND(k + 1, i, size + 1, size);
+                        this->ApplyGivensRotation_(cj[k], sj[k], Hj[ki], Hj[kp1i]);
+                    }
+
+                    // Construct J(i)
+                    this->GenerateGivensRotation_(Hj[ii], Hj[ip1i], cj[i], sj[i]);
+
+                    // Apply J(i) to H(i,i) and H(i,i+1) such that H(i,i+1) = 0
+                    this->ApplyGivensRotation_(cj[i], sj[i], Hj[ii], Hj[ip1i]);
+
+                    // Apply J(i) to the norm of the residual sg[i]
+                    this->ApplyGivensRotation_(cj[i], sj[i], rj[i], rj[i + 1]);
+
+                    res_norm[j] = std::abs(rj[i + 1]);
+                }
+
+                v[i + 1]->Scale(alpha.data());
+
+                // Check convergence
+                ++i;
+                if(this->iter_ctrl_.CheckResidual(res_norm, this->index_))
+                {
+                    break;
+                }
+            }
+
+            // Solve upper triangular systems
+            for(int j = 0; j < num_vec; ++j)
+            {
+                ValueType* Hj = &H[j * (size + 1) * size];
+                ValueType* rj = &r[j * (size + 1)];
+
+                for(int l = i - 1; l >= 0; --l)
+                {
+                    ValueType diag = Hj[DENSE_IND(l, l, size + 1, size)];
+
+                    rj[l] = (diag != zero) ? rj[l] / diag : zero;
+
+                    for(int k = 0; k < l; ++k)
+                    {
+                        rj[k] -= Hj[DENSE_IND(k, l, size + 1, size)] * rj[l];
+                    }
+                }
+            }
+
+            // Update solutions
+            for(int l = 0; l < i; ++l)
+            {
+                for(int j = 0; j < num_vec; ++j)
+                {
+                    alpha[j] = r[j * (size + 1) + l];
+                }
+
+                x->AddScale(*v[l], alpha.data());
+            }
+
+            // Compute residual z = b - Ax
+            op->Apply(*x, z);
+            z->ScaleAdd(minus_one.data(), rhs);
+        }
+
+        log_debug(this, "GMRES::SolveMulti_()", " #*# end");
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void GMRES<OperatorType, VectorType, ValueType>::GenerateGivensRotation_(ValueType  dx,
                                                                              ValueType  dy,
@@ -46,6 +46,10 @@ namespace rocalution
   * The Krylov subspace basis size can be set using SetBasisSize(). The default size is
   * 30.
   *
+  * Multiple right-hand sides can be solved at once with SolveMulti(). Each system builds
+  * its own Krylov subspace, while the operator applications and the orthogonalization are
+  * performed for all systems together.
+  *
   * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
   * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
@@ -77,6 +81,16 @@ namespace rocalution
         virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
         virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
 
+        virtual void SolveMultiNonPrecond_(const LocalMultiVector<ValueType>& rhs,
+                                           LocalMultiVector<ValueType>*       x);
+        virtual void SolveMultiPrecond_(const LocalMultiVector<ValueType>& rhs,
+                                        LocalMultiVector<ValueType>*       x);
+
+        /** \brief Multiple right-hand sides solution procedure, with or without
+        * preconditioner
+        */
+        void SolveMulti_(const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x);
+
         virtual void PrintStart_(void) const;
         virtual void PrintEnd_(void) const;
 
@@ -97,6 +111,10 @@ namespace rocalution
         ValueType* r_;
         ValueType* H_;
 
+        // Multi-vector Krylov basis and work space, allocated on demand
+        LocalMultiVector<ValueType>** mv_;
+        LocalMultiVector<ValueType>   mz_;
+
         int size_basis_;
     };
 
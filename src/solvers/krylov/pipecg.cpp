@@ -0,0 +1,666 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "pipecg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+#include "../../utils/type_traits.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    PipeCG<OperatorType, VectorType, ValueType>::PipeCG()
+    {
+        log_debug(this, "PipeCG::PipeCG()", "default constructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    PipeCG<OperatorType, VectorType, ValueType>::~PipeCG()
+    {
+        log_debug(this, "PipeCG::~PipeCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("PipeCG solver");
+        }
+        else
+        {
+            LOG_INFO("PipePCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("PipeCG (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("PipePCG solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("PipeCG (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("PipePCG ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "PipeCG::Build()", this->build_, " #*# begin");
+
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->Build();
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+
+            this->m_.CloneBackend(*this->op_);
+            this->m_.Allocate("m", this->op_->GetM());
+
+            this->q_.CloneBackend(*this->op_);
+            this->q_.Allocate("q", this->op_->GetM());
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+
+        this->w_.CloneBackend(*this->op_);
+        this->w_.Allocate("w", this->op_->GetM());
+
+        this->n_.CloneBackend(*this->op_);
+        this->n_.Allocate("n", this->op_->GetM());
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+
+        this->s_.CloneBackend(*this->op_);
+        this->s_.Allocate("s", this->op_->GetM());
+
+        this->z_.CloneBackend(*this->op_);
+        this->z_.Allocate("z", this->op_->GetM());
+
+        log_debug(this, "PipeCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::BuildMoveToAcceleratorAsync(void)
+    {
+        log_debug(this, "PipeCG::BuildMoveToAcceleratorAsync()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->BuildMoveToAcceleratorAsync();
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+            this->u_.MoveToAcceleratorAsync();
+
+            this->m_.CloneBackend(*this->op_);
+            this->m_.Allocate("m", this->op_->GetM());
+            this->m_.MoveToAcceleratorAsync();
+
+            this->q_.CloneBackend(*this->op_);
+            this->q_.Allocate("q", this->op_->GetM());
+            this->q_.MoveToAcceleratorAsync();
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+        this->r_.MoveToAcceleratorAsync();
+
+        this->w_.CloneBackend(*this->op_);
+        this->w_.Allocate("w", this->op_->GetM());
+        this->w_.MoveToAcceleratorAsync();
+
+        this->n_.CloneBackend(*this->op_);
+        this->n_.Allocate("n", this->op_->GetM());
+        this->n_.MoveToAcceleratorAsync();
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+        this->p_.MoveToAcceleratorAsync();
+
+        this->s_.CloneBackend(*this->op_);
+        this->s_.Allocate("s", this->op_->GetM());
+        this->s_.MoveToAcceleratorAsync();
+
+        this->z_.CloneBackend(*this->op_);
+        this->z_.Allocate("z", this->op_->GetM());
+        this->z_.MoveToAcceleratorAsync();
+
+        log_debug(this, "PipeCG::BuildMoveToAcceleratorAsync()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Sync(void)
+    {
+        log_debug(this, "PipeCG::Sync()", this->build_, " #*# begin");
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->Sync();
+            this->u_.Sync();
+            this->m_.Sync();
+            this->q_.Sync();
+        }
+
+        this->r_.Sync();
+        this->w_.Sync();
+        this->n_.Sync();
+        this->p_.Sync();
+        this->s_.Sync();
+        this->z_.Sync();
+
+        log_debug(this, "PipeCG::Sync()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "PipeCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->r_.Clear();
+            this->w_.Clear();
+            this->n_.Clear();
+            this->p_.Clear();
+            this->s_.Clear();
+            this->z_.Clear();
+            this->u_.Clear();
+            this->m_.Clear();
+            this->q_.Clear();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "PipeCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Zeros();
+            this->w_.Zeros();
+            this->n_.Zeros();
+            this->p_.Zeros();
+            this->s_.Zeros();
+            this->z_.Zeros();
+            this->u_.Zeros();
+            this->m_.Zeros();
+            this->q_.Zeros();
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "PipeCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToHost();
+            this->w_.MoveToHost();
+            this->n_.MoveToHost();
+            this->p_.MoveToHost();
+            this->s_.MoveToHost();
+            this->z_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToHost();
+                this->m_.MoveToHost();
+                this->q_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "PipeCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToAccelerator();
+            this->w_.MoveToAccelerator();
+            this->n_.MoveToAccelerator();
+            this->p_.MoveToAccelerator();
+            this->s_.MoveToAccelerator();
+            this->z_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToAccelerator();
+                this->m_.MoveToAccelerator();
+                this->q_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                       VectorType*       x)
+    {
+        log_debug(this, "PipeCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* w = &this->w_;
+        VectorType* n = &this->n_;
+        VectorType* p = &this->p_;
+        VectorType* s = &this->s_;
+        VectorType* z = &this->z_;
+
+        ValueType alpha = static_cast<ValueType>(0);
+        ValueType beta;
+        ValueType gamma;
+        ValueType gamma_old = static_cast<ValueType>(1);
+        ValueType delta;
+
+        // Merged reduction of gamma = (r,r), delta = (r,w) and the coupling terms
+        // (r,s), (p,w) and (p,s) of the previous search direction
+        const VectorType* dot_x[5] = {r, r, r, p, p};
+        const VectorType* dot_y[5] = {r, w, s, w, s};
+        ValueType         dot[5];
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        // Smallest residual norm of the current recurrence
+        numeric_traits_t<ValueType> res_min = std::abs(res_norm);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "PipeCG::SolveNonPrecond_()", " #*# end");
+            return;
+        }
+
+        // w = Ar
+        op->Apply(*r, w);
+
+        bool first = true;
+
+        while(true)
+        {
+            // Start the merged non-blocking reduction
+            r->DotAsync(first ? 2 : 5, dot_x, dot_y, dot);
+
+            // n = Aw, overlapping the reduction
+            op->Apply(*w, n);
+
+            // Complete the reduction
+            r->DotSync();
+
+            gamma = dot[0];
+            delta = dot[1];
+
+            if(first == true)
+            {
+                // alpha = gamma / delta
+                alpha = gamma / delta;
+
+                // z = n, s = w, p = r
+                z->CopyFrom(*n);
+                s->CopyFrom(*w);
+                p->CopyFrom(*r);
+
+                first = false;
+            }
+            else
+            {
+                // Check convergence, gamma = |r|^2
+                res_norm = this->Norm_(*r, gamma);
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    break;
+                }
+
+                // beta = gamma / gamma_old
+                beta = gamma / gamma_old;
+
+                // (p,s), with p = r + beta*p and s = w + beta*s
+                ValueType ps = delta + beta * dot[2] + rocalution_conj(beta) * dot[3]
+                               + beta * rocalution_conj(beta) * dot[4];
+
+                // Restart from the true residual on breakdown or growth of the recurrences
+                if(!(std::real(ps) > 0) || std::abs(res_norm) > 10 * res_min)
+                {
+                    op->Apply(*x, r);
+                    r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+                    op->Apply(*r, w);
+
+                    res_min = std::abs(this->Norm_(*r));
+                    first   = true;
+                    continue;
+                }
+
+                res_min = std::min(res_min, std::abs(res_norm));
+
+                // alpha = gamma / (p,s)
+                alpha = gamma / ps;
+
+                // z = n + beta*z, s = w + beta*s, p = r + beta*p
+                z->ScaleAdd(beta, *n);
+                s->ScaleAdd(beta, *w);
+                p->ScaleAdd(beta, *r);
+            }
+
+            gamma_old = gamma;
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // w = w - alpha*z
+            w->AddScale(*z, -alpha);
+        }
+
+        log_debug(this, "PipeCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                    VectorType*       x)
+    {
+        log_debug(this, "PipeCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* w = &this->w_;
+        VectorType* n = &this->n_;
+        VectorType* p = &this->p_;
+        VectorType* s = &this->s_;
+        VectorType* z = &this->z_;
+        VectorType* u = &this->u_;
+        VectorType* m = &this->m_;
+        VectorType* q = &this->q_;
+
+        ValueType alpha = static_cast<ValueType>(0);
+        ValueType beta;
+        ValueType gamma;
+        ValueType gamma_old = static_cast<ValueType>(1);
+        ValueType delta;
+
+        // Merged reduction of gamma = (r,u), delta = (u,w), |r|^2 = (r,r) and the
+        // coupling terms (u,s), (p,w) and (p,s) of the previous search direction
+        const VectorType* dot_x[6] = {r, u, r, u, p, p};
+        const VectorType* dot_y[6] = {u, w, r, s, w, s};
+        ValueType         dot[6];
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        // Smallest residual norm of the current recurrence
+        numeric_traits_t<ValueType> res_min = std::abs(res_norm);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "PipeCG::SolvePrecond_()", " #*# end");
+            return;
+        }
+
+        // Mu = r
+        this->precond_->SolveZeroSol(*r, u);
+
+        // w = Au
+        op->Apply(*u, w);
+
+        bool first = true;
+
+        while(true)
+        {
+            // Start the merged non-blocking reduction
+            r->DotAsync(first ? 3 : 6, dot_x, dot_y, dot);
+
+            // Mm = w and n = Am, overlapping the reduction
+            this->precond_->SolveZeroSol(*w, m);
+            op->Apply(*m, n);
+
+            // Complete the reduction
+            r->DotSync();
+
+            gamma = dot[0];
+            delta = dot[1];
+
+            if(first == true)
+            {
+                // alpha = gamma / delta
+                alpha = gamma / delta;
+
+                // z = n, q = m, s = w, p = u
+                z->CopyFrom(*n);
+                q->CopyFrom(*m);
+                s->CopyFrom(*w);
+                p->CopyFrom(*u);
+
+                first = false;
+            }
+            else
+            {
+                // Check convergence
+                res_norm = this->Norm_(*r, dot[2]);
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    break;
+                }
+
+                // beta = gamma / gamma_old
+                beta = gamma / gamma_old;
+
+                // (p,s), with p = u + beta*p and s = w + beta*s
+                ValueType ps = delta + beta * dot[3] + rocalution_conj(beta) * dot[4]
+                               + beta * rocalution_conj(beta) * dot[5];
+
+                // Restart from the true residual on breakdown or growth of the recurrences
+                if(!(std::real(ps) > 0) || std::abs(res_norm) > 10 * res_min)
+                {
+                    op->Apply(*x, r);
+                    r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+                    this->precond_->SolveZeroSol(*r, u);
+                    op->Apply(*u, w);
+
+                    res_min = std::abs(this->Norm_(*r));
+                    first   = true;
+                    continue;
+                }
+
+                res_min = std::min(res_min, std::abs(res_norm));
+
+                // alpha = gamma / (p,s)
+                alpha = gamma / ps;
+
+                // z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p
+                z->ScaleAdd(beta, *n);
+                q->ScaleAdd(beta, *m);
+                s->ScaleAdd(beta, *w);
+                p->ScaleAdd(beta, *u);
+            }
+
+            gamma_old = gamma;
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // u = u - alpha*q
+            u->AddScale(*q, -alpha);
+
+            // w = w - alpha*z
+            w->AddScale(*z, -alpha);
+        }
+
+        log_debug(this, "PipeCG::SolvePrecond_()", " #*# end");
+    }
+
+    template class PipeCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class PipeCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipeCG<LocalMatrix<std::complex<double>>,
+                          LocalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class PipeCG<LocalMatrix<std::complex<float>>,
+                          LocalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+    template class PipeCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class PipeCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipeCG<GlobalMatrix<std::complex<double>>,
+                          GlobalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class PipeCG<GlobalMatrix<std::complex<float>>,
+                          GlobalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+    template class PipeCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class PipeCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipeCG<LocalStencil<std::complex<double>>,
+                          LocalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class PipeCG<LocalStencil<std::complex<float>>,
+                          LocalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -168,6 +168,8 @@ namespace rocalution
     {
         log_debug(this, "MixedPrecisionDC::Build()", " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
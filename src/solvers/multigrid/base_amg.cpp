@@ -33,13 +33,193 @@
 #include "../krylov/cg.hpp"
 #include "../preconditioners/preconditioner.hpp"
 
+#include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
+#include "../../utils/rocsparseio.h"
 
+#include <limits>
 #include <list>
+#include <type_traits>
 
 namespace rocalution
 {
 
+    // Version of the AMG hierarchy file layout
+    static const int64_t AMG_HIERARCHY_VERSION = 1;
+
+    // Number of entries in the AMG hierarchy file header
+    static const int64_t AMG_HIERARCHY_HEADER_SIZE = 13;
+
+    template <typename T>
+    static rocsparseio_type amg_rsio_type(void);
+
+    template <>
+    rocsparseio_type amg_rsio_type<int32_t>(void)
+    {
+        return rocsparseio_type_int32;
+    }
+
+    template <>
+    rocsparseio_type amg_rsio_type<float>(void)
+    {
+        return rocsparseio_type_float32;
+    }
+
+    template <>
+    rocsparseio_type amg_rsio_type<double>(void)
+    {
+        return rocsparseio_type_float64;
+    }
+
+    template <>
+    rocsparseio_type amg_rsio_type<std::complex<float>>(void)
+    {
+        return rocsparseio_type_complex32;
+    }
+
+    template <>
+    rocsparseio_type amg_rsio_type<std::complex<double>>(void)
+    {
+        return rocsparseio_type_complex64;
+    }
+
+    // Append a host CSR copy of op to the rocsparseio file. Row offsets are stored as
+    // 64 bit integers, such that the file does not depend on PtrType.
+    template <typename ValueType>
+    static bool write_operator_rsio(rocsparseio_handle            handle,
+                                    const LocalMatrix<ValueType>& op,
+                                    const char*                   name)
+    {
+        LocalMatrix<ValueType> csr;
+        csr.CloneFrom(op);
+        csr.MoveToHost();
+        csr.ConvertToCSR();
+
+        int64_t nrow = csr.GetM();
+        int64_t ncol = csr.GetN();
+        int64_t nnz  = csr.GetNnz();
+
+        PtrType*   row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+
+        csr.LeaveDataPtrCSR(&row_offset, &col, &val);
+
+        int64_t* ptr = NULL;
+        allocate_host(nrow + 1, &ptr);
+
+        for(int64_t i = 0; i < nrow + 1; ++i)
+        {
+            ptr[i] = row_offset[i];
+        }
+
+        rocsparseio_status status = rocsparseio_write_sparse_csx(handle,
+                                                                 rocsparseio_direction_row,
+                                                                 nrow,
+                                                                 ncol,
+                                                                 nnz,
+                                                                 rocsparseio_type_int64,
+                                                                 ptr,
+                                                                 amg_rsio_type<int>(),
+                                                                 col,
+                                                                 amg_rsio_type<ValueType>(),
+                                                                 val,
+                                                                 rocsparseio_index_base_zero,
+                                                                 "%s",
+                                                                 name);
+
+        free_host(&ptr);
+        free_host(&row_offset);
+        free_host(&col);
+        free_host(&val);
+
+        return status == rocsparseio_status_success;
+    }
+
+    // Read the next CSR matrix of the rocsparseio file into op (on the host)
+    template <typename ValueType>
+    static bool read_operator_rsio(rocsparseio_handle      handle,
+                                   LocalMatrix<ValueType>* op,
+                                   const char*             name)
+    {
+        rocsparseio_direction  dir;
+        rocsparseio_index_base base;
+        uint64_t               nrow;
+        uint64_t               ncol;
+        uint64_t               nnz;
+        rocsparseio_type       ptr_type;
+        rocsparseio_type       ind_type;
+        rocsparseio_type       val_type;
+
+        if(rocsparseiox_read_metadata_sparse_csx(
+               handle, &dir, &nrow, &ncol, &nnz, &ptr_type, &ind_type, &val_type, &base)
+           != rocsparseio_status_success)
+        {
+            return false;
+        }
+
+        // Hierarchies are only read with the types they have been written with
+        if(dir != rocsparseio_direction_row || base != rocsparseio_index_base_zero
+           || ptr_type != rocsparseio_type_int64 || ind_type != amg_rsio_type<int>()
+           || val_type != amg_rsio_type<ValueType>())
+        {
+            return false;
+        }
+
+        if(nrow > static_cast<uint64_t>(std::numeric_limits<int>::max())
+           || ncol > static_cast<uint64_t>(std::numeric_limits<int>::max())
+           || nnz > static_cast<uint64_t>(std::numeric_limits<PtrType>::max()))
+        {
+            return false;
+        }
+
+        int64_t*   ptr = NULL;
+        int*       col = NULL;
+        ValueType* val = NULL;
+
+        allocate_host(nrow + 1, &ptr);
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
+
+        if(rocsparseiox_read_sparse_csx(handle, ptr, col, val) != rocsparseio_status_success)
+        {
+            free_host(&ptr);
+            free_host(&col);
+            free_host(&val);
+
+            return false;
+        }
+
+        PtrType* row_offset = NULL;
+        allocate_host(nrow + 1, &row_offset);
+
+        for(uint64_t i = 0; i < nrow + 1; ++i)
+        {
+            row_offset[i] = static_cast<PtrType>(ptr[i]);
+        }
+
+        free_host(&ptr);
+
+        op->Clear();
+        op->MoveToHost();
+        op->SetDataPtrCSR(&row_offset, &col, &val, name, nnz, nrow, ncol);
+
+        return true;
+    }
+
+    // Hierarchies of global operators cannot be stored, BaseAMG checks this beforehand
+    template <typename ValueType>
+    static bool write_operator_rsio(rocsparseio_handle, const GlobalMatrix<ValueType>&, const char*)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    static bool read_operator_rsio(rocsparseio_handle, GlobalMatrix<ValueType>*, const char*)
+    {
+        return false;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     BaseAMG<OperatorType, VectorType, ValueType>::BaseAMG()
     {
@@ -134,11 +314,179 @@ namespace rocalution
         return this->levels_;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::SaveHierarchy(
+        const std::string& filename) const
+    {
+        log_debug(this, "BaseAMG::SaveHierarchy()", filename);
+
+        assert(this->hierarchy_ == true);
+        assert(this->levels_ > 1);
+
+        if(std::is_same<OperatorType, LocalMatrix<ValueType>>::value == false)
+        {
+            LOG_INFO("BaseAMG::SaveHierarchy() is only available for LocalMatrix operators");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        rocsparseio_handle handle;
+
+        if(rocsparseio_open(&handle, rocsparseio_rwmode_write, filename.c_str())
+           != rocsparseio_status_success)
+        {
+            LOG_INFO("Execution of BaseAMG::SaveHierarchy() failed: cannot open file "
+                     << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header, followed by operator, restriction and prolongation of each level. The
+        // finest level is described by the number of rows of its prolongation.
+        int64_t header[AMG_HIERARCHY_HEADER_SIZE] = {AMG_HIERARCHY_VERSION,
+                                                     this->levels_,
+                                                     this->prolong_op_level_[0]->GetM(),
+                                                     this->coarse_size_,
+                                                     this->op_format_,
+                                                     this->op_blockdim_,
+                                                     this->sm_format_,
+                                                     this->iter_pre_smooth_,
+                                                     this->iter_post_smooth_,
+                                                     this->cycle_,
+                                                     this->kcycle_full_,
+                                                     this->scaling_,
+                                                     this->host_level_};
+
+        bool success = rocsparseio_write_dense_vector(handle,
+                                                      rocsparseio_type_int64,
+                                                      AMG_HIERARCHY_HEADER_SIZE,
+                                                      header,
+                                                      1,
+                                                      "rocalution amg hierarchy")
+                       == rocsparseio_status_success;
+
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            success = success && write_operator_rsio(handle, *this->op_level_[i], "op_level");
+            success = success
+                      && write_operator_rsio(
+                          handle, *this->restrict_op_level_[i], "restrict_op_level");
+            success = success
+                      && write_operator_rsio(
+                          handle, *this->prolong_op_level_[i], "prolong_op_level");
+        }
+
+        if(rocsparseio_close(handle) != rocsparseio_status_success || success == false)
+        {
+            LOG_INFO("Execution of BaseAMG::SaveHierarchy() failed: cannot write file "
+                     << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::LoadHierarchy(const std::string& filename)
+    {
+        log_debug(this, "BaseAMG::LoadHierarchy()", filename);
+
+        assert(this->build_ == false);
+        assert(this->hierarchy_ == false);
+        assert(this->op_ != NULL);
+
+        if(std::is_same<OperatorType, LocalMatrix<ValueType>>::value == false)
+        {
+            LOG_INFO("BaseAMG::LoadHierarchy() is only available for LocalMatrix operators");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        rocsparseio_handle handle;
+
+        if(rocsparseio_open(&handle, rocsparseio_rwmode_read, filename.c_str())
+           != rocsparseio_status_success)
+        {
+            LOG_INFO("Execution of BaseAMG::LoadHierarchy() failed: cannot open file "
+                     << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header
+        int64_t          header[AMG_HIERARCHY_HEADER_SIZE];
+        rocsparseio_type header_type;
+        uint64_t         header_size;
+
+        if(rocsparseiox_read_metadata_dense_vector(handle, &header_type, &header_size)
+               != rocsparseio_status_success
+           || header_type != rocsparseio_type_int64 || header_size != AMG_HIERARCHY_HEADER_SIZE
+           || rocsparseiox_read_dense_vector(handle, header, 1) != rocsparseio_status_success
+           || header[0] != AMG_HIERARCHY_VERSION || header[1] < 2)
+        {
+            LOG_INFO("Execution of BaseAMG::LoadHierarchy() failed: "
+                     << filename << " is not an AMG hierarchy");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(header[2] != this->op_->GetM())
+        {
+            LOG_INFO("Execution of BaseAMG::LoadHierarchy() failed: hierarchy has been built for "
+                     << header[2] << " rows, operator has " << this->op_->GetM() << " rows");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        this->levels_           = static_cast<int>(header[1]);
+        this->coarse_size_      = static_cast<int>(header[3]);
+        this->op_format_        = static_cast<unsigned int>(header[4]);
+        this->op_blockdim_      = static_cast<int>(header[5]);
+        this->sm_format_        = static_cast<unsigned int>(header[6]);
+        this->iter_pre_smooth_  = static_cast<int>(header[7]);
+        this->iter_post_smooth_ = static_cast<int>(header[8]);
+        this->cycle_            = static_cast<unsigned int>(header[9]);
+        this->kcycle_full_      = header[10] != 0;
+        this->scaling_          = header[11] != 0;
+        this->host_level_       = static_cast<int>(header[12]);
+
+        // Allocate data structures
+        this->op_level_          = new OperatorType*[this->levels_ - 1];
+        this->restrict_op_level_ = new OperatorType*[this->levels_ - 1];
+        this->prolong_op_level_  = new OperatorType*[this->levels_ - 1];
+        this->trans_level_       = new LocalVector<int>*[this->levels_ - 1];
+
+        bool success = true;
+
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            this->op_level_[i]          = new OperatorType;
+            this->restrict_op_level_[i] = new OperatorType;
+            this->prolong_op_level_[i]  = new OperatorType;
+            this->trans_level_[i]       = new LocalVector<int>;
+
+            success = success && read_operator_rsio(handle, this->op_level_[i], "op_level");
+            success = success
+                      && read_operator_rsio(
+                          handle, this->restrict_op_level_[i], "restrict_op_level");
+            success = success
+                      && read_operator_rsio(handle, this->prolong_op_level_[i], "prolong_op_level");
+
+            this->op_level_[i]->CloneBackend(*this->op_);
+            this->restrict_op_level_[i]->CloneBackend(*this->op_);
+            this->prolong_op_level_[i]->CloneBackend(*this->op_);
+            this->trans_level_[i]->CloneBackend(*this->op_);
+        }
+
+        if(rocsparseio_close(handle) != rocsparseio_status_success || success == false)
+        {
+            LOG_INFO("Execution of BaseAMG::LoadHierarchy() failed: cannot read file "
+                     << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        this->hierarchy_ = true;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseAMG<OperatorType, VectorType, ValueType>::Build(void)
     {
         log_debug(this, "BaseAMG::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -28,6 +28,7 @@
 #include "base_multigrid.hpp"
 #include "rocalution/export.hpp"
 
+#include <string>
 #include <vector>
 
 namespace rocalution
@@ -35,7 +36,8 @@ namespace rocalution
     typedef enum _coarsening_strategy
     {
         Greedy = 0,
-        PMIS   = 1
+        PMIS   = 1,
+        HMIS   = 2
     } CoarseningStrategy;
 
     typedef enum _interpolation_type
@@ -109,6 +111,55 @@ namespace rocalution
         ROCALUTION_EXPORT
         int GetNumLevels(void);
 
+        /** \brief Save the AMG hierarchy to a file
+        * \details
+        * Writes the coarse grid operators, the restriction and prolongation operators of
+        * all levels and the cycle and smoother configuration (number of pre- and
+        * post-smoothing steps, cycle type, scaling, operator formats and number of host
+        * levels) into a single rocsparseio file. The hierarchy has to be built, i.e.
+        * BuildHierarchy() or Build() have been called. All operators are stored in CSR
+        * format. Only available for LocalMatrix operators.
+        *
+        * @param[in]
+        * filename  name of the file the hierarchy is written to.
+        */
+        ROCALUTION_EXPORT
+        void SaveHierarchy(const std::string& filename) const;
+
+        /** \brief Load an AMG hierarchy from a file
+        * \details
+        * Reads a hierarchy that has been written by SaveHierarchy(), such that a
+        * subsequent Build() skips the coarsening and only sets up the smoothers and the
+        * coarse grid solver. The operator has to be set before and its size has to match
+        * the finest level of the stored hierarchy. The stored cycle and smoother
+        * configuration is restored and can be changed before Build() is called. Only
+        * available for LocalMatrix operators.
+        *
+        * ReBuildNumeric() can be used to update a loaded hierarchy with new operator
+        * values, the coarse grid operators are then recomputed from the stored
+        * restriction and prolongation operators.
+        *
+        * \par Example
+        * \code{.cpp}
+        *   // First run
+        *   SAAMG<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType> amg;
+        *   amg.SetOperator(mat);
+        *   amg.Build();
+        *   amg.SaveHierarchy("amg.rsio");
+        *
+        *   // Later runs
+        *   SAAMG<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType> amg;
+        *   amg.SetOperator(mat);
+        *   amg.LoadHierarchy("amg.rsio");
+        *   amg.Build();
+        * \endcode
+        *
+        * @param[in]
+        * filename  name of the file the hierarchy is read from.
+        */
+        ROCALUTION_EXPORT
+        void LoadHierarchy(const std::string& filename);
+
         /** \private */
         virtual void SetRestrictOperator(OperatorType** op);
         /** \private */
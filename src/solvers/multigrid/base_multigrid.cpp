@@ -26,6 +26,7 @@
 #include "../iter_ctrl.hpp"
 
 #include "../../base/local_matrix.hpp"
+#include "../../base/local_multi_vector.hpp"
 #include "../../base/local_vector.hpp"
 
 #include "../../base/global_matrix.hpp"
@@ -33,9 +34,12 @@
 
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profile.hpp"
 
 #include <complex>
 #include <math.h>
+#include <type_traits>
+#include <vector>
 
 namespace rocalution
 {
@@ -64,6 +68,10 @@ namespace rocalution
         this->s_level_ = NULL;
         this->q_level_ = NULL;
 
+        this->mr_level_ = NULL;
+        this->mt_level_ = NULL;
+        this->md_level_ = NULL;
+
         this->solver_coarse_  = NULL;
         this->smoother_level_ = NULL;
 
@@ -315,6 +323,8 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Build()", this->build_, " #*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -408,6 +418,9 @@ namespace rocalution
                 delete[] this->q_level_;
             }
 
+            // Clear multi-vector work space
+            this->ClearMulti_();
+
             // Clear smoothers
             for(int i = 0; i < this->levels_ - 1; ++i)
             {
@@ -431,6 +444,9 @@ namespace rocalution
 
         if(this->build_ == true)
         {
+            // Multi-vector work space is re-allocated on demand
+            this->ClearMulti_();
+
             this->r_level_[this->levels_ - 1]->MoveToHost();
             this->d_level_[this->levels_ - 1]->MoveToHost();
             this->t_level_[this->levels_ - 1]->MoveToHost();
@@ -485,6 +501,9 @@ namespace rocalution
 
         if(this->build_ == true)
         {
+            // Multi-vector work space is re-allocated on demand
+            this->ClearMulti_();
+
             // If coarsest level on accelerator
             if(this->host_level_ == 0)
             {
@@ -650,6 +669,9 @@ namespace rocalution
             assert(this->prolong_op_level_[i] != NULL);
         }
 
+        ProfileRegion region(this->is_precond_ ? ProfilePhase_Precond : ProfilePhase_Solve,
+                             &this->profile_);
+
         if(this->verb_ > 0)
         {
             this->PrintStart_();
@@ -660,8 +682,7 @@ namespace rocalution
         if(this->is_precond_ == false)
         {
             // initial residual = b - Ax
-            this->op_->Apply(*x, this->r_level_[0]);
-            this->r_level_[0]->ScaleAdd(static_cast<ValueType>(-1), rhs);
+            this->op_->Residual(rhs, *x, this->r_level_[0]);
 
             this->res_norm_ = std::abs(this->Norm_(*this->r_level_[0]));
 
@@ -698,12 +719,161 @@ namespace rocalution
         log_debug(this, "BaseMultiGrid::Solve()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::SolveMulti(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "BaseMultiGrid::SolveMulti()", " #*# begin", (const void*&)rhs, x);
+
+        ProfileRegion region(this->is_precond_ ? ProfilePhase_Precond : ProfilePhase_Solve,
+                             &this->profile_);
+
+        // Cycles other than the single-node V-cycle, intergrid scaling and host levels are
+        // processed one right-hand side after the other
+        if(std::is_same<VectorType, LocalVector<ValueType>>::value == false
+           || this->cycle_ != Vcycle || this->scaling_ == true || this->host_level_ != 0)
+        {
+            Solver<OperatorType, VectorType, ValueType>::SolveMulti(rhs, x);
+
+            log_debug(this, "BaseMultiGrid::SolveMulti()", " #*# end");
+
+            return;
+        }
+
+        assert(this->levels_ > 1);
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->precond_ == NULL);
+        assert(this->solver_coarse_ != NULL);
+        assert(rhs.GetSize() == this->op_->GetM());
+        assert(x->GetSize() == this->op_->GetN());
+        assert(rhs.GetNumVectors() == x->GetNumVectors());
+
+        int num_vec = rhs.GetNumVectors();
+
+        // Allocate the multi-vector work space on all levels
+        if(this->mr_level_ == NULL || this->mr_level_[0]->GetNumVectors() != num_vec)
+        {
+            this->ClearMulti_();
+
+            this->mr_level_ = new LocalMultiVector<ValueType>*[this->levels_];
+            this->mt_level_ = new LocalMultiVector<ValueType>*[this->levels_];
+            this->md_level_ = new LocalMultiVector<ValueType>*[this->levels_];
+
+            for(int i = 0; i < this->levels_; ++i)
+            {
+                const OperatorType* op = (i == 0) ? this->op_ : this->op_level_[i - 1];
+
+                this->mr_level_[i] = NULL;
+                this->mt_level_[i] = NULL;
+                this->md_level_[i] = NULL;
+
+                if(i < this->levels_ - 1)
+                {
+                    this->mr_level_[i] = new LocalMultiVector<ValueType>;
+                    this->mr_level_[i]->CloneBackend(*op);
+                    this->mr_level_[i]->Allocate("residual", op->GetM(), num_vec);
+                }
+
+                if(i > 0)
+                {
+                    this->mt_level_[i] = new LocalMultiVector<ValueType>;
+                    this->mt_level_[i]->CloneBackend(*op);
+                    this->mt_level_[i]->Allocate("temporary", op->GetM(), num_vec);
+
+                    this->md_level_[i] = new LocalMultiVector<ValueType>;
+                    this->md_level_[i]->CloneBackend(*op);
+                    this->md_level_[i]->Allocate("defect correction", op->GetM(), num_vec);
+                }
+            }
+        }
+
+        if(this->verb_ > 0)
+        {
+            this->PrintStart_();
+            this->iter_ctrl_.PrintInit();
+        }
+
+        // Skip residual, if preconditioner
+        if(this->is_precond_ == false)
+        {
+            std::vector<ValueType> minus_one(num_vec, static_cast<ValueType>(-1));
+
+            // initial residual = b - Ax
+            const Operator<ValueType>* op = this->op_;
+
+            op->Apply(*x, this->mr_level_[0]);
+            this->mr_level_[0]->ScaleAdd(minus_one.data(), rhs);
+
+            this->NormMulti_(*this->mr_level_[0], &this->res_norm_multi_);
+
+            if(this->iter_ctrl_.InitResidual(this->res_norm_multi_) == false)
+            {
+                log_debug(this, "BaseMultiGrid::SolveMulti()", " #*# end");
+
+                return;
+            }
+        }
+        else
+        {
+            // Initialize dummy residual
+            this->iter_ctrl_.InitResidual(1.0);
+        }
+
+        this->VcycleMulti_(rhs, x);
+
+        // If no preconditioner, compute until convergence
+        if(this->is_precond_ == false)
+        {
+            while(!this->iter_ctrl_.CheckResidual(this->res_norm_multi_, this->index_))
+            {
+                this->VcycleMulti_(rhs, x);
+            }
+        }
+
+        if(this->verb_ > 0)
+        {
+            this->iter_ctrl_.PrintStatus();
+            this->PrintEnd_();
+        }
+
+        log_debug(this, "BaseMultiGrid::SolveMulti()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::ClearMulti_(void)
+    {
+        log_debug(this, "BaseMultiGrid::ClearMulti_()");
+
+        if(this->mr_level_ != NULL)
+        {
+            for(int i = 0; i < this->levels_; ++i)
+            {
+                delete this->mr_level_[i];
+                delete this->mt_level_[i];
+                delete this->md_level_[i];
+            }
+
+            delete[] this->mr_level_;
+            delete[] this->mt_level_;
+            delete[] this->md_level_;
+
+            this->mr_level_ = NULL;
+            this->mt_level_ = NULL;
+            this->md_level_ = NULL;
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseMultiGrid<OperatorType, VectorType, ValueType>::Restrict_(const VectorType& fine,
                                                                        VectorType*       coarse)
     {
         log_debug(this, "BaseMultiGrid::Restrict_()", (const void*&)fine, coarse);
 
+        ProfileRegion region(ProfileLevelPhase_Restrict, this->current_level_);
+
         this->restrict_op_level_[this->current_level_]->Apply(fine, coarse);
     }
 
@@ -713,6 +883,8 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Prolong_()", (const void*&)coarse, fine);
 
+        ProfileRegion region(ProfileLevelPhase_Prolong, this->current_level_);
+
         this->prolong_op_level_[this->current_level_]->Apply(coarse, fine);
     }
 
@@ -725,6 +897,8 @@ namespace rocalution
         // Run coarse grid solver, if coarsest grid has been reached
         if(this->current_level_ == this->levels_ - 1)
         {
+            ProfileRegion region(ProfileLevelPhase_CoarseSolve, this->current_level_);
+
             this->solver_coarse_->SolveZeroSol(rhs, x);
             return;
         }
@@ -750,16 +924,20 @@ namespace rocalution
 
         // Pre-smoothing
         smoother->InitMaxIter(this->iter_pre_smooth_);
-        if(this->is_precond_ || this->current_level_ != 0)
         {
-            // When this AMG is a preconditioner or if we are not on the finest level,
-            // we have to use a zero initial guess
-            smoother->SolveZeroSol(rhs, x);
-        }
-        else
-        {
-            // For AMG as a solver, x cannot be zero
-            smoother->Solve(rhs, x);
+            ProfileRegion region(ProfileLevelPhase_Smooth, this->current_level_);
+
+            if(this->is_precond_ || this->current_level_ != 0)
+            {
+                // When this AMG is a preconditioner or if we are not on the finest level,
+                // we have to use a zero initial guess
+                smoother->SolveZeroSol(rhs, x);
+            }
+            else
+            {
+                // For AMG as a solver, x cannot be zero
+                smoother->Solve(rhs, x);
+            }
         }
 
         // Scaling
@@ -788,28 +966,39 @@ namespace rocalution
             }
         }
 
-        // Update residual r = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
-
-        // Copy s when scaling is enabled
-        if(this->scaling_ && this->current_level_ == 0)
+        if((this->scaling_ && this->current_level_ == 0)
+           || this->current_level_ + 1 == this->levels_ - this->host_level_)
         {
-            s->CopyFrom(*r);
-        }
+            // Update residual r = b - Ax
+            op->Residual(rhs, *x, r);
 
-        // Check if 'continue computation on host' flag is set for this new level
-        if(this->current_level_ + 1 == this->levels_ - this->host_level_)
-        {
-            r->MoveToHost();
-        }
+            // Copy s when scaling is enabled
+            if(this->scaling_ && this->current_level_ == 0)
+            {
+                s->CopyFrom(*r);
+            }
+
+            // Check if 'continue computation on host' flag is set for this new level
+            if(this->current_level_ + 1 == this->levels_ - this->host_level_)
+            {
+                r->MoveToHost();
+            }
 
-        // Restrict residual vector on finest level
-        this->Restrict_(*r, rc);
+            // Restrict residual vector on finest level
+            this->Restrict_(*r, rc);
 
-        if(this->current_level_ + 1 == this->levels_ - this->host_level_)
+            if(this->current_level_ + 1 == this->levels_ - this->host_level_)
+            {
+                r->CloneBackend(*op);
+            }
+        }
+        else
         {
-            r->CloneBackend(*op);
+            // Update and restrict residual rc = R (b - Ax) in a single sweep, if supported
+            ProfileRegion region(ProfileLevelPhase_Restrict, this->current_level_);
+
+            op->ResidualRestrict(
+                rhs, *x, *this->restrict_op_level_[this->current_level_], r, rc);
         }
 
         ++this->current_level_;
@@ -900,14 +1089,17 @@ namespace rocalution
 
         // Post-smoothing on finest level
         smoother->InitMaxIter(this->iter_post_smooth_);
-        smoother->Solve(rhs, x);
+        {
+            ProfileRegion region(ProfileLevelPhase_Smooth, this->current_level_);
+
+            smoother->Solve(rhs, x);
+        }
 
         // Only update the residual, if this is not a preconditioner
         if(this->current_level_ == 0 && this->is_precond_ == false)
         {
             // Update residual
-            op->Apply(*x, r);
-            r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+            op->Residual(rhs, *x, r);
 
             this->res_norm_ = std::abs(this->Norm_(*r));
         }
@@ -915,6 +1107,108 @@ namespace rocalution
         log_debug(this, "BaseMultiGrid::Vcycle_()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::VcycleMulti_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "BaseMultiGrid::VcycleMulti_()", " #*# begin", (const void*&)rhs, x);
+
+        // Run coarse grid solver, if coarsest grid has been reached
+        if(this->current_level_ == this->levels_ - 1)
+        {
+            ProfileRegion region(ProfileLevelPhase_CoarseSolve, this->current_level_);
+
+            this->solver_coarse_->SolveMultiZeroSol(rhs, x);
+            return;
+        }
+
+        // Smoother on the current level
+        IterativeLinearSolver<OperatorType, VectorType, ValueType>* smoother
+            = this->smoother_level_[this->current_level_];
+
+        // Operators on the current level, all right-hand sides share a single pass
+        const Operator<ValueType>* op = (this->current_level_ == 0)
+                                            ? this->op_
+                                            : this->op_level_[this->current_level_ - 1];
+        const Operator<ValueType>* restrict_op = this->restrict_op_level_[this->current_level_];
+        const Operator<ValueType>* prolong_op  = this->prolong_op_level_[this->current_level_];
+
+        // Temporary multi-vectors on the current level
+        LocalMultiVector<ValueType>* r  = this->mr_level_[this->current_level_];
+        LocalMultiVector<ValueType>* rc = this->mt_level_[this->current_level_ + 1];
+        LocalMultiVector<ValueType>* xc = this->md_level_[this->current_level_ + 1];
+
+        int num_vec = rhs.GetNumVectors();
+
+        std::vector<ValueType> one(num_vec, static_cast<ValueType>(1));
+        std::vector<ValueType> minus_one(num_vec, static_cast<ValueType>(-1));
+
+        // Pre-smoothing
+        smoother->InitMaxIter(this->iter_pre_smooth_);
+        {
+            ProfileRegion region(ProfileLevelPhase_Smooth, this->current_level_);
+
+            if(this->is_precond_ || this->current_level_ != 0)
+            {
+                // When this AMG is a preconditioner or if we are not on the finest level,
+                // we have to use a zero initial guess
+                smoother->SolveMultiZeroSol(rhs, x);
+            }
+            else
+            {
+                // For AMG as a solver, x cannot be zero
+                smoother->SolveMulti(rhs, x);
+            }
+        }
+
+        // Update residual r = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(minus_one.data(), rhs);
+
+        // Restrict residual vectors
+        {
+            ProfileRegion region(ProfileLevelPhase_Restrict, this->current_level_);
+
+            restrict_op->Apply(*r, rc);
+        }
+
+        ++this->current_level_;
+
+        this->VcycleMulti_(*rc, xc);
+
+        --this->current_level_;
+
+        // Prolong solution vectors
+        {
+            ProfileRegion region(ProfileLevelPhase_Prolong, this->current_level_);
+
+            prolong_op->Apply(*xc, r);
+        }
+
+        // Defect correction
+        x->AddScale(*r, one.data());
+
+        // Post-smoothing
+        smoother->InitMaxIter(this->iter_post_smooth_);
+        {
+            ProfileRegion region(ProfileLevelPhase_Smooth, this->current_level_);
+
+            smoother->SolveMulti(rhs, x);
+        }
+
+        // Only update the residual, if this is not a preconditioner
+        if(this->current_level_ == 0 && this->is_precond_ == false)
+        {
+            // Update residual
+            op->Apply(*x, r);
+            r->ScaleAdd(minus_one.data(), rhs);
+
+            this->NormMulti_(*r, &this->res_norm_multi_);
+        }
+
+        log_debug(this, "BaseMultiGrid::VcycleMulti_()", " #*# end");
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseMultiGrid<OperatorType, VectorType, ValueType>::Wcycle_(const VectorType& rhs,
                                                                      VectorType*       x)
@@ -1005,6 +1299,8 @@ namespace rocalution
         }
         else
         {
+            ProfileRegion region(ProfileLevelPhase_CoarseSolve, this->current_level_);
+
             this->solver_coarse_->SolveZeroSol(rhs, x);
         }
     }
@@ -111,6 +111,14 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Solve(const VectorType& rhs, VectorType* x);
 
+        /** \brief Solve all vectors of a multi-vector. For a single-node V-cycle without
+        * intergrid scaling, all right-hand sides are cycled together, otherwise they are
+        * processed one after the other.
+        */
+        ROCALUTION_EXPORT
+        virtual void SolveMulti(const LocalMultiVector<ValueType>& rhs,
+                                LocalMultiVector<ValueType>*       x);
+
         /** \brief Build multigrid solver */
         virtual void Build(void);
         /** \brief Initialize multigrid solver (called from Build()) */
@@ -136,6 +144,11 @@ namespace rocalution
         /** \brief K-cycle */
         void Kcycle_(const VectorType& rhs, VectorType* x);
 
+        /** \brief V-cycle for multiple right-hand sides */
+        void VcycleMulti_(const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x);
+        /** \brief Free the multi-vector work space */
+        void ClearMulti_(void);
+
         /** \private */
         virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
 
@@ -170,6 +183,8 @@ namespace rocalution
 
         /** \brief Residual norm */
         double res_norm_;
+        /** \brief Residual norms of multiple systems */
+        std::vector<double> res_norm_multi_;
 
         /** \brief Operator hierarchy */
         OperatorType** op_level_;
@@ -185,6 +200,10 @@ namespace rocalution
         VectorType** s_level_; /**< \private */
         VectorType** q_level_; /**< \private */
 
+        LocalMultiVector<ValueType>** mr_level_; /**< \private */
+        LocalMultiVector<ValueType>** mt_level_; /**< \private */
+        LocalMultiVector<ValueType>** md_level_; /**< \private */
+
         /** \brief Transfer mapping */
         LocalVector<int>** trans_level_;
 
@@ -149,19 +149,40 @@ namespace rocalution
         assert(this->build_ == true);
         assert(this->op_ != NULL);
 
+        // Aggregations are only available, if the hierarchy has been built by this instance,
+        // otherwise the coarse operators are computed from restriction and prolongation
+        bool aggregation = (this->rG_level_.size() == static_cast<size_t>(this->levels_ - 1));
+
         this->op_level_[0]->Clear();
         this->op_level_[0]->CloneBackend(*this->op_);
         this->op_level_[0]->ConvertToCSR();
 
         this->trans_level_[0]->CloneBackend(*this->op_);
 
-        this->op_->CoarsenOperator(this->op_level_[0],
-                                   this->dim_level_[0],
-                                   this->dim_level_[0],
-                                   *this->trans_level_[0],
-                                   this->Gsize_level_[0],
-                                   this->rG_level_[0],
-                                   this->rGsize_level_[0]);
+        if(aggregation == true)
+        {
+            this->op_->CoarsenOperator(this->op_level_[0],
+                                       this->dim_level_[0],
+                                       this->dim_level_[0],
+                                       *this->trans_level_[0],
+                                       this->Gsize_level_[0],
+                                       this->rG_level_[0],
+                                       this->rGsize_level_[0]);
+        }
+        else if(this->op_->GetFormat() != CSR)
+        {
+            OperatorType op_csr;
+            op_csr.CloneFrom(*this->op_);
+            op_csr.ConvertToCSR();
+
+            this->op_level_[0]->TripleMatrixProduct(
+                *this->restrict_op_level_[0], op_csr, *this->prolong_op_level_[0]);
+        }
+        else
+        {
+            this->op_level_[0]->TripleMatrixProduct(
+                *this->restrict_op_level_[0], *this->op_, *this->prolong_op_level_[0]);
+        }
 
         for(int i = 1; i < this->levels_ - 1; ++i)
         {
@@ -175,13 +196,23 @@ namespace rocalution
                 this->op_level_[i - 1]->MoveToHost();
             }
 
-            this->op_level_[i - 1]->CoarsenOperator(this->op_level_[i],
-                                                    this->dim_level_[i],
-                                                    this->dim_level_[i],
-                                                    *this->trans_level_[i],
-                                                    this->Gsize_level_[i],
-                                                    this->rG_level_[i],
-                                                    this->rGsize_level_[i]);
+            if(aggregation == true)
+            {
+                this->op_level_[i - 1]->CoarsenOperator(this->op_level_[i],
+                                                        this->dim_level_[i],
+                                                        this->dim_level_[i],
+                                                        *this->trans_level_[i],
+                                                        this->Gsize_level_[i],
+                                                        this->rG_level_[i],
+                                                        this->rGsize_level_[i]);
+            }
+            else
+            {
+                this->op_level_[i]->CloneBackend(*this->op_level_[i - 1]);
+                this->op_level_[i]->TripleMatrixProduct(*this->restrict_op_level_[i],
+                                                        *this->op_level_[i - 1],
+                                                        *this->prolong_op_level_[i]);
+            }
 
             if(i == this->levels_ - this->host_level_ - 1)
             {
@@ -223,7 +254,7 @@ namespace rocalution
 
         if(this->build_ == true)
         {
-            for(int i = 0; i < this->levels_ - 1; ++i)
+            for(size_t i = 0; i < this->rG_level_.size(); ++i)
             {
                 free_host(&this->rG_level_[i]);
             }
@@ -64,6 +64,9 @@ namespace rocalution
         log_debug(this, "RugeStuebenAMG::RugeStuebenAMG()", "destructor");
 
         this->Clear();
+
+        // Aggregation data of a hierarchy that has not been built completely
+        this->ClearLocal();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -82,6 +85,9 @@ namespace rocalution
             case PMIS:
                 coarsening = "PMIS";
                 break;
+            case HMIS:
+                coarsening = "HMIS";
+                break;
             }
 
             std::string interpolation;
@@ -121,6 +127,9 @@ namespace rocalution
         case PMIS:
             coarsening = "PMIS";
             break;
+        case HMIS:
+            coarsening = "HMIS";
+            break;
         }
 
         std::string interpolation;
@@ -195,48 +204,80 @@ namespace rocalution
         assert(this->build_);
         assert(this->op_ != NULL);
 
-        // Create coarse operator
-        this->op_level_[0]->Clear();
-        this->op_level_[0]->ConvertToCSR();
-        this->op_level_[0]->CloneBackend(*this->op_);
-
-        assert(this->restrict_op_level_[0] != NULL);
-        assert(this->prolong_op_level_[0] != NULL);
+        // C/F splittings are only available, if the hierarchy has been built by this instance
+        bool splitting = (this->CFmap_level_.size() == static_cast<size_t>(this->levels_ - 1));
 
-        if(this->op_->GetFormat() != CSR)
+        for(int i = 0; i < this->levels_ - 1; ++i)
         {
-            OperatorType op_csr;
-            op_csr.CloneFrom(*this->op_);
-            op_csr.ConvertToCSR();
+            assert(this->restrict_op_level_[i] != NULL);
+            assert(this->prolong_op_level_[i] != NULL);
 
-            this->op_level_[0]->TripleMatrixProduct(
-                *this->restrict_op_level_[0], op_csr, *this->prolong_op_level_[0]);
-        }
-        else
-        {
-            this->op_level_[0]->TripleMatrixProduct(
-                *this->restrict_op_level_[0], *this->op_, *this->prolong_op_level_[0]);
-        }
+            // Levels that have been moved to the host
+            bool host_level = (i >= this->levels_ - this->host_level_ - 1);
 
-        for(int i = 1; i < this->levels_ - 1; ++i)
-        {
-            // Create coarse operator
-            this->op_level_[i]->Clear();
-            this->op_level_[i]->ConvertToCSR();
-            this->op_level_[i]->CloneBackend(*this->op_);
+            // Fine operator of the current level, in CSR format and on the backend of the
+            // transfer operators
+            OperatorType        op_csr;
+            const OperatorType* op = this->op_;
 
-            assert(this->restrict_op_level_[i] != NULL);
-            assert(this->prolong_op_level_[i] != NULL);
+            if(i == 0)
+            {
+                if(this->op_->GetFormat() != CSR || host_level == true)
+                {
+                    op_csr.CloneFrom(*this->op_);
+                    op_csr.ConvertToCSR();
+
+                    if(host_level == true)
+                    {
+                        op_csr.MoveToHost();
+                    }
+
+                    op = &op_csr;
+                }
+            }
+            else
+            {
+                if(host_level == true)
+                {
+                    this->op_level_[i - 1]->MoveToHost();
+                }
+
+                op = this->op_level_[i - 1];
+            }
+
+            // Recompute the interpolation weights, the C/F splitting is kept
+            if(splitting == true)
+            {
+                this->CFmap_level_[i]->CloneBackend(*op);
+                this->S_level_[i]->CloneBackend(*op);
+
+                this->Interpolate_(*op,
+                                   *this->CFmap_level_[i],
+                                   *this->S_level_[i],
+                                   this->prolong_op_level_[i],
+                                   this->restrict_op_level_[i]);
+            }
+
+            // Create coarse operator, its CSR structure is reused if it contains the product
+            bool reuse = this->op_level_[i]->GetFormat() == CSR;
+
+            if(reuse == false)
+            {
+                this->op_level_[i]->Clear();
+                this->op_level_[i]->ConvertToCSR();
+            }
+
+            this->op_level_[i]->CloneBackend(*this->op_);
 
-            if(i == this->levels_ - this->host_level_ - 1)
+            if(host_level == true)
             {
-                this->op_level_[i - 1]->MoveToHost();
+                this->op_level_[i]->MoveToHost();
             }
 
             this->op_level_[i]->TripleMatrixProduct(
-                *this->restrict_op_level_[i], *this->op_level_[i - 1], *this->prolong_op_level_[i]);
+                *this->restrict_op_level_[i], *op, *this->prolong_op_level_[i], reuse);
 
-            if(i == this->levels_ - this->host_level_ - 1)
+            if(i > 0 && i == this->levels_ - this->host_level_ - 1)
             {
                 this->op_level_[i - 1]->CloneBackend(*this->restrict_op_level_[i - 1]);
             }
@@ -273,6 +314,58 @@ namespace rocalution
         log_debug(this, "RugeStuebenAMG::ReBuildNumeric()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void RugeStuebenAMG<OperatorType, VectorType, ValueType>::ClearLocal(void)
+    {
+        log_debug(this, "RugeStuebenAMG::ClearLocal()", this->build_);
+
+        for(size_t i = 0; i < this->CFmap_level_.size(); ++i)
+        {
+            delete this->CFmap_level_[i];
+            delete this->S_level_[i];
+        }
+
+        this->CFmap_level_.clear();
+        this->S_level_.clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void RugeStuebenAMG<OperatorType, VectorType, ValueType>::Interpolate_(
+        const OperatorType&      op,
+        const LocalVector<int>&  CFmap,
+        const LocalVector<bool>& S,
+        OperatorType*            pro,
+        OperatorType*            res) const
+    {
+        log_debug(this, "RugeStuebenAMG::Interpolate_()", (const void*&)op, pro, res);
+
+        assert(pro != NULL);
+        assert(res != NULL);
+
+        pro->Clear();
+
+        // Create prolongation and restriction operators
+        switch(this->interpolation_)
+        {
+        case Direct:
+            op.RSDirectInterpolation(CFmap, S, pro);
+            break;
+        case ExtPI:
+            op.RSExtPIInterpolation(CFmap, S, this->FF1_, pro);
+            break;
+        }
+
+        // Sanity check
+        assert(pro->GetM() == op.GetN());
+
+        // Transpose P to obtain R
+        if(pro->GetN() > 0)
+        {
+            res->Clear();
+            pro->Transpose(res);
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     bool RugeStuebenAMG<OperatorType, VectorType, ValueType>::Aggregate_(const OperatorType& op,
                                                                          OperatorType*       pro,
@@ -287,50 +380,42 @@ namespace rocalution
         assert(coarse != NULL);
 
         // Determine C/F map and S
-        LocalVector<int>  CFmap;
-        LocalVector<bool> S;
+        LocalVector<int>*  CFmap = new LocalVector<int>;
+        LocalVector<bool>* S     = new LocalVector<bool>;
 
-        CFmap.CloneBackend(op);
-        S.CloneBackend(op);
+        CFmap->CloneBackend(op);
+        S->CloneBackend(op);
 
         switch(this->coarsening_)
         {
         case Greedy:
-            op.RSCoarsening(this->eps_, &CFmap, &S);
+            op.RSCoarsening(this->eps_, CFmap, S);
             break;
         case PMIS:
-            op.RSPMISCoarsening(this->eps_, &CFmap, &S);
-            break;
-        }
-
-        // Create prolongation and restriction operators
-        switch(this->interpolation_)
-        {
-        case Direct:
-            op.RSDirectInterpolation(CFmap, S, pro);
+            op.RSPMISCoarsening(this->eps_, CFmap, S);
             break;
-        case ExtPI:
-            op.RSExtPIInterpolation(CFmap, S, this->FF1_, pro);
+        case HMIS:
+            op.RSHMISCoarsening(this->eps_, CFmap, S);
             break;
         }
 
-        // Clean up
-        CFmap.Clear();
-        S.Clear();
-
-        // Sanity check
-        assert(pro->GetM() == op.GetN());
+        // Create prolongation and restriction operators
+        this->Interpolate_(op, *CFmap, *S, pro, res);
 
         // We need to revert the level creation, if the number of columns of P is zero
         // because in that case, R will have zero rows and thus the coarse level will be
         // a 0x0 matrix.
         if(pro->GetN() == 0)
         {
+            delete CFmap;
+            delete S;
+
             return false;
         }
 
-        // Transpose P to obtain R
-        pro->Transpose(res);
+        // Store C/F splitting for possible numerical rebuild
+        this->CFmap_level_.push_back(CFmap);
+        this->S_level_.push_back(S);
 
         // Create coarse operator
         coarse->CloneBackend(op);
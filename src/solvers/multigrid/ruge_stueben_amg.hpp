@@ -62,7 +62,12 @@ namespace rocalution
         ROCALUTION_EXPORT
         void SetStrengthThreshold(float eps);
 
-        /** \brief Set Coarsening strategy */
+        /** \brief Set Coarsening strategy
+        * \details
+        * Greedy is the classical sequential Ruge-Stueben splitting, PMIS and HMIS are
+        * parallel. HMIS starts PMIS from the coarse points of Ruge-Stueben splittings of
+        * blocks of rows and usually converges faster than PMIS.
+        */
         ROCALUTION_EXPORT
         void SetCoarseningStrategy(CoarseningStrategy strat);
 
@@ -74,8 +79,16 @@ namespace rocalution
         ROCALUTION_EXPORT
         void SetInterpolationFF1Limit(bool FF1);
 
+        /** \brief Rebuild the hierarchy numerically
+        * \details
+        * The C/F splitting and the strong connections of the previous Build() are kept.
+        * The interpolation weights are recomputed from the new values of the operator,
+        * followed by the coarse operators.
+        */
         ROCALUTION_EXPORT
         virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void ClearLocal(void);
 
     protected:
         virtual bool Aggregate_(const OperatorType& op,
@@ -84,6 +97,13 @@ namespace rocalution
                                 OperatorType*       coarse,
                                 LocalVector<int>*   trans);
 
+        /** \brief Constructs the prolongation and restriction operator from the C/F splitting */
+        void Interpolate_(const OperatorType&      op,
+                          const LocalVector<int>&  CFmap,
+                          const LocalVector<bool>& S,
+                          OperatorType*            pro,
+                          OperatorType*            res) const;
+
         virtual void PrintStart_(void) const;
         virtual void PrintEnd_(void) const;
 
@@ -99,6 +119,10 @@ namespace rocalution
 
         /** \brief Interpolation type */
         InterpolationType interpolation_;
+
+        // C/F splitting and strong connections of each level for numerical rebuilds
+        std::vector<LocalVector<int>*>  CFmap_level_;
+        std::vector<LocalVector<bool>*> S_level_;
     };
 
 } // namespace rocalution
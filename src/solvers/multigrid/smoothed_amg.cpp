@@ -56,6 +56,9 @@ namespace rocalution
         log_debug(this, "SAAMG::SAAMG()", "destructor");
 
         this->Clear();
+
+        // Aggregation data of a hierarchy that has not been built completely
+        this->ClearLocal();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -164,48 +167,83 @@ namespace rocalution
         assert(this->build_);
         assert(this->op_ != NULL);
 
-        // Create coarse operator
-        this->op_level_[0]->Clear();
-        this->op_level_[0]->ConvertToCSR();
-        this->op_level_[0]->CloneBackend(*this->op_);
-
-        assert(this->restrict_op_level_[0] != NULL);
-        assert(this->prolong_op_level_[0] != NULL);
+        // Aggregates are only available, if the hierarchy has been built by this instance
+        bool aggregates
+            = (this->aggregates_level_.size() == static_cast<size_t>(this->levels_ - 1));
 
-        if(this->op_->GetFormat() != CSR)
+        for(int i = 0; i < this->levels_ - 1; ++i)
         {
-            OperatorType op_csr;
-            op_csr.CloneFrom(*this->op_);
-            op_csr.ConvertToCSR();
+            assert(this->restrict_op_level_[i] != NULL);
+            assert(this->prolong_op_level_[i] != NULL);
 
-            this->op_level_[0]->TripleMatrixProduct(
-                *this->restrict_op_level_[0], op_csr, *this->prolong_op_level_[0]);
-        }
-        else
-        {
-            this->op_level_[0]->TripleMatrixProduct(
-                *this->restrict_op_level_[0], *this->op_, *this->prolong_op_level_[0]);
-        }
+            // Levels that have been moved to the host
+            bool host_level = (i >= this->levels_ - this->host_level_ - 1);
 
-        for(int i = 1; i < this->levels_ - 1; ++i)
-        {
-            // Create coarse operator
-            this->op_level_[i]->Clear();
-            this->op_level_[i]->ConvertToCSR();
-            this->op_level_[i]->CloneBackend(*this->op_);
+            // Fine operator of the current level, in CSR format and on the backend of the
+            // transfer operators
+            OperatorType        op_csr;
+            const OperatorType* op = this->op_;
 
-            assert(this->restrict_op_level_[i] != NULL);
-            assert(this->prolong_op_level_[i] != NULL);
+            if(i == 0)
+            {
+                if(this->op_->GetFormat() != CSR || host_level == true)
+                {
+                    op_csr.CloneFrom(*this->op_);
+                    op_csr.ConvertToCSR();
+
+                    if(host_level == true)
+                    {
+                        op_csr.MoveToHost();
+                    }
+
+                    op = &op_csr;
+                }
+            }
+            else
+            {
+                if(host_level == true)
+                {
+                    this->op_level_[i - 1]->MoveToHost();
+                }
+
+                op = this->op_level_[i - 1];
+            }
 
-            if(i == this->levels_ - this->host_level_ - 1)
+            // Smooth the prolongation with the new values, the aggregates are kept
+            if(aggregates == true)
             {
-                this->op_level_[i - 1]->MoveToHost();
+                this->connections_level_[i]->CloneBackend(*op);
+                this->aggregates_level_[i]->CloneBackend(*op);
+                this->aggregate_root_nodes_level_[i]->CloneBackend(*op);
+
+                this->SmoothAggregates_(*op,
+                                        *this->connections_level_[i],
+                                        *this->aggregates_level_[i],
+                                        *this->aggregate_root_nodes_level_[i],
+                                        this->prolong_op_level_[i],
+                                        this->restrict_op_level_[i]);
+            }
+
+            // Create coarse operator, its CSR structure is reused if it contains the product
+            bool reuse = this->op_level_[i]->GetFormat() == CSR;
+
+            if(reuse == false)
+            {
+                this->op_level_[i]->Clear();
+                this->op_level_[i]->ConvertToCSR();
+            }
+
+            this->op_level_[i]->CloneBackend(*this->op_);
+
+            if(host_level == true)
+            {
+                this->op_level_[i]->MoveToHost();
             }
 
             this->op_level_[i]->TripleMatrixProduct(
-                *this->restrict_op_level_[i], *this->op_level_[i - 1], *this->prolong_op_level_[i]);
+                *this->restrict_op_level_[i], *op, *this->prolong_op_level_[i], reuse);
 
-            if(i == this->levels_ - this->host_level_ - 1)
+            if(i > 0 && i == this->levels_ - this->host_level_ - 1)
             {
                 this->op_level_[i - 1]->CloneBackend(*this->restrict_op_level_[i - 1]);
             }
@@ -238,6 +276,64 @@ namespace rocalution
                 this->op_level_[i]->ConvertTo(this->op_format_, this->op_blockdim_);
             }
         }
+
+        log_debug(this, "SAAMG::ReBuildNumeric()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SAAMG<OperatorType, VectorType, ValueType>::ClearLocal(void)
+    {
+        log_debug(this, "SAAMG::ClearLocal()", this->build_);
+
+        for(size_t i = 0; i < this->aggregates_level_.size(); ++i)
+        {
+            delete this->connections_level_[i];
+            delete this->aggregates_level_[i];
+            delete this->aggregate_root_nodes_level_[i];
+        }
+
+        this->connections_level_.clear();
+        this->aggregates_level_.clear();
+        this->aggregate_root_nodes_level_.clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SAAMG<OperatorType, VectorType, ValueType>::SmoothAggregates_(
+        const OperatorType&         op,
+        const LocalVector<bool>&    connections,
+        const LocalVector<int64_t>& aggregates,
+        const LocalVector<int64_t>& aggregate_root_nodes,
+        OperatorType*               pro,
+        OperatorType*               res) const
+    {
+        log_debug(this, "SAAMG::SmoothAggregates_()", (const void*&)op, pro, res);
+
+        assert(pro != NULL);
+        assert(res != NULL);
+
+        pro->Clear();
+
+        switch(lumping_strat_)
+        {
+        case AddWeakConnections:
+            op.AMGSmoothedAggregation(
+                this->relax_, connections, aggregates, aggregate_root_nodes, pro, 0);
+            break;
+        case SubtractWeakConnections:
+            op.AMGSmoothedAggregation(
+                this->relax_, connections, aggregates, aggregate_root_nodes, pro, 1);
+            break;
+        }
+
+        // Sanity check
+        assert(pro->GetM() == op.GetN());
+
+        // Transpose P to obtain R
+        if(pro->GetN() > 0)
+        {
+            res->Clear();
+            pro->Transpose(res);
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -253,13 +349,13 @@ namespace rocalution
         assert(res != NULL);
         assert(coarse != NULL);
 
-        LocalVector<bool>    connections;
-        LocalVector<int64_t> aggregates;
-        LocalVector<int64_t> aggregate_root_nodes;
+        LocalVector<bool>*    connections          = new LocalVector<bool>;
+        LocalVector<int64_t>* aggregates           = new LocalVector<int64_t>;
+        LocalVector<int64_t>* aggregate_root_nodes = new LocalVector<int64_t>;
 
-        connections.CloneBackend(op);
-        aggregates.CloneBackend(op);
-        aggregate_root_nodes.CloneBackend(op);
+        connections->CloneBackend(op);
+        aggregates->CloneBackend(op);
+        aggregate_root_nodes->CloneBackend(op);
 
         ValueType eps = this->eps_;
         for(int i = 0; i < this->levels_ - 1; ++i)
@@ -269,43 +365,36 @@ namespace rocalution
         switch(strat_)
         {
         case Greedy:
-            op.AMGGreedyAggregate(eps, &connections, &aggregates, &aggregate_root_nodes);
+            op.AMGGreedyAggregate(eps, connections, aggregates, aggregate_root_nodes);
             break;
         case PMIS:
-            op.AMGPMISAggregate(eps, &connections, &aggregates, &aggregate_root_nodes);
-            break;
-        }
-
-        switch(lumping_strat_)
-        {
-        case AddWeakConnections:
-            op.AMGSmoothedAggregation(
-                this->relax_, connections, aggregates, aggregate_root_nodes, pro, 0);
-            break;
-        case SubtractWeakConnections:
-            op.AMGSmoothedAggregation(
-                this->relax_, connections, aggregates, aggregate_root_nodes, pro, 1);
+            op.AMGPMISAggregate(eps, connections, aggregates, aggregate_root_nodes);
             break;
+        case HMIS:
+            LOG_INFO("SAAMG::Aggregate_() HMIS coarsening is only available for Ruge-Stueben "
+                     "AMG, use PMIS instead");
+            FATAL_ERROR(__FILE__, __LINE__);
         }
 
-        // Clean up
-        connections.Clear();
-        aggregates.Clear();
-        aggregate_root_nodes.Clear();
-
-        // Sanity check
-        assert(pro->GetM() == op.GetN());
+        this->SmoothAggregates_(
+            op, *connections, *aggregates, *aggregate_root_nodes, pro, res);
 
         // We need to revert the level creation, if the number of columns of P is zero
         // because in that case, R will have zero rows and thus the coarse level will be
         // a 0x0 matrix.
         if(pro->GetN() == 0)
         {
+            delete connections;
+            delete aggregates;
+            delete aggregate_root_nodes;
+
             return false;
         }
 
-        // Transpose P to obtain R
-        pro->Transpose(res);
+        // Store aggregation data for possible numerical rebuild
+        this->connections_level_.push_back(connections);
+        this->aggregates_level_.push_back(aggregates);
+        this->aggregate_root_nodes_level_.push_back(aggregate_root_nodes);
 
         // Create coarse operator
         coarse->CloneBackend(op);
@@ -71,8 +71,16 @@ namespace rocalution
         ROCALUTION_EXPORT
         void SetLumpingStrategy(LumpingStrategy lumping_strat);
 
+        /** \brief Rebuild the hierarchy numerically
+        * \details
+        * The aggregates of the previous Build() are kept. The prolongation and restriction
+        * operators are smoothed with the new values of the operator and the coarse
+        * operators are recomputed.
+        */
         ROCALUTION_EXPORT
         virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void ClearLocal(void);
 
     protected:
         virtual bool Aggregate_(const OperatorType& op,
@@ -81,6 +89,14 @@ namespace rocalution
                                 OperatorType*       coarse,
                                 LocalVector<int>*   trans);
 
+        /** \brief Constructs the prolongation and restriction operator from the aggregates */
+        void SmoothAggregates_(const OperatorType&         op,
+                               const LocalVector<bool>&    connections,
+                               const LocalVector<int64_t>& aggregates,
+                               const LocalVector<int64_t>& aggregate_root_nodes,
+                               OperatorType*               pro,
+                               OperatorType*               res) const;
+
         virtual void PrintStart_(void) const;
         virtual void PrintEnd_(void) const;
 
@@ -96,6 +112,11 @@ namespace rocalution
 
         /** \brief Lumping strategy */
         LumpingStrategy lumping_strat_;
+
+        // Aggregation data of each level for numerical rebuilds
+        std::vector<LocalVector<bool>*>    connections_level_;
+        std::vector<LocalVector<int64_t>*> aggregates_level_;
+        std::vector<LocalVector<int64_t>*> aggregate_root_nodes_level_;
     };
 
 } // namespace rocalution
@@ -121,9 +121,15 @@ namespace rocalution
         assert(this->build_);
         assert(this->op_ != NULL);
 
-        // Create coarse operator
-        this->op_level_[0]->Clear();
-        this->op_level_[0]->ConvertToCSR();
+        // Create coarse operator, its CSR structure is reused if it contains the product
+        bool reuse = this->op_level_[0]->GetFormat() == CSR;
+
+        if(reuse == false)
+        {
+            this->op_level_[0]->Clear();
+            this->op_level_[0]->ConvertToCSR();
+        }
+
         this->op_level_[0]->CloneBackend(*this->op_);
 
         assert(this->restrict_op_level_[0] != NULL);
@@ -136,18 +142,23 @@ namespace rocalution
             op_csr.ConvertToCSR();
 
             this->op_level_[0]->TripleMatrixProduct(
-                *this->restrict_op_level_[0], op_csr, *this->prolong_op_level_[0]);
+                *this->restrict_op_level_[0], op_csr, *this->prolong_op_level_[0], reuse);
         }
         else
         {
             this->op_level_[0]->TripleMatrixProduct(
-                *this->restrict_op_level_[0], *this->op_, *this->prolong_op_level_[0]);
+                *this->restrict_op_level_[0], *this->op_, *this->prolong_op_level_[0], reuse);
         }
 
         for(int i = 1; i < this->levels_ - 1; ++i)
         {
-            this->op_level_[i]->Clear();
-            this->op_level_[i]->ConvertToCSR();
+            reuse = this->op_level_[i]->GetFormat() == CSR;
+
+            if(reuse == false)
+            {
+                this->op_level_[i]->Clear();
+                this->op_level_[i]->ConvertToCSR();
+            }
 
             // Create coarse operator
             OperatorType tmp;
@@ -162,8 +173,10 @@ namespace rocalution
                 this->op_level_[i - 1]->MoveToHost();
             }
 
-            this->op_level_[i]->TripleMatrixProduct(
-                *this->restrict_op_level_[i], *this->op_level_[i - 1], *this->prolong_op_level_[i]);
+            this->op_level_[i]->TripleMatrixProduct(*this->restrict_op_level_[i],
+                                                    *this->op_level_[i - 1],
+                                                    *this->prolong_op_level_[i],
+                                                    reuse);
 
             if(i == this->levels_ - this->host_level_ - 1)
             {
@@ -234,6 +247,10 @@ namespace rocalution
         case PMIS:
             op.AMGPMISAggregate(eps, &connections, &aggregates, &aggregate_root_nodes);
             break;
+        case HMIS:
+            LOG_INFO("UAAMG::Aggregate_() HMIS coarsening is only available for Ruge-Stueben "
+                     "AMG, use PMIS instead");
+            FATAL_ERROR(__FILE__, __LINE__);
         }
 
         op.AMGUnsmoothedAggregation(aggregates, aggregate_root_nodes, pro);
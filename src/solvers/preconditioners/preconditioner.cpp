@@ -31,6 +31,7 @@
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profile.hpp"
 
 #include <complex>
 #include <math.h>
@@ -68,6 +69,8 @@ namespace rocalution
     {
         log_debug(this, "Preconditioner::SolveZeroSol()", (const void*&)rhs, x);
 
+        ProfileRegion region(ProfilePhase_Precond);
+
         this->Solve(rhs, x);
     }
 
@@ -469,6 +472,28 @@ namespace rocalution
         log_debug(this, "ILU::Build()", this->build_, " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ILU<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "ILU::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true && this->ILU_.GetFormat() == this->op_->GetFormat())
+        {
+            // The ILU(p) pattern and the triangular solve analysis only depend on the
+            // structure, thus only the values are refreshed and re-factorized
+            this->ILU_.Zeros();
+            this->ILU_.MatrixAdd(
+                *this->op_, static_cast<ValueType>(0), static_cast<ValueType>(1), false);
+
+            this->ILU_.ILU0Factorize();
+        }
+        else
+        {
+            this->Clear();
+            this->Build();
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void ILU<OperatorType, VectorType, ValueType>::Clear(void)
     {
@@ -792,6 +817,27 @@ namespace rocalution
         log_debug(this, "ILUT::Build()", this->build_, " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ILUT<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "ILUT::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true && this->ILUT_.GetFormat() == this->op_->GetFormat())
+        {
+            // Factorize the new values on the frozen ILUT pattern
+            this->ILUT_.Zeros();
+            this->ILUT_.MatrixAdd(
+                *this->op_, static_cast<ValueType>(0), static_cast<ValueType>(1), false);
+
+            this->ILUT_.ILU0Factorize();
+        }
+        else
+        {
+            this->Clear();
+            this->Build();
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void ILUT<OperatorType, VectorType, ValueType>::Clear(void)
     {
@@ -883,6 +929,31 @@ namespace rocalution
         log_debug(this, "IC::Build()", this->build_, " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IC<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "IC::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true && this->IC_.GetFormat() == this->op_->GetFormat())
+        {
+            // The lower triangular pattern and the triangular solve analysis are kept,
+            // the values are refreshed from the operator and re-factorized
+            this->IC_.Zeros();
+            this->IC_.MatrixAdd(
+                *this->op_, static_cast<ValueType>(0), static_cast<ValueType>(1), false);
+
+            // The inverse diagonal is not moved together with the preconditioner
+            this->inv_diag_entries_.CloneBackend(this->IC_);
+
+            this->IC_.ICFactorize(&this->inv_diag_entries_);
+        }
+        else
+        {
+            this->Clear();
+            this->Build();
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IC<OperatorType, VectorType, ValueType>::Clear(void)
     {
@@ -231,6 +231,8 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
         virtual void Clear(void);
 
     protected:
@@ -375,6 +377,13 @@ namespace rocalution
 
         ROCALUTION_EXPORT
         virtual void Build(void);
+        /** \brief Re-factorize on the sparsity pattern of the previous Build()
+        * \details
+        * The new values of the operator are factorized without fill-in on the pattern
+        * that has been computed by the last Build(), no further entries are dropped.
+        */
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
         ROCALUTION_EXPORT
         virtual void Clear(void);
 
@@ -416,6 +425,8 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
         virtual void Clear(void);
 
     protected:
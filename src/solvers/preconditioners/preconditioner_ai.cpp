@@ -290,6 +290,40 @@ namespace rocalution
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void FSAI<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "FSAI::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            assert(this->op_ != NULL);
+
+            // The previous factor serves as external pattern, such that the symbolic
+            // power of the operator is not computed again
+            OperatorType pattern;
+            pattern.CloneFrom(this->FSAI_L_);
+            pattern.ConvertToCSR();
+            pattern.CloneBackend(*this->op_);
+
+            this->FSAI_L_.CloneFrom(*this->op_);
+            this->FSAI_L_.FSAI(this->matrix_power_, &pattern);
+
+            this->FSAI_LT_.CloneBackend(*this->op_);
+            this->FSAI_L_.Transpose(&this->FSAI_LT_);
+
+            if(this->op_mat_format_ == true)
+            {
+                this->FSAI_L_.ConvertTo(this->precond_mat_format_, this->format_block_dim_);
+                this->FSAI_LT_.ConvertTo(this->precond_mat_format_, this->format_block_dim_);
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void FSAI<OperatorType, VectorType, ValueType>::Clear(void)
     {
@@ -415,6 +449,31 @@ namespace rocalution
         log_debug(this, "SPAI::Build()", this->build_, " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SPAI<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "SPAI::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            assert(this->op_ != NULL);
+
+            // SPAI is based on the pattern of the operator, there is no symbolic phase
+            // to skip. Clear() is avoided, as it would reset the preconditioner format.
+            this->SPAI_.CloneFrom(*this->op_);
+            this->SPAI_.SPAI();
+
+            if(this->op_mat_format_ == true)
+            {
+                this->SPAI_.ConvertTo(this->precond_mat_format_, this->format_block_dim_);
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void SPAI<OperatorType, VectorType, ValueType>::Clear(void)
     {
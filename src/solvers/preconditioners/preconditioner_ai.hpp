@@ -118,6 +118,9 @@ namespace rocalution
 
         ROCALUTION_EXPORT
         virtual void Build(void);
+        /** \brief Recompute the preconditioner on the sparsity pattern of the previous Build() */
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
         ROCALUTION_EXPORT
         virtual void Clear(void);
 
@@ -177,6 +180,8 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
         virtual void Clear(void);
 
         /** \brief Set the matrix format of the preconditioner */
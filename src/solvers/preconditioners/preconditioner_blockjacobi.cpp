@@ -31,6 +31,7 @@
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profile.hpp"
 
 #include "preconditioner.hpp"
 
@@ -146,6 +147,8 @@ namespace rocalution
     {
         log_debug(this, "BlockJacobi::SolveZeroSol()", " #*# begin", (const void*&)rhs, x);
 
+        ProfileRegion region(ProfilePhase_Precond);
+
         this->local_precond_->SolveZeroSol(rhs.GetInterior(), &x->GetInterior());
 
         log_debug(this, "BlockJacobi::SolveZeroSol()", " #*# end");
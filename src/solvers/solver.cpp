@@ -25,6 +25,7 @@
 #include "../utils/def.hpp"
 
 #include "../base/local_matrix.hpp"
+#include "../base/local_multi_vector.hpp"
 #include "../base/local_stencil.hpp"
 #include "../base/local_vector.hpp"
 
@@ -33,11 +34,55 @@
 
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profile.hpp"
 
 #include <complex>
+#include <type_traits>
+#include <vector>
 
 namespace rocalution
 {
+    // Multi-vector columns can only be exchanged with local vectors
+    template <typename ValueType>
+    static void multi_get_column(const LocalMultiVector<ValueType>& src,
+                                 int                                j,
+                                 LocalVector<ValueType>*            dst)
+    {
+        if(dst->GetSize() != src.GetSize())
+        {
+            dst->Clear();
+            dst->CloneBackend(src);
+        }
+
+        src.GetColumn(j, dst);
+    }
+
+    template <typename ValueType>
+    static void multi_get_column(const LocalMultiVector<ValueType>& src,
+                                 int                                j,
+                                 GlobalVector<ValueType>*           dst)
+    {
+        LOG_INFO("Multi-vector solves are only supported for local vectors");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    static void multi_set_column(LocalMultiVector<ValueType>*  dst,
+                                 int                           j,
+                                 const LocalVector<ValueType>& src)
+    {
+        dst->SetColumn(j, src);
+    }
+
+    template <typename ValueType>
+    static void multi_set_column(LocalMultiVector<ValueType>*   dst,
+                                 int                            j,
+                                 const GlobalVector<ValueType>& src)
+    {
+        LOG_INFO("Multi-vector solves are only supported for local vectors");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     SolverDescr::SolverDescr() {}
 
     SolverDescr::SolverDescr(const SolverDescr& other)
@@ -185,6 +230,51 @@ namespace rocalution
         this->Solve(rhs, x);
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Solver<OperatorType, VectorType, ValueType>::SolveMulti(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "Solver::SolveMulti()", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(rhs.GetSize() == x->GetSize());
+        assert(rhs.GetNumVectors() == x->GetNumVectors());
+
+        if(std::is_same<VectorType, LocalVector<ValueType>>::value == false)
+        {
+            LOG_INFO("Multi-vector solves are only supported for local vectors");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        ProfileRegion region(this->is_precond_ ? ProfilePhase_Precond : ProfilePhase_Solve,
+                             &this->profile_);
+
+        // Solve one system after the other
+        VectorType b;
+        VectorType y;
+
+        for(int j = 0; j < rhs.GetNumVectors(); ++j)
+        {
+            multi_get_column(rhs, j, &b);
+            multi_get_column(*x, j, &y);
+
+            this->Solve(b, &y);
+
+            multi_set_column(x, j, y);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Solver<OperatorType, VectorType, ValueType>::SolveMultiZeroSol(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "Solver::SolveMultiZeroSol()", (const void*&)rhs, x);
+
+        x->Zeros();
+        this->SolveMulti(rhs, x);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void Solver<OperatorType, VectorType, ValueType>::Build(void)
     {
@@ -300,6 +390,36 @@ namespace rocalution
         this->solver_descr_ = descr;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Solver<OperatorType, VectorType, ValueType>::EnableProfiling(bool sync)
+    {
+        log_debug(this, "Solver::EnableProfiling()", sync);
+
+        this->profile_.Enable(sync);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Solver<OperatorType, VectorType, ValueType>::DisableProfiling(void)
+    {
+        log_debug(this, "Solver::DisableProfiling()");
+
+        this->profile_.Disable();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Solver<OperatorType, VectorType, ValueType>::ResetProfile(void)
+    {
+        log_debug(this, "Solver::ResetProfile()");
+
+        this->profile_.Reset();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    const SolverProfile& Solver<OperatorType, VectorType, ValueType>::GetProfile(void) const
+    {
+        return this->profile_;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     IterativeLinearSolver<OperatorType, VectorType, ValueType>::IterativeLinearSolver()
     {
@@ -468,6 +588,79 @@ namespace rocalution
         return 0;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    ValueType IterativeLinearSolver<OperatorType, VectorType, ValueType>::Norm_(
+        const VectorType& vec, ValueType norm2)
+    {
+        log_debug(this, "IterativeLinearSolver::Norm_()", (const void*&)vec, norm2);
+
+        // L2 norm can be obtained from the squared L2 norm without another sweep
+        if(this->res_norm_type_ == 2)
+        {
+            return std::sqrt(norm2);
+        }
+
+        return this->Norm_(vec);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::NormMulti_(
+        const LocalMultiVector<ValueType>& vec, std::vector<double>* nrm)
+    {
+        log_debug(this, "IterativeLinearSolver::NormMulti_()", (const void*&)vec, nrm);
+
+        assert(nrm != NULL);
+
+        int num_vec = vec.GetNumVectors();
+
+        std::vector<ValueType> col_nrm(num_vec, static_cast<ValueType>(0));
+
+        // L2 norm of all vectors in a single sweep
+        if(this->res_norm_type_ == 2)
+        {
+            vec.Norm(col_nrm.data());
+        }
+        else
+        {
+            LocalVector<ValueType> col;
+            col.CloneBackend(vec);
+
+            ValueType amax = static_cast<ValueType>(0);
+
+            for(int j = 0; j < num_vec; ++j)
+            {
+                vec.GetColumn(j, &col);
+
+                // L1 norm
+                if(this->res_norm_type_ == 1)
+                {
+                    col_nrm[j] = col.Asum();
+                }
+
+                // Infinity norm
+                if(this->res_norm_type_ == 3)
+                {
+                    int64_t index = col.Amax(col_nrm[j]);
+
+                    // Index of the largest entry within the multi-vector
+                    if(j == 0 || std::abs(col_nrm[j]) > std::abs(amax))
+                    {
+                        amax         = col_nrm[j];
+                        this->index_ = index + j * vec.GetSize();
+                    }
+                }
+            }
+        }
+
+        // Each system is checked against its own tolerance
+        nrm->resize(num_vec);
+
+        for(int j = 0; j < num_vec; ++j)
+        {
+            (*nrm)[j] = std::abs(col_nrm[j]);
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IterativeLinearSolver<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs,
                                                                            VectorType*       x)
@@ -479,6 +672,9 @@ namespace rocalution
         assert(this->op_ != NULL);
         assert(this->build_ == true);
 
+        ProfileRegion region(this->is_precond_ ? ProfilePhase_Precond : ProfilePhase_Solve,
+                             &this->profile_);
+
         if(this->verb_ > 0)
         {
             this->PrintStart_();
@@ -501,6 +697,92 @@ namespace rocalution
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SolveMulti(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "IterativeLinearSolver::SolveMulti()", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(rhs.GetSize() == x->GetSize());
+        assert(rhs.GetNumVectors() == x->GetNumVectors());
+
+        if(std::is_same<VectorType, LocalVector<ValueType>>::value == false)
+        {
+            LOG_INFO("Multi-vector solves are only supported for local vectors");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        ProfileRegion region(this->is_precond_ ? ProfilePhase_Precond : ProfilePhase_Solve,
+                             &this->profile_);
+
+        if(this->verb_ > 0)
+        {
+            this->PrintStart_();
+            this->iter_ctrl_.PrintInit();
+        }
+
+        if(this->precond_ == NULL)
+        {
+            this->SolveMultiNonPrecond_(rhs, x);
+        }
+        else
+        {
+            this->SolveMultiPrecond_(rhs, x);
+        }
+
+        if(this->verb_ > 0)
+        {
+            this->iter_ctrl_.PrintStatus();
+            this->PrintEnd_();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SolveMultiNonPrecond_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "IterativeLinearSolver::SolveMultiNonPrecond_()", (const void*&)rhs, x);
+
+        // Solve one system after the other
+        VectorType b;
+        VectorType y;
+
+        for(int j = 0; j < rhs.GetNumVectors(); ++j)
+        {
+            multi_get_column(rhs, j, &b);
+            multi_get_column(*x, j, &y);
+
+            this->SolveNonPrecond_(b, &y);
+
+            multi_set_column(x, j, y);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SolveMultiPrecond_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "IterativeLinearSolver::SolveMultiPrecond_()", (const void*&)rhs, x);
+
+        // Solve one system after the other
+        VectorType b;
+        VectorType y;
+
+        for(int j = 0; j < rhs.GetNumVectors(); ++j)
+        {
+            multi_get_column(rhs, j, &b);
+            multi_get_column(*x, j, &y);
+
+            this->SolvePrecond_(b, &y);
+
+            multi_set_column(x, j, y);
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SetPreconditioner(
         Solver<OperatorType, VectorType, ValueType>& precond)
@@ -615,6 +897,8 @@ namespace rocalution
     {
         log_debug(this, "FixedPoint::Build()", "#*# begin");
 
+        ProfileRegion region(ProfilePhase_Build, &this->profile_);
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -652,6 +936,9 @@ namespace rocalution
         assert(this->precond_ != NULL);
         assert(this->build_ == true);
 
+        ProfileRegion region(this->is_precond_ ? ProfilePhase_Precond : ProfilePhase_Solve,
+                             &this->profile_);
+
         if(this->verb_ > 0)
         {
             this->PrintStart_();
@@ -706,8 +993,7 @@ namespace rocalution
             // x^(k+1) = x^k + omega * (b - Ax^k)
 
             // inital residual x_res = b - Ax
-            this->op_->Apply(*x, &this->x_res_);
-            this->x_res_.ScaleAdd(static_cast<ValueType>(-1), rhs);
+            this->op_->Residual(rhs, *x, &this->x_res_);
 
             // Solve M x_old = x_res
             this->precond_->SolveZeroSol(this->x_res_, &this->x_old_);
@@ -718,8 +1004,7 @@ namespace rocalution
             for(int iter = 1; iter < steps; ++iter)
             {
                 // x_res = b - Ax
-                this->op_->Apply(*x, &this->x_res_);
-                this->x_res_.ScaleAdd(static_cast<ValueType>(-1), rhs);
+                this->op_->Residual(rhs, *x, &this->x_res_);
 
                 // Solve M x_old = x_res
                 this->precond_->SolveZeroSol(this->x_res_, &this->x_old_);
@@ -739,8 +1024,7 @@ namespace rocalution
             // x^(k+1) = x^k + omega * (b - Ax^k)
 
             // inital residual x_res = b - Ax
-            this->op_->Apply(*x, &this->x_res_);
-            this->x_res_.ScaleAdd(static_cast<ValueType>(-1), rhs);
+            this->op_->Residual(rhs, *x, &this->x_res_);
 
             ValueType res = this->Norm_(this->x_res_);
 
@@ -768,8 +1052,7 @@ namespace rocalution
                 }
 
                 // x_res = b - Ax
-                this->op_->Apply(*x, &this->x_res_);
-                this->x_res_.ScaleAdd(static_cast<ValueType>(-1), rhs);
+                this->op_->Residual(rhs, *x, &this->x_res_);
 
                 res = this->Norm_(this->x_res_);
 
@@ -814,7 +1097,10 @@ namespace rocalution
             // x^(k+1) = x^k + omega * (b - Ax^k)
 
             // Solve M x = rhs
-            this->precond_->Solve(rhs, x);
+            {
+                ProfileRegion region(ProfilePhase_Precond);
+                this->precond_->Solve(rhs, x);
+            }
 
             // x *= omega
             x->Scale(this->omega_);
@@ -823,8 +1109,7 @@ namespace rocalution
             for(int iter = 1; iter < steps; ++iter)
             {
                 // x_res = rhs - Ax
-                this->op_->Apply(*x, &this->x_res_);
-                this->x_res_.ScaleAdd(static_cast<ValueType>(-1), rhs);
+                this->op_->Residual(rhs, *x, &this->x_res_);
 
                 // Solve M x_old = x_res
                 this->precond_->SolveZeroSol(this->x_res_, &this->x_old_);
@@ -853,7 +1138,10 @@ namespace rocalution
             }
 
             // Solve M x_old = rhs
-            this->precond_->Solve(rhs, x);
+            {
+                ProfileRegion region(ProfilePhase_Precond);
+                this->precond_->Solve(rhs, x);
+            }
 
             // x *= omega
             x->Scale(this->omega_);
@@ -863,8 +1151,7 @@ namespace rocalution
                 while(true)
                 {
                     // x_res = rhs - Ax
-                    this->op_->Apply(*x, &this->x_res_);
-                    this->x_res_.ScaleAdd(static_cast<ValueType>(-1), rhs);
+                    this->op_->Residual(rhs, *x, &this->x_res_);
 
                     res = this->Norm_(this->x_res_);
 
@@ -947,6 +1234,9 @@ namespace rocalution
         assert(this->op_ != NULL);
         assert(this->build_ == true);
 
+        ProfileRegion region(this->is_precond_ ? ProfilePhase_Precond : ProfilePhase_Solve,
+                             &this->profile_);
+
         if(this->verb_ > 0)
         {
             this->PrintStart_();
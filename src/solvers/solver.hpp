@@ -25,7 +25,9 @@
 #define ROCALUTION_SOLVER_HPP_
 
 #include "../base/base_rocalution.hpp"
+#include "../base/local_multi_vector.hpp"
 #include "../base/local_vector.hpp"
+#include "../utils/profile.hpp"
 #include "iter_ctrl.hpp"
 #include "rocalution/export.hpp"
 
@@ -203,6 +205,25 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void SolveZeroSol(const VectorType& rhs, VectorType* x);
 
+        /** \brief Solve Operator x_j = rhs_j for all vectors of a multi-vector
+        * \details
+        * By default, the systems are solved one after the other. Solvers that support
+        * multiple right-hand sides natively (e.g. CG, GMRES and the multigrid solvers)
+        * share each operator application among all systems and stop once every system
+        * meets the absolute or relative tolerance with respect to its own initial
+        * residual. Multi-vector solves are only available for local vectors.
+        */
+        ROCALUTION_EXPORT
+        virtual void SolveMulti(const LocalMultiVector<ValueType>& rhs,
+                                LocalMultiVector<ValueType>*       x);
+
+        /** \brief Solve Operator x_j = rhs_j for all vectors of a multi-vector, setting
+        * initial x = 0
+        */
+        ROCALUTION_EXPORT
+        virtual void SolveMultiZeroSol(const LocalMultiVector<ValueType>& rhs,
+                                       LocalMultiVector<ValueType>*       x);
+
         /** \brief Clear (free all local data) the solver */
         ROCALUTION_EXPORT
         virtual void Clear(void);
@@ -245,6 +266,25 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void SetSolverDescriptor(const SolverDescr& descr);
 
+        /** \brief Enable the recording of wall time and call counts per phase
+        * \details
+        * When enabled, Build() and Solve() record the time spent in SpMV, preconditioner
+        * applications, reductions, halo exchanges and multigrid level operations into
+        * the solver profile. If \p sync is false, the accelerator is not synchronized
+        * at phase boundaries. See SolverProfile for details.
+        */
+        ROCALUTION_EXPORT
+        void EnableProfiling(bool sync = true);
+        /** \brief Disable the recording of wall time and call counts per phase */
+        ROCALUTION_EXPORT
+        void DisableProfiling(void);
+        /** \brief Reset the recorded profile */
+        ROCALUTION_EXPORT
+        void ResetProfile(void);
+        /** \brief Return the recorded profile */
+        ROCALUTION_EXPORT
+        const SolverProfile& GetProfile(void) const;
+
         /** \brief Mark this solver as being a preconditioner */
         inline void FlagPrecond(void)
         {
@@ -284,6 +324,9 @@ namespace rocalution
         /** \brief Verbose flag */
         int verb_;
 
+        /** \brief Recorded wall time and call counts per phase */
+        SolverProfile profile_;
+
         /** \brief Print starting message of the solver */
         virtual void PrintStart_(void) const = 0;
         /** \brief Print ending message of the solver */
@@ -401,6 +444,11 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Solve(const VectorType& rhs, VectorType* x);
 
+        /** \brief Solve Operator x_j = rhs_j for all vectors of a multi-vector */
+        ROCALUTION_EXPORT
+        virtual void SolveMulti(const LocalMultiVector<ValueType>& rhs,
+                                LocalMultiVector<ValueType>*       x);
+
         /** \brief Set a preconditioner of the linear solver */
         ROCALUTION_EXPORT
         virtual void SetPreconditioner(Solver<OperatorType, VectorType, ValueType>& precond);
@@ -433,6 +481,21 @@ namespace rocalution
         /** \brief Preconditioned solution procedure */
         virtual void SolvePrecond_(const VectorType& rhs, VectorType* x) = 0;
 
+        /** \brief Non-preconditioned solution procedure for multiple right-hand sides; solves
+        * one system after the other, unless overloaded by the solver
+        */
+        virtual void SolveMultiNonPrecond_(const LocalMultiVector<ValueType>& rhs,
+                                           LocalMultiVector<ValueType>*       x);
+
+        /** \brief Preconditioned solution procedure for multiple right-hand sides; solves one
+        * system after the other, unless overloaded by the solver
+        */
+        virtual void SolveMultiPrecond_(const LocalMultiVector<ValueType>& rhs,
+                                        LocalMultiVector<ValueType>*       x);
+
+        /** \brief Computes the vector norm of each vector of a multi-vector */
+        void NormMulti_(const LocalMultiVector<ValueType>& vec, std::vector<double>* nrm);
+
         /** \brief Residual norm type (i.e. L1, L2, L-infinity etc) */
         int res_norm_type_;
 
@@ -441,6 +504,8 @@ namespace rocalution
 
         /** \brief Computes the vector norm */
         ValueType Norm_(const VectorType& vec);
+        /** \brief Computes the vector norm, reusing its already known squared \f$L_2\f$ norm */
+        ValueType Norm_(const VectorType& vec, ValueType norm2);
     };
 
     /** \ingroup solver_module
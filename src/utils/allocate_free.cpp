@@ -29,10 +29,27 @@
 #include "communicator.hpp"
 #endif
 
+#if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__) \
+    || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ROCALUTION_HOST_MMAP
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
 
 namespace rocalution
 {
@@ -40,6 +57,449 @@ namespace rocalution
     //#define LONG_PTR size_t
     //#define LONG_PTR long
 
+    // Alignment of the host memory pool buffers
+#define HOST_POOL_ALIGNMENT 64
+
+    // Size class caching pool for host buffers, see enable_host_memory_pool()
+    struct HostMemoryPool
+    {
+        std::mutex        mutex;
+        std::atomic<bool> enabled{false};
+
+        // Number of pool buffers in use, to skip the lookup in free_host() when zero
+        std::atomic<int64_t> live_count{0};
+
+        // Cached buffers per size class
+        std::map<size_t, std::vector<void*>> cache;
+        // Size class of each pool buffer in use
+        std::unordered_map<void*, size_t> live;
+
+        int64_t allocations  = 0;
+        int64_t hits         = 0;
+        int64_t live_bytes   = 0;
+        int64_t peak_bytes   = 0;
+        int64_t cached_bytes = 0;
+
+        ~HostMemoryPool();
+    };
+
+    static void* _host_pool_raw_allocate(size_t size)
+    {
+        // total size = size + (alignment-1) + (void ptr)
+        void* non_aligned = malloc(size + (HOST_POOL_ALIGNMENT - 1) + sizeof(void*));
+
+        if(non_aligned == NULL)
+        {
+            return NULL;
+        }
+
+        void* aligned = reinterpret_cast<void*>(
+            (reinterpret_cast<uintptr_t>(non_aligned) + sizeof(void*) + HOST_POOL_ALIGNMENT - 1)
+            & ~static_cast<uintptr_t>(HOST_POOL_ALIGNMENT - 1));
+        *(reinterpret_cast<void**>(aligned) - 1) = non_aligned;
+
+        return aligned;
+    }
+
+    static void _host_pool_raw_free(void* ptr)
+    {
+        free(*(reinterpret_cast<void**>(ptr) - 1));
+    }
+
+    // Release all cached buffers, pool mutex must be held
+    static void _host_pool_release_cache(HostMemoryPool& pool)
+    {
+        for(auto& c : pool.cache)
+        {
+            for(void* ptr : c.second)
+            {
+                _host_pool_raw_free(ptr);
+            }
+        }
+
+        pool.cache.clear();
+        pool.cached_bytes = 0;
+    }
+
+    HostMemoryPool::~HostMemoryPool()
+    {
+        _host_pool_release_cache(*this);
+    }
+
+    static HostMemoryPool& _host_pool(void)
+    {
+        static HostMemoryPool pool;
+
+        return pool;
+    }
+
+    // Round up to the size class, 64 bytes granularity for small buffers and four
+    // classes per power of two for large buffers
+    static size_t _host_pool_size_class(size_t size)
+    {
+        if(size <= 1024)
+        {
+            return (size + HOST_POOL_ALIGNMENT - 1) & ~static_cast<size_t>(HOST_POOL_ALIGNMENT - 1);
+        }
+
+        size_t pow2 = 1024;
+        while(pow2 <= size / 2)
+        {
+            pow2 *= 2;
+        }
+
+        size_t step = pow2 / 4;
+
+        return (size + step - 1) / step * step;
+    }
+
+    // Obtain a buffer from the pool, returns NULL if the pool is disabled
+    static void* _host_pool_allocate(size_t size)
+    {
+        HostMemoryPool& pool = _host_pool();
+
+        if(pool.enabled.load(std::memory_order_relaxed) == false)
+        {
+            return NULL;
+        }
+
+        size_t sclass = _host_pool_size_class(size);
+        void*  ptr    = NULL;
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        auto it = pool.cache.find(sclass);
+
+        if(it != pool.cache.end() && it->second.empty() == false)
+        {
+            ptr = it->second.back();
+            it->second.pop_back();
+
+            pool.cached_bytes -= sclass;
+            ++pool.hits;
+        }
+        else
+        {
+            ptr = _host_pool_raw_allocate(sclass);
+
+            if(ptr == NULL)
+            {
+                // Give the cached buffers back to the system and try again
+                _host_pool_release_cache(pool);
+                ptr = _host_pool_raw_allocate(sclass);
+            }
+
+            if(ptr == NULL)
+            {
+                LOG_INFO("Cannot allocate memory");
+                LOG_VERBOSE_INFO(2, "Size of the requested buffer = " << size);
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+        }
+
+        pool.live[ptr] = sclass;
+        pool.live_count.fetch_add(1, std::memory_order_relaxed);
+
+        ++pool.allocations;
+        pool.live_bytes += sclass;
+        pool.peak_bytes = std::max(pool.peak_bytes, pool.live_bytes);
+
+        return ptr;
+    }
+
+    // Return a buffer to the pool, returns false if it has not been allocated by the pool
+    static bool _host_pool_free(void* ptr)
+    {
+        HostMemoryPool& pool = _host_pool();
+
+        if(pool.live_count.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        auto it = pool.live.find(ptr);
+
+        if(it == pool.live.end())
+        {
+            return false;
+        }
+
+        size_t sclass = it->second;
+
+        pool.live.erase(it);
+        pool.live_count.fetch_sub(1, std::memory_order_relaxed);
+        pool.live_bytes -= sclass;
+
+        if(pool.enabled.load(std::memory_order_relaxed) == true)
+        {
+            pool.cache[sclass].push_back(ptr);
+            pool.cached_bytes += sclass;
+        }
+        else
+        {
+            _host_pool_raw_free(ptr);
+        }
+
+        return true;
+    }
+
+    // File mappings and the arrays that have been adopted from them, see map_host_file()
+    struct HostMappingRegistry
+    {
+        std::mutex mutex;
+
+        // Number of adopted arrays, to skip the lookup in free_host() when zero
+        std::atomic<int64_t> num_arrays{0};
+
+        // Size and number of references (adopted arrays and the mapping itself) of each
+        // mapping
+        std::unordered_map<void*, std::pair<size_t, int64_t>> mappings;
+        // Mapping of each adopted array
+        std::unordered_map<const void*, void*> arrays;
+    };
+
+    static HostMappingRegistry& _host_mappings(void)
+    {
+        static HostMappingRegistry registry;
+
+        return registry;
+    }
+
+    // Drop a reference of a mapping and unmap it when unreferenced, registry mutex must
+    // be held
+    static void _host_mapping_unref(HostMappingRegistry& registry, void* mapping)
+    {
+        auto it = registry.mappings.find(mapping);
+
+        assert(it != registry.mappings.end());
+
+        if(--it->second.second == 0)
+        {
+#ifdef ROCALUTION_HOST_MMAP
+            munmap(mapping, it->second.first);
+#endif
+            registry.mappings.erase(it);
+        }
+    }
+
+    // Release an adopted array, returns false if it does not belong to a mapping
+    static bool _host_mapping_free(void* ptr)
+    {
+        HostMappingRegistry& registry = _host_mappings();
+
+        if(registry.num_arrays.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto it = registry.arrays.find(ptr);
+
+        if(it == registry.arrays.end())
+        {
+            return false;
+        }
+
+        void* mapping = it->second;
+
+        registry.arrays.erase(it);
+        registry.num_arrays.fetch_sub(1, std::memory_order_relaxed);
+
+        _host_mapping_unref(registry, mapping);
+
+        return true;
+    }
+
+    void* map_host_file(const char* filename, size_t* size)
+    {
+        log_debug(0, "map_host_file()", filename, size);
+
+        assert(filename != NULL);
+        assert(size != NULL);
+
+#ifdef ROCALUTION_HOST_MMAP
+        int fd = open(filename, O_RDONLY);
+
+        if(fd < 0)
+        {
+            return NULL;
+        }
+
+        struct stat st;
+
+        if(fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            close(fd);
+            return NULL;
+        }
+
+        // Private writable mapping, modified pages are copied on write
+        void* mapping = mmap(NULL,
+                             static_cast<size_t>(st.st_size),
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE,
+                             fd,
+                             0);
+
+        // The mapping stays valid after closing the file
+        close(fd);
+
+        if(mapping == MAP_FAILED)
+        {
+            return NULL;
+        }
+
+        *size = static_cast<size_t>(st.st_size);
+
+        HostMappingRegistry& registry = _host_mappings();
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        registry.mappings[mapping] = std::make_pair(*size, static_cast<int64_t>(1));
+
+        return mapping;
+#else
+        return NULL;
+#endif
+    }
+
+    void adopt_host_mapping(void* mapping, const void* ptr)
+    {
+        log_debug(0, "adopt_host_mapping()", mapping, ptr);
+
+        HostMappingRegistry& registry = _host_mappings();
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto it = registry.mappings.find(mapping);
+
+        assert(it != registry.mappings.end());
+        assert(static_cast<const char*>(ptr) >= static_cast<const char*>(mapping));
+        assert(static_cast<const char*>(ptr)
+               < static_cast<const char*>(mapping) + it->second.first);
+        assert(registry.arrays.find(ptr) == registry.arrays.end());
+
+        ++it->second.second;
+
+        registry.arrays[ptr] = mapping;
+        registry.num_arrays.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void unmap_host_file(void* mapping)
+    {
+        log_debug(0, "unmap_host_file()", mapping);
+
+        if(mapping == NULL)
+        {
+            return;
+        }
+
+        HostMappingRegistry& registry = _host_mappings();
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        _host_mapping_unref(registry, mapping);
+    }
+
+    bool is_host_mapping(const void* ptr)
+    {
+        HostMappingRegistry& registry = _host_mappings();
+
+        if(registry.num_arrays.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        return registry.arrays.find(ptr) != registry.arrays.end();
+    }
+
+    void enable_host_memory_pool(void)
+    {
+        log_debug(0, "enable_host_memory_pool()");
+
+        HostMemoryPool& pool = _host_pool();
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        pool.enabled.store(true);
+    }
+
+    void disable_host_memory_pool(void)
+    {
+        log_debug(0, "disable_host_memory_pool()");
+
+        HostMemoryPool& pool = _host_pool();
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        pool.enabled.store(false);
+        _host_pool_release_cache(pool);
+    }
+
+    void trim_host_memory_pool(void)
+    {
+        log_debug(0, "trim_host_memory_pool()");
+
+        HostMemoryPool& pool = _host_pool();
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        _host_pool_release_cache(pool);
+    }
+
+    void get_host_memory_pool_stats(HostMemoryPoolStats* stats)
+    {
+        log_debug(0, "get_host_memory_pool_stats()", stats);
+
+        assert(stats != NULL);
+
+        HostMemoryPool& pool = _host_pool();
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        stats->allocations  = pool.allocations;
+        stats->hits         = pool.hits;
+        stats->hit_rate     = (pool.allocations > 0)
+                                  ? static_cast<double>(pool.hits) / pool.allocations
+                                  : 0.0;
+        stats->live_bytes   = pool.live_bytes;
+        stats->peak_bytes   = pool.peak_bytes;
+        stats->cached_bytes = pool.cached_bytes;
+    }
+
+    // In NUMA mode, touch the pages of a new buffer in parallel with the static partition
+    // of the host kernels, such that they are placed on the NUMA node of the thread that
+    // is going to access them
+    template <typename DataType>
+    static void _first_touch_host(int64_t n, DataType* ptr)
+    {
+#ifdef _OPENMP
+        const Rocalution_Backend_Descriptor* backend = _get_backend_descriptor();
+
+        if(backend->OpenMP_numa == false)
+        {
+            return;
+        }
+
+        // Same thread count as the host kernels, without changing the global OpenMP
+        // setting of the caller
+        int nt = (backend->OpenMP_threshold > 0 && n <= backend->OpenMP_threshold)
+                     ? 1
+                     : backend->OpenMP_threads;
+
+#pragma omp parallel for num_threads(nt) schedule(static)
+        for(int64_t i = 0; i < n; ++i)
+        {
+            ptr[i] = DataType();
+        }
+#endif
+    }
+
     template <typename DataType>
     void allocate_host(int64_t n, DataType** ptr)
     {
@@ -80,6 +540,28 @@ namespace rocalution
             // << " " << n);
             // *********************************************************
 
+            // *********************************************************
+            // Host memory pool
+            void* buffer = _host_pool_allocate(n * sizeof(DataType));
+
+            if(buffer != NULL)
+            {
+                *ptr = static_cast<DataType*>(buffer);
+
+                // Initialize the elements as new[] does
+                for(int64_t i = 0; i < n; ++i)
+                {
+                    new(*ptr + i) DataType;
+                }
+
+                _first_touch_host(n, *ptr);
+
+                log_debug(0, "allocate_host()", "* end", *ptr);
+
+                return;
+            }
+            // *********************************************************
+
             // *********************************************************
             // C++ style and error handling
 
@@ -91,6 +573,8 @@ namespace rocalution
                 LOG_VERBOSE_INFO(2, "Size of the requested buffer = " << n * sizeof(DataType));
                 FATAL_ERROR(__FILE__, __LINE__);
             }
+
+            _first_touch_host(n, *ptr);
             // *********************************************************
 
             assert(*ptr != NULL);
@@ -121,8 +605,11 @@ namespace rocalution
         }
 
         // *********************************************************
-        // C++ style
-        delete[] * ptr;
+        // C++ style, unless the buffer belongs to the host memory pool or a file mapping
+        if(_host_pool_free(*ptr) == false && _host_mapping_free(*ptr) == false)
+        {
+            delete[] * ptr;
+        }
         // *********************************************************
 
         // *********************************************************
@@ -26,6 +26,7 @@
 
 #include "rocalution/export.hpp"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace rocalution
@@ -129,6 +130,119 @@ namespace rocalution
   */
     template <typename DataType>
     ROCALUTION_EXPORT void copy_h2h(int64_t n, const DataType* src, DataType* dst);
+
+    /** \ingroup backend_module
+  * \brief Map a file into host memory
+  * \details
+  * \p map_host_file maps a file privately into host memory. The mapping is writable,
+  * modified pages are copied on write and never written back to the file. Arrays that
+  * lie within the mapping can be handed out with adopt_host_mapping() and are released
+  * with free_host(). The mapping is removed, once unmap_host_file() has been called and
+  * all adopted arrays have been freed.
+  *
+  * @param[in]
+  * filename    name of the file
+  * @param[out]
+  * size        size of the file in bytes
+  *
+  * \retval pointer to the mapped file, NULL if the file cannot be mapped or memory
+  * mapping is not supported
+  */
+    void* map_host_file(const char* filename, size_t* size);
+
+    /** \ingroup backend_module
+  * \brief Adopt an array that lies within a file mapping
+  * \details
+  * The array \p ptr has to be released with free_host().
+  *
+  * @param[in]
+  * mapping     pointer returned by map_host_file()
+  * @param[in]
+  * ptr         beginning of the array within the mapping
+  */
+    void adopt_host_mapping(void* mapping, const void* ptr);
+
+    /** \ingroup backend_module
+  * \brief Release a file mapping
+  * \details
+  * Arrays that have been adopted from the mapping stay valid until they are freed.
+  *
+  * @param[in]
+  * mapping     pointer returned by map_host_file()
+  */
+    void unmap_host_file(void* mapping);
+
+    /** \ingroup backend_module
+  * \brief Check whether an array has been adopted from a file mapping
+  * \details
+  * Arrays of matrices that are loaded with MapFileCSR() are adopted from the mapping,
+  * if their precision and alignment match.
+  *
+  * @param[in]
+  * ptr         beginning of the array
+  *
+  * \retval true if \p ptr has been adopted with adopt_host_mapping() and not been freed
+  */
+    ROCALUTION_EXPORT
+    bool is_host_mapping(const void* ptr);
+
+    /** \ingroup backend_module
+  * \brief Statistics of the host memory pool
+  */
+    struct HostMemoryPoolStats
+    {
+        /** \brief Number of buffers that have been allocated through the pool */
+        int64_t allocations;
+        /** \brief Number of allocations that have been served from cached buffers */
+        int64_t hits;
+        /** \brief Ratio of hits and allocations */
+        double hit_rate;
+        /** \brief Size in bytes of the pool buffers currently in use */
+        int64_t live_bytes;
+        /** \brief Maximum size in bytes of the pool buffers in use at the same time */
+        int64_t peak_bytes;
+        /** \brief Size in bytes of the cached buffers */
+        int64_t cached_bytes;
+    };
+
+    /** \ingroup backend_module
+  * \brief Enable the host memory pool
+  * \details
+  * \p enable_host_memory_pool enables a caching pool behind allocate_host() and
+  * free_host(). Buffers are rounded up to size classes and aligned to 64 bytes. Freed
+  * buffers are kept in the pool and reused by subsequent allocations of the same size
+  * class, e.g. when vectors and matrices are repeatedly cleared and allocated.
+  *
+  * \note While the pool is enabled, buffers obtained from allocate_host() (and hence
+  * buffers that are returned by LeaveDataPtr functions) must be released with
+  * free_host().
+  */
+    ROCALUTION_EXPORT
+    void enable_host_memory_pool(void);
+
+    /** \ingroup backend_module
+  * \brief Disable the host memory pool
+  * \details
+  * \p disable_host_memory_pool releases all cached buffers. Buffers that are still in
+  * use are returned to the system when they are freed.
+  */
+    ROCALUTION_EXPORT
+    void disable_host_memory_pool(void);
+
+    /** \ingroup backend_module
+  * \brief Release all cached buffers of the host memory pool
+  */
+    ROCALUTION_EXPORT
+    void trim_host_memory_pool(void);
+
+    /** \ingroup backend_module
+  * \brief Obtain the statistics of the host memory pool
+  *
+  * @param[out]
+  * stats   pool statistics
+  */
+    ROCALUTION_EXPORT
+    void get_host_memory_pool_stats(HostMemoryPoolStats* stats);
 } // namespace rocalution
 
 #endif // ROCALUTION_UTILS_ALLOCATE_FREE_HPP_
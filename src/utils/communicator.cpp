@@ -25,6 +25,7 @@
 #include "def.hpp"
 #include "log_mpi.hpp"
 
+#include <algorithm>
 #include <complex>
 
 namespace rocalution
@@ -174,6 +175,51 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    // Allreduce SUM - ASYNC
+    template <>
+    void communication_async_allreduce_sum(
+        double* local, double* global, int count, const void* comm, MRequest* request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_DOUBLE, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(
+        float* local, float* global, int count, const void* comm, MRequest* request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_FLOAT, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+#ifdef SUPPORT_COMPLEX
+    template <>
+    void communication_async_allreduce_sum(std::complex<double>* local,
+                                           std::complex<double>* global,
+                                           int                   count,
+                                           const void*           comm,
+                                           MRequest*             request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_DOUBLE_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(std::complex<float>* local,
+                                           std::complex<float>* global,
+                                           int                  count,
+                                           const void*          comm,
+                                           MRequest*            request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+#endif
+
     // Allreduce single MAX - SYNC
     template <>
     void communication_sync_allreduce_single_max(double* local, double* global, const void* comm)
@@ -751,4 +797,66 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    // Collective file access
+    bool communication_file_open(const char* filename, MFile* file, const void* comm)
+    {
+        int status = MPI_File_open(
+            *(MPI_Comm*)comm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &file->fh);
+
+        return status == MPI_SUCCESS;
+    }
+
+    bool communication_file_read_at_all(
+        MFile* file, int64_t offset, int64_t size, void* buf, const void* comm)
+    {
+        // MPI counts are 32 bit, thus large reads are split into chunks. All ranks
+        // need to take part in each collective call, including those that are done.
+        const int64_t chunk = 1 << 30;
+
+        int64_t nchunk = (size + chunk - 1) / chunk;
+        int64_t max_nchunk;
+
+        int status
+            = MPI_Allreduce(&nchunk, &max_nchunk, 1, MPI_INT64_T, MPI_MAX, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+        // A short read (e.g. of a truncated file) is reported, all chunks are still
+        // read to keep the collective calls matched
+        bool complete = true;
+
+        for(int64_t i = 0; i < max_nchunk; ++i)
+        {
+            int64_t begin = std::min(i * chunk, size);
+            int64_t count = std::min(chunk, size - begin);
+
+            MPI_Status mpi_status;
+
+            status = MPI_File_read_at_all(file->fh,
+                                          static_cast<MPI_Offset>(offset + begin),
+                                          static_cast<char*>(buf) + begin,
+                                          static_cast<int>(count),
+                                          MPI_BYTE,
+                                          &mpi_status);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+            int nread;
+
+            status = MPI_Get_count(&mpi_status, MPI_BYTE, &nread);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+            if(nread != static_cast<int>(count))
+            {
+                complete = false;
+            }
+        }
+
+        return complete;
+    }
+
+    void communication_file_close(MFile* file)
+    {
+        int status = MPI_File_close(&file->fh);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
 } // namespace rocalution
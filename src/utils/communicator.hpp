@@ -24,6 +24,7 @@
 #ifndef ROCALUTION_UTILS_COMMUNICATOR_HPP_
 #define ROCALUTION_UTILS_COMMUNICATOR_HPP_
 
+#include <cstdint>
 #include <mpi.h>
 
 namespace rocalution
@@ -33,6 +34,11 @@ namespace rocalution
         MPI_Request req;
     };
 
+    struct MFile
+    {
+        MPI_File fh;
+    };
+
     template <typename ValueType>
     void communication_sync_exscan(ValueType* send, ValueType* recv, int count, const void* comm);
 
@@ -47,6 +53,10 @@ namespace rocalution
                                                   const void* comm,
                                                   MRequest*   request);
 
+    template <typename ValueType>
+    void communication_async_allreduce_sum(
+        ValueType* local, ValueType* global, int count, const void* comm, MRequest* request);
+
     template <typename ValueType>
     void communication_sync_allreduce_single_max(ValueType*  local,
                                                  ValueType*  global,
@@ -87,6 +97,12 @@ namespace rocalution
     void communication_sync(MRequest* request);
     void communication_syncall(int count, MRequest* requests);
 
+    // Collective file access
+    bool communication_file_open(const char* filename, MFile* file, const void* comm);
+    bool communication_file_read_at_all(
+        MFile* file, int64_t offset, int64_t size, void* buf, const void* comm);
+    void communication_file_close(MFile* file);
+
 } // namespace rocalution
 
 #endif // ROCALUTION_UTILS_COMMUNICATOR_HPP_
@@ -24,8 +24,8 @@
 #include "log.hpp"
 #include "../base/backend_manager.hpp"
 #include "def.hpp"
-#include "time_functions.hpp"
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -53,7 +53,10 @@ namespace rocalution
 
                 std::ostringstream str_double;
                 str_double.precision(20);
-                str_double << rocalution_time();
+                // Wall clock time stamp, the monotonic timers have an arbitrary epoch
+                str_double << std::chrono::duration<double, std::micro>(
+                                  std::chrono::system_clock::now().time_since_epoch())
+                                  .count();
                 std::string mid_name = str_double.str();
 
                 std::ostringstream rank;
@@ -0,0 +1,369 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "profile.hpp"
+#include "def.hpp"
+#include "log.hpp"
+#include "time_functions.hpp"
+
+#include <fstream>
+
+namespace rocalution
+{
+
+    // Profile that currently records, NULL if profiling is inactive. Each host thread
+    // has its own active profile, such that solvers running concurrently on different
+    // threads do not record into each other's profile
+    static thread_local SolverProfile* _active_profile = NULL;
+
+    // Number of phases as signed integers, for loop bounds and index arithmetic
+    static const int _profile_phase_count       = static_cast<int>(ProfilePhase_Count);
+    static const int _profile_level_phase_count = static_cast<int>(ProfileLevelPhase_Count);
+
+    static const char* _profile_phase_name[ProfilePhase_Count]
+        = {"build", "solve", "spmv", "precond", "reduction", "halo_exchange"};
+
+    static const char* _profile_level_phase_name[ProfileLevelPhase_Count]
+        = {"smooth", "restrict", "prolong", "coarse_solve"};
+
+    SolverProfile::SolverProfile()
+        : enabled_(false)
+        , sync_(true)
+    {
+        for(int i = 0; i < _profile_phase_count; ++i)
+        {
+            this->depth_[i] = 0;
+        }
+
+        this->Reset();
+    }
+
+    SolverProfile::~SolverProfile()
+    {
+        if(_active_profile == this)
+        {
+            _active_profile = NULL;
+        }
+    }
+
+    bool SolverProfile::IsEnabled(void) const
+    {
+        return this->enabled_;
+    }
+
+    void SolverProfile::Enable(bool sync)
+    {
+        this->enabled_ = true;
+        this->sync_    = sync;
+    }
+
+    void SolverProfile::Disable(void)
+    {
+        this->enabled_ = false;
+    }
+
+    void SolverProfile::Reset(void)
+    {
+        for(int i = 0; i < _profile_phase_count; ++i)
+        {
+            this->time_[i]  = 0.0;
+            this->calls_[i] = 0;
+        }
+
+        this->level_time_.clear();
+        this->level_calls_.clear();
+    }
+
+    double SolverProfile::GetTime(ProfilePhase phase) const
+    {
+        assert(phase < ProfilePhase_Count);
+
+        return this->time_[phase];
+    }
+
+    int64_t SolverProfile::GetCalls(ProfilePhase phase) const
+    {
+        assert(phase < ProfilePhase_Count);
+
+        return this->calls_[phase];
+    }
+
+    int SolverProfile::GetNumLevels(void) const
+    {
+        return static_cast<int>(this->level_time_.size() / ProfileLevelPhase_Count);
+    }
+
+    double SolverProfile::GetLevelTime(int level, ProfileLevelPhase phase) const
+    {
+        assert(level >= 0);
+        assert(phase < ProfileLevelPhase_Count);
+
+        if(level >= this->GetNumLevels())
+        {
+            return 0.0;
+        }
+
+        return this->level_time_[level * ProfileLevelPhase_Count + phase];
+    }
+
+    int64_t SolverProfile::GetLevelCalls(int level, ProfileLevelPhase phase) const
+    {
+        assert(level >= 0);
+        assert(phase < ProfileLevelPhase_Count);
+
+        if(level >= this->GetNumLevels())
+        {
+            return 0;
+        }
+
+        return this->level_calls_[level * ProfileLevelPhase_Count + phase];
+    }
+
+    void SolverProfile::Print(void) const
+    {
+        LOG_INFO("SolverProfile (time in us)");
+
+        for(int i = 0; i < _profile_phase_count; ++i)
+        {
+            LOG_INFO("  " << _profile_phase_name[i] << ": calls=" << this->calls_[i]
+                          << "; time=" << this->time_[i]);
+        }
+
+        for(int l = 0; l < this->GetNumLevels(); ++l)
+        {
+            for(int i = 0; i < _profile_level_phase_count; ++i)
+            {
+                int idx = l * _profile_level_phase_count + i;
+
+                if(this->level_calls_[idx] > 0)
+                {
+                    LOG_INFO("  level " << l << " " << _profile_level_phase_name[i]
+                                        << ": calls=" << this->level_calls_[idx]
+                                        << "; time=" << this->level_time_[idx]);
+                }
+            }
+        }
+    }
+
+    void SolverProfile::WriteJSON(const std::string& filename) const
+    {
+        std::ofstream file;
+
+        LOG_INFO("Writing solver profile to filename = " << filename << "; writing...");
+
+        file.open(filename.c_str(), std::ifstream::out);
+
+        if(!file.is_open())
+        {
+            LOG_INFO("Can not open file [write]:" << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        file.setf(std::ios::fixed);
+        file.precision(3);
+
+        file << "{\n  \"unit\": \"us\",\n  \"phases\": {\n";
+
+        for(int i = 0; i < _profile_phase_count; ++i)
+        {
+            file << "    \"" << _profile_phase_name[i] << "\": {\"calls\": " << this->calls_[i]
+                 << ", \"time\": " << this->time_[i] << "}"
+                 << (i < _profile_phase_count - 1 ? ",\n" : "\n");
+        }
+
+        file << "  },\n  \"levels\": [";
+
+        for(int l = 0; l < this->GetNumLevels(); ++l)
+        {
+            file << (l > 0 ? ",\n" : "\n") << "    {\"level\": " << l;
+
+            for(int i = 0; i < _profile_level_phase_count; ++i)
+            {
+                int idx = l * _profile_level_phase_count + i;
+
+                file << ", \"" << _profile_level_phase_name[i]
+                     << "\": {\"calls\": " << this->level_calls_[idx]
+                     << ", \"time\": " << this->level_time_[idx] << "}";
+            }
+
+            file << "}";
+        }
+
+        file << (this->GetNumLevels() > 0 ? "\n  ]\n}\n" : "]\n}\n");
+
+        file.close();
+
+        LOG_INFO("Writing solver profile to filename = " << filename << "; done");
+    }
+
+    void SolverProfile::WriteCSV(const std::string& filename) const
+    {
+        std::ofstream file;
+
+        LOG_INFO("Writing solver profile to filename = " << filename << "; writing...");
+
+        file.open(filename.c_str(), std::ifstream::out);
+
+        if(!file.is_open())
+        {
+            LOG_INFO("Can not open file [write]:" << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        file.setf(std::ios::fixed);
+        file.precision(3);
+
+        file << "phase,level,calls,time_us\n";
+
+        for(int i = 0; i < _profile_phase_count; ++i)
+        {
+            file << _profile_phase_name[i] << ",," << this->calls_[i] << "," << this->time_[i]
+                 << "\n";
+        }
+
+        for(int l = 0; l < this->GetNumLevels(); ++l)
+        {
+            for(int i = 0; i < _profile_level_phase_count; ++i)
+            {
+                int idx = l * _profile_level_phase_count + i;
+
+                file << _profile_level_phase_name[i] << "," << l << "," << this->level_calls_[idx]
+                     << "," << this->level_time_[idx] << "\n";
+            }
+        }
+
+        file.close();
+
+        LOG_INFO("Writing solver profile to filename = " << filename << "; done");
+    }
+
+    ProfileRegion::ProfileRegion(ProfilePhase phase)
+        : profile_(NULL)
+        , activated_(false)
+        , nested_(false)
+        , phase_(phase)
+        , level_(-1)
+        , start_(0.0)
+    {
+        this->Begin_(_active_profile);
+    }
+
+    ProfileRegion::ProfileRegion(ProfilePhase phase, SolverProfile* owner)
+        : profile_(NULL)
+        , activated_(false)
+        , nested_(false)
+        , phase_(phase)
+        , level_(-1)
+        , start_(0.0)
+    {
+        if(_active_profile == NULL && owner != NULL && owner->enabled_ == true)
+        {
+            _active_profile  = owner;
+            this->activated_ = true;
+        }
+
+        this->Begin_(_active_profile);
+    }
+
+    ProfileRegion::ProfileRegion(ProfileLevelPhase phase, int level)
+        : profile_(NULL)
+        , activated_(false)
+        , nested_(false)
+        , phase_(phase)
+        , level_(level)
+        , start_(0.0)
+    {
+        assert(level >= 0);
+
+        this->Begin_(_active_profile);
+    }
+
+    ProfileRegion::~ProfileRegion()
+    {
+        if(this->profile_ == NULL)
+        {
+            return;
+        }
+
+        double time = 0.0;
+
+        if(this->nested_ == false)
+        {
+            time = ((this->profile_->sync_ == true) ? rocalution_time() : rocalution_time_nosync())
+                   - this->start_;
+        }
+
+        if(this->level_ >= 0)
+        {
+            int idx = this->level_ * ProfileLevelPhase_Count + this->phase_;
+
+            if(this->profile_->GetNumLevels() <= this->level_)
+            {
+                this->profile_->level_time_.resize((this->level_ + 1) * ProfileLevelPhase_Count,
+                                                   0.0);
+                this->profile_->level_calls_.resize((this->level_ + 1) * ProfileLevelPhase_Count,
+                                                    0);
+            }
+
+            this->profile_->level_time_[idx] += time;
+            ++this->profile_->level_calls_[idx];
+        }
+        else
+        {
+            --this->profile_->depth_[this->phase_];
+
+            if(this->nested_ == false)
+            {
+                this->profile_->time_[this->phase_] += time;
+                ++this->profile_->calls_[this->phase_];
+            }
+        }
+
+        if(this->activated_ == true)
+        {
+            _active_profile = NULL;
+        }
+    }
+
+    void ProfileRegion::Begin_(SolverProfile* profile)
+    {
+        if(profile == NULL)
+        {
+            return;
+        }
+
+        this->profile_ = profile;
+
+        if(this->level_ < 0)
+        {
+            this->nested_ = (this->profile_->depth_[this->phase_]++ > 0);
+        }
+
+        if(this->nested_ == false)
+        {
+            this->start_
+                = (this->profile_->sync_ == true) ? rocalution_time() : rocalution_time_nosync();
+        }
+    }
+
+} // namespace rocalution
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_UTILS_PROFILE_HPP_
+#define ROCALUTION_UTILS_PROFILE_HPP_
+
+#include "rocalution/export.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rocalution
+{
+    /*! \brief Solver phases that are recorded by a SolverProfile */
+    typedef enum _profile_phase : unsigned int
+    {
+        ProfilePhase_Build        = 0, /**< Solver build, including preconditioner setup. */
+        ProfilePhase_Solve        = 1, /**< Solve, including all of the phases below. */
+        ProfilePhase_SpMV         = 2, /**< Sparse matrix vector products. */
+        ProfilePhase_Precond      = 3, /**< Preconditioner applications. */
+        ProfilePhase_Reduction    = 4, /**< Dot products, norms and other reductions. */
+        ProfilePhase_HaloExchange = 5, /**< Ghost value exchange of global operators. */
+        ProfilePhase_Count        = 6
+    } ProfilePhase;
+
+    /*! \brief Multigrid level phases that are recorded by a SolverProfile */
+    typedef enum _profile_level_phase : unsigned int
+    {
+        ProfileLevelPhase_Smooth      = 0, /**< Pre- and post-smoothing. */
+        ProfileLevelPhase_Restrict    = 1, /**< Restriction to the next coarser level. */
+        ProfileLevelPhase_Prolong     = 2, /**< Prolongation from the next coarser level. */
+        ProfileLevelPhase_CoarseSolve = 3, /**< Coarse grid solve. */
+        ProfileLevelPhase_Count       = 4
+    } ProfileLevelPhase;
+
+    /** \ingroup solver_module
+  * \class SolverProfile
+  * \brief Wall time and call counts of the phases of a solver
+  * \details
+  * A SolverProfile is attached to each solver and is filled in when profiling has been
+  * enabled with Solver::EnableProfiling(). The outermost solver with profiling enabled
+  * collects the time of all operations performed during its Build() and Solve(),
+  * including those of its preconditioners, smoothers and sub-solvers. The active profile
+  * is tracked per host thread, i.e. solvers running concurrently on different threads
+  * record into their own profiles.
+  *
+  * Times are given in microseconds and are inclusive, i.e. the time of an SpMV that is
+  * performed within the preconditioner is accounted to both phases. Each phase is only
+  * recorded once when it is nested into itself (e.g. the interior SpMV of a global
+  * operator). Multigrid solvers record their smoothing, restriction, prolongation and
+  * coarse grid solve per level.
+  *
+  * \note By default, recording synchronizes the accelerator at the beginning and end of
+  * each phase, such that the time of accelerator kernels is attributed to the phase
+  * that launched them. Overlap of computation and communication is therefore lost
+  * while profiling. Without synchronization, phases record host time only.
+  */
+    class SolverProfile
+    {
+    public:
+        ROCALUTION_EXPORT
+        SolverProfile();
+        ROCALUTION_EXPORT
+        ~SolverProfile();
+
+        /** \brief Return true, if recording is enabled */
+        ROCALUTION_EXPORT
+        bool IsEnabled(void) const;
+
+        /** \brief Enable recording, optionally synchronizing the accelerator */
+        ROCALUTION_EXPORT
+        void Enable(bool sync = true);
+        /** \brief Disable recording */
+        ROCALUTION_EXPORT
+        void Disable(void);
+
+        /** \brief Reset all recorded times and call counts */
+        ROCALUTION_EXPORT
+        void Reset(void);
+
+        /** \brief Return the accumulated time of a phase in microseconds */
+        ROCALUTION_EXPORT
+        double GetTime(ProfilePhase phase) const;
+        /** \brief Return the number of calls of a phase */
+        ROCALUTION_EXPORT
+        int64_t GetCalls(ProfilePhase phase) const;
+
+        /** \brief Return the number of multigrid levels that have been recorded */
+        ROCALUTION_EXPORT
+        int GetNumLevels(void) const;
+        /** \brief Return the accumulated time of a multigrid level phase in microseconds */
+        ROCALUTION_EXPORT
+        double GetLevelTime(int level, ProfileLevelPhase phase) const;
+        /** \brief Return the number of calls of a multigrid level phase */
+        ROCALUTION_EXPORT
+        int64_t GetLevelCalls(int level, ProfileLevelPhase phase) const;
+
+        /** \brief Print the recorded profile */
+        ROCALUTION_EXPORT
+        void Print(void) const;
+
+        /** \brief Write the recorded profile into a JSON file */
+        ROCALUTION_EXPORT
+        void WriteJSON(const std::string& filename) const;
+        /** \brief Write the recorded profile into a CSV file
+        * \details
+        * Each line holds the phase name, the multigrid level (empty for solver phases),
+        * the number of calls and the accumulated time in microseconds.
+        */
+        ROCALUTION_EXPORT
+        void WriteCSV(const std::string& filename) const;
+
+    private:
+        friend class ProfileRegion;
+
+        bool enabled_;
+        bool sync_;
+
+        double  time_[ProfilePhase_Count];
+        int64_t calls_[ProfilePhase_Count];
+
+        // Nesting depth of each phase, a phase is only recorded at depth 0
+        int depth_[ProfilePhase_Count];
+
+        // Level phases, stored level after level
+        std::vector<double>  level_time_;
+        std::vector<int64_t> level_calls_;
+    };
+
+    // Scoped recording of a phase into the active profile of the calling thread
+    /** \private */
+    class ProfileRegion
+    {
+    public:
+        // Record phase into the active profile, if any
+        explicit ProfileRegion(ProfilePhase phase);
+        // Record phase and make owner the active profile, if it is enabled and no other
+        // profile is active
+        ProfileRegion(ProfilePhase phase, SolverProfile* owner);
+        // Record a multigrid level phase into the active profile, if any
+        ProfileRegion(ProfileLevelPhase phase, int level);
+        ~ProfileRegion();
+
+    private:
+        void Begin_(SolverProfile* profile);
+
+        SolverProfile* profile_;
+        bool           activated_;
+        bool           nested_;
+        int            phase_;
+        int            level_;
+        double         start_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_UTILS_PROFILE_HPP_
@@ -497,6 +497,105 @@ extern "C" rocsparseio_status
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseio_write_sparse_zcsx(rocsparseio_handle     handle_,
+                                                            rocsparseio_direction  dir_,
+                                                            uint64_t               m_,
+                                                            uint64_t               n_,
+                                                            uint64_t               nnz_,
+                                                            rocsparseio_type       ptr_type_,
+                                                            const void*            ptr_,
+                                                            rocsparseio_type       ind_type_,
+                                                            const void*            ind_,
+                                                            rocsparseio_type       val_type_,
+                                                            const void*            val_,
+                                                            rocsparseio_index_base base_,
+                                                            int                    compress_val_,
+                                                            const char*            name_,
+                                                            ...)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::direction_t(dir_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::type_t(ptr_type_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::type_t(ind_type_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::type_t(val_type_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::index_base_t(base_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(!ptr_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG((nnz_ > 0 && !ind_), rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG((nnz_ > 0 && !val_), rocsparseio::status_t::invalid_pointer);
+
+    {
+        va_list args;
+        va_start(args, name_);
+        ROCSPARSEIO_C_CHECK(rocsparseio::write_sparse_zcsx(handle_,
+                                                           dir_,
+                                                           m_,
+                                                           n_,
+                                                           nnz_,
+                                                           ptr_type_,
+                                                           ptr_,
+                                                           ind_type_,
+                                                           ind_,
+                                                           val_type_,
+                                                           val_,
+                                                           base_,
+                                                           compress_val_ != 0,
+                                                           name_,
+                                                           args));
+        va_end(args);
+    }
+
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_read_metadata_sparse_zcsx(rocsparseio_handle     handle_,
+                                                                     rocsparseio_direction* dir_,
+                                                                     uint64_t*              m_,
+                                                                     uint64_t*              n_,
+                                                                     uint64_t*              nnz_,
+
+                                                                     rocsparseio_type* ptr_type_,
+                                                                     rocsparseio_type* ind_type_,
+                                                                     rocsparseio_type* val_type_,
+                                                                     rocsparseio_index_base* base_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!dir_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!m_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!n_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!nnz_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!ptr_type_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!ind_type_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!val_type_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!base_, rocsparseio::status_t::invalid_pointer);
+    rocsparseio::direction_t  dir;
+    rocsparseio::type_t       ptr_type;
+    rocsparseio::type_t       ind_type;
+    rocsparseio::type_t       val_type;
+    rocsparseio::index_base_t index_base;
+
+    ROCSPARSEIO_C_CHECK(rocsparseio::read_metadata_sparse_zcsx(
+        handle_, &dir, m_, n_, nnz_, &ptr_type, &ind_type, &val_type, &index_base));
+    dir_[0]      = (rocsparseio_direction)dir;
+    ptr_type_[0] = (rocsparseio_type)ptr_type;
+    ind_type_[0] = (rocsparseio_type)ind_type;
+    val_type_[0] = (rocsparseio_type)val_type;
+    base_[0]     = (rocsparseio_index_base)index_base;
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status
+    rocsparseiox_read_sparse_zcsx(rocsparseio_handle handle_, void* ptr_, void* ind_, void* val_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::read_sparse_zcsx(handle_, ptr_, ind_, val_));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_read_sparse_csx(rocsparseio_handle     handle_,
                                                           rocsparseio_direction* dir_,
                                                           uint64_t*              m_,
@@ -120,6 +120,7 @@ typedef rocsparseio_enum_t rocsparseio_index_base_t;
 #define ROCSPARSEIO_FORMAT_SPARSE_ELL 6
 #define ROCSPARSEIO_FORMAT_SPARSE_HYB 7
 #define ROCSPARSEIO_FORMAT_SPARSE_MCSX 8
+#define ROCSPARSEIO_FORMAT_SPARSE_ZCSX 9
 
 typedef enum rocsparseio_index_base_
 {
@@ -154,7 +155,8 @@ typedef enum rocsparseio_format_
     rocsparseio_format_sparse_dia   = ROCSPARSEIO_FORMAT_SPARSE_DIA,
     rocsparseio_format_sparse_ell   = ROCSPARSEIO_FORMAT_SPARSE_ELL,
     rocsparseio_format_sparse_hyb   = ROCSPARSEIO_FORMAT_SPARSE_HYB,
-    rocsparseio_format_sparse_mcsx  = ROCSPARSEIO_FORMAT_SPARSE_MCSX
+    rocsparseio_format_sparse_mcsx  = ROCSPARSEIO_FORMAT_SPARSE_MCSX,
+    rocsparseio_format_sparse_zcsx  = ROCSPARSEIO_FORMAT_SPARSE_ZCSX
 } rocsparseio_format;
 
 typedef enum rocsparseio_direction_
@@ -458,6 +460,75 @@ rocsparseio_status rocsparseiox_read_metadata_sparse_csx(rocsparseio_handle
 rocsparseio_status
     rocsparseiox_read_sparse_csx(rocsparseio_handle handle, void* ptr, void* ind, void* data);
 
+//! @brief Write a compressed sparse csr/csc matrix.
+//! @details Indices are delta and varint encoded, values are optionally
+//! byte-shuffled and LZ compressed. Arrays are encoded and decoded in blocks
+//! of rows (columns), in parallel. Only 32 and 64 bit integer types are
+//! supported for \p ptr and \p ind.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] dir indicates if the matrix is using a Compressed Sparse Row or
+//! Column storage.
+//! @param[in] m number of rows.
+//! @param[in] n number of columns.
+//! @param[in] nnz number of non-zeros.
+//! @param[in] ptr_type type of elements of the array \p ptr.
+//! @param[in] ptr array of offsets.
+//! @param[in] ind_type type of elements of the array \p ind.
+//! @param[in] ind array of column/row indices.
+//! @param[in] val_type type of elements of the array \p val.
+//! @param[in] val array of values.
+//! @param[in] base index base used in arrays \p ptr and \p ind.
+//! @param[in] compress_val compress the array \p val if non-zero, store it raw
+//! otherwise.
+//! @param[in] name flexible C-printf style name.
+//! @retval rocsparseio_status
+rocsparseio_status rocsparseio_write_sparse_zcsx(rocsparseio_handle     handle,
+                                                 rocsparseio_direction  dir,
+                                                 uint64_t               m,
+                                                 uint64_t               n,
+                                                 uint64_t               nnz,
+                                                 rocsparseio_type       ptr_type,
+                                                 const void*            ptr,
+                                                 rocsparseio_type       ind_type,
+                                                 const void*            ind,
+                                                 rocsparseio_type       val_type,
+                                                 const void*            val,
+                                                 rocsparseio_index_base base,
+                                                 int                    compress_val,
+                                                 const char*            name,
+                                                 ...);
+
+//! @brief Read metadata information of the compressed sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[out] dir indicates if the matrix is using with a Compressed Sparse
+//! Row or Column storage.
+//! @param[out] m number of rows.
+//! @param[out] n number of columns.
+//! @param[out] nnz number of non-zeros.
+//! @param[out] ptr_type type of elements of the array \p ptr.
+//! @param[out] ind_type type of elements of the array \p ind.
+//! @param[out] val_type type of elements of the array \p val.
+//! @param[out] base index base used in arrays \p ptr and \p ind.
+//! @retval rocsparseio_status
+rocsparseio_status rocsparseiox_read_metadata_sparse_zcsx(rocsparseio_handle      handle,
+                                                          rocsparseio_direction*  dir,
+                                                          uint64_t*               m,
+                                                          uint64_t*               n,
+                                                          uint64_t*               nnz,
+                                                          rocsparseio_type*       ptr_type,
+                                                          rocsparseio_type*       ind_type,
+                                                          rocsparseio_type*       data_type,
+                                                          rocsparseio_index_base* base);
+
+//! @brief Read and decode compressed sparse csr/csc matrix data arrays.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] ptr array of offsets to fill.
+//! @param[in] ind array of column/row indices to fill.
+//! @param[in] val array of values to fill.
+//! @retval rocsparseio_status
+rocsparseio_status
+    rocsparseiox_read_sparse_zcsx(rocsparseio_handle handle, void* ptr, void* ind, void* data);
+
 //! @brief Write a sparse modified csr/csc matrix.
 //! @param[in] handle pointer to the rocsparseio handle.
 //! @param[in] dir indicates if the matrix is using a Modified Compressed Sparse Row or
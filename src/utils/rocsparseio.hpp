@@ -29,6 +29,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <vector>
 
 //
 //
@@ -180,6 +181,7 @@ namespace rocsparseio
             sparse_hyb   = rocsparseio_format_sparse_hyb,
             sparse_dia   = rocsparseio_format_sparse_dia,
             sparse_mcsx  = rocsparseio_format_sparse_mcsx,
+            sparse_zcsx  = rocsparseio_format_sparse_zcsx,
         } value_type;
 
         value_type       value{};
@@ -216,6 +218,7 @@ namespace rocsparseio
             case sparse_dia:
             case sparse_hyb:
             case sparse_mcsx:
+            case sparse_zcsx:
             {
                 return false;
             }
@@ -241,6 +244,7 @@ namespace rocsparseio
                 CASE(sparse_ell);
                 CASE(sparse_dia);
                 CASE(sparse_hyb);
+                CASE(sparse_zcsx);
 #undef CASE
             }
             return "unknown";
@@ -814,9 +818,6 @@ namespace rocsparseio
         ROCSPARSEIO_CHECK_ARG(data_type_.is_invalid(), status_t::invalid_value);
         ROCSPARSEIO_CHECK_ARG(((data_nmemb_ > 0) && (data_ == nullptr)), status_t::invalid_pointer);
         ROCSPARSEIO_CHECK_ARG(((data_inc_ > 0) && (data_ == nullptr)), status_t::invalid_size);
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_vector, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb_, out_));
 
         rocsparseio_string name;
         if(name_)
@@ -842,6 +843,10 @@ namespace rocsparseio
             return status_t::invalid_file_operation;
         }
 
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_vector, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb_, out_));
+
         uint64_t data_size = data_type_.size();
         if(data_inc_ == 1)
         {
@@ -1310,6 +1315,747 @@ namespace rocsparseio
 
 } // namespace rocsparseio
 
+//
+// Compressed sparse csr/csc.
+//
+// The outer dimension (rows for csr, columns for csc) is split into blocks holding
+// approximately zcsx_block_nnz non-zeros. Each block is encoded independently, such
+// that blocks are encoded and decoded in parallel:
+// - the index stream holds, for each row, its length followed by its zigzag delta
+//   encoded indices, all stored as LEB128 varints. Sorted indices of a banded matrix
+//   thus take one or two bytes each.
+// - the value stream holds a one byte tag, followed by either the raw values or the
+//   LZ compressed byte planes of the values (byte-shuffle), whichever is smaller.
+//
+// Layout, after the csx-like header and a flag indicating value compression:
+//   block_row[nblocks + 1]     first row of each block
+//   block_ptr[nblocks + 1]     ptr value at the first row of each block
+//   ind_offset[nblocks + 1]    offset of each block in the index stream
+//   val_offset[nblocks + 1]    offset of each block in the value stream
+//   index stream, value stream
+//
+namespace rocsparseio
+{
+    static constexpr uint64_t zcsx_block_nnz = 1 << 16;
+
+    static constexpr uint8_t zcsx_value_raw        = 0;
+    static constexpr uint8_t zcsx_value_shuffle_lz = 1;
+
+    struct zcsx_blocks
+    {
+        std::vector<uint64_t>             row;
+        std::vector<uint64_t>             ptr;
+        std::vector<std::vector<uint8_t>> ind;
+        std::vector<std::vector<uint8_t>> val;
+    };
+
+    inline void zcsx_put_varint(std::vector<uint8_t>& out_, uint64_t x_)
+    {
+        while(x_ >= 0x80)
+        {
+            out_.push_back(static_cast<uint8_t>(x_ | 0x80));
+            x_ >>= 7;
+        }
+        out_.push_back(static_cast<uint8_t>(x_));
+    }
+
+    inline bool zcsx_get_varint(const uint8_t*& p_, const uint8_t* end_, uint64_t& x_)
+    {
+        x_ = 0;
+        for(int shift = 0; shift < 64 && p_ < end_; shift += 7)
+        {
+            const uint8_t byte = *p_++;
+            x_ |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline uint64_t zcsx_zigzag(int64_t x_)
+    {
+        return (static_cast<uint64_t>(x_) << 1) ^ static_cast<uint64_t>(x_ >> 63);
+    }
+
+    inline int64_t zcsx_unzigzag(uint64_t x_)
+    {
+        return static_cast<int64_t>(x_ >> 1) ^ -static_cast<int64_t>(x_ & 1);
+    }
+
+    //
+    // Greedy LZ77, each token is (literal length, literals, match length - 4, offset).
+    // The last token only holds literals, the decoder stops at the expected size.
+    //
+    inline void zcsx_lz_compress(const uint8_t* src_, uint64_t size_, std::vector<uint8_t>& out_)
+    {
+        static constexpr int hash_bits = 14;
+
+        std::vector<int64_t> table(1 << hash_bits, -1);
+
+        uint64_t anchor = 0;
+        uint64_t i      = 0;
+
+        while(i + 4 <= size_)
+        {
+            uint32_t seq;
+            memcpy(&seq, src_ + i, sizeof(uint32_t));
+
+            const uint32_t h    = (seq * 2654435761u) >> (32 - hash_bits);
+            const int64_t  cand = table[h];
+            table[h]            = static_cast<int64_t>(i);
+
+            if(cand >= 0 && memcmp(src_ + cand, src_ + i, 4) == 0)
+            {
+                uint64_t len = 4;
+                while(i + len < size_ && src_[cand + len] == src_[i + len])
+                {
+                    ++len;
+                }
+
+                zcsx_put_varint(out_, i - anchor);
+                out_.insert(out_.end(), src_ + anchor, src_ + i);
+                zcsx_put_varint(out_, len - 4);
+                zcsx_put_varint(out_, i - cand);
+
+                i += len;
+                anchor = i;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        zcsx_put_varint(out_, size_ - anchor);
+        out_.insert(out_.end(), src_ + anchor, src_ + size_);
+    }
+
+    inline bool
+        zcsx_lz_decompress(const uint8_t* p_, const uint8_t* end_, uint8_t* dst_, uint64_t size_)
+    {
+        uint64_t o = 0;
+
+        while(true)
+        {
+            uint64_t lit;
+            if(!zcsx_get_varint(p_, end_, lit) || lit > size_ - o
+               || lit > static_cast<uint64_t>(end_ - p_))
+            {
+                return false;
+            }
+
+            memcpy(dst_ + o, p_, lit);
+            p_ += lit;
+            o += lit;
+
+            if(o == size_)
+            {
+                return p_ == end_;
+            }
+
+            uint64_t len;
+            uint64_t off;
+            if(!zcsx_get_varint(p_, end_, len) || !zcsx_get_varint(p_, end_, off))
+            {
+                return false;
+            }
+
+            len += 4;
+            if(off == 0 || off > o || len > size_ - o)
+            {
+                return false;
+            }
+
+            // Byte by byte, source and destination may overlap
+            for(uint64_t l = 0; l < len; ++l)
+            {
+                dst_[o + l] = dst_[o + l - off];
+            }
+
+            o += len;
+        }
+    }
+
+    template <typename P, typename I>
+    inline void zcsx_encode_indices(
+        uint64_t begin_, uint64_t end_, const P* ptr_, const I* ind_, std::vector<uint8_t>& out_)
+    {
+        const int64_t origin = static_cast<int64_t>(ptr_[0]);
+
+        for(uint64_t i = begin_; i < end_; ++i)
+        {
+            const int64_t row_begin = static_cast<int64_t>(ptr_[i]) - origin;
+            const int64_t row_end   = static_cast<int64_t>(ptr_[i + 1]) - origin;
+
+            zcsx_put_varint(out_, static_cast<uint64_t>(row_end - row_begin));
+
+            int64_t prev = 0;
+            for(int64_t k = row_begin; k < row_end; ++k)
+            {
+                const int64_t j = static_cast<int64_t>(ind_[k]);
+                zcsx_put_varint(out_, zcsx_zigzag(j - prev));
+                prev = j;
+            }
+        }
+    }
+
+    template <typename P, typename I>
+    inline bool zcsx_decode_indices(uint64_t       begin_,
+                                    uint64_t       end_,
+                                    uint64_t       ptr_begin_,
+                                    uint64_t       ptr_end_,
+                                    uint64_t       origin_,
+                                    const uint8_t* p_,
+                                    const uint8_t* stream_end_,
+                                    P*             ptr_,
+                                    I*             ind_)
+    {
+        uint64_t k = ptr_begin_;
+
+        for(uint64_t i = begin_; i < end_; ++i)
+        {
+            uint64_t len;
+            if(!zcsx_get_varint(p_, stream_end_, len) || len > ptr_end_ - k)
+            {
+                return false;
+            }
+
+            I* row_ind = ind_ + (k - origin_);
+
+            int64_t prev = 0;
+            for(uint64_t l = 0; l < len; ++l)
+            {
+                uint64_t z;
+                if(!zcsx_get_varint(p_, stream_end_, z))
+                {
+                    return false;
+                }
+
+                prev += zcsx_unzigzag(z);
+                row_ind[l] = static_cast<I>(prev);
+            }
+
+            k += len;
+            ptr_[i + 1] = static_cast<P>(k);
+        }
+
+        return (k == ptr_end_) && (p_ == stream_end_);
+    }
+
+    inline void zcsx_encode_values(const uint8_t*        val_,
+                                   uint64_t              count_,
+                                   uint64_t              size_,
+                                   bool                  compress_,
+                                   std::vector<uint8_t>& out_)
+    {
+        const uint64_t nbytes = count_ * size_;
+
+        if(compress_)
+        {
+            std::vector<uint8_t> shuffled(nbytes);
+            for(uint64_t e = 0; e < count_; ++e)
+            {
+                for(uint64_t b = 0; b < size_; ++b)
+                {
+                    shuffled[b * count_ + e] = val_[e * size_ + b];
+                }
+            }
+
+            out_.push_back(zcsx_value_shuffle_lz);
+            zcsx_lz_compress(shuffled.data(), nbytes, out_);
+
+            if(out_.size() <= nbytes)
+            {
+                return;
+            }
+
+            // Incompressible, store raw values instead
+            out_.clear();
+        }
+
+        out_.push_back(zcsx_value_raw);
+        out_.insert(out_.end(), val_, val_ + nbytes);
+    }
+
+    inline bool zcsx_decode_values(
+        const uint8_t* p_, const uint8_t* end_, uint64_t count_, uint64_t size_, uint8_t* val_)
+    {
+        const uint64_t nbytes = count_ * size_;
+
+        if(p_ == end_)
+        {
+            return false;
+        }
+
+        const uint8_t tag = *p_++;
+
+        if(tag == zcsx_value_raw)
+        {
+            if(static_cast<uint64_t>(end_ - p_) != nbytes)
+            {
+                return false;
+            }
+
+            memcpy(val_, p_, nbytes);
+            return true;
+        }
+
+        if(tag == zcsx_value_shuffle_lz)
+        {
+            std::vector<uint8_t> shuffled(nbytes);
+            if(!zcsx_lz_decompress(p_, end_, shuffled.data(), nbytes))
+            {
+                return false;
+            }
+
+            for(uint64_t e = 0; e < count_; ++e)
+            {
+                for(uint64_t b = 0; b < size_; ++b)
+                {
+                    val_[e * size_ + b] = shuffled[b * count_ + e];
+                }
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    template <typename P, typename I>
+    inline void zcsx_encode(uint64_t       outer_,
+                            const P*       ptr_,
+                            const I*       ind_,
+                            const uint8_t* data_,
+                            uint64_t       data_size_,
+                            bool           compress_,
+                            zcsx_blocks&   blocks_)
+    {
+        // Split the outer dimension into blocks of similar number of non-zeros
+        blocks_.row.assign(1, 0);
+        blocks_.ptr.assign(1, static_cast<uint64_t>(ptr_[0]));
+
+        for(uint64_t i = 0; i < outer_; ++i)
+        {
+            if(static_cast<uint64_t>(ptr_[i + 1]) - blocks_.ptr.back() >= zcsx_block_nnz
+               || i + 1 == outer_)
+            {
+                blocks_.row.push_back(i + 1);
+                blocks_.ptr.push_back(static_cast<uint64_t>(ptr_[i + 1]));
+            }
+        }
+
+        const int64_t nblocks = static_cast<int64_t>(blocks_.row.size()) - 1;
+
+        blocks_.ind.assign(nblocks, std::vector<uint8_t>());
+        blocks_.val.assign(nblocks, std::vector<uint8_t>());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t b = 0; b < nblocks; ++b)
+        {
+            const uint64_t first = blocks_.ptr[b] - blocks_.ptr[0];
+            const uint64_t count = blocks_.ptr[b + 1] - blocks_.ptr[b];
+
+            zcsx_encode_indices(blocks_.row[b], blocks_.row[b + 1], ptr_, ind_, blocks_.ind[b]);
+            zcsx_encode_values(
+                data_ + first * data_size_, count, data_size_, compress_, blocks_.val[b]);
+        }
+    }
+
+    template <typename P, typename I>
+    inline bool zcsx_decode(const std::vector<uint64_t>& block_row_,
+                            const std::vector<uint64_t>& block_ptr_,
+                            const std::vector<uint64_t>& ind_offset_,
+                            const std::vector<uint64_t>& val_offset_,
+                            const std::vector<uint8_t>&  ind_stream_,
+                            const std::vector<uint8_t>&  val_stream_,
+                            uint64_t                     data_size_,
+                            P*                           ptr_,
+                            I*                           ind_,
+                            uint8_t*                     data_)
+    {
+        const int64_t nblocks = static_cast<int64_t>(block_row_.size()) - 1;
+
+        ptr_[0] = static_cast<P>(block_ptr_[0]);
+
+        bool valid = true;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(&& : valid)
+#endif
+        for(int64_t b = 0; b < nblocks; ++b)
+        {
+            const uint64_t first = block_ptr_[b] - block_ptr_[0];
+            const uint64_t count = block_ptr_[b + 1] - block_ptr_[b];
+
+            valid = valid
+                    && zcsx_decode_indices(block_row_[b],
+                                           block_row_[b + 1],
+                                           block_ptr_[b],
+                                           block_ptr_[b + 1],
+                                           block_ptr_[0],
+                                           ind_stream_.data() + ind_offset_[b],
+                                           ind_stream_.data() + ind_offset_[b + 1],
+                                           ptr_,
+                                           ind_)
+                    && zcsx_decode_values(val_stream_.data() + val_offset_[b],
+                                          val_stream_.data() + val_offset_[b + 1],
+                                          count,
+                                          data_size_,
+                                          data_ + first * data_size_);
+        }
+
+        return valid;
+    }
+
+    // Indices of the compressed format are restricted to 32 and 64 bit integers
+    inline bool zcsx_is_index_type(type_t type_)
+    {
+        return (type_ == type_t::int32) || (type_ == type_t::int64);
+    }
+
+    inline void zcsx_encode(uint64_t     outer_,
+                            type_t       ptr_type_,
+                            const void*  ptr_,
+                            type_t       ind_type_,
+                            const void*  ind_,
+                            const void*  data_,
+                            uint64_t     data_size_,
+                            bool         compress_,
+                            zcsx_blocks& blocks_)
+    {
+        const uint8_t* data = static_cast<const uint8_t*>(data_);
+
+        if(ptr_type_ == type_t::int32 && ind_type_ == type_t::int32)
+        {
+            zcsx_encode(outer_,
+                        static_cast<const int32_t*>(ptr_),
+                        static_cast<const int32_t*>(ind_),
+                        data,
+                        data_size_,
+                        compress_,
+                        blocks_);
+        }
+        else if(ptr_type_ == type_t::int32)
+        {
+            zcsx_encode(outer_,
+                        static_cast<const int32_t*>(ptr_),
+                        static_cast<const int64_t*>(ind_),
+                        data,
+                        data_size_,
+                        compress_,
+                        blocks_);
+        }
+        else if(ind_type_ == type_t::int32)
+        {
+            zcsx_encode(outer_,
+                        static_cast<const int64_t*>(ptr_),
+                        static_cast<const int32_t*>(ind_),
+                        data,
+                        data_size_,
+                        compress_,
+                        blocks_);
+        }
+        else
+        {
+            zcsx_encode(outer_,
+                        static_cast<const int64_t*>(ptr_),
+                        static_cast<const int64_t*>(ind_),
+                        data,
+                        data_size_,
+                        compress_,
+                        blocks_);
+        }
+    }
+
+    inline status_t fwrite_zcsx_stream(FILE* out_, const std::vector<std::vector<uint8_t>>& chunks_)
+    {
+        uint64_t nbytes = 0;
+        for(size_t b = 0; b < chunks_.size(); ++b)
+        {
+            nbytes += chunks_[b].size();
+        }
+
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(sizeof(uint8_t), out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nbytes, out_));
+        for(size_t b = 0; b < chunks_.size(); ++b)
+        {
+            if(chunks_[b].size() != fwrite(chunks_[b].data(), 1, chunks_[b].size(), out_))
+            {
+                return status_t::invalid_file_operation;
+            }
+        }
+
+        return status_t::success;
+    }
+
+    template <typename T>
+    inline status_t fread_zcsx_array(FILE* in_, std::vector<T>& data_)
+    {
+        uint64_t size;
+        uint64_t nmemb;
+        ROCSPARSEIO_CHECK(fread_array_metadata(in_, &size, &nmemb));
+        if(size != sizeof(T))
+        {
+            return status_t::invalid_format;
+        }
+
+        data_.resize(nmemb);
+        return fread_array(in_, data_.data());
+    }
+
+    inline status_t fwrite_sparse_zcsx(FILE*       out_,
+                                       direction_t dir_,
+                                       uint64_t    m_,
+                                       uint64_t    n_,
+                                       uint64_t    nnz_,
+                                       type_t      ptr_type_,
+                                       const void* __restrict__ ptr_,
+                                       type_t ind_type_,
+                                       const void* __restrict__ ind_,
+                                       type_t data_type_,
+                                       const void* __restrict__ data_,
+                                       index_base_t base_,
+                                       bool         compress_,
+                                       const char*  name_,
+                                       ...)
+    {
+        ROCSPARSEIO_CHECK_ARG(!zcsx_is_index_type(ptr_type_), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(!zcsx_is_index_type(ind_type_), status_t::invalid_value);
+
+        rocsparseio_string name;
+        if(name_)
+        {
+            va_list args;
+            va_start(args, name_);
+            int len = vsnprintf(name, sizeof(rocsparseio_string), name_, args);
+            va_end(args);
+            if(len < 0 || static_cast<size_t>(len) >= sizeof(rocsparseio_string))
+            {
+                std::cerr << "the name of the object to save is too long and would be truncated. "
+                          << std::endl;
+                return status_t::invalid_value;
+            }
+        }
+        else
+        {
+            sprintf(name, "unknown");
+        }
+
+        const uint64_t outer = (dir_ == direction_t::row) ? m_ : n_;
+
+        zcsx_blocks blocks;
+        zcsx_encode(
+            outer, ptr_type_, ptr_, ind_type_, ind_, data_, data_type_.size(), compress_, blocks);
+
+        const size_t          nblocks = blocks.ind.size();
+        std::vector<uint64_t> ind_offset(nblocks + 1, 0);
+        std::vector<uint64_t> val_offset(nblocks + 1, 0);
+        for(size_t b = 0; b < nblocks; ++b)
+        {
+            ind_offset[b + 1] = ind_offset[b] + blocks.ind[b].size();
+            val_offset[b + 1] = val_offset[b] + blocks.val[b].size();
+        }
+
+        if(size_t(1) != fwrite(name, sizeof(rocsparseio_string), 1, out_))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_zcsx, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(compress_ ? 1 : 0, out_));
+
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, sizeof(uint64_t), blocks.row.size(), blocks.row.data()));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, sizeof(uint64_t), blocks.ptr.size(), blocks.ptr.data()));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, sizeof(uint64_t), nblocks + 1, ind_offset.data()));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, sizeof(uint64_t), nblocks + 1, val_offset.data()));
+        ROCSPARSEIO_CHECK(fwrite_zcsx_stream(out_, blocks.ind));
+        ROCSPARSEIO_CHECK(fwrite_zcsx_stream(out_, blocks.val));
+
+        return status_t::success;
+    };
+
+    inline status_t fread_metadata_sparse_zcsx(FILE*         in_,
+                                               direction_t*  dir_,
+                                               uint64_t*     m_,
+                                               uint64_t*     n_,
+                                               uint64_t*     nnz_,
+                                               type_t*       ptr_type_,
+                                               type_t*       ind_type_,
+                                               type_t*       data_type_,
+                                               index_base_t* base_)
+    {
+        const long pos = ftell(in_);
+
+        if(0 != fseek(in_, sizeof(rocsparseio_string), SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        format_t format(0);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
+        if(format != format_t::sparse_zcsx)
+        {
+            return status_t::invalid_format;
+        }
+
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(dir_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(m_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(n_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nnz_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ptr_type_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ind_type_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(data_type_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(base_, in_));
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        return status_t::success;
+    }
+
+    inline status_t fread_sparse_zcsx(FILE* in_,
+                                      void* __restrict__ ptr_,
+                                      void* __restrict__ ind_,
+                                      void* __restrict__ data_)
+    {
+        direction_t  dir;
+        uint64_t     m;
+        uint64_t     n;
+        uint64_t     nnz;
+        type_t       ptr_type;
+        type_t       ind_type;
+        type_t       data_type;
+        index_base_t base;
+        ROCSPARSEIO_CHECK(fread_metadata_sparse_zcsx(
+            in_, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &data_type, &base));
+
+        if(0 != fseek(in_, sizeof(uint64_t) * 10 + sizeof(rocsparseio_string), SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        std::vector<uint64_t> block_row;
+        std::vector<uint64_t> block_ptr;
+        std::vector<uint64_t> ind_offset;
+        std::vector<uint64_t> val_offset;
+        std::vector<uint8_t>  ind_stream;
+        std::vector<uint8_t>  val_stream;
+
+        ROCSPARSEIO_CHECK(fread_zcsx_array(in_, block_row));
+        ROCSPARSEIO_CHECK(fread_zcsx_array(in_, block_ptr));
+        ROCSPARSEIO_CHECK(fread_zcsx_array(in_, ind_offset));
+        ROCSPARSEIO_CHECK(fread_zcsx_array(in_, val_offset));
+        ROCSPARSEIO_CHECK(fread_zcsx_array(in_, ind_stream));
+        ROCSPARSEIO_CHECK(fread_zcsx_array(in_, val_stream));
+
+        //
+        // Check the block tables, such that blocks can be decoded independently.
+        //
+        const uint64_t outer   = (dir == direction_t::row) ? m : n;
+        const size_t   nblocks = block_row.size() - 1;
+
+        if(block_row.empty() || block_ptr.size() != nblocks + 1
+           || ind_offset.size() != nblocks + 1 || val_offset.size() != nblocks + 1
+           || block_row[0] != 0 || block_row[nblocks] != outer
+           || block_ptr[nblocks] - block_ptr[0] != nnz || ind_offset[0] != 0
+           || val_offset[0] != 0 || ind_offset[nblocks] != ind_stream.size()
+           || val_offset[nblocks] != val_stream.size())
+        {
+            return status_t::invalid_file;
+        }
+
+        for(size_t b = 0; b < nblocks; ++b)
+        {
+            if(block_row[b] > block_row[b + 1] || block_ptr[b] > block_ptr[b + 1]
+               || ind_offset[b] > ind_offset[b + 1] || val_offset[b] > val_offset[b + 1])
+            {
+                return status_t::invalid_file;
+            }
+        }
+
+        if(!zcsx_is_index_type(ptr_type) || !zcsx_is_index_type(ind_type))
+        {
+            return status_t::invalid_format;
+        }
+
+        const uint64_t data_size = data_type.size();
+        uint8_t*       data      = static_cast<uint8_t*>(data_);
+
+        bool valid;
+        if(ptr_type == type_t::int32 && ind_type == type_t::int32)
+        {
+            valid = zcsx_decode(block_row,
+                                block_ptr,
+                                ind_offset,
+                                val_offset,
+                                ind_stream,
+                                val_stream,
+                                data_size,
+                                static_cast<int32_t*>(ptr_),
+                                static_cast<int32_t*>(ind_),
+                                data);
+        }
+        else if(ptr_type == type_t::int32)
+        {
+            valid = zcsx_decode(block_row,
+                                block_ptr,
+                                ind_offset,
+                                val_offset,
+                                ind_stream,
+                                val_stream,
+                                data_size,
+                                static_cast<int32_t*>(ptr_),
+                                static_cast<int64_t*>(ind_),
+                                data);
+        }
+        else if(ind_type == type_t::int32)
+        {
+            valid = zcsx_decode(block_row,
+                                block_ptr,
+                                ind_offset,
+                                val_offset,
+                                ind_stream,
+                                val_stream,
+                                data_size,
+                                static_cast<int64_t*>(ptr_),
+                                static_cast<int32_t*>(ind_),
+                                data);
+        }
+        else
+        {
+            valid = zcsx_decode(block_row,
+                                block_ptr,
+                                ind_offset,
+                                val_offset,
+                                ind_stream,
+                                val_stream,
+                                data_size,
+                                static_cast<int64_t*>(ptr_),
+                                static_cast<int64_t*>(ind_),
+                                data);
+        }
+
+        return valid ? status_t::success : status_t::invalid_file;
+    }
+
+} // namespace rocsparseio
+
 namespace rocsparseio
 {
     inline status_t fwrite_sparse_coo(FILE*    out_,
@@ -2222,6 +2968,27 @@ namespace rocsparseio
         return fread_sparse_csx(handle_->f, ts_...);
     }
 
+    template <typename... Ts>
+    inline status_t write_sparse_zcsx(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fwrite_sparse_zcsx(handle_->f, ts_...);
+    }
+
+    template <typename... Ts>
+    inline status_t read_metadata_sparse_zcsx(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fread_metadata_sparse_zcsx(handle_->f, ts_...);
+    }
+
+    template <typename... Ts>
+    inline status_t read_sparse_zcsx(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fread_sparse_zcsx(handle_->f, ts_...);
+    }
+
     template <typename... Ts>
     inline status_t write_sparse_coo(rocsparseio_handle handle_, Ts&&... ts_)
     {
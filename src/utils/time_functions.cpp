@@ -27,45 +27,80 @@
 #include "../base/backend_manager.hpp"
 #include "time_functions.hpp"
 
-// the default OS is Linux
-
-#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
-    || defined(__WIN64) && !defined(__CYGWIN__)
-// Windows
-#include <windows.h>
-
-#else
-// Linux
-#include <sys/time.h>
-
-#endif
+#include <chrono>
 
 namespace rocalution
 {
 
     double rocalution_time(void)
     {
-        double the_time_now = 0.0;
-
         _rocalution_sync();
-#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
-    || defined(__WIN64) && !defined(__CYGWIN__)
-        // Windows
-        LARGE_INTEGER now;
-        LARGE_INTEGER freq;
-
-        QueryPerformanceCounter(&now);
-        QueryPerformanceFrequency(&freq);
-
-        the_time_now = (now.QuadPart * 1000000.0) / static_cast<double>(freq.QuadPart);
-#else
-        // Linux
-        struct timeval now;
-
-        gettimeofday(&now, NULL);
-        the_time_now = now.tv_sec * 1000000.0 + (now.tv_usec);
-#endif
-        return the_time_now;
+
+        return rocalution_time_nosync();
+    }
+
+    double rocalution_time_nosync(void)
+    {
+        return std::chrono::duration<double, std::micro>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    Timer::Timer(bool sync)
+        : sync_(sync)
+        , running_(false)
+        , start_(0.0)
+        , time_(0.0)
+    {
+    }
+
+    Timer::~Timer() {}
+
+    void Timer::Start(void)
+    {
+        assert(this->running_ == false);
+
+        this->running_ = true;
+        this->start_   = (this->sync_ == true) ? rocalution_time() : rocalution_time_nosync();
+    }
+
+    double Timer::Stop(void)
+    {
+        assert(this->running_ == true);
+
+        double now = (this->sync_ == true) ? rocalution_time() : rocalution_time_nosync();
+
+        this->running_ = false;
+        this->time_ += now - this->start_;
+
+        return now - this->start_;
+    }
+
+    void Timer::Reset(void)
+    {
+        this->running_ = false;
+        this->time_    = 0.0;
+    }
+
+    double Timer::GetTime(void) const
+    {
+        return this->time_;
+    }
+
+    ScopedTimer::ScopedTimer(double* time, bool sync)
+        : time_(time)
+        , sync_(sync)
+    {
+        assert(time != NULL);
+
+        this->start_ = (this->sync_ == true) ? rocalution_time() : rocalution_time_nosync();
+    }
+
+    ScopedTimer::~ScopedTimer()
+    {
+        double now = (this->sync_ == true) ? rocalution_time() : rocalution_time_nosync();
+
+        *this->time_ += now - this->start_;
     }
 
 } // namespace rocalution
@@ -31,10 +31,81 @@ namespace rocalution
 
     /** \ingroup backend_module
   * \brief Return current time in microseconds
+  * \details
+  * The time is taken from a monotonic high resolution clock, after all work on the
+  * accelerator has been completed. Only differences of two time points are meaningful.
   */
     ROCALUTION_EXPORT
     double rocalution_time(void);
 
+    /** \ingroup backend_module
+  * \brief Return current time in microseconds, without synchronizing the accelerator
+  * \details
+  * Same as rocalution_time(), but work that is still pending on the accelerator is
+  * not waited for. This is suitable for timing host code or for timing without
+  * serializing host and accelerator.
+  */
+    ROCALUTION_EXPORT
+    double rocalution_time_nosync(void);
+
+    /** \ingroup backend_module
+  * \class Timer
+  * \brief Monotonic high resolution timer
+  * \details
+  * The timer accumulates the time in microseconds of all Start() / Stop() intervals.
+  * If \p sync is true, the accelerator is synchronized at the beginning and the end of
+  * each interval, see rocalution_time() and rocalution_time_nosync().
+  */
+    class Timer
+    {
+    public:
+        /** \brief Create a timer, optionally synchronizing the accelerator */
+        ROCALUTION_EXPORT
+        explicit Timer(bool sync = true);
+        ROCALUTION_EXPORT
+        ~Timer();
+
+        /** \brief Start a new interval */
+        ROCALUTION_EXPORT
+        void Start(void);
+        /** \brief Stop the current interval and return its time in microseconds */
+        ROCALUTION_EXPORT
+        double Stop(void);
+
+        /** \brief Reset the accumulated time */
+        ROCALUTION_EXPORT
+        void Reset(void);
+
+        /** \brief Return the accumulated time in microseconds */
+        ROCALUTION_EXPORT
+        double GetTime(void) const;
+
+    private:
+        bool   sync_;
+        bool   running_;
+        double start_;
+        double time_;
+    };
+
+    /** \ingroup backend_module
+  * \class ScopedTimer
+  * \brief Add the lifetime of the object in microseconds to a time variable
+  */
+    class ScopedTimer
+    {
+    public:
+        /** \brief Start timing, the elapsed time is added to \p time on destruction */
+        ROCALUTION_EXPORT
+        explicit ScopedTimer(double* time, bool sync = true);
+        ROCALUTION_EXPORT
+        ~ScopedTimer();
+
+    private:
+        double* time_;
+        bool    sync_;
+        double  start_;
+    };
+
 } // namespace rocalution
 
 #endif // ROCALUTION_UTILS_TIME_FUNCTIONS_HPP_